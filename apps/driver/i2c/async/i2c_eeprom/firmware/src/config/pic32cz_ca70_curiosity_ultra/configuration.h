@@ -95,6 +95,11 @@ extern "C" {
 /* I2C Driver Common Configuration Options */
 #define DRV_I2C_INSTANCES_NUMBER              (1U)
 
+/* I2C Driver Scheduler Configuration Options */
+#define DRV_I2C_SCHED_AGING_LIMIT             (4U)
+#define DRV_I2C_SCHED_CPU_CLOCK_FREQUENCY     (300000000U)
+#define DRV_I2C_SCHED_STATISTICS_ENABLE       true
+
 
 
 
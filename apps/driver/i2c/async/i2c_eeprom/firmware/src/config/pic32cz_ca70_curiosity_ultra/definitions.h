@@ -52,6 +52,7 @@
 #include "peripheral/pio/plib_pio.h"
 #include "peripheral/nvic/plib_nvic.h"
 #include "peripheral/twihs/master/plib_twihs0_master.h"
+#include "peripheral/xdmac/plib_xdmac.h"
 #include "peripheral/efc/plib_efc.h"
 #include "bsp/bsp.h"
 #include "driver/i2c/drv_i2c.h"
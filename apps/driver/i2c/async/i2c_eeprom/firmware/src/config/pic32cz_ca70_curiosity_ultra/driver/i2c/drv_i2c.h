@@ -232,6 +232,69 @@ typedef enum
 
 typedef void (*DRV_I2C_TRANSFER_EVENT_HANDLER )( DRV_I2C_TRANSFER_EVENT event, DRV_I2C_TRANSFER_HANDLE transferHandle, uintptr_t context );
 
+// *****************************************************************************
+/* I2C Driver Client Priority
+
+   Summary:
+    Identifies the scheduling class of a client.
+
+   Description:
+    This enumeration identifies the priority class used by the driver to pick
+    the next queued transfer when the bus becomes free. A transfer of a higher
+    class is started before the queued transfers of the lower classes.
+
+   Remarks:
+    Clients are opened with DRV_I2C_CLIENT_PRIORITY_NORMAL. The class is changed
+    by calling DRV_I2C_ClientSchedulingSet.
+*/
+
+typedef enum
+{
+    /* Latency sensitive traffic, for example periodic sensor sampling */
+    DRV_I2C_CLIENT_PRIORITY_HIGH = 0,
+
+    /* Default class */
+    DRV_I2C_CLIENT_PRIORITY_NORMAL,
+
+    /* Bulk traffic, for example EEPROM page writes */
+    DRV_I2C_CLIENT_PRIORITY_LOW,
+
+} DRV_I2C_CLIENT_PRIORITY;
+
+// *****************************************************************************
+/* I2C Driver Client Queue Statistics
+
+   Summary:
+    Defines the queueing counters of a client.
+
+   Description:
+    This data type holds the counters returned by the
+    DRV_I2C_ClientQueueStatisticsGet API. The wait of a transfer is the time
+    from the transfer add call until the transfer is started on the bus.
+
+   Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Transfers of the client started on the bus */
+    uint32_t transferCount;
+
+    /* Average queue wait of the started transfers, in microseconds */
+    uint32_t averageWaitUs;
+
+    /* Longest queue wait seen, in microseconds */
+    uint32_t maxWaitUs;
+
+    /* Transfers started after the client's deadline had elapsed */
+    uint32_t deadlineMissCount;
+
+    /* Transfers that required the bus to be reconfigured for the client */
+    uint32_t setupChangeCount;
+
+} DRV_I2C_CLIENT_QUEUE_STATISTICS;
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -506,6 +569,150 @@ void DRV_I2C_Close( const DRV_HANDLE handle );
 
 bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* setup);
 
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_TransferStatisticsGet( const DRV_HANDLE handle, DRV_I2C_TRANSFER_STATISTICS* statistics )
+
+   Summary:
+    Gets the transfer and interrupt counters of the driver instance.
+
+   Description:
+    This function copies the number of transfers carried out on the I2C
+    peripheral, how many of their read or write phases were moved by DMA, and
+    how many interrupts were taken to complete them. Dividing interruptCount
+    by transferCount gives the interrupt cost of a transfer.
+
+   Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+   Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine
+
+    statistics - Pointer to the structure that receives the counters
+
+   Returns:
+    true - The counters were copied.
+    false - The handle or statistics pointer is invalid, or the PLib does not
+    keep statistics.
+
+  Example:
+    <code>
+    DRV_I2C_TRANSFER_STATISTICS statistics;
+
+    if (DRV_I2C_TransferStatisticsGet(myI2CHandle, &statistics) == true)
+    {
+        // statistics.interruptCount / statistics.transferCount interrupts
+        // were taken per transfer
+    }
+    </code>
+
+  Remarks:
+    The counters are shared by all the clients of the driver instance.
+*/
+
+bool DRV_I2C_TransferStatisticsGet( const DRV_HANDLE handle, DRV_I2C_TRANSFER_STATISTICS* statistics );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_ClientSchedulingSet( const DRV_HANDLE handle, DRV_I2C_CLIENT_PRIORITY priority, uint32_t deadlineUs )
+
+   Summary:
+    Sets the priority class and queue deadline of a client.
+
+   Description:
+    The driver queues the transfers of each priority class separately, in the
+    order they were added. When the bus becomes free it starts:
+    - The oldest transfer of the first class whose oldest transfer is
+      overdue. A transfer is overdue once it has waited longer than the
+      deadline of its client, or once DRV_I2C_SCHED_AGING_LIMIT other
+      transfers have been started ahead of it.
+    - Otherwise the next transfer of the client that had the bus last, if it
+      has one queued in the highest class with queued transfers and its clock
+      speed is the current one. The clock is then not reprogrammed.
+    - Otherwise the oldest transfer of the highest class with queued
+      transfers.
+
+    Transfers of the same client are always started in the order they were
+    added.
+
+   Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+   Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine
+
+    priority - Priority class of the client
+
+    deadlineUs - Longest queue wait, in microseconds, before the transfers of
+    the client are started ahead of all the others. Pass 0 to rely on the
+    priority class and aging only.
+
+   Returns:
+    true - The scheduling parameters were updated.
+    false - The handle, priority or deadline is invalid, or the priority
+    differs from the current one while transfers of the client are queued.
+
+  Example:
+    <code>
+    // Sample the sensor ahead of the EEPROM traffic and never let a sample
+    // request wait more than 2 ms.
+    DRV_I2C_ClientSchedulingSet(mySensorHandle, DRV_I2C_CLIENT_PRIORITY_HIGH, 2000);
+    DRV_I2C_ClientSchedulingSet(myEEPROMHandle, DRV_I2C_CLIENT_PRIORITY_LOW, 0);
+    </code>
+
+  Remarks:
+    The deadline does not preempt the transfer in progress on the bus.
+    Deadlines need DRV_I2C_SCHED_STATISTICS_ENABLE. Without it only a
+    deadlineUs of 0 is accepted.
+*/
+
+bool DRV_I2C_ClientSchedulingSet( const DRV_HANDLE handle, DRV_I2C_CLIENT_PRIORITY priority, uint32_t deadlineUs );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_ClientQueueStatisticsGet( const DRV_HANDLE handle, DRV_I2C_CLIENT_QUEUE_STATISTICS* statistics )
+
+   Summary:
+    Gets the queue wait counters of a client.
+
+   Description:
+    This function copies the number of transfers of the client started on the
+    bus, their average and longest queue wait, how many of them missed the
+    client's deadline and how many required the bus to be reconfigured.
+
+   Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+   Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine
+
+    statistics - Pointer to the structure that receives the counters
+
+   Returns:
+    true - The counters were copied.
+    false - The handle or statistics pointer is invalid.
+
+  Example:
+    <code>
+    DRV_I2C_CLIENT_QUEUE_STATISTICS statistics;
+
+    if (DRV_I2C_ClientQueueStatisticsGet(mySensorHandle, &statistics) == true)
+    {
+        // statistics.maxWaitUs is the worst case sample latency
+    }
+    </code>
+
+  Remarks:
+    The counters are cleared when the client is opened. The waits and
+    deadline misses are only counted with DRV_I2C_SCHED_STATISTICS_ENABLE,
+    they read 0 otherwise.
+*/
+
+bool DRV_I2C_ClientQueueStatisticsGet( const DRV_HANDLE handle, DRV_I2C_CLIENT_QUEUE_STATISTICS* statistics );
+
 
 // *****************************************************************************
 /* Function:
@@ -64,6 +64,18 @@
 
 #define DRV_I2C_TOKEN_MAX                       (0xFFFFU)
 
+/* Timestamping of the queued transfers with the DWT cycle counter. It is
+ * needed for client deadlines and queue wait statistics. */
+#ifndef DRV_I2C_SCHED_STATISTICS_ENABLE
+#define DRV_I2C_SCHED_STATISTICS_ENABLE         false
+#endif
+
+/* CPU cycles per microsecond, used to convert the queue wait timestamps */
+#define DRV_I2C_SCHED_CYCLES_PER_US             (DRV_I2C_SCHED_CPU_CLOCK_FREQUENCY / 1000000U)
+
+/* Number of client priority classes, each with its own transfer queue */
+#define DRV_I2C_SCHED_CLASS_NUMBER              ((uint32_t)DRV_I2C_CLIENT_PRIORITY_LOW + 1U)
+
 // *****************************************************************************
 /* I2C Transfer Object Flags
 
@@ -168,9 +180,19 @@ typedef struct DRV_I2C_TRANSFER_OBJ_T
     /* Errors associated with the I2C transfer */
     volatile DRV_I2C_ERROR          errors;
 
-    /* Next buffer pointer */
+    /* Cycle counter value when the transfer was added to the queue */
+    uint32_t                        queuedAt;
+
+    /* Next buffer pointer in the free list, in the transfer list or in a
+     * class queue */
     struct DRV_I2C_TRANSFER_OBJ_T*   next;
 
+    /* Previous buffer pointer in the class queue */
+    struct DRV_I2C_TRANSFER_OBJ_T*   prev;
+
+    /* Next queued buffer of the same client */
+    struct DRV_I2C_TRANSFER_OBJ_T*   clientNext;
+
 } DRV_I2C_TRANSFER_OBJ;
 
 // *****************************************************************************
@@ -212,6 +234,9 @@ typedef struct
     /* Current transfer setup will be used to verify change in the transfer setup by client */
     DRV_I2C_TRANSFER_SETUP      currentTransferSetup;
 
+    /* Client of the last transfer started */
+    DRV_HANDLE                  lastClientHandle;
+
     /* Interrupt Sources of I2C */
     const DRV_I2C_INTERRUPT_SOURCES* interruptSources;
 
@@ -224,9 +249,22 @@ typedef struct
     /* Pointer to the transfer pool */
     DRV_I2C_TRANSFER_OBJ*       transferObjPool;
 
-    /* Linked list of transfer objects */
+    /* Linked list of free transfer objects in the transfer pool */
+    DRV_I2C_TRANSFER_OBJ*       freeObjList;
+
+    /* Linked list of transfer objects. It holds the transfer on the bus, the
+     * transfers waiting for the bus are in the class queues. */
     DRV_I2C_TRANSFER_OBJ*       transferObjList;
 
+    /* Queued transfers of each client priority class, oldest first */
+    DRV_I2C_TRANSFER_OBJ*       schedQueueHead[DRV_I2C_SCHED_CLASS_NUMBER];
+    DRV_I2C_TRANSFER_OBJ*       schedQueueTail[DRV_I2C_SCHED_CLASS_NUMBER];
+
+    /* Number of transfers started ahead of the oldest transfer of each
+     * class, by the other classes or by the client that had the bus last,
+     * since the class last gave the bus to its oldest transfer */
+    uint32_t                    schedOvertaken[DRV_I2C_SCHED_CLASS_NUMBER];
+
     /* Instance specific token counter used to generate unique client/transfer handles */
     uint16_t                    i2cTokenCount;
 
@@ -288,6 +326,31 @@ typedef struct
     /* Client specific transfer setup */
     DRV_I2C_TRANSFER_SETUP          transferSetup;
 
+    /* Scheduling class of the client */
+    DRV_I2C_CLIENT_PRIORITY         priority;
+
+    /* Longest queue wait in CPU cycles, 0 if the client has no deadline */
+    uint32_t                        deadline;
+
+    /* Transfers of the client started on the bus */
+    uint32_t                        transferCount;
+
+    /* Sum and maximum of the queue waits in CPU cycles */
+    uint64_t                        waitTotal;
+
+    uint32_t                        waitMax;
+
+    /* Transfers started after the deadline had elapsed */
+    uint32_t                        deadlineMissCount;
+
+    /* Transfers that required the bus to be reconfigured */
+    uint32_t                        setupChangeCount;
+
+    /* Queued transfers of the client, oldest first. They are also in the
+     * queue of the client class. */
+    DRV_I2C_TRANSFER_OBJ*           queueHead;
+    DRV_I2C_TRANSFER_OBJ*           queueTail;
+
 } DRV_I2C_CLIENT_OBJ;
 
 #endif //#ifndef DRV_I2C_LOCAL_H
@@ -102,6 +102,9 @@ static const DRV_I2C_PLIB_INTERFACE drvI2C0PLibAPI = {
 
     /* I2C PLib Callback Register */
     .callbackRegister = (DRV_I2C_PLIB_CALLBACK_REGISTER)TWIHS0_CallbackRegister,
+
+    /* I2C PLib Transfer Statistics function */
+    .transferStatisticsGet = (DRV_I2C_PLIB_TRANSFER_STATISTICS_GET)TWIHS0_TransferStatisticsGet,
 };
 
 
@@ -196,6 +199,8 @@ void SYS_Initialize ( void* data )
     CLOCK_Initialize();
 	PIO_Initialize();
 
+    XDMAC_Initialize();
+
 
 
 	RSWDT_REGS->RSWDT_MR = RSWDT_MR_WDDIS_Msk;	// Disable RSWDT 
@@ -138,7 +138,6 @@ extern void TC3_CH2_Handler            ( void ) __attribute__((weak, alias("Dumm
 extern void MLB_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void AES_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void TRNG_Handler               ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
-extern void XDMAC_Handler              ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void ISI_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void PWM1_Handler               ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void FPU_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
@@ -232,7 +231,7 @@ const H3DeviceVectors exception_table=
     .pfnMLB_Handler                = MLB_Handler,
     .pfnAES_Handler                = AES_Handler,
     .pfnTRNG_Handler               = TRNG_Handler,
-    .pfnXDMAC_Handler              = XDMAC_Handler,
+    .pfnXDMAC_Handler              = XDMAC_InterruptHandler,
     .pfnISI_Handler                = ISI_Handler,
     .pfnPWM1_Handler               = PWM1_Handler,
     .pfnFPU_Handler                = FPU_Handler,
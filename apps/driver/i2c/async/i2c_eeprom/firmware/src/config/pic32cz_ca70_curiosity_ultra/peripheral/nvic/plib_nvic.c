@@ -61,6 +61,8 @@ void NVIC_Initialize( void )
      * from within the "Interrupt Manager" of MHC. */
     NVIC_SetPriority(TWIHS0_IRQn, 7);
     NVIC_EnableIRQ(TWIHS0_IRQn);
+    NVIC_SetPriority(XDMAC_IRQn, 7);
+    NVIC_EnableIRQ(XDMAC_IRQn);
 
     /* Enable Usage fault */
     SCB->SHCSR |= (SCB_SHCSR_USGFAULTENA_Msk);
@@ -72,6 +72,12 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* OSAL semaphores and mutexes created from static storage */
+#define OSAL_STATIC_SEMAPHORE_COUNT                      (4U)
+
+/* Count the core clock cycles of the boot in SYS_BootCycles */
+#define SYS_BOOT_TIME_ENABLE                             true
+
 
 
 // *****************************************************************************
@@ -95,6 +101,11 @@ extern "C" {
 /* I2C Driver Common Configuration Options */
 #define DRV_I2C_INSTANCES_NUMBER              (1U)
 
+/* I2C Driver Scheduler Configuration Options */
+#define DRV_I2C_SCHED_AGING_LIMIT             (4U)
+#define DRV_I2C_SCHED_CPU_CLOCK_FREQUENCY     (300000000U)
+#define DRV_I2C_SCHED_STATISTICS_ENABLE       true
+
 
 
 
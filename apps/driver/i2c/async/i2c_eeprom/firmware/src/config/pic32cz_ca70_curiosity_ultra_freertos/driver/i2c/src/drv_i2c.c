@@ -214,32 +214,159 @@ static void lDRV_I2C_ResourceUnlock(DRV_I2C_OBJ * dObj)
     }
 }
 
+static void lDRV_I2C_FreeTransferObjListInit(DRV_I2C_OBJ* dObj)
+{
+    uint32_t index;
+
+    /* Chain all the transfer objects of the pool into the free list */
+    dObj->freeObjList = NULL;
+
+    for (index = dObj->transferObjPoolSize; index > 0U; index--)
+    {
+        dObj->transferObjPool[index - 1U].inUse = false;
+        dObj->transferObjPool[index - 1U].next = dObj->freeObjList;
+        dObj->freeObjList = &dObj->transferObjPool[index - 1U];
+    }
+}
+
+static void lDRV_I2C_FreeTransferObjPut(
+    DRV_I2C_OBJ* dObj,
+    DRV_I2C_TRANSFER_OBJ* transferObj
+)
+{
+    transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_FREE;
+    transferObj->inUse = false;
+
+    /* Return the transfer object to the head of the free list */
+    transferObj->next = dObj->freeObjList;
+    dObj->freeObjList = transferObj;
+}
+
 static DRV_I2C_TRANSFER_OBJ* lDRV_I2C_FreeTransferObjGet(DRV_I2C_CLIENT_OBJ* clientObj)
 {
     uint32_t index;
     DRV_I2C_OBJ* dObj = (DRV_I2C_OBJ* )&gDrvI2CObj[clientObj->drvIndex];
-    DRV_I2C_TRANSFER_OBJ* pTransferObj = dObj->transferObjPool;
+    DRV_I2C_TRANSFER_OBJ* pTransferObj = dObj->freeObjList;
 
-    for (index = 0; index < dObj->transferObjPoolSize; index++)
+    if (pTransferObj == NULL)
     {
-        if (pTransferObj[index].inUse == false)
-        {
-            pTransferObj[index].inUse = true;
-            pTransferObj[index].next = NULL;
+        /* All the transfer objects are in use */
+        return NULL;
+    }
 
-            /* Generate a unique buffer handle consisting of an incrementing
-             * token counter, driver index and the buffer index.
-             */
-            pTransferObj[index].transferHandle = (DRV_I2C_TRANSFER_HANDLE)lDRV_I2C_MAKE_HANDLE(
-                dObj->i2cTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+    /* Take the transfer object at the head of the free list */
+    dObj->freeObjList = pTransferObj->next;
 
-            /* Update the token for next time */
-            dObj->i2cTokenCount = lDRV_I2C_UPDATE_TOKEN(dObj->i2cTokenCount);
+    pTransferObj->inUse = true;
+    pTransferObj->next = NULL;
+
+    index = (uint32_t)(pTransferObj - dObj->transferObjPool);
 
-            return &pTransferObj[index];
+    /* Generate a unique buffer handle consisting of an incrementing
+     * token counter, driver index and the buffer index.
+     */
+    pTransferObj->transferHandle = (DRV_I2C_TRANSFER_HANDLE)lDRV_I2C_MAKE_HANDLE(
+        dObj->i2cTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+
+    /* Update the token for next time */
+    dObj->i2cTokenCount = lDRV_I2C_UPDATE_TOKEN(dObj->i2cTokenCount);
+
+    return pTransferObj;
+}
+
+static bool lDRV_I2C_TransferObjQueueIsEmpty( const DRV_I2C_OBJ* dObj )
+{
+    uint32_t priority;
+    bool isEmpty = true;
+
+    for (priority = 0U; priority < DRV_I2C_SCHED_CLASS_NUMBER; priority++)
+    {
+        if (dObj->schedQueueHead[priority] != NULL)
+        {
+            isEmpty = false;
         }
     }
-    return NULL;
+
+    return isEmpty;
+}
+
+// Appends the transfer to the queue of the client class and to the queue of
+// the client
+static void lDRV_I2C_TransferObjEnqueue(
+    DRV_I2C_OBJ* dObj,
+    DRV_I2C_CLIENT_OBJ* clientObj,
+    DRV_I2C_TRANSFER_OBJ* transferObj
+)
+{
+    uint32_t priority = (uint32_t)clientObj->priority;
+
+    transferObj->next       = NULL;
+    transferObj->prev       = dObj->schedQueueTail[priority];
+    transferObj->clientNext = NULL;
+
+    if (dObj->schedQueueHead[priority] == NULL)
+    {
+        dObj->schedQueueHead[priority] = transferObj;
+    }
+    else
+    {
+        dObj->schedQueueTail[priority]->next = transferObj;
+    }
+
+    dObj->schedQueueTail[priority] = transferObj;
+
+    if (clientObj->queueHead == NULL)
+    {
+        clientObj->queueHead = transferObj;
+    }
+    else
+    {
+        clientObj->queueTail->clientNext = transferObj;
+    }
+
+    clientObj->queueTail = transferObj;
+}
+
+// Takes the oldest queued transfer of the client off the queues. The oldest
+// transfer of a class is also the oldest of its client.
+static DRV_I2C_TRANSFER_OBJ* lDRV_I2C_TransferObjDequeue(
+    DRV_I2C_OBJ* dObj,
+    DRV_I2C_CLIENT_OBJ* clientObj
+)
+{
+    DRV_I2C_TRANSFER_OBJ* transferObj = clientObj->queueHead;
+    uint32_t priority = (uint32_t)clientObj->priority;
+
+    clientObj->queueHead = transferObj->clientNext;
+
+    if (clientObj->queueHead == NULL)
+    {
+        clientObj->queueTail = NULL;
+    }
+
+    if (transferObj->prev == NULL)
+    {
+        dObj->schedQueueHead[priority] = transferObj->next;
+    }
+    else
+    {
+        transferObj->prev->next = transferObj->next;
+    }
+
+    if (transferObj->next == NULL)
+    {
+        dObj->schedQueueTail[priority] = transferObj->prev;
+    }
+    else
+    {
+        transferObj->next->prev = transferObj->prev;
+    }
+
+    transferObj->next       = NULL;
+    transferObj->prev       = NULL;
+    transferObj->clientNext = NULL;
+
+    return transferObj;
 }
 
 static bool lDRV_I2C_TransferObjAddToList(
@@ -250,30 +377,24 @@ static bool lDRV_I2C_TransferObjAddToList(
     DRV_I2C_TRANSFER_OBJ** pTransferObjList;
     bool isFirstTransferInList = false;
 
+    DRV_I2C_CLIENT_OBJ* clientObj;
+
     pTransferObjList = (DRV_I2C_TRANSFER_OBJ**)&(dObj->transferObjList);
 
-    // Is the buffer object list empty?
-    if (*pTransferObjList == NULL)
+    transferObj->next = NULL;
+
+    // Is the bus free with no transfer waiting for it?
+    if ((*pTransferObjList == NULL) && (lDRV_I2C_TransferObjQueueIsEmpty(dObj) == true))
     {
         *pTransferObjList = transferObj;
         isFirstTransferInList = true;
     }
     else
     {
-        // List is not empty. Iterate to the end of the buffer object list.
-        while (*pTransferObjList != NULL)
-        {
-            if ((*pTransferObjList)->next == NULL)
-            {
-                // End of the list reached, add the buffer here.
-                (*pTransferObjList)->next = transferObj;
-                break;
-            }
-            else
-            {
-                pTransferObjList = (DRV_I2C_TRANSFER_OBJ**)&((*pTransferObjList)->next);
-            }
-        }
+        // Add the buffer after the last buffer object of the client and class
+        clientObj = &((DRV_I2C_CLIENT_OBJ *)dObj->clientObjPool)[transferObj->clientHandle & DRV_I2C_INDEX_MASK];
+
+        lDRV_I2C_TransferObjEnqueue(dObj, clientObj, transferObj);
     }
 
     return isFirstTransferInList;
@@ -289,6 +410,193 @@ static DRV_I2C_TRANSFER_OBJ* lDRV_I2C_TransferObjListGet( DRV_I2C_OBJ* dObj )
     return pTransferObj;
 }
 
+#if (DRV_I2C_SCHED_STATISTICS_ENABLE == true)
+static inline uint32_t lDRV_I2C_TimestampGet(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
+static DRV_I2C_CLIENT_OBJ* lDRV_I2C_TransferClientGet( DRV_I2C_TRANSFER_OBJ* transferObj )
+{
+    return &((DRV_I2C_CLIENT_OBJ *)gDrvI2CObj[((transferObj->clientHandle & DRV_I2C_INSTANCE_MASK) >> 8)].clientObjPool)
+            [transferObj->clientHandle & DRV_I2C_INDEX_MASK];
+}
+
+static bool lDRV_I2C_TransferObjIsOverdue(
+    DRV_I2C_OBJ* dObj,
+    DRV_I2C_TRANSFER_OBJ* transferObj,
+    uint32_t priority
+)
+{
+    /* DRV_I2C_SCHED_AGING_LIMIT other transfers were started ahead of it */
+    if (dObj->schedOvertaken[priority] >= DRV_I2C_SCHED_AGING_LIMIT)
+    {
+        return true;
+    }
+
+#if (DRV_I2C_SCHED_STATISTICS_ENABLE == true)
+    DRV_I2C_CLIENT_OBJ* clientObj = lDRV_I2C_TransferClientGet(transferObj);
+
+    if ((clientObj->deadline != 0U) && ((lDRV_I2C_TimestampGet() - transferObj->queuedAt) >= clientObj->deadline))
+    {
+        return true;
+    }
+#else
+    (void)transferObj;
+#endif
+
+    return false;
+}
+
+// Returns the client of the last transfer started if it is still open and
+// its clock speed is the one the PLIB is set up for, NULL otherwise
+static DRV_I2C_CLIENT_OBJ* lDRV_I2C_LastClientObjGet( DRV_I2C_OBJ* dObj )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj;
+    uint32_t index = dObj->lastClientHandle & DRV_I2C_INDEX_MASK;
+
+    if ((dObj->lastClientHandle == DRV_HANDLE_INVALID) || (index >= dObj->nClientsMax))
+    {
+        return NULL;
+    }
+
+    clientObj = &((DRV_I2C_CLIENT_OBJ *)dObj->clientObjPool)[index];
+
+    if ((clientObj->clientHandle != dObj->lastClientHandle) ||
+        (clientObj->transferSetup.clockSpeed != dObj->currentTransferSetup.clockSpeed))
+    {
+        return NULL;
+    }
+
+    return clientObj;
+}
+
+static DRV_I2C_TRANSFER_OBJ* lDRV_I2C_TransferObjSchedule( DRV_I2C_OBJ* dObj )
+{
+    DRV_I2C_TRANSFER_OBJ* pSelectedObj = dObj->transferObjList;
+    DRV_I2C_CLIENT_OBJ* clientObj;
+    DRV_I2C_CLIENT_OBJ* lastClientObj;
+    uint32_t selected = DRV_I2C_SCHED_CLASS_NUMBER;
+    uint32_t priority;
+    bool isOverdue = false;
+
+    // Nothing to schedule while a transfer is in progress
+    if (pSelectedObj != NULL)
+    {
+        return pSelectedObj;
+    }
+
+    // Only the oldest transfer of each class is looked at. The first overdue
+    // one goes first, otherwise the one of the highest class.
+    for (priority = 0U; priority < DRV_I2C_SCHED_CLASS_NUMBER; priority++)
+    {
+        if (dObj->schedQueueHead[priority] != NULL)
+        {
+            if (selected == DRV_I2C_SCHED_CLASS_NUMBER)
+            {
+                selected = priority;
+            }
+
+            if (lDRV_I2C_TransferObjIsOverdue(dObj, dObj->schedQueueHead[priority], priority) == true)
+            {
+                selected = priority;
+                isOverdue = true;
+                break;
+            }
+        }
+    }
+
+    if (selected == DRV_I2C_SCHED_CLASS_NUMBER)
+    {
+        return NULL;
+    }
+
+    // Within the class, the client that had the bus last keeps it while it
+    // has transfers queued and the bus runs at its clock speed, which saves
+    // reprogramming the PLIB for every transfer of interleaved clients.
+    // Otherwise the oldest transfer of the class goes.
+    clientObj = lDRV_I2C_TransferClientGet(dObj->schedQueueHead[selected]);
+
+    if (isOverdue == false)
+    {
+        lastClientObj = lDRV_I2C_LastClientObjGet(dObj);
+
+        if ((lastClientObj != NULL) && (lastClientObj->queueHead != NULL) &&
+            ((uint32_t)lastClientObj->priority == selected))
+        {
+            clientObj = lastClientObj;
+        }
+    }
+
+    // Age the classes that are being overtaken, including the selected class
+    // if its oldest transfer waits behind the last client
+    for (priority = 0U; priority < DRV_I2C_SCHED_CLASS_NUMBER; priority++)
+    {
+        if ((priority == selected) && (clientObj->queueHead == dObj->schedQueueHead[priority]))
+        {
+            dObj->schedOvertaken[priority] = 0U;
+        }
+        else if (dObj->schedQueueHead[priority] != NULL)
+        {
+            dObj->schedOvertaken[priority]++;
+        }
+        else
+        {
+            /* Nothing waiting in this class */
+        }
+    }
+
+    // Move the selected transfer to the head of the list
+    pSelectedObj = lDRV_I2C_TransferObjDequeue(dObj, clientObj);
+    dObj->transferObjList = pSelectedObj;
+
+    return pSelectedObj;
+}
+
+static void lDRV_I2C_TransferSetupApply(
+    DRV_I2C_OBJ* dObj,
+    DRV_I2C_CLIENT_OBJ* clientObj,
+    DRV_I2C_TRANSFER_OBJ* transferObj
+)
+{
+#if (DRV_I2C_SCHED_STATISTICS_ENABLE == true)
+    uint32_t wait = lDRV_I2C_TimestampGet() - transferObj->queuedAt;
+#endif
+
+    /* Update the queue wait statistics of the client */
+    clientObj->transferCount++;
+
+#if (DRV_I2C_SCHED_STATISTICS_ENABLE == true)
+    clientObj->waitTotal += wait;
+
+    if (wait > clientObj->waitMax)
+    {
+        clientObj->waitMax = wait;
+    }
+
+    if ((clientObj->deadline != 0U) && (wait > clientObj->deadline))
+    {
+        clientObj->deadlineMissCount++;
+    }
+#else
+    (void)transferObj;
+#endif
+
+    /* Check if the transfer setup for this client is different than the current transfer setup */
+    if (dObj->currentTransferSetup.clockSpeed != clientObj->transferSetup.clockSpeed)
+    {
+        /* Set the new transfer setup */
+        (void) dObj->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
+
+        dObj->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
+
+        clientObj->setupChangeCount++;
+    }
+
+    dObj->lastClientHandle = transferObj->clientHandle;
+}
+
 static void lDRV_I2C_RemoveTransferObjFromList( DRV_I2C_OBJ* dObj )
 {
     DRV_I2C_TRANSFER_OBJ** pTransferObjList;
@@ -299,13 +607,13 @@ static void lDRV_I2C_RemoveTransferObjFromList( DRV_I2C_OBJ* dObj )
     if (*pTransferObjList != NULL)
     {
         /* Save the buffer object to be removed. Set the next buffer object as
-         * the new head of the linked list. Reset the removed buffer object. */
+         * the new head of the linked list. Return the removed buffer object to
+         * the free list. */
 
         DRV_I2C_TRANSFER_OBJ* temp = *pTransferObjList;
         *pTransferObjList = (*pTransferObjList)->next;
-        temp->currentState = DRV_I2C_TRANSFER_OBJ_IS_FREE;
-        temp->next = NULL;
-        temp->inUse = false;
+
+        lDRV_I2C_FreeTransferObjPut(dObj, temp);
     }
 }
 
@@ -314,34 +622,17 @@ static void lDRV_I2C_RemoveClientTransfersFromList(
     DRV_I2C_CLIENT_OBJ* clientObj
 )
 {
-    DRV_I2C_TRANSFER_OBJ** pTransferObjList;
     DRV_I2C_TRANSFER_OBJ* delTransferObj = NULL;
 
-    pTransferObjList = (DRV_I2C_TRANSFER_OBJ**)&(dObj->transferObjList);
-
-    while (*pTransferObjList != NULL)
+    // The buffer object in process is at the head of the transfer list and is
+    // not removed. The queued ones are in the queue of the client.
+    while (clientObj->queueHead != NULL)
     {
-        // Do not remove the buffer object that is already in process
-        if (((*pTransferObjList)->clientHandle == clientObj->clientHandle) &&
-            ((*pTransferObjList)->currentState == DRV_I2C_TRANSFER_OBJ_IS_IN_QUEUE))
-        {
-            // Save the node to be deleted off the list
-            delTransferObj = *pTransferObjList;
+        delTransferObj = lDRV_I2C_TransferObjDequeue(dObj, clientObj);
 
-            // Update the current node to point to the deleted node's next
-            *pTransferObjList = (DRV_I2C_TRANSFER_OBJ*)(*pTransferObjList)->next;
-
-            // Reset the deleted node
-            delTransferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_FREE;
-            delTransferObj->event = DRV_I2C_TRANSFER_EVENT_COMPLETE;
-            delTransferObj->next = NULL;
-            delTransferObj->inUse = false;
-        }
-        else
-        {
-            // Move to the next node
-            pTransferObjList = (DRV_I2C_TRANSFER_OBJ**)&((*pTransferObjList)->next);
-        }
+        // Return the deleted node to the free list
+        delTransferObj->event = DRV_I2C_TRANSFER_EVENT_COMPLETE;
+        lDRV_I2C_FreeTransferObjPut(dObj, delTransferObj);
     }
 }
 
@@ -390,24 +681,16 @@ static void lDRV_I2C_NextTransferInitiate(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ*
     {
         transferStatus = true;
 
-        /* Get the transfer object at the head of the list */
-        transferObj = lDRV_I2C_TransferObjListGet(dObj);
+        /* Move the next queued transfer to the head of the list */
+        transferObj = lDRV_I2C_TransferObjSchedule(dObj);
 
         /* Process the next transfer buffer */
         if((transferObj != NULL) && (transferObj->currentState == DRV_I2C_TRANSFER_OBJ_IS_IN_QUEUE))
         {
             // Get the client object that owns this buffer
-            clientObj = &((DRV_I2C_CLIENT_OBJ *)gDrvI2CObj[((transferObj->clientHandle & DRV_I2C_INSTANCE_MASK) >> 8)].clientObjPool)
-                        [transferObj->clientHandle & DRV_I2C_INDEX_MASK];
+            clientObj = lDRV_I2C_TransferClientGet(transferObj);
 
-            /* Check if the transfer setup for this client is different than the current transfer setup */
-            if (dObj->currentTransferSetup.clockSpeed != clientObj->transferSetup.clockSpeed)
-            {
-                /* Set the new transfer setup */
-                (void) dObj->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
-
-                dObj->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
-            }
+            lDRV_I2C_TransferSetupApply(dObj, clientObj, transferObj);
 
             switch(transferObj->flag)
             {
@@ -487,6 +770,8 @@ SYS_MODULE_OBJ DRV_I2C_Initialize(
 
 /* MISRAC 2012 deviation block end */
 
+    uint32_t priority;
+
     /* Validate the request */
     if(drvIndex >= DRV_I2C_INSTANCES_NUMBER)
     {
@@ -528,6 +813,23 @@ SYS_MODULE_OBJ DRV_I2C_Initialize(
     dObj->i2cTokenCount                     = 1;
     dObj->initI2CClockSpeed                 = i2cInit->clockSpeed;
     dObj->currentTransferSetup.clockSpeed   = i2cInit->clockSpeed;
+    dObj->lastClientHandle                  = DRV_HANDLE_INVALID;
+
+    for (priority = 0U; priority < DRV_I2C_SCHED_CLASS_NUMBER; priority++)
+    {
+        dObj->schedQueueHead[priority] = NULL;
+        dObj->schedQueueTail[priority] = NULL;
+        dObj->schedOvertaken[priority] = 0U;
+    }
+
+    lDRV_I2C_FreeTransferObjListInit(dObj);
+
+#if (DRV_I2C_SCHED_STATISTICS_ENABLE == true)
+    /* Start the cycle counter used to timestamp the queued transfers */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 
     /* Register a callback with the underlying PLIB.
      * dObj as a context parameter will be used to distinguish the events
@@ -627,6 +929,15 @@ DRV_HANDLE DRV_I2C_Open(
             clientObj->transferSetup.clockSpeed = dObj->initI2CClockSpeed;
             clientObj->eventHandler             = NULL;
             clientObj->context                  = 0U;
+            clientObj->priority                 = DRV_I2C_CLIENT_PRIORITY_NORMAL;
+            clientObj->deadline                 = 0U;
+            clientObj->transferCount            = 0U;
+            clientObj->waitTotal                = 0U;
+            clientObj->waitMax                  = 0U;
+            clientObj->deadlineMissCount        = 0U;
+            clientObj->setupChangeCount         = 0U;
+            clientObj->queueHead                = NULL;
+            clientObj->queueTail                = NULL;
 
             return ((DRV_HANDLE) clientObj->clientHandle );
         }
@@ -747,6 +1058,129 @@ bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* set
     return true;
 }
 
+bool DRV_I2C_TransferStatisticsGet( const DRV_HANDLE handle, DRV_I2C_TRANSFER_STATISTICS* statistics )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+
+    if(statistics == NULL)
+    {
+        return false;
+    }
+
+    /* Validate the driver handle */
+    clientObj = lDRV_I2C_DriverHandleValidate(handle);
+
+    if(clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = &gDrvI2CObj[clientObj->drvIndex];
+
+    if(dObj->i2cPlib->transferStatisticsGet == NULL)
+    {
+        return false;
+    }
+
+    dObj->i2cPlib->transferStatisticsGet(statistics);
+
+    return true;
+}
+
+bool DRV_I2C_ClientSchedulingSet( const DRV_HANDLE handle, DRV_I2C_CLIENT_PRIORITY priority, uint32_t deadlineUs )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+
+#if (DRV_I2C_SCHED_STATISTICS_ENABLE == true)
+    if ((priority > DRV_I2C_CLIENT_PRIORITY_LOW) || (deadlineUs > (0x7FFFFFFFU / DRV_I2C_SCHED_CYCLES_PER_US)))
+#else
+    /* Deadlines need the cycle counter timestamps */
+    if ((priority > DRV_I2C_CLIENT_PRIORITY_LOW) || (deadlineUs != 0U))
+#endif
+    {
+        return false;
+    }
+
+    /* Validate the driver handle */
+    clientObj = lDRV_I2C_DriverHandleValidate(handle);
+
+    if(clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = &gDrvI2CObj[clientObj->drvIndex];
+
+    /* The scheduler reads these from the PLIB interrupt context */
+    if(lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
+    /* The queued transfers of the client stay in the queue of the current
+     * class, so the class can only change while none are queued. This keeps
+     * the transfers of a client in order. */
+    if ((priority != clientObj->priority) && (clientObj->queueHead != NULL))
+    {
+        lDRV_I2C_ResourceUnlock(dObj);
+        return false;
+    }
+
+    clientObj->priority = priority;
+    clientObj->deadline = deadlineUs * DRV_I2C_SCHED_CYCLES_PER_US;
+
+    lDRV_I2C_ResourceUnlock(dObj);
+
+    return true;
+}
+
+bool DRV_I2C_ClientQueueStatisticsGet( const DRV_HANDLE handle, DRV_I2C_CLIENT_QUEUE_STATISTICS* statistics )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+    uint64_t waitTotal;
+
+    if(statistics == NULL)
+    {
+        return false;
+    }
+
+    /* Validate the driver handle */
+    clientObj = lDRV_I2C_DriverHandleValidate(handle);
+
+    if(clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = &gDrvI2CObj[clientObj->drvIndex];
+
+    /* Take a consistent snapshot of the counters updated by the PLIB interrupt */
+    if(lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
+    statistics->transferCount       = clientObj->transferCount;
+    statistics->maxWaitUs           = clientObj->waitMax / DRV_I2C_SCHED_CYCLES_PER_US;
+    statistics->deadlineMissCount   = clientObj->deadlineMissCount;
+    statistics->setupChangeCount    = clientObj->setupChangeCount;
+    waitTotal                       = clientObj->waitTotal;
+
+    lDRV_I2C_ResourceUnlock(dObj);
+
+    statistics->averageWaitUs = 0U;
+
+    if (statistics->transferCount != 0U)
+    {
+        statistics->averageWaitUs = (uint32_t)((waitTotal / statistics->transferCount) / DRV_I2C_SCHED_CYCLES_PER_US);
+    }
+
+    return true;
+}
+
 DRV_I2C_ERROR DRV_I2C_ErrorGet( const DRV_I2C_TRANSFER_HANDLE transferHandle )
 {
     DRV_I2C_OBJ* dObj = NULL;
@@ -869,6 +1303,9 @@ static void lDRV_I2C_WriteReadTransferAdd (
     transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_IN_QUEUE;
     transferObj->event        = DRV_I2C_TRANSFER_EVENT_PENDING;
     transferObj->flag         = transferFlags;
+#if (DRV_I2C_SCHED_STATISTICS_ENABLE == true)
+    transferObj->queuedAt     = lDRV_I2C_TimestampGet();
+#endif
 
     *transferHandle = transferObj->transferHandle;
 
@@ -876,15 +1313,7 @@ static void lDRV_I2C_WriteReadTransferAdd (
     if (lDRV_I2C_TransferObjAddToList(dObj, transferObj) == true)
     {
         /* This is the first request in the queue, hence initiate a PLIB transfer */
-
-        /* Check if the transfer setup for this client is different than the current transfer setup */
-        if (dObj->currentTransferSetup.clockSpeed != clientObj->transferSetup.clockSpeed)
-        {
-            /* Set the new transfer setup */
-            (void) dObj->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
-
-            dObj->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
-        }
+        lDRV_I2C_TransferSetupApply(dObj, clientObj, transferObj);
 
         transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_PROCESSING;
 
@@ -65,6 +65,14 @@
 #define APP_EEPROM_SLAVE_ADDR                       0x0057
 #define APP_EEPROM_START_MEMORY_ADDR                0x00
 
+/* In the profiling build the SYS_PROFILE console keys print the task report
+ * and the trace instead of requesting a read */
+#if defined(SYS_PROFILE_ENABLE) && (SYS_PROFILE_ENABLE == true)
+#define APP_EEPROM_PROFILE_COMMAND(key)             SYS_PROFILE_CommandProcess(key)
+#else
+#define APP_EEPROM_PROFILE_COMMAND(key)             false
+#endif
+
 // *****************************************************************************
 /* Application Data
 
@@ -158,6 +166,9 @@ void APP_I2C_EEPROM_Tasks ( void )
             {
                 /* Register the I2C Driver client event callback */
                 DRV_I2C_TransferEventHandlerSet(appEEPROMData.i2cHandle, APP_I2C_EEPROM_EventHandler, 0);       
+
+                /* EEPROM traffic yields the bus to the temperature sensor */
+                (void) DRV_I2C_ClientSchedulingSet(appEEPROMData.i2cHandle, DRV_I2C_CLIENT_PRIORITY_LOW, 0);
                 
                 /* Get a handle to the console instance */
                 appEEPROMData.consoleHandle = SYS_CONSOLE_HandleGet(SYS_CONSOLE_INDEX_0);
@@ -274,7 +285,8 @@ void APP_I2C_EEPROM_Tasks ( void )
             break;
 
         case APP_EEPROM_STATE_CHECK_READ_REQ:
-            if (SYS_CONSOLE_Read(appEEPROMData.consoleHandle, &appEEPROMData.consoleData, 1 ) == 1)
+            if ((SYS_CONSOLE_Read(appEEPROMData.consoleHandle, &appEEPROMData.consoleData, 1 ) == 1) &&
+                (APP_EEPROM_PROFILE_COMMAND(appEEPROMData.consoleData) == false))
             {
                 SYS_CONSOLE_PRINT("Reading last 5 temperature values from EEPROM...\r\n");
                 appEEPROMData.state = APP_EEPROM_STATE_READ;
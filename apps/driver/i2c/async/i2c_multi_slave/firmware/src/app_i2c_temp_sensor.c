@@ -63,6 +63,7 @@
 #define APP_TEMP_SLAVE_ADDR                         0x004F
 #define APP_TEMP_TEMPERATURE_REG_ADDR               0x00
 #define APP_TEMP_SAMPLING_TIME                      1000
+#define APP_TEMP_SAMPLE_DEADLINE_US                 2000
 
 // *****************************************************************************
 /* Application Data
@@ -176,6 +177,9 @@ void APP_I2C_TEMP_SENSOR_Tasks ( void )
                 /* Register the I2C Driver client event callback */
                 DRV_I2C_TransferEventHandlerSet(appTempData.i2cHandle, APP_I2C_TEMP_SENSOR_EventHandler, 0);
 
+                /* Sample ahead of the EEPROM traffic sharing the bus */
+                (void) DRV_I2C_ClientSchedulingSet(appTempData.i2cHandle, DRV_I2C_CLIENT_PRIORITY_HIGH, APP_TEMP_SAMPLE_DEADLINE_US);
+
                 /* Register the Periodic Timer callback */
                 appTempData.tmrHandle = SYS_TIME_CallbackRegisterMS(APP_I2C_TEMP_SENSOR_TimerCallback, 0, APP_TEMP_SAMPLING_TIME, SYS_TIME_PERIODIC);
                 if (appTempData.tmrHandle == SYS_TIME_HANDLE_INVALID)
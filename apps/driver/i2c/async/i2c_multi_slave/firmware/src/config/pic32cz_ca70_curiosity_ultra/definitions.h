@@ -58,6 +58,7 @@
 #include "system/time/sys_time.h"
 #include "peripheral/uart/plib_uart1.h"
 #include "peripheral/twihs/master/plib_twihs0_master.h"
+#include "peripheral/xdmac/plib_xdmac.h"
 #include "system/console/sys_console.h"
 #include "system/console/src/sys_console_uart_definitions.h"
 #include "system/int/sys_int.h"
@@ -66,6 +66,7 @@ void DebugMonitor_Handler (void);
 void UART1_InterruptHandler (void);
 void TWIHS0_InterruptHandler (void);
 void TC0_CH0_InterruptHandler (void);
+void XDMAC_InterruptHandler (void);
 
 
 
@@ -65,6 +65,8 @@ void NVIC_Initialize( void )
     NVIC_EnableIRQ(TWIHS0_IRQn);
     NVIC_SetPriority(TC0_CH0_IRQn, 7);
     NVIC_EnableIRQ(TC0_CH0_IRQn);
+    NVIC_SetPriority(XDMAC_IRQn, 7);
+    NVIC_EnableIRQ(XDMAC_IRQn);
 
     /* Enable Usage fault */
     SCB->SHCSR |= (SCB_SHCSR_USGFAULTENA_Msk);
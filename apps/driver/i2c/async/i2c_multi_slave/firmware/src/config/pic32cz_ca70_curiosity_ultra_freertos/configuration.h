@@ -72,6 +72,12 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* OSAL semaphores and mutexes created from static storage */
+#define OSAL_STATIC_SEMAPHORE_COUNT                      (10U)
+
+/* Count the core clock cycles of the boot in SYS_BootCycles */
+#define SYS_BOOT_TIME_ENABLE                             true
+
 
 
 // *****************************************************************************
@@ -88,6 +94,11 @@ extern "C" {
 #define SYS_TIME_CPU_CLOCK_FREQUENCY                (300000000)
 #define SYS_TIME_COMPARE_UPDATE_EXECUTION_CYCLES    (900)
 
+/* RTOS profiling, set SYS_PROFILE_ENABLE to true for the profiling build */
+#define SYS_PROFILE_ENABLE                          false
+#define SYS_PROFILE_MAX_TASKS                       (16U)
+#define SYS_PROFILE_TRACE_SIZE                      (256U)
+
 #define SYS_CONSOLE_DEVICE_MAX_INSTANCES   			(1U)
 #define SYS_CONSOLE_UART_MAX_INSTANCES 	   			(1U)
 #define SYS_CONSOLE_USB_CDC_MAX_INSTANCES 	   		(0U)
@@ -115,6 +126,11 @@ extern "C" {
 /* I2C Driver Common Configuration Options */
 #define DRV_I2C_INSTANCES_NUMBER              (1U)
 
+/* I2C Driver Scheduler Configuration Options */
+#define DRV_I2C_SCHED_AGING_LIMIT             (4U)
+#define DRV_I2C_SCHED_CPU_CLOCK_FREQUENCY     (300000000U)
+#define DRV_I2C_SCHED_STATISTICS_ENABLE       true
+
 
 
 
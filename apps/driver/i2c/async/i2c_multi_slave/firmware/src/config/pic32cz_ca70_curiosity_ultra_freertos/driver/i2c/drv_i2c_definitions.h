@@ -91,6 +91,34 @@ typedef struct
 
 } DRV_I2C_TRANSFER_SETUP;
 
+// *****************************************************************************
+/* I2C Driver Transfer Statistics
+
+  Summary:
+    Defines the transfer and interrupt counters of a driver instance.
+
+  Description:
+    This data type holds the counters returned by the
+    DRV_I2C_TransferStatisticsGet API. The counters are maintained by the I2C
+    PLib and cover every transfer it has carried out since initialization.
+
+  Remarks:
+    The layout matches the statistics structure of the I2C PLib.
+*/
+
+typedef struct
+{
+    /* Transfers started on the peripheral */
+    uint32_t transferCount;
+
+    /* Read or write phases whose data was moved by DMA */
+    uint32_t dmaTransferCount;
+
+    /* Peripheral and DMA interrupts taken on behalf of the transfers */
+    uint32_t interruptCount;
+
+} DRV_I2C_TRANSFER_STATISTICS;
+
 // *****************************************************************************
 /* I2C Driver Error
 
@@ -135,6 +163,8 @@ typedef bool (* DRV_I2C_PLIB_TRANSFER_SETUP)(DRV_I2C_TRANSFER_SETUP* setup, uint
 
 typedef void (* DRV_I2C_PLIB_CALLBACK_REGISTER)(DRV_I2C_PLIB_CALLBACK callback, uintptr_t contextHandle);
 
+typedef void (* DRV_I2C_PLIB_TRANSFER_STATISTICS_GET)(DRV_I2C_TRANSFER_STATISTICS* statistics);
+
 typedef struct
 {
     int32_t         i2cInt0;
@@ -195,6 +225,9 @@ typedef struct
     /* I2C PLib callback register API */
     DRV_I2C_PLIB_CALLBACK_REGISTER              callbackRegister;
 
+    /* I2C PLib transfer statistics API. May be NULL. */
+    DRV_I2C_PLIB_TRANSFER_STATISTICS_GET        transferStatisticsGet;
+
 } DRV_I2C_PLIB_INTERFACE;
 
 // *****************************************************************************
@@ -102,6 +102,9 @@ static const DRV_I2C_PLIB_INTERFACE drvI2C0PLibAPI = {
 
     /* I2C PLib Callback Register */
     .callbackRegister = (DRV_I2C_PLIB_CALLBACK_REGISTER)TWIHS0_CallbackRegister,
+
+    /* I2C PLib Transfer Statistics function */
+    .transferStatisticsGet = (DRV_I2C_PLIB_TRANSFER_STATISTICS_GET)TWIHS0_TransferStatisticsGet,
 };
 
 
@@ -242,8 +245,19 @@ void SYS_Initialize ( void* data )
     EFC_Initialize();
   
     CLOCK_Initialize();
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+    /* Count the core clock cycles up to the start of the scheduler */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
 	PIO_Initialize();
 
+    XDMAC_Initialize();
+
 
 
 	RSWDT_REGS->RSWDT_MR = RSWDT_MR_WDDIS_Msk;	// Disable RSWDT 
@@ -69,6 +69,7 @@ void xPortSysTickHandler (void);
 void UART1_InterruptHandler (void);
 void TWIHS0_InterruptHandler (void);
 void TC0_CH0_InterruptHandler (void);
+void XDMAC_InterruptHandler (void);
 
 
 
@@ -153,6 +153,34 @@ typedef void (*TWIHS_CALLBACK)
     uintptr_t contextHandle
 );
 
+// *****************************************************************************
+/* TWIHS Transfer Statistics
+
+  Summary:
+    TWIHS PLib transfer and interrupt counters.
+
+  Description:
+    This data type holds the counters returned by TWIHSx_TransferStatisticsGet.
+    Dividing interruptCount by transferCount gives the number of interrupts
+    taken per transfer.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Transfers started through the PLib API */
+    uint32_t transferCount;
+
+    /* Read or write phases whose data was moved by the XDMAC */
+    uint32_t dmaTransferCount;
+
+    /* TWIHS and XDMAC interrupts taken on behalf of the transfers */
+    uint32_t interruptCount;
+
+} TWIHS_TRANSFER_STATISTICS;
+
 // *****************************************************************************
 /* TWIHS PLib Instance Object
 
@@ -176,9 +204,19 @@ typedef struct
     size_t  writeCount;
     size_t  readCount;
 
+    /* Internal (memory) address sent by the peripheral after the slave address */
+    uint32_t internalAddress;
+    uint8_t  internalAddressSize;
+
     /* State */
     TWIHS_STATE state;
 
+    /* XDMAC is moving the data of the current read or write phase */
+    bool dmaInProgress;
+
+    /* Transfer and interrupt counters */
+    TWIHS_TRANSFER_STATISTICS statistics;
+
     /* Transfer status */
     TWIHS_ERROR error;
 
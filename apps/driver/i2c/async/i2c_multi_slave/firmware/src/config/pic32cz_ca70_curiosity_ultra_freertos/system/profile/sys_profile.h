@@ -0,0 +1,292 @@
+/*************************************************************************
+RTOS Profiling Service Interface Declarations and Types
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_profile.h
+
+  Summary:
+    RTOS profiling interface declarations and types.
+
+  Description:
+    This file contains function, type and macro declarations of an opt-in
+    profiling layer for FreeRTOS. It feeds the FreeRTOS run time statistics
+    from the SYS_TIME 64-bit counter, records scheduler and interrupt events
+    in a RAM trace ring and reports per task CPU load, scheduling latency
+    and stack high water marks.
+
+    This header is included by FreeRTOSConfig.h, it must not include any
+    FreeRTOS header.
+  *************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_PROFILE_H_
+#define SYS_PROFILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Build Parameters
+// *****************************************************************************
+// *****************************************************************************
+
+/* Enables the profiling build. When false FreeRTOSConfig.h leaves the run
+ * time statistics and the trace facility off and this service compiles to
+ * nothing. */
+#ifndef SYS_PROFILE_ENABLE
+    #define SYS_PROFILE_ENABLE              false
+#endif
+
+/* Number of tasks tracked. Tasks are identified by their FreeRTOS TCB number,
+ * which starts at 1 and grows with every task created, including the idle
+ * task. Tasks numbered SYS_PROFILE_MAX_TASKS or higher have no latency
+ * statistics. */
+#ifndef SYS_PROFILE_MAX_TASKS
+    #define SYS_PROFILE_MAX_TASKS           (16U)
+#endif
+
+/* Number of events held by the trace ring, a power of two */
+#ifndef SYS_PROFILE_TRACE_SIZE
+    #define SYS_PROFILE_TRACE_SIZE          (256U)
+#endif
+
+/* Number of the newest trace events printed by SYS_PROFILE_TracePrint */
+#ifndef SYS_PROFILE_TRACE_PRINT_COUNT
+    #define SYS_PROFILE_TRACE_PRINT_COUNT   (32U)
+#endif
+
+/* The reports are printed through SYS_PROFILE_PRINT(fmt, ...), which
+ * defaults to the system console and can be redirected (for example to
+ * printf) from configuration.h. */
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* SYS PROFILE Trace Events
+
+  Summary:
+    Identifies the events recorded in the trace ring.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* "ready": a task was moved to the ready list, id is its TCB number */
+    SYS_PROFILE_EVENT_TASK_READY = 0,
+
+    /* "switch": a task was switched in, id is its TCB number */
+    SYS_PROFILE_EVENT_TASK_SWITCH,
+
+    /* "isr": an interrupt handler entered a FromISR kernel routine, id is
+     * the exception number (IRQn + 16) */
+    SYS_PROFILE_EVENT_ISR,
+
+} SYS_PROFILE_EVENT;
+
+// *****************************************************************************
+/* SYS PROFILE Trace Entry
+
+  Summary:
+    Event recorded in the trace ring.
+
+  Remarks:
+    The timestamp is the low 32 bits of the SYS_TIME counter.
+*/
+
+typedef struct
+{
+    uint32_t timestamp;
+
+    uint16_t event;
+
+    uint16_t id;
+
+} SYS_PROFILE_TRACE_ENTRY;
+
+#if (SYS_PROFILE_ENABLE == true)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Kernel Hook Routines
+// *****************************************************************************
+// *****************************************************************************
+/* These routines are called by the FreeRTOS trace and run time statistics
+   macros defined in FreeRTOSConfig.h, from task, scheduler and interrupt
+   context. They are not meant to be called by the application.
+*/
+
+/* portCONFIGURE_TIMER_FOR_RUN_TIME_STATS: the scheduler is being started */
+void SYS_PROFILE_SchedulerStart ( void );
+
+/* portGET_RUN_TIME_COUNTER_VALUE: SYS_TIME counts since the scheduler start */
+uint64_t SYS_PROFILE_RunTimeCounterGet ( void );
+
+/* traceMOVED_TASK_TO_READY_STATE */
+void SYS_PROFILE_TaskReady ( uint32_t taskNumber );
+
+/* traceTASK_SWITCHED_IN */
+void SYS_PROFILE_TaskSwitchedIn ( uint32_t taskNumber );
+
+/* traceENTER_ of the FromISR routines */
+void SYS_PROFILE_IsrEnter ( void );
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+//*****************************************************************************
+/* Function:
+    void SYS_PROFILE_ReportPrint ( void );
+
+  Summary:
+    Prints the statistics of every task.
+
+  Description:
+    This function prints one line per task through SYS_PROFILE_PRINT, with
+    the share of the CPU and the largest scheduling latency since the
+    previous report, and the smallest amount of stack that has remained
+    free since the task started:
+
+    <code>
+    PROF id=4 task=DRV_SDMMC0_Tasks cpu=12.5% lat_max_us=38 stack_free=3472
+    PROF window_ms=1000
+    </code>
+
+    The scheduling latency is the time from a task being made ready to it
+    being switched in.
+
+  Precondition:
+    The scheduler must be running.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    The system keeps running. The task states are collected with
+    uxTaskGetSystemState, which suspends the scheduler, but not interrupts,
+    while it walks the task lists.
+*/
+
+void SYS_PROFILE_ReportPrint ( void );
+
+//*****************************************************************************
+/* Function:
+    void SYS_PROFILE_TracePrint ( void );
+
+  Summary:
+    Prints the newest events of the trace ring.
+
+  Description:
+    This function prints the newest SYS_PROFILE_TRACE_PRINT_COUNT events of
+    the trace ring, oldest first, through SYS_PROFILE_PRINT. Each line holds
+    the time since the previous event:
+
+    <code>
+    TRACE dt_us=12 ev=isr id=74
+    TRACE dt_us=3 ev=ready id=4
+    TRACE dt_us=2 ev=switch id=4
+    </code>
+
+  Precondition:
+    The scheduler must be running.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    The ring keeps recording while it is printed, events overwritten during
+    the report are skipped.
+*/
+
+void SYS_PROFILE_TracePrint ( void );
+
+//*****************************************************************************
+/* Function:
+    bool SYS_PROFILE_CommandProcess ( uint8_t key );
+
+  Summary:
+    Handles a profiling console command.
+
+  Description:
+    This function handles a key read from the system console:
+    - 'p' prints the task report, see SYS_PROFILE_ReportPrint.
+    - 't' prints the trace ring, see SYS_PROFILE_TracePrint.
+
+  Precondition:
+    The scheduler must be running.
+
+  Parameters:
+    key - Key read from the console.
+
+  Returns:
+    true - The key is a profiling command and was handled.
+
+    false - The key is not a profiling command.
+
+  Remarks:
+    The application which owns the console input passes the keys it reads,
+    and ignores those for which true is returned.
+*/
+
+bool SYS_PROFILE_CommandProcess ( uint8_t key );
+
+#endif // (SYS_PROFILE_ENABLE == true)
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif /* SYS_PROFILE_H_ */
@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP_I2C_EEPROM_Tasks. */
 TaskHandle_t xAPP_I2C_EEPROM_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_I2C_EEPROM_Tasks task. */
+static StackType_t lAPP_I2C_EEPROM_TasksStack[1024];
+static StaticTask_t lAPP_I2C_EEPROM_TasksTCB;
+#endif
+
 static void lAPP_I2C_EEPROM_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -80,6 +90,12 @@ TaskHandle_t xAPP_I2C_TEMP_SENSOR_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_I2C_TEMP_SENSOR_Tasks task. */
+static StackType_t lAPP_I2C_TEMP_SENSOR_TasksStack[1024];
+static StaticTask_t lAPP_I2C_TEMP_SENSOR_TasksTCB;
+#endif
+
 static void lAPP_I2C_TEMP_SENSOR_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -120,6 +136,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_I2C_EEPROM_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_I2C_EEPROM_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_I2C_EEPROM_Tasks,
+           "APP_I2C_EEPROM_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_I2C_EEPROM_TasksStack,
+           &lAPP_I2C_EEPROM_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_I2C_EEPROM_Tasks,
            "APP_I2C_EEPROM_Tasks",
@@ -127,8 +153,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_I2C_EEPROM_Tasks);
+#endif
 
     /* Create OS Thread for APP_I2C_TEMP_SENSOR_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_I2C_TEMP_SENSOR_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_I2C_TEMP_SENSOR_Tasks,
+           "APP_I2C_TEMP_SENSOR_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_I2C_TEMP_SENSOR_TasksStack,
+           &lAPP_I2C_TEMP_SENSOR_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_I2C_TEMP_SENSOR_Tasks,
            "APP_I2C_TEMP_SENSOR_Tasks",
@@ -136,8 +173,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_I2C_TEMP_SENSOR_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -72,6 +72,12 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* OSAL semaphores and mutexes created from static storage */
+#define OSAL_STATIC_SEMAPHORE_COUNT                      (6U)
+
+/* Count the core clock cycles of the boot in SYS_BootCycles */
+#define SYS_BOOT_TIME_ENABLE                             true
+
 
 
 // *****************************************************************************
@@ -67,6 +67,7 @@ void DebugMonitor_Handler (void);
 void xPortPendSVHandler (void);
 void xPortSysTickHandler (void);
 void TWIHS0_InterruptHandler (void);
+void XDMAC_InterruptHandler (void);
 
 
 
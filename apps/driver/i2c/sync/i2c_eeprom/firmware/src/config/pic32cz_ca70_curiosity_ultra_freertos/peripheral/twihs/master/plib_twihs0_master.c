@@ -47,10 +47,25 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <string.h>
 #include "device.h"
 #include "plib_twihs0_master.h"
+#include "peripheral/xdmac/plib_xdmac.h"
 #include "interrupts.h"
 
+/* XDMAC channels serving TWIHS0. A read or write phase is handed to the XDMAC
+ * when at least TWIHS0_DMA_MIN_SIZE of its bytes can be moved that way;
+ * shorter phases are cheaper to run from the TWIHS interrupt alone. */
+#define TWIHS0_DMA_TX_CHANNEL   XDMAC_CHANNEL_0
+#define TWIHS0_DMA_RX_CHANNEL   XDMAC_CHANNEL_1
+#define TWIHS0_DMA_MIN_SIZE     (4U)
+
+/* Read phases into a buffer that does not start and end on cache line
+ * boundaries go through this bounce buffer, so that no line the CPU shares
+ * with the client buffer is evicted over the DMA data. Longer unaligned read
+ * phases stay on the interrupt path. */
+#define TWIHS0_DMA_BOUNCE_SIZE  (256U)
+
 // *****************************************************************************
 // *****************************************************************************
 // Global Data
@@ -59,12 +74,147 @@
 
 static volatile TWIHS_OBJ twihs0Obj;
 
+static CACHE_ALIGN uint8_t twihs0DmaBounceBuffer[TWIHS0_DMA_BOUNCE_SIZE];
+
 // *****************************************************************************
 // *****************************************************************************
 // TWIHS0 PLib Interface Routines
 // *****************************************************************************
 // *****************************************************************************
 
+static bool TWIHS0_DMABufferIsAligned( const uint8_t* buffer, size_t size )
+{
+    return ((((uintptr_t)buffer | (uintptr_t)size) & (CACHE_LINE_SIZE - 1U)) == 0U);
+}
+
+// The DMA part of a read phase, all but the last two bytes
+static size_t TWIHS0_DMAReadSizeGet( void )
+{
+    return twihs0Obj.readSize - 2U;
+}
+
+// Buffer the XDMAC reads into: the client buffer itself when it owns whole
+// cache lines, otherwise the bounce buffer
+static uint8_t* TWIHS0_DMAReadBufferGet( void )
+{
+    uint8_t* buffer = twihs0Obj.readBuffer;
+
+    if (TWIHS0_DMABufferIsAligned(buffer, TWIHS0_DMAReadSizeGet()) == false)
+    {
+        buffer = twihs0DmaBounceBuffer;
+    }
+
+    return buffer;
+}
+
+static bool TWIHS0_DMAReadIsPossible( void )
+{
+    size_t size;
+
+    if (twihs0Obj.readSize < (TWIHS0_DMA_MIN_SIZE + 2U))
+    {
+        return false;
+    }
+
+    size = TWIHS0_DMAReadSizeGet();
+
+    return ((TWIHS0_DMABufferIsAligned(twihs0Obj.readBuffer, size) == true) || (size <= TWIHS0_DMA_BOUNCE_SIZE));
+}
+
+static void TWIHS0_DMACallback( XDMAC_TRANSFER_EVENT event, uintptr_t context )
+{
+    uint8_t* buffer;
+    size_t size;
+
+    (void) context;
+
+    if (twihs0Obj.dmaInProgress == false)
+    {
+        // Channel disabled by an abort or an error
+        return;
+    }
+
+    twihs0Obj.statistics.interruptCount++;
+
+    if (event == XDMAC_TRANSFER_COMPLETE)
+    {
+        twihs0Obj.dmaInProgress = false;
+
+        if (twihs0Obj.state == TWIHS_STATE_TRANSFER_WRITE)
+        {
+            // The last byte is written from the TXRDY interrupt, which also
+            // issues the STOP or the repeated START for the read
+            twihs0Obj.writeCount = twihs0Obj.writeSize - 1U;
+            TWIHS0_REGS->TWIHS_IER = TWIHS_IER_TXRDY_Msk | TWIHS_IER_TXCOMP_Msk;
+        }
+        else
+        {
+            // Lines speculatively fetched while the XDMAC was writing the
+            // buffer hold stale data
+            buffer = TWIHS0_DMAReadBufferGet();
+            size = TWIHS0_DMAReadSizeGet();
+
+            SCB_InvalidateDCache_by_Addr(buffer, (int32_t)size);
+
+            if (buffer != twihs0Obj.readBuffer)
+            {
+                (void) memcpy(twihs0Obj.readBuffer, buffer, size);
+            }
+
+            // STOP must be set before the next-to-last byte is read, hence the
+            // last two bytes are read from the RXRDY interrupt
+            twihs0Obj.readCount = size;
+            TWIHS0_REGS->TWIHS_IER = TWIHS_IER_RXRDY_Msk | TWIHS_IER_TXCOMP_Msk;
+        }
+    }
+    else
+    {
+        // End the transfer, disable the channel and notify the client from
+        // the TWIHS interrupt
+        twihs0Obj.error = TWIHS_BUS_ERROR;
+        twihs0Obj.state = TWIHS_STATE_ERROR;
+        NVIC_SetPendingIRQ(TWIHS0_IRQn);
+    }
+}
+
+static void TWIHS0_DMAStop( void )
+{
+    if (twihs0Obj.dmaInProgress)
+    {
+        twihs0Obj.dmaInProgress = false;
+        XDMAC_ChannelDisable(TWIHS0_DMA_TX_CHANNEL);
+        XDMAC_ChannelDisable(TWIHS0_DMA_RX_CHANNEL);
+    }
+}
+
+static void TWIHS0_DMAWriteStart( void )
+{
+    // All but the last byte
+    size_t size = twihs0Obj.writeSize - 1U;
+
+    SCB_CleanDCache_by_Addr(twihs0Obj.writeBuffer, (int32_t)size);
+
+    twihs0Obj.dmaInProgress = true;
+    twihs0Obj.statistics.dmaTransferCount++;
+
+    (void) XDMAC_ChannelTransfer(TWIHS0_DMA_TX_CHANNEL, twihs0Obj.writeBuffer, (const void *)&TWIHS0_REGS->TWIHS_THR, size);
+}
+
+static void TWIHS0_DMAReadStart( void )
+{
+    uint8_t* buffer = TWIHS0_DMAReadBufferGet();
+    size_t size = TWIHS0_DMAReadSizeGet();
+
+    // The buffer owns whole cache lines, no dirty line can be written back
+    // over the DMA data once they are invalidated
+    SCB_InvalidateDCache_by_Addr(buffer, (int32_t)size);
+
+    twihs0Obj.dmaInProgress = true;
+    twihs0Obj.statistics.dmaTransferCount++;
+
+    (void) XDMAC_ChannelTransfer(TWIHS0_DMA_RX_CHANNEL, (const void *)&TWIHS0_REGS->TWIHS_RHR, buffer, size);
+}
+
 void TWIHS0_Initialize( void )
 {
     // Reset the i2c Module
@@ -91,6 +241,13 @@ void TWIHS0_Initialize( void )
     // Initialize the twihs PLib Object
     twihs0Obj.error = TWIHS_ERROR_NONE;
     twihs0Obj.state = TWIHS_STATE_IDLE;
+    twihs0Obj.dmaInProgress = false;
+    twihs0Obj.statistics.transferCount = 0;
+    twihs0Obj.statistics.dmaTransferCount = 0;
+    twihs0Obj.statistics.interruptCount = 0;
+
+    XDMAC_ChannelCallbackRegister(TWIHS0_DMA_TX_CHANNEL, TWIHS0_DMACallback, 0);
+    XDMAC_ChannelCallbackRegister(TWIHS0_DMA_RX_CHANNEL, TWIHS0_DMACallback, 0);
 }
 
 static void TWIHS0_InitiateRead( void )
@@ -111,9 +268,18 @@ static void TWIHS0_InitiateRead( void )
         TWIHS0_REGS->TWIHS_CR = TWIHS_CR_START_Msk;
     }
 
-    __enable_irq();
+    if (TWIHS0_DMAReadIsPossible() == true)
+    {
+        TWIHS0_DMAReadStart();
+
+        __enable_irq();
+    }
+    else
+    {
+        __enable_irq();
 
-    TWIHS0_REGS->TWIHS_IER = TWIHS_IER_RXRDY_Msk | TWIHS_IER_TXCOMP_Msk;
+        TWIHS0_REGS->TWIHS_IER = TWIHS_IER_RXRDY_Msk | TWIHS_IER_TXCOMP_Msk;
+    }
 }
 
 static bool TWIHS0_InitiateTransfer( uint16_t address, bool type )
@@ -131,7 +297,10 @@ static bool TWIHS0_InitiateTransfer( uint16_t address, bool type )
     // 7-bit Slave Address
     else
     {
-        TWIHS0_REGS->TWIHS_MMR = TWIHS_MMR_DADR(address) | TWIHS_MMR_IADRSZ(0);
+        TWIHS0_REGS->TWIHS_MMR = TWIHS_MMR_DADR(address) | TWIHS_MMR_IADRSZ(twihs0Obj.internalAddressSize);
+
+        // Set internal address. It is sent by the peripheral ahead of the data bytes
+        TWIHS0_REGS->TWIHS_IADR = TWIHS_IADR_IADR(twihs0Obj.internalAddress);
     }
 
     twihs0Obj.writeCount = 0;
@@ -189,10 +358,17 @@ static bool TWIHS0_InitiateTransfer( uint16_t address, bool type )
         {
             twihs0Obj.state = TWIHS_STATE_TRANSFER_WRITE;
 
-            TWIHS0_REGS->TWIHS_THR = TWIHS_THR_TXDATA(twihs0Obj.writeBuffer[0]);
-            twihs0Obj.writeCount++;
+            if (twihs0Obj.writeSize >= (TWIHS0_DMA_MIN_SIZE + 1U))
+            {
+                TWIHS0_DMAWriteStart();
+            }
+            else
+            {
+                TWIHS0_REGS->TWIHS_THR = TWIHS_THR_TXDATA(twihs0Obj.writeBuffer[0]);
+                twihs0Obj.writeCount++;
 
-            TWIHS0_REGS->TWIHS_IER = TWIHS_IDR_TXRDY_Msk | TWIHS_IER_TXCOMP_Msk;
+                TWIHS0_REGS->TWIHS_IER = TWIHS_IDR_TXRDY_Msk | TWIHS_IER_TXCOMP_Msk;
+            }
         }
     }
     // Read transfer
@@ -230,6 +406,8 @@ void TWIHS0_TransferAbort( void )
 {
     twihs0Obj.error = TWIHS_ERROR_NONE;
 
+    TWIHS0_DMAStop();
+
     // Reset the PLib objects and Interrupts
     twihs0Obj.state = TWIHS_STATE_IDLE;
     TWIHS0_REGS->TWIHS_IDR = TWIHS_IDR_TXCOMP_Msk | TWIHS_IDR_TXRDY_Msk | TWIHS_IDR_RXRDY_Msk;
@@ -257,7 +435,10 @@ bool TWIHS0_Read( uint16_t address, uint8_t *pdata, size_t length )
     twihs0Obj.readSize = length;
     twihs0Obj.writeBuffer = NULL;
     twihs0Obj.writeSize = 0;
+    twihs0Obj.internalAddress = 0;
+    twihs0Obj.internalAddressSize = 0;
     twihs0Obj.error = TWIHS_ERROR_NONE;
+    twihs0Obj.statistics.transferCount++;
 
     return TWIHS0_InitiateTransfer(address, true);
 }
@@ -280,7 +461,10 @@ bool TWIHS0_Write( uint16_t address, uint8_t *pdata, size_t length )
     twihs0Obj.readSize = 0;
     twihs0Obj.writeBuffer = pdata;
     twihs0Obj.writeSize = length;
+    twihs0Obj.internalAddress = 0;
+    twihs0Obj.internalAddressSize = 0;
     twihs0Obj.error = TWIHS_ERROR_NONE;
+    twihs0Obj.statistics.transferCount++;
 
     return TWIHS0_InitiateTransfer(address, false);
 }
@@ -304,7 +488,42 @@ bool TWIHS0_WriteRead( uint16_t address, uint8_t *wdata, size_t wlength, uint8_t
     twihs0Obj.readSize = rlength;
     twihs0Obj.writeBuffer = wdata;
     twihs0Obj.writeSize = wlength;
+    twihs0Obj.internalAddress = 0;
+    twihs0Obj.internalAddressSize = 0;
     twihs0Obj.error = TWIHS_ERROR_NONE;
+    twihs0Obj.statistics.transferCount++;
+
+    return TWIHS0_InitiateTransfer(address, false);
+}
+
+bool TWIHS0_AddressedWrite( uint16_t address, uint32_t internalAddress, uint8_t internalAddressSize, uint8_t *pdata, size_t length )
+{
+    // Internal address register is also used for 10-bit slave addressing
+    if ((address > 0x007FU) || (internalAddressSize == 0U) || (internalAddressSize > 3U) || (length == 0U))
+    {
+        return false;
+    }
+
+    // Check for ongoing transfer
+    if( twihs0Obj.state != TWIHS_STATE_IDLE )
+    {
+        return false;
+    }
+    if ((TWIHS0_REGS->TWIHS_SR & (TWIHS_SR_SDA_Msk | TWIHS_SR_SCL_Msk)) != (TWIHS_SR_SDA_Msk | TWIHS_SR_SCL_Msk))
+    {
+        twihs0Obj.error = TWIHS_BUS_ERROR;
+        return false;
+    }
+
+    twihs0Obj.address = address;
+    twihs0Obj.readBuffer = NULL;
+    twihs0Obj.readSize = 0;
+    twihs0Obj.writeBuffer = pdata;
+    twihs0Obj.writeSize = length;
+    twihs0Obj.internalAddress = internalAddress;
+    twihs0Obj.internalAddressSize = internalAddressSize;
+    twihs0Obj.error = TWIHS_ERROR_NONE;
+    twihs0Obj.statistics.transferCount++;
 
     return TWIHS0_InitiateTransfer(address, false);
 }
@@ -320,6 +539,16 @@ TWIHS_ERROR TWIHS0_ErrorGet( void )
     return error;
 }
 
+void TWIHS0_TransferStatisticsGet( TWIHS_TRANSFER_STATISTICS* statistics )
+{
+    if (statistics != NULL)
+    {
+        statistics->transferCount = twihs0Obj.statistics.transferCount;
+        statistics->dmaTransferCount = twihs0Obj.statistics.dmaTransferCount;
+        statistics->interruptCount = twihs0Obj.statistics.interruptCount;
+    }
+}
+
 bool TWIHS0_TransferSetup( TWIHS_TRANSFER_SETUP* setup, uint32_t srcClkFreq )
 {
     uint32_t i2cClkSpeed;
@@ -374,6 +603,8 @@ void __attribute__((used)) TWIHS0_InterruptHandler( void )
     uint32_t status;
     uintptr_t context = twihs0Obj.context;
 
+    twihs0Obj.statistics.interruptCount++;
+
     // Read the peripheral status
     status = TWIHS0_REGS->TWIHS_SR;
 
@@ -409,6 +640,8 @@ void __attribute__((used)) TWIHS0_InterruptHandler( void )
         {
             case TWIHS_STATE_ADDR_SEND:
             {
+                TWIHS0_DMAStop();
+
                 if (twihs0Obj.writeSize != 0U )
                 {
                     // Initiate Write transfer
@@ -537,7 +770,9 @@ void __attribute__((used)) TWIHS0_InterruptHandler( void )
     }
     if (twihs0Obj.state == TWIHS_STATE_ERROR)
     {
-        // NACK is received,
+        // NACK is received, or the XDMAC reported an error
+        TWIHS0_DMAStop();
+
         twihs0Obj.state = TWIHS_STATE_IDLE;
         TWIHS0_REGS->TWIHS_IDR = TWIHS_IDR_TXCOMP_Msk | TWIHS_IDR_TXRDY_Msk | TWIHS_IDR_RXRDY_Msk;
 
@@ -56,6 +56,7 @@
 #include "driver/i2c/drv_i2c.h"
 #include "peripheral/uart/plib_uart1.h"
 #include "peripheral/twihs/master/plib_twihs0_master.h"
+#include "peripheral/xdmac/plib_xdmac.h"
 #include "system/console/sys_console.h"
 #include "system/console/src/sys_console_uart_definitions.h"
 #include "FreeRTOS.h"
@@ -214,6 +215,18 @@ typedef struct
 
 extern SYSTEM_OBJECTS sysObj;
 
+#ifndef SYS_BOOT_TIME_ENABLE
+#define SYS_BOOT_TIME_ENABLE    false
+#endif
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+/* Core clock cycles from the end of CLOCK_Initialize in SYS_Initialize to the
+   call of vTaskStartScheduler in SYS_Tasks, counted by the DWT cycle counter.
+   Divide by configCPU_CLOCK_HZ for the boot time in seconds. The C startup
+   code that runs before main is not included. */
+extern uint32_t SYS_BootCycles;
+#endif
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -506,6 +506,50 @@ void DRV_I2C_Close( const DRV_HANDLE handle );
 
 bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* setup);
 
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_TransferStatisticsGet( const DRV_HANDLE handle, DRV_I2C_TRANSFER_STATISTICS* statistics )
+
+   Summary:
+    Gets the transfer and interrupt counters of the driver instance.
+
+   Description:
+    This function copies the number of transfers carried out on the I2C
+    peripheral, how many of their read or write phases were moved by DMA, and
+    how many interrupts were taken to complete them. Dividing interruptCount
+    by transferCount gives the interrupt cost of a transfer.
+
+   Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+   Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine
+
+    statistics - Pointer to the structure that receives the counters
+
+   Returns:
+    true - The counters were copied.
+    false - The handle or statistics pointer is invalid, or the PLib does not
+    keep statistics.
+
+  Example:
+    <code>
+    DRV_I2C_TRANSFER_STATISTICS statistics;
+
+    if (DRV_I2C_TransferStatisticsGet(myI2CHandle, &statistics) == true)
+    {
+        // statistics.interruptCount / statistics.transferCount interrupts
+        // were taken per transfer
+    }
+    </code>
+
+  Remarks:
+    The counters are shared by all the clients of the driver instance.
+*/
+
+bool DRV_I2C_TransferStatisticsGet( const DRV_HANDLE handle, DRV_I2C_TRANSFER_STATISTICS* statistics );
+
 
 // *****************************************************************************
 /* Function:
@@ -243,6 +243,36 @@ bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* set
     return true;
 }
 
+bool DRV_I2C_TransferStatisticsGet( const DRV_HANDLE handle, DRV_I2C_TRANSFER_STATISTICS* statistics )
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+
+    if(statistics == NULL)
+    {
+        return false;
+    }
+
+    /* Validate the driver handle */
+    clientObj = lDRV_I2C_DriverHandleValidate(handle);
+
+    if(clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = (DRV_I2C_OBJ*)clientObj->hDriver;
+
+    if(dObj->i2cPlib->transferStatisticsGet == NULL)
+    {
+        return false;
+    }
+
+    dObj->i2cPlib->transferStatisticsGet(statistics);
+
+    return true;
+}
+
 DRV_I2C_ERROR DRV_I2C_ErrorGet( const DRV_HANDLE drvHandle )
 {
     DRV_I2C_CLIENT_OBJ* clientObj = NULL;
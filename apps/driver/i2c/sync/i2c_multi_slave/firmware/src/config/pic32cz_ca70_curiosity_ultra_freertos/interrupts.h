@@ -68,6 +68,7 @@ void xPortPendSVHandler (void);
 void xPortSysTickHandler (void);
 void UART1_InterruptHandler (void);
 void TWIHS0_InterruptHandler (void);
+void XDMAC_InterruptHandler (void);
 
 
 
@@ -79,6 +79,14 @@ extern "C" {
 // Section: System Service Configuration
 // *****************************************************************************
 // *****************************************************************************
+/* TIME System Service Configuration Options */
+#define SYS_TIME_INDEX_0                            (0)
+#define SYS_TIME_MAX_TIMERS                         (5)
+#define SYS_TIME_HW_COUNTER_WIDTH                   (16)
+#define SYS_TIME_HW_COUNTER_PERIOD                  (65535U)
+#define SYS_TIME_HW_COUNTER_HALF_PERIOD             (SYS_TIME_HW_COUNTER_PERIOD>>1)
+#define SYS_TIME_CPU_CLOCK_FREQUENCY                (300000000)
+#define SYS_TIME_COMPARE_UPDATE_EXECUTION_CYCLES    (900)
 
 
 // *****************************************************************************
@@ -96,6 +104,9 @@ extern "C" {
 #define DRV_AT24_EEPROM_FLASH_SIZE             (256U)
 #define DRV_AT24_EEPROM_PAGE_SIZE              (16U)
 #define DRV_AT24_WRITE_BUFFER_SIZE             (18)
+#define DRV_AT24_EEPROM_WRITE_CYCLE_TIME_US    (5000U)
+#define DRV_AT24_CACHE_NUM_PAGES               (4U)
+#define DRV_AT24_CACHE_FLUSH_TIMEOUT_MS        (100U)
 
 
 // *****************************************************************************
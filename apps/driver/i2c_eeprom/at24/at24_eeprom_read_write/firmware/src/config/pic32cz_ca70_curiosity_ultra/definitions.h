@@ -53,6 +53,9 @@
 #include "peripheral/pio/plib_pio.h"
 #include "peripheral/nvic/plib_nvic.h"
 #include "peripheral/twihs/master/plib_twihs0_master.h"
+#include "peripheral/xdmac/plib_xdmac.h"
+#include "peripheral/tc/plib_tc0.h"
+#include "system/time/sys_time.h"
 #include "peripheral/efc/plib_efc.h"
 #include "bsp/bsp.h"
 #include "system/int/sys_int.h"
@@ -194,6 +197,8 @@ typedef struct
     /* AT24 Driver Object */
     SYS_MODULE_OBJ drvAT24;
 
+    SYS_MODULE_OBJ  sysTime;
+
 
 } SYSTEM_OBJECTS;
 
@@ -127,6 +127,39 @@ typedef struct
 
 } DRV_AT24_GEOMETRY;
 
+// *****************************************************************************
+/* DRV_AT24 Cache Statistics
+
+ Summary:
+    Defines the data type for the AT24 Driver RAM cache statistics.
+
+ Description:
+    This will be used to get the hit, miss and flush counters of the RAM page
+    cache of the AT24 EEPROM driver.
+
+ Remarks:
+    The counters wrap around on overflow.
+*/
+
+typedef struct
+{
+    /* Reads served entirely from the cache */
+    uint32_t readHits;
+
+    /* Reads that needed an EEPROM transfer */
+    uint32_t readMisses;
+
+    /* Writes merged into cached pages */
+    uint32_t writeHits;
+
+    /* Writes that needed an EEPROM transfer */
+    uint32_t writeMisses;
+
+    /* Page programs issued to write back modified pages */
+    uint32_t flushes;
+
+} DRV_AT24_CACHE_STATS;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: DRV_AT24 Driver Module Interface Routines
@@ -454,7 +487,9 @@ void DRV_AT24_Close(const DRV_HANDLE handle);
     </code>
 
   Remarks:
-    None.
+    If the RAM page cache is enabled and holds all the requested data, the
+    request completes before the function returns and the event handler is
+    called from within this function.
 */
 
 bool DRV_AT24_Read(const DRV_HANDLE handle, void *rxData, uint32_t rxDataLength, uint32_t address );
@@ -519,7 +554,11 @@ bool DRV_AT24_Read(const DRV_HANDLE handle, void *rxData, uint32_t rxDataLength,
     </code>
 
   Remarks:
-    None.
+    If the RAM page cache is enabled and the write falls in cached pages, or
+    overwrites one whole page, the data is only merged into the cache and
+    programmed later by DRV_AT24_CacheFlush or on flush timeout. The request
+    then completes before the function returns and the event handler is
+    called from within this function.
 */
 
 bool DRV_AT24_Write(const DRV_HANDLE handle, void *txData, uint32_t txDataLength, uint32_t address );
@@ -626,6 +665,157 @@ bool DRV_AT24_PageWrite(const DRV_HANDLE handle, void *txData, uint32_t address
 
 DRV_AT24_TRANSFER_STATUS DRV_AT24_TransferStatusGet(const DRV_HANDLE handle);
 
+// *****************************************************************************
+/* Function:
+    bool DRV_AT24_CacheFlush(const DRV_HANDLE handle);
+
+  Summary:
+    Programs the modified pages of the RAM cache to the EEPROM.
+
+  Description:
+    When the RAM page cache is enabled, writes to cached pages are only
+    merged into the cache. This function programs every modified page to the
+    EEPROM, one page program for all the writes merged into a page. Modified
+    pages are also programmed automatically after cacheFlushTimeout
+    milliseconds, if a timeout is configured.
+
+    The flush completes like any other transfer: the status is available
+    through DRV_AT24_TransferStatusGet and the registered event handler is
+    called when the last page has been programmed.
+
+    A flush on timeout is not a client request. It does not change the
+    status returned by DRV_AT24_TransferStatusGet and does not call the
+    event handler. A read, write or flush submitted while it is programming
+    a page is accepted and started as soon as that page program has ended.
+
+  Precondition:
+    DRV_AT24_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+  Returns:
+    false
+    - if handle is invalid
+    - if the cache is not enabled
+    - if the driver is busy handling another transfer request
+
+    true
+    - if the flush request is accepted.
+
+  Example:
+    <code>
+
+    if (DRV_AT24_CacheFlush(myHandle) != false)
+    {
+        while (DRV_AT24_TransferStatusGet(myHandle) == DRV_AT24_TRANSFER_STATUS_BUSY);
+    }
+
+    </code>
+
+  Remarks:
+    If no page is modified, the request completes before the function
+    returns and the event handler is called from within this function.
+*/
+
+bool DRV_AT24_CacheFlush(const DRV_HANDLE handle);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_AT24_CacheInvalidate(const DRV_HANDLE handle);
+
+  Summary:
+    Drops all the pages of the RAM cache.
+
+  Description:
+    This function marks every page of the RAM page cache as not cached, so
+    that the following reads are served from the EEPROM. It is used to read
+    back what has actually been programmed, for example to verify a write.
+    The modified pages must have been programmed by DRV_AT24_CacheFlush
+    before the cache can be invalidated.
+
+  Precondition:
+    DRV_AT24_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+  Returns:
+    false
+    - if handle is invalid
+    - if the cache is not enabled
+    - if the driver is busy handling a transfer request
+    - if a page of the cache is modified and not yet programmed
+
+    true
+    - if the cache is invalidated.
+
+  Example:
+    <code>
+
+    if (DRV_AT24_CacheFlush(myHandle) != false)
+    {
+        while (DRV_AT24_TransferStatusGet(myHandle) == DRV_AT24_TRANSFER_STATUS_BUSY);
+
+        if (DRV_AT24_CacheInvalidate(myHandle) == true)
+        {
+            // Reads now come from the EEPROM
+        }
+    }
+
+    </code>
+
+  Remarks:
+    The function completes immediately, no transfer is started.
+*/
+
+bool DRV_AT24_CacheInvalidate(const DRV_HANDLE handle);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_AT24_CacheStatsGet(const DRV_HANDLE handle, DRV_AT24_CACHE_STATS *stats);
+
+  Summary:
+    Returns the hit, miss and flush counters of the RAM cache.
+
+  Description:
+    This function copies the statistics of the RAM page cache into the
+    structure provided by the client.
+
+  Precondition:
+    DRV_AT24_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+    stats  - Pointer to the structure to copy the statistics into
+
+  Returns:
+    true - if the statistics are copied
+
+    false - if handle is invalid, stats is NULL or the cache is not enabled
+
+  Example:
+    <code>
+
+    DRV_AT24_CACHE_STATS cacheStats;
+
+    if (DRV_AT24_CacheStatsGet(myHandle, &cacheStats) == true)
+    {
+        printf("Read hits: %u, misses: %u\r\n", cacheStats.readHits, cacheStats.readMisses);
+    }
+
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_AT24_CacheStatsGet(const DRV_HANDLE handle, DRV_AT24_CACHE_STATS *stats);
+
 // *****************************************************************************
 /* Function:
     void DRV_AT24_EventHandlerSet(
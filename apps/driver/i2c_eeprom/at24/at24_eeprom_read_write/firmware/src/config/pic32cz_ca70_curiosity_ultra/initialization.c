@@ -78,6 +78,9 @@ static const DRV_AT24_PLIB_INTERFACE drvAT24PlibAPI = {
     /* I2C PLIB WriteRead function */
     .writeRead = (DRV_AT24_PLIB_WRITE_READ)TWIHS0_WriteRead,
 
+    /* I2C PLIB Write with internal (memory) address function */
+    .addressedWrite = (DRV_AT24_PLIB_ADDRESSED_WRITE)TWIHS0_AddressedWrite,
+
     /* I2C PLIB Write function */
     .write_t = (DRV_AT24_PLIB_WRITE)TWIHS0_Write,
 
@@ -95,6 +98,11 @@ static const DRV_AT24_PLIB_INTERFACE drvAT24PlibAPI = {
 };
 
 /* AT24 Driver Initialization Data */
+/* AT24 Driver RAM page cache */
+static DRV_AT24_CACHE_PAGE drvAT24CachePages[DRV_AT24_CACHE_NUM_PAGES];
+
+static uint8_t drvAT24CacheBuffer[DRV_AT24_CACHE_NUM_PAGES * DRV_AT24_EEPROM_PAGE_SIZE];
+
 static const DRV_AT24_INIT drvAT24InitData =
 {
     /* I2C PLIB API  interface*/
@@ -113,7 +121,40 @@ static const DRV_AT24_INIT drvAT24InitData =
     .numClients = DRV_AT24_CLIENTS_NUMBER_IDX,
 
     .blockStartAddress =    0x0,
+
+    /* EEPROM internal write cycle time in microseconds */
+    .writeCycleTime = DRV_AT24_EEPROM_WRITE_CYCLE_TIME_US,
+
+    /* RAM page cache */
+    .cachePages = drvAT24CachePages,
+
+    .cacheBuffer = drvAT24CacheBuffer,
+
+    .cacheNumPages = DRV_AT24_CACHE_NUM_PAGES,
+
+    /* Modified pages are programmed after this many milliseconds */
+    .cacheFlushTimeout = DRV_AT24_CACHE_FLUSH_TIMEOUT_MS,
+};
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="SYS_TIME Initialization Data">
+
+static const SYS_TIME_PLIB_INTERFACE sysTimePlibAPI = {
+    .timerCallbackSet = (SYS_TIME_PLIB_CALLBACK_REGISTER)TC0_CH0_TimerCallbackRegister,
+    .timerStart = (SYS_TIME_PLIB_START)TC0_CH0_TimerStart,
+    .timerStop = (SYS_TIME_PLIB_STOP)TC0_CH0_TimerStop ,
+    .timerFrequencyGet = (SYS_TIME_PLIB_FREQUENCY_GET)TC0_CH0_TimerFrequencyGet,
+    .timerPeriodSet = (SYS_TIME_PLIB_PERIOD_SET)TC0_CH0_TimerPeriodSet,
+    .timerCompareSet = (SYS_TIME_PLIB_COMPARE_SET)TC0_CH0_TimerCompareSet,
+    .timerCounterGet = (SYS_TIME_PLIB_COUNTER_GET)TC0_CH0_TimerCounterGet,
 };
+
+static const SYS_TIME_INIT sysTimeInitData =
+{
+    .timePlib = &sysTimePlibAPI,
+    .hwTimerIntNum = TC0_CH0_IRQn,
+};
+
 // </editor-fold>
 
 
@@ -171,6 +212,8 @@ void SYS_Initialize ( void* data )
     CLOCK_Initialize();
 	PIO_Initialize();
 
+    XDMAC_Initialize();
+
 
 
 	RSWDT_REGS->RSWDT_MR = RSWDT_MR_WDDIS_Msk;	// Disable RSWDT 
@@ -178,6 +221,9 @@ void SYS_Initialize ( void* data )
 	WDT_REGS->WDT_MR = WDT_MR_WDDIS_Msk; 		// Disable WDT 
 
 	TWIHS0_Initialize();
+ 
+    TC0_CH0_TimerInitialize(); 
+     
 
 	BSP_Initialize();
 
@@ -188,6 +234,12 @@ void SYS_Initialize ( void* data )
 
     sysObj.drvAT24 = DRV_AT24_Initialize(DRV_AT24_INDEX, (SYS_MODULE_INIT *)&drvAT24InitData);
 
+    /* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -  
+    H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1*/
+        
+    sysObj.sysTime = SYS_TIME_Initialize(SYS_TIME_INDEX_0, (SYS_MODULE_INIT *)&sysTimeInitData);
+    
+    /* MISRAC 2012 deviation block end */
 
 
 
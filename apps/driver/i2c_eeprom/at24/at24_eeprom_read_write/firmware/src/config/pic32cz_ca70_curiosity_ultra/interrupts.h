@@ -64,6 +64,8 @@ void BusFault_Handler (void);
 void UsageFault_Handler (void);
 void DebugMonitor_Handler (void);
 void TWIHS0_InterruptHandler (void);
+void TC0_CH0_InterruptHandler (void);
+void XDMAC_InterruptHandler (void);
 
 
 
@@ -81,12 +81,16 @@ bool TWIHS0_Write( uint16_t address, uint8_t *pdata, size_t length );
 
 bool TWIHS0_WriteRead( uint16_t address, uint8_t *wdata, size_t wlength, uint8_t *rdata, size_t rlength );
 
+bool TWIHS0_AddressedWrite( uint16_t address, uint32_t internalAddress, uint8_t internalAddressSize, uint8_t *pdata, size_t length );
+
 TWIHS_ERROR TWIHS0_ErrorGet( void );
 
 bool TWIHS0_TransferSetup( TWIHS_TRANSFER_SETUP* setup, uint32_t srcClkFreq );
 
 void TWIHS0_TransferAbort( void );
 
+void TWIHS0_TransferStatisticsGet( TWIHS_TRANSFER_STATISTICS* statistics );
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
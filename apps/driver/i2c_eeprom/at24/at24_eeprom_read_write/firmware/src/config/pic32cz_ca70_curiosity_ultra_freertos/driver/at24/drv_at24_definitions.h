@@ -81,6 +81,8 @@ typedef bool (* DRV_AT24_PLIB_WRITE_READ)(uint16_t address, uint8_t *wdata, uint
 
 typedef bool (* DRV_AT24_PLIB_WRITE)(uint16_t address, uint8_t *pdata, uint32_t length);
 
+typedef bool (* DRV_AT24_PLIB_ADDRESSED_WRITE)(uint16_t address, uint32_t memAddress, uint8_t memAddressSize, uint8_t *pdata, uint32_t length);
+
 typedef bool (* DRV_AT24_PLIB_READ)(uint16_t address, uint8_t *pdata, uint32_t length);
 
 typedef bool (* DRV_AT24_PLIB_IS_BUSY)(void);
@@ -111,6 +113,9 @@ typedef struct
     /* AT24 PLIB write API */
     DRV_AT24_PLIB_WRITE                     write_t;
 
+    /* AT24 PLIB write API that sends the memory address ahead of the data */
+    DRV_AT24_PLIB_ADDRESSED_WRITE           addressedWrite;
+
     /* AT24 PLIB read API */
     DRV_AT24_PLIB_READ                      read_t;
 
@@ -125,6 +130,45 @@ typedef struct
 
 } DRV_AT24_PLIB_INTERFACE;
 
+// *****************************************************************************
+/* AT24 Driver Cache Page
+
+  Summary:
+    Defines the bookkeeping data of one page of the AT24 driver RAM cache.
+
+  Description:
+    The application allocates an array of these objects, together with a data
+    buffer of (cacheNumPages * pageSize) bytes, and passes both to the driver
+    through the initialization data. The members are owned by the driver.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Cached copy of the EEPROM page */
+    uint8_t*                            data;
+
+    /* EEPROM address of the first byte of the page */
+    uint32_t                            address;
+
+    /* Value of the cache use counter when the page was last accessed */
+    uint32_t                            lastUsed;
+
+    /* Modified byte range [dirtyStart, dirtyEnd) that is yet to be programmed */
+    uint32_t                            dirtyStart;
+
+    uint32_t                            dirtyEnd;
+
+    /* Page holds the EEPROM contents */
+    bool                                isValid;
+
+    /* Page holds data that is yet to be programmed */
+    bool                                isDirty;
+
+} DRV_AT24_CACHE_PAGE;
+
 // *****************************************************************************
 /* AT24 Driver Initialization Data
 
@@ -158,6 +202,22 @@ typedef struct
 
     uint32_t                            blockStartAddress;
 
+    /* EEPROM internal write cycle time (tWR) in microseconds */
+    uint32_t                            writeCycleTime;
+
+    /* Bookkeeping array of the RAM page cache, NULL if the cache is not used */
+    DRV_AT24_CACHE_PAGE*                cachePages;
+
+    /* Data buffer of the RAM page cache, cacheNumPages * pageSize bytes */
+    uint8_t*                            cacheBuffer;
+
+    /* Number of pages in the RAM page cache, 0 disables the cache */
+    uint32_t                            cacheNumPages;
+
+    /* Time (in milliseconds) after which modified pages are programmed to
+     * the EEPROM, 0 if they are programmed only by DRV_AT24_CacheFlush */
+    uint32_t                            cacheFlushTimeout;
+
 } DRV_AT24_INIT;
 
 
@@ -45,8 +45,13 @@
 // Section: Include Files
 // *****************************************************************************
 // *****************************************************************************
+#include <string.h>
 #include "configuration.h"
 #include "driver/at24/drv_at24.h"
+#include "system/int/sys_int.h"
+
+/* Number of ACK poll timer ticks in one EEPROM write cycle time (tWR) */
+#define DRV_AT24_ACK_POLL_TICKS_PER_TWR     (8U)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -81,6 +86,129 @@ static uint8_t lDRV_AT24_ReadStatus(void)
     return (0U);
 }
 
+static bool lDRV_AT24_CacheTransferComplete(void);
+
+/* Ends the client request with the given status and notifies the client */
+static void lDRV_AT24_ClientRequestComplete(DRV_AT24_TRANSFER_STATUS status)
+{
+    gDrvAT24Obj.clientStatus = status;
+
+    if (gDrvAT24Obj.eventHandler != NULL)
+    {
+        gDrvAT24Obj.eventHandler(status, gDrvAT24Obj.context);
+    }
+}
+
+static void lDRV_AT24_EventNotify(void)
+{
+    /* If transfer is complete, notify the application */
+    if (gDrvAT24Obj.transferStatus != DRV_AT24_TRANSFER_STATUS_BUSY)
+    {
+        if ((gDrvAT24Obj.cacheOp != DRV_AT24_CACHE_OP_NONE) && (lDRV_AT24_CacheTransferComplete() == false))
+        {
+            /* Transfer was internal to the cache */
+        }
+        else
+        {
+            lDRV_AT24_ClientRequestComplete(gDrvAT24Obj.transferStatus);
+        }
+    }
+}
+
+/**
+  * Called by SYS_TIME every tWR/8 while a write request is in progress. Counts
+  * down to the next ACK poll and releases the timer once the request has ended.
+  */
+static void lDRV_AT24_AckPollTimerHandler(uintptr_t context)
+{
+    if (gDrvAT24Obj.ackPollTimer == SYS_TIME_HANDLE_INVALID)
+    {
+        /* SYS_TIME_CallbackRegisterUS has not returned the handle of this
+         * timer yet. The request is busy, so there is nothing to do. */
+    }
+    else if ((gDrvAT24Obj.clientStatus != DRV_AT24_TRANSFER_STATUS_BUSY) && \
+            (gDrvAT24Obj.isCacheFlushBusy == false))
+    {
+        (void) SYS_TIME_TimerDestroy(gDrvAT24Obj.ackPollTimer);
+        gDrvAT24Obj.ackPollTimer = SYS_TIME_HANDLE_INVALID;
+    }
+    else if (gDrvAT24Obj.ackPollTicks != 0U)
+    {
+        gDrvAT24Obj.ackPollTicks--;
+
+        if ((gDrvAT24Obj.ackPollTicks == 0U) && (lDRV_AT24_ReadStatus() == 0U))
+        {
+            gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
+
+            lDRV_AT24_EventNotify();
+        }
+    }
+    else
+    {
+        /* Data or ACK poll transfer is on the bus, nothing to do */
+    }
+}
+
+/**
+  * Starts the ACK poll timer for a new write request. SYS_TIME may not be
+  * called from the I2C interrupt context, so the timer is started here from
+  * the client's context and left running until the request ends. If no timer
+  * is available, the EEPROM is polled back to back.
+  * The caller marks the request busy, clientStatus for a client request or
+  * isCacheFlushBusy for a flush on timeout, before the timer is registered.
+  * Otherwise the timer could find the driver idle and release itself before
+  * the write is submitted. A queued request started by the I2C interrupt
+  * finds the timer still running from the flush it was queued behind.
+  */
+static void lDRV_AT24_AckPollTimerStart(void)
+{
+    if ((gDrvAT24Obj.ackPollTimer == SYS_TIME_HANDLE_INVALID) && \
+            (gDrvAT24Obj.writeCycleTime >= DRV_AT24_ACK_POLL_TICKS_PER_TWR) && \
+            (gDrvAT24Obj.isCachePendingStart == false))
+    {
+        gDrvAT24Obj.ackPollTicks = 0U;
+
+        gDrvAT24Obj.ackPollTimer = SYS_TIME_CallbackRegisterUS(lDRV_AT24_AckPollTimerHandler, 0, \
+                (gDrvAT24Obj.writeCycleTime / DRV_AT24_ACK_POLL_TICKS_PER_TWR), SYS_TIME_PERIODIC);
+    }
+}
+
+/**
+  * Schedules the next ACK poll of the EEPROM internal write cycle. The bus is
+  * left idle until then. The first poll is done after tWR, by when the write
+  * cycle has usually ended. If the EEPROM is still busy, the poll is retried
+  * with a delay that starts at tWR/8 and doubles up to tWR.
+  * Returns false if the poll could not be submitted.
+  */
+static bool lDRV_AT24_AckPollSchedule(bool isFirstPoll)
+{
+    gDrvAT24Obj.command = DRV_AT24_CMD_WAIT_WRITE_COMPLETE;
+
+    if (gDrvAT24Obj.ackPollTimer == SYS_TIME_HANDLE_INVALID)
+    {
+        /* No timer available, poll right away */
+        return (lDRV_AT24_ReadStatus() != 0U);
+    }
+
+    if (isFirstPoll == true)
+    {
+        /* The timer phase is arbitrary, one extra tick makes sure tWR has elapsed */
+        gDrvAT24Obj.ackPollBackoff = 1U;
+        gDrvAT24Obj.ackPollTicks = DRV_AT24_ACK_POLL_TICKS_PER_TWR + 1U;
+    }
+    else
+    {
+        gDrvAT24Obj.ackPollTicks = gDrvAT24Obj.ackPollBackoff;
+
+        if (gDrvAT24Obj.ackPollBackoff < DRV_AT24_ACK_POLL_TICKS_PER_TWR)
+        {
+            gDrvAT24Obj.ackPollBackoff <<= 1;
+        }
+    }
+
+    return true;
+}
+
 static bool lDRV_AT24_Write(
     void* txData,
     uint32_t txDataLength,
@@ -89,9 +217,8 @@ static bool lDRV_AT24_Write(
 {
     bool isRequestAccepted = false;
     uint32_t nTransferBytes = 0;
-    uint32_t nBytes = 0;
+    uint8_t memAddrSize = 1U;
     uint16_t slaveAddr;
-    uint16_t i;
 
     if ((address + txDataLength) > gDrvAT24Obj.flashSize)
     {
@@ -118,6 +245,54 @@ static bool lDRV_AT24_Write(
         slaveAddr |= ((uint16_t)((unsigned char*)&address)[2] & 0x01U);
     }
     if (gDrvAT24Obj.flashSize > 256U)       /* For 16-bit address */
+    {
+        memAddrSize = 2U;
+    }
+
+    gDrvAT24Obj.nextMemoryAddr = address + nTransferBytes;
+    gDrvAT24Obj.nextBufferAddr = (uint8_t *)((uint8_t*)txData + nTransferBytes);
+    gDrvAT24Obj.nPendingBytes = txDataLength - nTransferBytes;
+
+    gDrvAT24Obj.command = DRV_AT24_CMD_WRITE;
+
+    /* Submit a write request to I2C PLIB. The PLIB sends the memory address
+     * ahead of the data, so the data goes out of the client buffer as is. */
+    if (gDrvAT24Obj.i2cPlib->addressedWrite(slaveAddr, (address & 0x0000FFFFU), \
+            memAddrSize, (uint8_t*)txData, nTransferBytes))
+    {
+        isRequestAccepted = true;
+    }
+    else
+    {
+        gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
+    }
+
+    return isRequestAccepted;
+}
+
+static bool lDRV_AT24_Read(
+    void* rxData,
+    uint32_t rxDataLength,
+    uint32_t address
+)
+{
+    bool isRequestAccepted = false;
+    uint32_t nBytes = 0;
+    uint16_t slaveAddr;
+
+    gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_BUSY;
+
+    /* Frame the EEPROM address */
+    slaveAddr = gDrvAT24Obj.slaveAddress;
+    if (gDrvAT24Obj.flashSize > 131072U)    /* For 18-bit address */
+    {
+        slaveAddr |= ((uint16_t)((unsigned char*)&address)[2] & 0x02U);
+    }
+    if (gDrvAT24Obj.flashSize > 65536U)     /* For 17-bit address */
+    {
+        slaveAddr |= ((uint16_t)((unsigned char*)&address)[2] & 0x01U);
+    }
+    if (gDrvAT24Obj.flashSize > 256U)       /* For 16-bit address */
     {
         gDrvAT24Obj.writeBuffer[nBytes] = (uint8_t)((address & 0x0000FF00U) >> 8);
         nBytes++;
@@ -125,30 +300,543 @@ static bool lDRV_AT24_Write(
     /* For 8-bit address */
     gDrvAT24Obj.writeBuffer[nBytes] = (uint8_t)((address & 0x000000FFU));
     nBytes++;
+    
+    gDrvAT24Obj.command = DRV_AT24_CMD_READ;
 
-    for (i = 0 ; i < nTransferBytes; i++)
+    if(gDrvAT24Obj.i2cPlib->writeRead(slaveAddr, \
+            (uint8_t*)gDrvAT24Obj.writeBuffer, nBytes, rxData, rxDataLength))
+    {
+        isRequestAccepted = true;
+    }
+    else
     {
-        gDrvAT24Obj.writeBuffer[nBytes + i] = ((uint8_t*)txData)[i];
+        gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
     }
 
-    gDrvAT24Obj.nextMemoryAddr = address + nTransferBytes;
-    gDrvAT24Obj.nextBufferAddr = (uint8_t *)((uint8_t*)txData + nTransferBytes);
-    gDrvAT24Obj.nPendingBytes = txDataLength - nTransferBytes;
+    return isRequestAccepted;
+}
 
-    gDrvAT24Obj.command = DRV_AT24_CMD_WRITE;
+/* Returns the cached page holding the given address, NULL if it is not cached */
+static DRV_AT24_CACHE_PAGE* lDRV_AT24_CachePageGet(uint32_t address)
+{
+    uint32_t i;
+    uint32_t pageAddr = address - (address % gDrvAT24Obj.pageSize);
 
-    /* Submit a write request to I2C PLIB */
-    if (gDrvAT24Obj.i2cPlib->write_t(slaveAddr, \
-            (uint8_t*)gDrvAT24Obj.writeBuffer, (nBytes + nTransferBytes)))
+    for (i = 0; i < gDrvAT24Obj.cacheNumPages; i++)
     {
-        isRequestAccepted = true;
+        if ((gDrvAT24Obj.cachePages[i].isValid == true) && (gDrvAT24Obj.cachePages[i].address == pageAddr))
+        {
+            return &gDrvAT24Obj.cachePages[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Returns a free page, or else the least recently used clean page. Dirty
+ * pages are never evicted, NULL is returned if all the pages are dirty. */
+static DRV_AT24_CACHE_PAGE* lDRV_AT24_CachePageAllocate(uint32_t address)
+{
+    DRV_AT24_CACHE_PAGE* page;
+    DRV_AT24_CACHE_PAGE* victim = NULL;
+    uint32_t i;
+
+    for (i = 0; i < gDrvAT24Obj.cacheNumPages; i++)
+    {
+        page = &gDrvAT24Obj.cachePages[i];
+
+        if (page->isValid == false)
+        {
+            victim = page;
+            break;
+        }
+        if ((page->isDirty == false) && ((victim == NULL) || \
+                ((gDrvAT24Obj.cacheUseCount - page->lastUsed) > (gDrvAT24Obj.cacheUseCount - victim->lastUsed))))
+        {
+            victim = page;
+        }
+    }
+
+    if (victim != NULL)
+    {
+        victim->isValid = false;
+        victim->isDirty = false;
+        victim->address = address - (address % gDrvAT24Obj.pageSize);
+    }
+
+    return victim;
+}
+
+/* Returns the first page that is yet to be programmed, NULL if there is none */
+static DRV_AT24_CACHE_PAGE* lDRV_AT24_CacheDirtyPageGet(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < gDrvAT24Obj.cacheNumPages; i++)
+    {
+        if (gDrvAT24Obj.cachePages[i].isDirty == true)
+        {
+            return &gDrvAT24Obj.cachePages[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Copies data between the client buffer and the cached pages. If any page
+ * of the address range is not cached, nothing is copied and false is returned. */
+static bool lDRV_AT24_CacheAccess(uint8_t* buffer, uint32_t length, uint32_t address, bool isWrite)
+{
+    DRV_AT24_CACHE_PAGE* page;
+    uint32_t offset;
+    uint32_t pageOffset;
+    uint32_t nBytes = 0;
+
+    for (offset = 0; offset < length; offset += nBytes)
+    {
+        pageOffset = (address + offset) % gDrvAT24Obj.pageSize;
+        nBytes = gDrvAT24Obj.pageSize - pageOffset;
+        nBytes = (length - offset) >= nBytes? nBytes: (length - offset);
+
+        if (lDRV_AT24_CachePageGet(address + offset) == NULL)
+        {
+            return false;
+        }
+    }
+
+    for (offset = 0; offset < length; offset += nBytes)
+    {
+        pageOffset = (address + offset) % gDrvAT24Obj.pageSize;
+        nBytes = gDrvAT24Obj.pageSize - pageOffset;
+        nBytes = (length - offset) >= nBytes? nBytes: (length - offset);
+
+        page = lDRV_AT24_CachePageGet(address + offset);
+
+        if (isWrite == true)
+        {
+            (void) memcpy(&page->data[pageOffset], &buffer[offset], nBytes);
+
+            /* Grow the dirty range so that one page program covers all the writes */
+            if (page->isDirty == false)
+            {
+                page->dirtyStart = pageOffset;
+                page->dirtyEnd = pageOffset + nBytes;
+                page->isDirty = true;
+            }
+            else
+            {
+                page->dirtyStart = (pageOffset < page->dirtyStart)? pageOffset: page->dirtyStart;
+                page->dirtyEnd = ((pageOffset + nBytes) > page->dirtyEnd)? (pageOffset + nBytes): page->dirtyEnd;
+            }
+        }
+        else
+        {
+            (void) memcpy(&buffer[offset], &page->data[pageOffset], nBytes);
+        }
+
+        gDrvAT24Obj.cacheUseCount++;
+        page->lastUsed = gDrvAT24Obj.cacheUseCount;
+    }
+
+    return true;
+}
+
+/* Copies the overlapping part of every cached page into the buffer of a
+ * completed read, or the written data into the cached pages after a write,
+ * so that the client and the cache always see the latest data. */
+static void lDRV_AT24_CacheSync(uint8_t* buffer, uint32_t length, uint32_t address, bool isWrite)
+{
+    DRV_AT24_CACHE_PAGE* page;
+    uint32_t startAddr;
+    uint32_t endAddr;
+    uint32_t i;
+
+    for (i = 0; i < gDrvAT24Obj.cacheNumPages; i++)
+    {
+        page = &gDrvAT24Obj.cachePages[i];
+
+        if (page->isValid == false)
+        {
+            continue;
+        }
+
+        startAddr = (page->address > address)? page->address: address;
+        endAddr = ((page->address + gDrvAT24Obj.pageSize) < (address + length))? \
+                (page->address + gDrvAT24Obj.pageSize): (address + length);
+
+        if (startAddr < endAddr)
+        {
+            if (isWrite == true)
+            {
+                (void) memcpy(&page->data[startAddr - page->address], &buffer[startAddr - address], (endAddr - startAddr));
+            }
+            else
+            {
+                (void) memcpy(&buffer[startAddr - address], &page->data[startAddr - page->address], (endAddr - startAddr));
+            }
+        }
+    }
+}
+
+/* Submits the page program of the dirty range of a cached page */
+static bool lDRV_AT24_CacheFlushPage(DRV_AT24_CACHE_PAGE* page, DRV_AT24_CACHE_OP cacheOp)
+{
+    gDrvAT24Obj.cacheOp = cacheOp;
+    gDrvAT24Obj.cachePage = page;
+
+    if (lDRV_AT24_Write(&page->data[page->dirtyStart], (page->dirtyEnd - page->dirtyStart), \
+            (page->address + page->dirtyStart)) == false)
+    {
+        gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_NONE;
+        return false;
+    }
+
+    return true;
+}
+
+static void lDRV_AT24_CacheFlushTimerStart(void);
+
+/* Called by SYS_TIME when the flush timeout has expired */
+static void lDRV_AT24_CacheFlushTimerHandler(uintptr_t context)
+{
+    DRV_AT24_CACHE_PAGE* page;
+
+    gDrvAT24Obj.cacheFlushTimer = SYS_TIME_HANDLE_INVALID;
+
+    if ((gDrvAT24Obj.isClientCall == true) || (gDrvAT24Obj.transferStatus == DRV_AT24_TRANSFER_STATUS_BUSY))
+    {
+        /* Driver is in use, try again after another timeout period */
+        lDRV_AT24_CacheFlushTimerStart();
     }
     else
     {
-        gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
+        page = lDRV_AT24_CacheDirtyPageGet();
+
+        if (page != NULL)
+        {
+            /* The client status is left as is, client requests submitted
+             * meanwhile are queued until the page program has ended */
+            gDrvAT24Obj.isCacheFlushBusy = true;
+
+            lDRV_AT24_AckPollTimerStart();
+
+            if (lDRV_AT24_CacheFlushPage(page, DRV_AT24_CACHE_OP_FLUSH_TIMEOUT) == false)
+            {
+                gDrvAT24Obj.isCacheFlushBusy = false;
+            }
+        }
     }
+}
 
-    return isRequestAccepted;
+/* Starts the flush timeout, unless it is already running. SYS_TIME may not be
+ * called from the I2C interrupt context, so this is only called from the
+ * client's context and from the flush timer callback. A queued request
+ * started by the I2C interrupt had the timer started when it was queued. */
+static void lDRV_AT24_CacheFlushTimerStart(void)
+{
+    if ((gDrvAT24Obj.cacheFlushTimeout != 0U) && (gDrvAT24Obj.cacheFlushTimer == SYS_TIME_HANDLE_INVALID) \
+            && (gDrvAT24Obj.isCachePendingStart == false))
+    {
+        gDrvAT24Obj.cacheFlushTimer = SYS_TIME_CallbackRegisterMS(lDRV_AT24_CacheFlushTimerHandler, 0, \
+                gDrvAT24Obj.cacheFlushTimeout, SYS_TIME_SINGLE);
+    }
+}
+
+/* Serves a client read from the cache, or reads the page into the cache */
+static bool lDRV_AT24_CacheRead(uint8_t* rxData, uint32_t rxDataLength, uint32_t address)
+{
+    DRV_AT24_CACHE_PAGE* page = NULL;
+    bool status = false;
+
+    if (lDRV_AT24_CacheAccess(rxData, rxDataLength, address, false) == true)
+    {
+        gDrvAT24Obj.cacheStats.readHits++;
+
+        lDRV_AT24_ClientRequestComplete(DRV_AT24_TRANSFER_STATUS_COMPLETED);
+
+        return true;
+    }
+
+    gDrvAT24Obj.cacheStats.readMisses++;
+
+    gDrvAT24Obj.cacheClientBuffer = rxData;
+    gDrvAT24Obj.cacheClientLength = rxDataLength;
+    gDrvAT24Obj.cacheClientAddr = address;
+
+    /* Reads within one page bring the whole page into the cache */
+    if (((address % gDrvAT24Obj.pageSize) + rxDataLength) <= gDrvAT24Obj.pageSize)
+    {
+        page = lDRV_AT24_CachePageAllocate(address);
+    }
+
+    if (page != NULL)
+    {
+        gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_FILL_READ;
+        gDrvAT24Obj.cachePage = page;
+
+        status = lDRV_AT24_Read(page->data, gDrvAT24Obj.pageSize, page->address);
+    }
+    else
+    {
+        gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_READ;
+
+        status = lDRV_AT24_Read(rxData, rxDataLength, address);
+    }
+
+    if (status == false)
+    {
+        gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_NONE;
+    }
+
+    return status;
+}
+
+/* Merges a client write into the cache, or writes it through to the EEPROM */
+static bool lDRV_AT24_CacheWrite(uint8_t* txData, uint32_t txDataLength, uint32_t address)
+{
+    DRV_AT24_CACHE_PAGE* page = NULL;
+    bool status = false;
+
+    if (lDRV_AT24_CacheAccess(txData, txDataLength, address, true) == true)
+    {
+        gDrvAT24Obj.cacheStats.writeHits++;
+
+        lDRV_AT24_CacheFlushTimerStart();
+
+        lDRV_AT24_ClientRequestComplete(DRV_AT24_TRANSFER_STATUS_COMPLETED);
+
+        return true;
+    }
+
+    gDrvAT24Obj.cacheStats.writeMisses++;
+
+    gDrvAT24Obj.cacheClientBuffer = txData;
+    gDrvAT24Obj.cacheClientLength = txDataLength;
+    gDrvAT24Obj.cacheClientAddr = address;
+
+    /* Writes within one page are merged into a cached copy of the page */
+    if (((address % gDrvAT24Obj.pageSize) + txDataLength) <= gDrvAT24Obj.pageSize)
+    {
+        page = lDRV_AT24_CachePageAllocate(address);
+    }
+
+    if (page == NULL)
+    {
+        gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_WRITE;
+
+        lDRV_AT24_AckPollTimerStart();
+
+        status = lDRV_AT24_Write(txData, txDataLength, address);
+    }
+    else if (txDataLength == gDrvAT24Obj.pageSize)
+    {
+        /* The whole page is overwritten, there is nothing to read */
+        page->isValid = true;
+
+        (void) lDRV_AT24_CacheAccess(txData, txDataLength, address, true);
+
+        lDRV_AT24_CacheFlushTimerStart();
+
+        lDRV_AT24_ClientRequestComplete(DRV_AT24_TRANSFER_STATUS_COMPLETED);
+
+        return true;
+    }
+    else
+    {
+        gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_FILL_WRITE;
+        gDrvAT24Obj.cachePage = page;
+
+        /* Page turns dirty once the read completes, start the timeout now
+         * as the timer can not be started from the interrupt context */
+        lDRV_AT24_CacheFlushTimerStart();
+
+        status = lDRV_AT24_Read(page->data, gDrvAT24Obj.pageSize, page->address);
+    }
+
+    if (status == false)
+    {
+        gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_NONE;
+    }
+
+    return status;
+}
+
+/* Starts a client read, write or flush on the cache */
+static bool lDRV_AT24_CacheRequestStart(DRV_AT24_CACHE_OP request, uint8_t* buffer, uint32_t length, uint32_t address)
+{
+    DRV_AT24_CACHE_PAGE* page;
+    bool status = true;
+
+    switch (request)
+    {
+        case DRV_AT24_CACHE_OP_READ:
+            status = lDRV_AT24_CacheRead(buffer, length, address);
+            break;
+
+        case DRV_AT24_CACHE_OP_WRITE:
+            status = lDRV_AT24_CacheWrite(buffer, length, address);
+            break;
+
+        default:
+            page = lDRV_AT24_CacheDirtyPageGet();
+
+            if (page != NULL)
+            {
+                lDRV_AT24_AckPollTimerStart();
+
+                status = lDRV_AT24_CacheFlushPage(page, DRV_AT24_CACHE_OP_FLUSH);
+            }
+            else
+            {
+                /* Nothing to program */
+                lDRV_AT24_ClientRequestComplete(DRV_AT24_TRANSFER_STATUS_COMPLETED);
+            }
+            break;
+    }
+
+    return status;
+}
+
+/* Submits a client request on the cache. While a flush on timeout is on the
+ * bus the request is queued instead, and started by the I2C interrupt as soon
+ * as the page program has ended. Called from the client's context only. */
+static bool lDRV_AT24_CacheRequestSubmit(DRV_AT24_CACHE_OP request, uint8_t* buffer, uint32_t length, uint32_t address)
+{
+    bool interruptState;
+    bool isQueued = false;
+    bool status = true;
+
+    gDrvAT24Obj.clientStatus = DRV_AT24_TRANSFER_STATUS_BUSY;
+
+    interruptState = SYS_INT_Disable();
+
+    if (gDrvAT24Obj.isCacheFlushBusy == true)
+    {
+        gDrvAT24Obj.cachePendingBuffer = buffer;
+        gDrvAT24Obj.cachePendingLength = length;
+        gDrvAT24Obj.cachePendingAddr = address;
+        gDrvAT24Obj.cachePendingOp = request;
+
+        isQueued = true;
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    if (isQueued == true)
+    {
+        /* The flush stops after the current page, restart the timeout for
+         * the pages it leaves behind and for the pages this request dirties */
+        lDRV_AT24_CacheFlushTimerStart();
+    }
+    else
+    {
+        status = lDRV_AT24_CacheRequestStart(request, buffer, length, address);
+    }
+
+    if (status == false)
+    {
+        gDrvAT24Obj.clientStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
+    }
+
+    return status;
+}
+
+/* Starts the client request queued behind a flush on timeout, if any. Called
+ * from the I2C interrupt once the flush has released the bus. */
+static void lDRV_AT24_CachePendingStart(void)
+{
+    DRV_AT24_CACHE_OP request = gDrvAT24Obj.cachePendingOp;
+    bool status;
+
+    if (request != DRV_AT24_CACHE_OP_NONE)
+    {
+        gDrvAT24Obj.cachePendingOp = DRV_AT24_CACHE_OP_NONE;
+
+        gDrvAT24Obj.isCachePendingStart = true;
+
+        status = lDRV_AT24_CacheRequestStart(request, gDrvAT24Obj.cachePendingBuffer, \
+                gDrvAT24Obj.cachePendingLength, gDrvAT24Obj.cachePendingAddr);
+
+        gDrvAT24Obj.isCachePendingStart = false;
+
+        if (status == false)
+        {
+            lDRV_AT24_ClientRequestComplete(DRV_AT24_TRANSFER_STATUS_ERROR);
+        }
+    }
+}
+
+/* Called when a transfer that involves the cache has ended. Continues a
+ * flush with the next dirty page. Returns true if the client must be
+ * notified of the end of its request. */
+static bool lDRV_AT24_CacheTransferComplete(void)
+{
+    DRV_AT24_CACHE_OP cacheOp = gDrvAT24Obj.cacheOp;
+    DRV_AT24_CACHE_PAGE* page = gDrvAT24Obj.cachePage;
+    bool isTransferOk = (gDrvAT24Obj.transferStatus == DRV_AT24_TRANSFER_STATUS_COMPLETED);
+    bool notifyClient = true;
+
+    gDrvAT24Obj.cacheOp = DRV_AT24_CACHE_OP_NONE;
+
+    switch (cacheOp)
+    {
+        case DRV_AT24_CACHE_OP_READ:
+        case DRV_AT24_CACHE_OP_WRITE:
+            if (isTransferOk == true)
+            {
+                lDRV_AT24_CacheSync(gDrvAT24Obj.cacheClientBuffer, gDrvAT24Obj.cacheClientLength, \
+                        gDrvAT24Obj.cacheClientAddr, (cacheOp == DRV_AT24_CACHE_OP_WRITE));
+            }
+            break;
+
+        case DRV_AT24_CACHE_OP_FILL_READ:
+        case DRV_AT24_CACHE_OP_FILL_WRITE:
+            if (isTransferOk == true)
+            {
+                page->isValid = true;
+
+                (void) lDRV_AT24_CacheAccess(gDrvAT24Obj.cacheClientBuffer, gDrvAT24Obj.cacheClientLength, \
+                        gDrvAT24Obj.cacheClientAddr, (cacheOp == DRV_AT24_CACHE_OP_FILL_WRITE));
+            }
+            break;
+
+        case DRV_AT24_CACHE_OP_FLUSH:
+        case DRV_AT24_CACHE_OP_FLUSH_TIMEOUT:
+            if (isTransferOk == true)
+            {
+                page->isDirty = false;
+                gDrvAT24Obj.cacheStats.flushes++;
+
+                page = lDRV_AT24_CacheDirtyPageGet();
+
+                /* A client request queued behind a flush on timeout goes
+                 * first, the remaining pages wait for the next timeout */
+                if ((page != NULL) && ((cacheOp == DRV_AT24_CACHE_OP_FLUSH) || \
+                        (gDrvAT24Obj.cachePendingOp == DRV_AT24_CACHE_OP_NONE)) && \
+                        (lDRV_AT24_CacheFlushPage(page, cacheOp) == true))
+                {
+                    /* Flush continues with the next page */
+                    return false;
+                }
+            }
+
+            if (cacheOp == DRV_AT24_CACHE_OP_FLUSH_TIMEOUT)
+            {
+                /* The client did not request this flush. Pages that failed
+                 * to program stay dirty and are retried on the next flush. */
+                gDrvAT24Obj.isCacheFlushBusy = false;
+                notifyClient = false;
+
+                lDRV_AT24_CachePendingStart();
+            }
+            break;
+
+        default:
+                /* Nothing to do */
+            break;
+    }
+
+    return notifyClient;
 }
 
 static void lDRV_AT24_Handler(DRV_AT24_I2C_ERROR transferStatus)
@@ -158,15 +846,11 @@ static void lDRV_AT24_Handler(DRV_AT24_I2C_ERROR transferStatus)
         case DRV_AT24_CMD_WRITE:
             if (transferStatus == DRV_AT24_I2C_ERROR_NONE)
             {
-                /* Read the status of EEPROM internal write cycle */
-                if (lDRV_AT24_ReadStatus() == 0U)
+                /* Read the status of EEPROM internal write cycle after tWR */
+                if (lDRV_AT24_AckPollSchedule(true) == false)
                 {
                     gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
                 }
-                else
-                {
-                    gDrvAT24Obj.command = DRV_AT24_CMD_WAIT_WRITE_COMPLETE;
-                }
             }
             else
             {
@@ -194,7 +878,7 @@ static void lDRV_AT24_Handler(DRV_AT24_I2C_ERROR transferStatus)
             else
             {
                 /* Keep reading the status of EEPROM internal write cycle */
-                if (lDRV_AT24_ReadStatus() == 0U)
+                if (lDRV_AT24_AckPollSchedule(false) == false)
                 {
                     gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
                 }
@@ -222,14 +906,7 @@ static void lI2CEventHandler(uintptr_t context )
 {
     lDRV_AT24_Handler(gDrvAT24Obj.i2cPlib->errorGet());
 
-    /* If transfer is complete, notify the application */
-    if (gDrvAT24Obj.transferStatus != DRV_AT24_TRANSFER_STATUS_BUSY)
-    {
-        if (gDrvAT24Obj.eventHandler != NULL)
-        {
-            gDrvAT24Obj.eventHandler(gDrvAT24Obj.transferStatus, gDrvAT24Obj.context);
-        }
-    }
+    lDRV_AT24_EventNotify();
 }
 
 // *****************************************************************************
@@ -247,6 +924,7 @@ SYS_MODULE_OBJ DRV_AT24_Initialize(
 /* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -  H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1*/
 
     DRV_AT24_INIT *at24Init = (DRV_AT24_INIT *)init;
+    uint32_t i;
     
 /* MISRAC 2012 deviation block end */
 
@@ -265,6 +943,7 @@ SYS_MODULE_OBJ DRV_AT24_Initialize(
     gDrvAT24Obj.inUse                      = true;
     gDrvAT24Obj.nClients                   = 0;
     gDrvAT24Obj.transferStatus             = DRV_AT24_TRANSFER_STATUS_ERROR;
+    gDrvAT24Obj.clientStatus               = DRV_AT24_TRANSFER_STATUS_ERROR;
 
     gDrvAT24Obj.i2cPlib                    = at24Init->i2cPlib;
     gDrvAT24Obj.slaveAddress               = at24Init->slaveAddress;
@@ -272,6 +951,30 @@ SYS_MODULE_OBJ DRV_AT24_Initialize(
     gDrvAT24Obj.flashSize                  = at24Init->flashSize;
     gDrvAT24Obj.nClientsMax                = at24Init->numClients;
     gDrvAT24Obj.blockStartAddress          = at24Init->blockStartAddress;
+    gDrvAT24Obj.writeCycleTime             = at24Init->writeCycleTime;
+    gDrvAT24Obj.ackPollTimer               = SYS_TIME_HANDLE_INVALID;
+    gDrvAT24Obj.ackPollTicks               = 0;
+    gDrvAT24Obj.ackPollBackoff             = 0;
+
+    gDrvAT24Obj.cachePages                 = at24Init->cachePages;
+    gDrvAT24Obj.cacheNumPages              = (at24Init->cachePages != NULL)? at24Init->cacheNumPages: 0U;
+    gDrvAT24Obj.cacheFlushTimeout          = at24Init->cacheFlushTimeout;
+    gDrvAT24Obj.cacheFlushTimer            = SYS_TIME_HANDLE_INVALID;
+    gDrvAT24Obj.cacheOp                    = DRV_AT24_CACHE_OP_NONE;
+    gDrvAT24Obj.cacheUseCount              = 0;
+    gDrvAT24Obj.isClientCall               = false;
+    gDrvAT24Obj.isCacheFlushBusy           = false;
+    gDrvAT24Obj.cachePendingOp             = DRV_AT24_CACHE_OP_NONE;
+    gDrvAT24Obj.isCachePendingStart        = false;
+
+    (void) memset(&gDrvAT24Obj.cacheStats, 0, sizeof(DRV_AT24_CACHE_STATS));
+
+    for (i = 0; i < gDrvAT24Obj.cacheNumPages; i++)
+    {
+        gDrvAT24Obj.cachePages[i].data = &at24Init->cacheBuffer[i * gDrvAT24Obj.pageSize];
+        gDrvAT24Obj.cachePages[i].isValid = false;
+        gDrvAT24Obj.cachePages[i].isDirty = false;
+    }
 
     gDrvAT24Obj.eventHandler               = NULL;
     gDrvAT24Obj.context                    = 0;
@@ -330,7 +1033,7 @@ void DRV_AT24_EventHandlerSet(
 )
 {
     if((handle != DRV_HANDLE_INVALID) && (handle == 0U) && \
-            (gDrvAT24Obj.transferStatus != DRV_AT24_TRANSFER_STATUS_BUSY))
+            (gDrvAT24Obj.clientStatus != DRV_AT24_TRANSFER_STATUS_BUSY))
     {
         gDrvAT24Obj.eventHandler = eventHandler;
         gDrvAT24Obj.context = context;
@@ -345,85 +1048,152 @@ bool DRV_AT24_Read(
 )
 {
     bool isRequestAccepted = false;
-    uint32_t nBytes = 0;
-    uint16_t slaveAddr;
+
+    /* Keep the cache flush timer off the bus while the request is submitted */
+    gDrvAT24Obj.isClientCall = true;
 
     if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (rxData == NULL) || \
-            (rxDataLength == 0U) || (gDrvAT24Obj.transferStatus == DRV_AT24_TRANSFER_STATUS_BUSY))
+            (rxDataLength == 0U) || (gDrvAT24Obj.clientStatus == DRV_AT24_TRANSFER_STATUS_BUSY))
     {
-        return isRequestAccepted;
+        /* Invalid request */
     }
-
-    if ((address + rxDataLength) > gDrvAT24Obj.flashSize)
+    else if ((address + rxDataLength) > gDrvAT24Obj.flashSize)
     {
-        /* Writing past end of flash results in error */
-        return isRequestAccepted;
+        /* Reading past end of flash results in error */
+    }
+    else if (gDrvAT24Obj.cacheNumPages != 0U)
+    {
+        isRequestAccepted = lDRV_AT24_CacheRequestSubmit(DRV_AT24_CACHE_OP_READ, (uint8_t*)rxData, rxDataLength, address);
     }
+    else
+    {
+        gDrvAT24Obj.clientStatus = DRV_AT24_TRANSFER_STATUS_BUSY;
 
-    gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_BUSY;
+        isRequestAccepted = lDRV_AT24_Read(rxData, rxDataLength, address);
 
-    /* Frame the EEPROM address */
-    slaveAddr = gDrvAT24Obj.slaveAddress;
-    if (gDrvAT24Obj.flashSize > 131072U)    /* For 18-bit address */
+        if (isRequestAccepted == false)
+        {
+            gDrvAT24Obj.clientStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
+        }
+    }
+
+    gDrvAT24Obj.isClientCall = false;
+
+    return isRequestAccepted;
+}
+
+bool DRV_AT24_Write(
+    const DRV_HANDLE handle,
+    void* txData,
+    uint32_t txDataLength,
+    uint32_t address
+)
+{
+    bool isRequestAccepted = false;
+
+    /* Keep the cache flush timer off the bus while the request is submitted */
+    gDrvAT24Obj.isClientCall = true;
+
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (txData == NULL) || \
+            (txDataLength == 0U) || (gDrvAT24Obj.clientStatus == DRV_AT24_TRANSFER_STATUS_BUSY))
     {
-        slaveAddr |= ((uint16_t)((unsigned char*)&address)[2] & 0x02U);
+        /* Invalid request */
     }
-    if (gDrvAT24Obj.flashSize > 65536U)     /* For 17-bit address */
+    else if ((address + txDataLength) > gDrvAT24Obj.flashSize)
     {
-        slaveAddr |= ((uint16_t)((unsigned char*)&address)[2] & 0x01U);
+        /* Writing past end of flash results in error */
     }
-    if (gDrvAT24Obj.flashSize > 256U)       /* For 16-bit address */
+    else if (gDrvAT24Obj.cacheNumPages != 0U)
     {
-        gDrvAT24Obj.writeBuffer[nBytes] = (uint8_t)((address & 0x0000FF00U) >> 8);
-        nBytes++;
+        isRequestAccepted = lDRV_AT24_CacheRequestSubmit(DRV_AT24_CACHE_OP_WRITE, (uint8_t*)txData, txDataLength, address);
     }
-    /* For 8-bit address */
-    gDrvAT24Obj.writeBuffer[nBytes] = (uint8_t)((address & 0x000000FFU));
-    nBytes++;
-    
-    gDrvAT24Obj.command = DRV_AT24_CMD_READ;
+    else
+    {
+        gDrvAT24Obj.clientStatus = DRV_AT24_TRANSFER_STATUS_BUSY;
 
-    if(gDrvAT24Obj.i2cPlib->writeRead(slaveAddr, \
-            (uint8_t*)gDrvAT24Obj.writeBuffer, nBytes, rxData, rxDataLength))
+        lDRV_AT24_AckPollTimerStart();
+
+        isRequestAccepted = lDRV_AT24_Write(txData, txDataLength, address);
+
+        if (isRequestAccepted == false)
+        {
+            gDrvAT24Obj.clientStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
+        }
+    }
+
+    gDrvAT24Obj.isClientCall = false;
+
+    return isRequestAccepted;
+}
+
+bool DRV_AT24_PageWrite(const DRV_HANDLE handle, void *txData, uint32_t address )
+{
+    return DRV_AT24_Write(handle, txData, gDrvAT24Obj.pageSize, address );
+}
+
+bool DRV_AT24_CacheFlush(const DRV_HANDLE handle)
+{
+    bool isRequestAccepted = false;
+
+    /* Keep the cache flush timer off the bus while the request is submitted */
+    gDrvAT24Obj.isClientCall = true;
+
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (gDrvAT24Obj.cacheNumPages == 0U) \
+            || (gDrvAT24Obj.clientStatus == DRV_AT24_TRANSFER_STATUS_BUSY))
     {
-        isRequestAccepted = true;
+        /* Invalid request */
     }
     else
     {
-        gDrvAT24Obj.transferStatus = DRV_AT24_TRANSFER_STATUS_ERROR;
+        isRequestAccepted = lDRV_AT24_CacheRequestSubmit(DRV_AT24_CACHE_OP_FLUSH, NULL, 0U, 0U);
     }
 
+    gDrvAT24Obj.isClientCall = false;
+
     return isRequestAccepted;
 }
 
-bool DRV_AT24_Write(
-    const DRV_HANDLE handle,
-    void* txData,
-    uint32_t txDataLength,
-    uint32_t address
-)
+bool DRV_AT24_CacheInvalidate(const DRV_HANDLE handle)
 {
-    if((handle != DRV_HANDLE_INVALID) && (handle == 0U) && (txData != NULL) \
-            && (txDataLength != 0U) && (gDrvAT24Obj.transferStatus != DRV_AT24_TRANSFER_STATUS_BUSY))
+    uint32_t i;
+
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (gDrvAT24Obj.cacheNumPages == 0U) \
+            || (gDrvAT24Obj.clientStatus == DRV_AT24_TRANSFER_STATUS_BUSY) || (gDrvAT24Obj.isCacheFlushBusy == true))
     {
-        return lDRV_AT24_Write(txData, txDataLength, address);
+        return false;
     }
-    else
+
+    /* Modified pages must be flushed first, their data would be lost */
+    if (lDRV_AT24_CacheDirtyPageGet() != NULL)
     {
         return false;
     }
+
+    for (i = 0; i < gDrvAT24Obj.cacheNumPages; i++)
+    {
+        gDrvAT24Obj.cachePages[i].isValid = false;
+    }
+
+    return true;
 }
 
-bool DRV_AT24_PageWrite(const DRV_HANDLE handle, void *txData, uint32_t address )
+bool DRV_AT24_CacheStatsGet(const DRV_HANDLE handle, DRV_AT24_CACHE_STATS *stats)
 {
-    return DRV_AT24_Write(handle, txData, gDrvAT24Obj.pageSize, address );
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (stats == NULL) || (gDrvAT24Obj.cacheNumPages == 0U))
+    {
+        return false;
+    }
+
+    *stats = gDrvAT24Obj.cacheStats;
+
+    return true;
 }
 
 DRV_AT24_TRANSFER_STATUS DRV_AT24_TransferStatusGet(const DRV_HANDLE handle)
 {
     if((handle != DRV_HANDLE_INVALID) && (handle == 0U))
     {
-        return gDrvAT24Obj.transferStatus;
+        return gDrvAT24Obj.clientStatus;
     }
     else
     {
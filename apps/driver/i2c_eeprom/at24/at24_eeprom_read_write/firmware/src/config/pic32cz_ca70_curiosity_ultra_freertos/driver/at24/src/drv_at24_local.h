@@ -49,6 +49,7 @@
 // *****************************************************************************
 // *****************************************************************************
 #include "configuration.h"
+#include "system/time/sys_time.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -82,6 +83,31 @@ typedef enum
 
 } DRV_AT24_CMD;
 
+typedef enum
+{
+    /* Transfer is not related to the cache */
+    DRV_AT24_CACHE_OP_NONE,
+
+    /* Client read that missed the cache, cached data is copied over it */
+    DRV_AT24_CACHE_OP_READ,
+
+    /* Client write that missed the cache, cached pages are updated with it */
+    DRV_AT24_CACHE_OP_WRITE,
+
+    /* Page read into the cache to serve a client read */
+    DRV_AT24_CACHE_OP_FILL_READ,
+
+    /* Page read into the cache to merge a client write into it */
+    DRV_AT24_CACHE_OP_FILL_WRITE,
+
+    /* Dirty pages being programmed on client request */
+    DRV_AT24_CACHE_OP_FLUSH,
+
+    /* Dirty pages being programmed on flush timeout */
+    DRV_AT24_CACHE_OP_FLUSH_TIMEOUT,
+
+}DRV_AT24_CACHE_OP;
+
 // *****************************************************************************
 /* AT24 Driver Instance Object
 
@@ -133,9 +159,21 @@ typedef struct
     /* Starting memory address of EEPROM */
     uint32_t                        blockStartAddress;
 
-    /* Write buffer - must also hold the EEPROM memory address */
+    /* Write buffer - holds the EEPROM memory address */
     uint8_t                         writeBuffer[DRV_AT24_WRITE_BUFFER_SIZE];
 
+    /* EEPROM internal write cycle time (tWR) in microseconds */
+    uint32_t                        writeCycleTime;
+
+    /* Periodic timer pacing the ACK polls while a write request is in progress */
+    SYS_TIME_HANDLE                 ackPollTimer;
+
+    /* Timer ticks left before the next ACK poll, 0 if no poll is pending */
+    volatile uint32_t               ackPollTicks;
+
+    /* Timer ticks before the next ACK poll retry */
+    uint32_t                        ackPollBackoff;
+
     /* The command currently being executed */
     DRV_AT24_CMD                    command;
 
@@ -148,6 +186,59 @@ typedef struct
     /* Status of the transfer */
     volatile DRV_AT24_TRANSFER_STATUS       transferStatus;
 
+    /* Status of the client request, reported by DRV_AT24_TransferStatusGet.
+     * transferStatus also follows the flushes on timeout, this one does not. */
+    volatile DRV_AT24_TRANSFER_STATUS       clientStatus;
+
+    /* RAM page cache, cacheNumPages is 0 if the cache is not used */
+    DRV_AT24_CACHE_PAGE*            cachePages;
+
+    uint32_t                        cacheNumPages;
+
+    /* Incremented on every page access, used to find the least recently used page */
+    uint32_t                        cacheUseCount;
+
+    /* Cache operation of the ongoing transfer */
+    DRV_AT24_CACHE_OP               cacheOp;
+
+    /* Page being filled or programmed by the ongoing transfer */
+    DRV_AT24_CACHE_PAGE*            cachePage;
+
+    /* Client request being served through the cache */
+    uint8_t*                        cacheClientBuffer;
+
+    uint32_t                        cacheClientLength;
+
+    uint32_t                        cacheClientAddr;
+
+    /* Set while a flush on timeout is programming the dirty pages */
+    volatile bool                   isCacheFlushBusy;
+
+    /* Client request queued behind a flush on timeout, DRV_AT24_CACHE_OP_NONE
+     * if there is none. Only READ, WRITE and FLUSH are queued. */
+    volatile DRV_AT24_CACHE_OP      cachePendingOp;
+
+    uint8_t*                        cachePendingBuffer;
+
+    uint32_t                        cachePendingLength;
+
+    uint32_t                        cachePendingAddr;
+
+    /* Set while the I2C interrupt starts the queued request, the flush and
+     * ACK poll timers were already started by the client and are left alone */
+    bool                            isCachePendingStart;
+
+    /* Flush timeout in milliseconds and the timer running it */
+    uint32_t                        cacheFlushTimeout;
+
+    volatile SYS_TIME_HANDLE        cacheFlushTimer;
+
+    /* Set while a client request is being submitted, the flush timer then
+     * backs off instead of starting a transfer */
+    volatile bool                   isClientCall;
+
+    DRV_AT24_CACHE_STATS            cacheStats;
+
 } DRV_AT24_OBJ;
 
 
@@ -55,6 +55,7 @@
 #include "app_monitor.h"
 #include "app_sst26.h"
 #include "app_nvm.h"
+#include "app_stripe.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -129,7 +130,8 @@ void APP_MONITOR_Initialize ( void )
 
 void APP_MONITOR_Tasks ( void )
 {
-    if (appSST26Data.state == APP_SST26_STATE_SUCCESS && appNvmData.state == APP_NVM_STATE_SUCCESS)
+    if (appSST26Data.state == APP_SST26_STATE_SUCCESS && appNvmData.state == APP_NVM_STATE_SUCCESS &&
+        appStripeData.state == APP_STRIPE_STATE_SUCCESS)
     {
         LED_ON();
     }
@@ -99,7 +99,16 @@ void appTransferHandler
         case DRV_MEMORY_EVENT_COMMAND_COMPLETE:
             if (commandHandle == app_data->readHandle)
             {
-                appSST26Data.xfer_done = true;
+                app_data->latencyEnd = DWT->CYCCNT;
+                app_data->xfer_done = true;
+            }
+            else if (commandHandle == app_data->eraseHandle)
+            {
+                app_data->erase_done = true;
+            }
+            else
+            {
+                /* Nothing to do */
             }
             break;
 
@@ -119,8 +128,13 @@ void appTransferHandler
 // *****************************************************************************
 
 
-/* TODO:  Add any necessary local functions.
-*/
+static void APP_SST26_CycleCounterEnable(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
 
 
 // *****************************************************************************
@@ -146,6 +160,8 @@ void APP_SST26_Initialize ( void )
 
     for (i = 0; i < SST26_BUFFER_SIZE; i++)
         appSST26Data.writeBuffer[i] = i;
+
+    APP_SST26_CycleCounterEnable();
 }
 
 
@@ -258,14 +274,93 @@ void APP_SST26_Tasks ( void )
         {
             if (!memcmp(appSST26Data.writeBuffer, appSST26Data.readBuffer, SST26_BUFFER_SIZE))
             {
-                appSST26Data.state = APP_SST26_STATE_SUCCESS;
+                appSST26Data.state = APP_SST26_STATE_LATENCY_ERASE;
+            }
+            else
+            {
+                DRV_MEMORY_Close(appSST26Data.memoryHandle);
+                appSST26Data.state = APP_SST26_STATE_ERROR;
+            }
+
+            break;
+        }
+
+        case APP_SST26_STATE_LATENCY_ERASE:
+        {
+            appSST26Data.erase_done = false;
+
+            DRV_MEMORY_AsyncErase(appSST26Data.memoryHandle, &appSST26Data.eraseHandle, BLOCK_START + appSST26Data.numEraseBlocks, LATENCY_ERASE_BLOCKS);
+
+            if (DRV_MEMORY_COMMAND_HANDLE_INVALID == appSST26Data.eraseHandle)
+            {
+                appSST26Data.state = APP_SST26_STATE_ERROR;
+                break;
+            }
+            else
+            {
+                appSST26Data.state = APP_SST26_STATE_LATENCY_READ;
+            }
+        }
+
+        case APP_SST26_STATE_LATENCY_READ:
+        {
+            (void) memset(appSST26Data.readBuffer, 0, LATENCY_READ_SIZE);
+
+            appSST26Data.latencyStart = DWT->CYCCNT;
+
+            DRV_MEMORY_AsyncRead(appSST26Data.memoryHandle, &appSST26Data.readHandle, (void *)appSST26Data.readBuffer, BLOCK_START, LATENCY_READ_SIZE / geometry->geometryTable[GEOMETRY_TABLE_READ_ENTRY].blockSize);
+
+            if (DRV_MEMORY_COMMAND_HANDLE_INVALID == appSST26Data.readHandle)
+            {
+                appSST26Data.state = APP_SST26_STATE_ERROR;
+                break;
             }
             else
             {
+                appSST26Data.state = APP_SST26_STATE_LATENCY_WAIT;
+            }
+        }
+
+        case APP_SST26_STATE_LATENCY_WAIT:
+        {
+            uint32_t latency;
+
+            if (appSST26Data.xfer_done == false)
+            {
+                break;
+            }
+
+            appSST26Data.xfer_done = false;
+
+            if (memcmp(appSST26Data.writeBuffer, appSST26Data.readBuffer, LATENCY_READ_SIZE) != 0)
+            {
+                DRV_MEMORY_Close(appSST26Data.memoryHandle);
                 appSST26Data.state = APP_SST26_STATE_ERROR;
+                break;
+            }
+
+            latency = appSST26Data.latencyEnd - appSST26Data.latencyStart;
+
+            if (latency > appSST26Data.latencyMax)
+            {
+                appSST26Data.latencyMax = latency;
             }
 
-            DRV_MEMORY_Close(appSST26Data.memoryHandle);
+            appSST26Data.latencyTotal += latency;
+            appSST26Data.latencyCount++;
+
+            if (appSST26Data.erase_done == true)
+            {
+                /* Watch latencyMax and latencyAverage in the debugger */
+                appSST26Data.latencyAverage = (uint32_t)(appSST26Data.latencyTotal / appSST26Data.latencyCount);
+
+                DRV_MEMORY_Close(appSST26Data.memoryHandle);
+                appSST26Data.state = APP_SST26_STATE_SUCCESS;
+            }
+            else
+            {
+                appSST26Data.state = APP_SST26_STATE_LATENCY_READ;
+            }
 
             break;
         }
@@ -82,6 +82,12 @@ extern "C" {
 
 #define BLOCK_START                 0x0
 
+/* Read latency test: reads of LATENCY_READ_SIZE bytes of the verified region
+ * are queued back to back while LATENCY_ERASE_BLOCKS sectors following it are
+ * being erased. */
+#define LATENCY_ERASE_BLOCKS        (16U)
+#define LATENCY_READ_SIZE           (256U)
+
 // *****************************************************************************
 /* Application states
 
@@ -116,6 +122,15 @@ typedef enum
     /* Verify Data Read */
     APP_SST26_STATE_VERIFY_DATA,
 
+    /* Erase the sectors following the verified region */
+    APP_SST26_STATE_LATENCY_ERASE,
+
+    /* Read the verified region while the erase is in progress */
+    APP_SST26_STATE_LATENCY_READ,
+
+    /* Wait for the read and record its latency */
+    APP_SST26_STATE_LATENCY_WAIT,
+
     /* Transfer success */
     APP_SST26_STATE_SUCCESS,
 
@@ -162,6 +177,19 @@ typedef struct
     /* Number of read blocks*/
     uint32_t numEraseBlocks;
 
+    /* Latency erase status */
+    volatile bool erase_done;
+
+    /* DWT cycle counter when the latency read was queued and completed */
+    uint32_t latencyStart;
+    volatile uint32_t latencyEnd;
+
+    /* Read latencies in CPU cycles, from queuing to completion */
+    uint32_t latencyMax;
+    uint32_t latencyAverage;
+    uint64_t latencyTotal;
+    uint32_t latencyCount;
+
     /* Read Buffer */
     uint8_t readBuffer[SST26_BUFFER_SIZE];
 
@@ -0,0 +1,374 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_stripe.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MPLAB Harmony application.  It
+    implements the logic of the application's state machine and it may call
+    API routines of other MPLAB Harmony modules in the system, such as drivers,
+    system services, and middleware.  However, it does not call any of the
+    system interfaces (such as the "Initialize" and "Tasks" functions) of any of
+    the modules in the system or make any assumptions about when those functions
+    are called.  That is the responsibility of the configuration-specific system
+    files.
+ *******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "app_stripe.h"
+#include "app_sst26.h"
+#include "app_nvm.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Application Data
+
+  Summary:
+    Holds application data
+
+  Description:
+    This structure holds the application's data.
+
+  Remarks:
+    This structure should be initialized by the APP_STRIPE_Initialize function.
+
+    Application strings and buffers are be defined outside this structure.
+*/
+
+APP_STRIPE_DATA CACHE_ALIGN appStripeData;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Callback Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Shared by the SST26 and the stripe driver, both report through a
+ * DRV_MEMORY_TRANSFER_HANDLER. */
+void appStripeTransferHandler
+(
+    DRV_MEMORY_EVENT event,
+    DRV_MEMORY_COMMAND_HANDLE commandHandle,
+    uintptr_t context
+)
+{
+    APP_STRIPE_DATA *app_data = (APP_STRIPE_DATA *)context;
+
+    switch(event)
+    {
+        case DRV_MEMORY_EVENT_COMMAND_COMPLETE:
+            if ((commandHandle == app_data->writeHandle) || (commandHandle == app_data->readHandle))
+            {
+                app_data->xfer_done = true;
+            }
+            break;
+
+        case DRV_MEMORY_EVENT_COMMAND_ERROR:
+            app_data->state = APP_STRIPE_STATE_ERROR;
+            break;
+
+        default:
+            break;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Queues the erase and the write of the buffer at the byte address and starts
+ * timing them. The write is queued behind the erase, its completion ends the
+ * run. */
+static bool APP_STRIPE_EraseWrite(bool isStripe, SYS_MEDIA_GEOMETRY *geometry, uint32_t address)
+{
+    uint32_t eraseBlockSize;
+    uint32_t writeBlockSize;
+
+    if (geometry == NULL)
+    {
+        return false;
+    }
+
+    eraseBlockSize = geometry->geometryTable[STRIPE_GEOMETRY_TABLE_ERASE_ENTRY].blockSize;
+    writeBlockSize = geometry->geometryTable[STRIPE_GEOMETRY_TABLE_WRITE_ENTRY].blockSize;
+
+    appStripeData.xfer_done = false;
+    appStripeData.xferStart = DWT->CYCCNT;
+
+    if (isStripe == true)
+    {
+        DRV_MEMORY_STRIPE_AsyncErase(appStripeData.memoryHandle, &appStripeData.eraseHandle,
+            (address / eraseBlockSize), (STRIPE_BUFFER_SIZE / eraseBlockSize));
+    }
+    else
+    {
+        DRV_MEMORY_AsyncErase(appStripeData.memoryHandle, &appStripeData.eraseHandle,
+            (address / eraseBlockSize), (STRIPE_BUFFER_SIZE / eraseBlockSize));
+    }
+
+    if (DRV_MEMORY_COMMAND_HANDLE_INVALID == appStripeData.eraseHandle)
+    {
+        return false;
+    }
+
+    if (isStripe == true)
+    {
+        DRV_MEMORY_STRIPE_AsyncWrite(appStripeData.memoryHandle, &appStripeData.writeHandle,
+            (void *)&appStripeData.writeBuffer, (address / writeBlockSize), (STRIPE_BUFFER_SIZE / writeBlockSize));
+    }
+    else
+    {
+        DRV_MEMORY_AsyncWrite(appStripeData.memoryHandle, &appStripeData.writeHandle,
+            (void *)&appStripeData.writeBuffer, (address / writeBlockSize), (STRIPE_BUFFER_SIZE / writeBlockSize));
+    }
+
+    return (DRV_MEMORY_COMMAND_HANDLE_INVALID != appStripeData.writeHandle);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Initialization and State Machine Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP_STRIPE_Initialize ( void )
+
+  Remarks:
+    See prototype in app_stripe.h.
+ */
+
+void APP_STRIPE_Initialize ( void )
+{
+    uint32_t i = 0;
+
+    /* Place the App state machine in its initial state. */
+    appStripeData.state = APP_STRIPE_STATE_WAIT_APPS;
+
+    appStripeData.readHandle = DRV_MEMORY_COMMAND_HANDLE_INVALID;
+
+    for (i = 0; i < STRIPE_BUFFER_SIZE; i++)
+        appStripeData.writeBuffer[i] = (uint8_t)(i ^ (i >> 8));
+}
+
+
+/******************************************************************************
+  Function:
+    void APP_STRIPE_Tasks ( void )
+
+ Description:
+    Times the erase and write of the same buffer on the SST26 alone and on the
+    stripe of the SST26 and the internal flash, then reads the striped buffer
+    back and verifies it. The cycle counter is enabled by APP_SST26_Initialize.
+
+  Remarks:
+    See prototype in app_stripe.h.
+ */
+
+void APP_STRIPE_Tasks ( void )
+{
+
+    /* Check the application's current state. */
+    switch ( appStripeData.state )
+    {
+        case APP_STRIPE_STATE_WAIT_APPS:
+        {
+            /* Keep the timed runs clear of the other applications' requests */
+            if ((appSST26Data.state == APP_SST26_STATE_SUCCESS) && (appNvmData.state == APP_NVM_STATE_SUCCESS))
+            {
+                appStripeData.state = APP_STRIPE_STATE_SINGLE_OPEN;
+            }
+            else if ((appSST26Data.state == APP_SST26_STATE_ERROR) || (appNvmData.state == APP_NVM_STATE_ERROR))
+            {
+                appStripeData.state = APP_STRIPE_STATE_ERROR;
+            }
+            else
+            {
+                /* Nothing to do */
+            }
+
+            break;
+        }
+
+        case APP_STRIPE_STATE_SINGLE_OPEN:
+        {
+            appStripeData.memoryHandle = DRV_MEMORY_Open(DRV_MEMORY_INDEX_0, DRV_IO_INTENT_READWRITE);
+
+            if (DRV_HANDLE_INVALID != appStripeData.memoryHandle)
+            {
+                DRV_MEMORY_TransferHandlerSet(appStripeData.memoryHandle, appStripeTransferHandler, (uintptr_t)&appStripeData);
+                appStripeData.state = APP_STRIPE_STATE_SINGLE_WRITE;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        case APP_STRIPE_STATE_SINGLE_WRITE:
+        {
+            if (APP_STRIPE_EraseWrite(false, DRV_MEMORY_GeometryGet(appStripeData.memoryHandle), STRIPE_SINGLE_ADDRESS) == false)
+            {
+                appStripeData.state = APP_STRIPE_STATE_ERROR;
+                break;
+            }
+            else
+            {
+                appStripeData.state = APP_STRIPE_STATE_SINGLE_WAIT;
+            }
+        }
+
+        case APP_STRIPE_STATE_SINGLE_WAIT:
+        {
+            if (appStripeData.xfer_done)
+            {
+                appStripeData.singleCycles = DWT->CYCCNT - appStripeData.xferStart;
+
+                DRV_MEMORY_Close(appStripeData.memoryHandle);
+
+                appStripeData.state = APP_STRIPE_STATE_STRIPE_OPEN;
+            }
+
+            break;
+        }
+
+        case APP_STRIPE_STATE_STRIPE_OPEN:
+        {
+            /* Fails until the stripe driver has opened its devices */
+            appStripeData.memoryHandle = DRV_MEMORY_STRIPE_Open(DRV_MEMORY_STRIPE_INDEX_0, DRV_IO_INTENT_READWRITE);
+
+            if (DRV_HANDLE_INVALID != appStripeData.memoryHandle)
+            {
+                DRV_MEMORY_STRIPE_TransferHandlerSet(appStripeData.memoryHandle, appStripeTransferHandler, (uintptr_t)&appStripeData);
+                appStripeData.state = APP_STRIPE_STATE_STRIPE_WRITE;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        case APP_STRIPE_STATE_STRIPE_WRITE:
+        {
+            if (APP_STRIPE_EraseWrite(true, DRV_MEMORY_STRIPE_GeometryGet(appStripeData.memoryHandle), STRIPE_STRIPED_ADDRESS) == false)
+            {
+                appStripeData.state = APP_STRIPE_STATE_ERROR;
+                break;
+            }
+            else
+            {
+                appStripeData.state = APP_STRIPE_STATE_STRIPE_WAIT;
+            }
+        }
+
+        case APP_STRIPE_STATE_STRIPE_WAIT:
+        {
+            if (appStripeData.xfer_done)
+            {
+                appStripeData.stripeCycles = DWT->CYCCNT - appStripeData.xferStart;
+                appStripeData.xfer_done = false;
+                appStripeData.state = APP_STRIPE_STATE_READ_MEMORY;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        case APP_STRIPE_STATE_READ_MEMORY:
+        {
+            /* The stripe read block is one byte */
+            DRV_MEMORY_STRIPE_AsyncRead(appStripeData.memoryHandle, &appStripeData.readHandle, (void *)&appStripeData.readBuffer, STRIPE_STRIPED_ADDRESS, STRIPE_BUFFER_SIZE);
+
+            if (DRV_MEMORY_COMMAND_HANDLE_INVALID == appStripeData.readHandle)
+            {
+                appStripeData.state = APP_STRIPE_STATE_ERROR;
+                break;
+            }
+            else
+            {
+                appStripeData.state = APP_STRIPE_STATE_READ_WAIT;
+            }
+        }
+
+        case APP_STRIPE_STATE_READ_WAIT:
+        {
+            if (appStripeData.xfer_done)
+            {
+                appStripeData.xfer_done = false;
+                appStripeData.state = APP_STRIPE_STATE_VERIFY_DATA;
+            }
+
+            break;
+        }
+
+        case APP_STRIPE_STATE_VERIFY_DATA:
+        {
+            if (!memcmp(appStripeData.writeBuffer, appStripeData.readBuffer, STRIPE_BUFFER_SIZE))
+            {
+                appStripeData.state = APP_STRIPE_STATE_SUCCESS;
+            }
+            else
+            {
+                appStripeData.state = APP_STRIPE_STATE_ERROR;
+            }
+
+            DRV_MEMORY_STRIPE_Close(appStripeData.memoryHandle);
+
+            break;
+        }
+
+        case APP_STRIPE_STATE_SUCCESS:
+        case APP_STRIPE_STATE_ERROR:
+        default:
+        {
+            break;
+        }
+
+    }
+}
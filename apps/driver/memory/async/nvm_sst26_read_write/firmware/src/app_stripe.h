@@ -0,0 +1,274 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_stripe.h
+
+  Summary:
+    This header file provides prototypes and definitions for the application.
+
+  Description:
+    This header file provides function prototypes and data type definitions for
+    the application.  Some of these are required by the system (such as the
+    "APP_STRIPE_Initialize" and "APP_STRIPE_Tasks" prototypes) and some of them are only used
+    internally by the application (such as the "APP_STRIPE_STATES" definition).  Both
+    are defined here for convenience.
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef APP_STRIPE_H
+#define APP_STRIPE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "configuration.h"
+#include "driver/memory/drv_memory.h"
+#include "driver/memory/drv_memory_stripe.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Will Erase and Write 32KB of Data, once on the SST26 alone and once striped
+ * over the SST26 and the internal flash */
+#define STRIPE_BUFFER_SIZE                  (32768U)
+
+#define STRIPE_GEOMETRY_TABLE_READ_ENTRY    (0)
+#define STRIPE_GEOMETRY_TABLE_WRITE_ENTRY   (1)
+#define STRIPE_GEOMETRY_TABLE_ERASE_ENTRY   (2)
+
+/* Byte addresses of the runs, clear of the regions used by the other
+ * applications */
+#define STRIPE_SINGLE_ADDRESS               (0x40000U)
+#define STRIPE_STRIPED_ADDRESS              (0x100000U)
+
+// *****************************************************************************
+/* Application states
+
+  Summary:
+    Application states enumeration
+
+  Description:
+    This enumeration defines the valid application states.  These states
+    determine the behavior of the application at various times.
+*/
+
+typedef enum
+{
+    /* Wait for the other applications to be done with the devices */
+    APP_STRIPE_STATE_WAIT_APPS,
+
+    /* Open the SST26 driver */
+    APP_STRIPE_STATE_SINGLE_OPEN,
+
+    /* Erase and write the buffer to the SST26 */
+    APP_STRIPE_STATE_SINGLE_WRITE,
+
+    /* Wait for the write to complete */
+    APP_STRIPE_STATE_SINGLE_WAIT,
+
+    /* Open the stripe driver */
+    APP_STRIPE_STATE_STRIPE_OPEN,
+
+    /* Erase and write the buffer to the stripe */
+    APP_STRIPE_STATE_STRIPE_WRITE,
+
+    /* Wait for the write to complete */
+    APP_STRIPE_STATE_STRIPE_WAIT,
+
+    /* Read the buffer back from the stripe */
+    APP_STRIPE_STATE_READ_MEMORY,
+
+    /* Wait for the read to complete */
+    APP_STRIPE_STATE_READ_WAIT,
+
+    /* Verify Data Read */
+    APP_STRIPE_STATE_VERIFY_DATA,
+
+    /* Transfer success */
+    APP_STRIPE_STATE_SUCCESS,
+
+    /* An app error has occurred */
+    APP_STRIPE_STATE_ERROR
+
+} APP_STRIPE_STATES;
+
+// *****************************************************************************
+/* Application Data
+
+  Summary:
+    Holds application data
+
+  Description:
+    This structure holds the application's data.
+
+  Remarks:
+    Application strings and buffers are be defined outside this structure.
+ */
+
+typedef struct
+{
+    /* Application's current state */
+    APP_STRIPE_STATES state;
+
+    /* Driver Handle */
+    DRV_HANDLE memoryHandle;
+
+    /* Application transfer status */
+    volatile bool xfer_done;
+
+    /* Erase/Write/Read Command Handles*/
+    DRV_MEMORY_COMMAND_HANDLE eraseHandle;
+    DRV_MEMORY_COMMAND_HANDLE writeHandle;
+    DRV_MEMORY_COMMAND_HANDLE readHandle;
+
+    /* DWT cycle counter when the erase was queued */
+    uint32_t xferStart;
+
+    /* Cycles taken to erase and write the buffer to the SST26 alone and to
+     * the stripe. Watch them in the debugger. */
+    uint32_t singleCycles;
+    uint32_t stripeCycles;
+
+    /* Read Buffer */
+    uint8_t readBuffer[STRIPE_BUFFER_SIZE];
+
+    /* Write Buffer*/
+    uint8_t writeBuffer[STRIPE_BUFFER_SIZE];
+} APP_STRIPE_DATA;
+
+extern APP_STRIPE_DATA appStripeData;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Callback Routines
+// *****************************************************************************
+// *****************************************************************************
+/* These routines are called by drivers when certain events occur.
+*/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Initialization and State Machine Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP_STRIPE_Initialize ( void )
+
+  Summary:
+     MPLAB Harmony application initialization routine.
+
+  Description:
+    This function initializes the Harmony application.  It places the
+    application in its initial state and prepares it to run so that its
+    APP_STRIPE_Tasks function can be called.
+
+  Precondition:
+    All other system initialization routines should be called before calling
+    this routine (in "SYS_Initialize").
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    APP_STRIPE_Initialize();
+    </code>
+
+  Remarks:
+    This routine must be called from the SYS_Initialize function.
+*/
+
+void APP_STRIPE_Initialize ( void );
+
+
+/*******************************************************************************
+  Function:
+    void APP_STRIPE_Tasks ( void )
+
+  Summary:
+    MPLAB Harmony Demo application tasks function
+
+  Description:
+    This routine is the Harmony Demo application's tasks function.  It
+    defines the application's state machine and core logic.
+
+  Precondition:
+    The system and application initialization ("SYS_Initialize") should be
+    called before calling this.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    APP_STRIPE_Tasks();
+    </code>
+
+  Remarks:
+    This routine must be called from SYS_Tasks() routine.
+ */
+
+void APP_STRIPE_Tasks( void );
+
+
+#endif /* APP_STRIPE_H */
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
@@ -89,7 +89,7 @@ extern "C" {
 
 /* Memory Driver Instance 1 Configuration */
 #define DRV_MEMORY_INDEX_1                   1
-#define DRV_MEMORY_CLIENTS_NUMBER_IDX1       1
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX1       2
 #define DRV_MEMORY_BUF_Q_SIZE_IDX1    5
 #define DRV_MEMORY_DEVICE_START_ADDRESS      0x500000U
 #define DRV_MEMORY_DEVICE_MEDIA_SIZE         1024UL
@@ -100,7 +100,7 @@ extern "C" {
 
 /* Memory Driver Instance 0 Configuration */
 #define DRV_MEMORY_INDEX_0                   0
-#define DRV_MEMORY_CLIENTS_NUMBER_IDX0       1
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX0       2
 #define DRV_MEMORY_BUF_Q_SIZE_IDX0    5
 
 /* Memory Driver Global Configuration Options */
@@ -112,6 +112,13 @@ extern "C" {
 #define DRV_SST26_PAGE_SIZE             (256U)
 #define DRV_SST26_ERASE_BUFFER_SIZE     (4096U)
 
+/* Memory Stripe Driver Instance 0 Configuration */
+#define DRV_MEMORY_STRIPE_INDEX_0                0
+#define DRV_MEMORY_STRIPE_BUF_Q_SIZE_IDX0        2
+
+/* Memory Stripe Driver Global Configuration Options */
+#define DRV_MEMORY_STRIPE_INSTANCES_NUMBER       (1U)
+
 
 
 // *****************************************************************************
@@ -55,6 +55,7 @@
 #include "peripheral/nvic/plib_nvic.h"
 #include "peripheral/mpu/plib_mpu.h"
 #include "driver/memory/drv_memory.h"
+#include "driver/memory/drv_memory_stripe.h"
 #include "peripheral/efc/plib_efc.h"
 #include "bsp/bsp.h"
 #include "driver/sst26/drv_sst26.h"
@@ -64,6 +65,7 @@
 #include "system/debug/sys_debug.h"
 #include "app_sst26.h"
 #include "app_nvm.h"
+#include "app_stripe.h"
 #include "app_monitor.h"
 
 
@@ -197,6 +199,7 @@ typedef struct
 {
     SYS_MODULE_OBJ  drvMemory1;
     SYS_MODULE_OBJ  drvMemory0;
+    SYS_MODULE_OBJ  drvMemoryStripe0;
     SYS_MODULE_OBJ  drvSST26;
 
 } SYSTEM_OBJECTS;
@@ -0,0 +1,228 @@
+/******************************************************************************
+  MEMORY Stripe Driver Local Data Structures
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_memory_stripe_local.h
+
+  Summary:
+    MEMORY Stripe Driver Local Data Structures
+
+  Description:
+    Driver Local Data Structures
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_MEMORY_STRIPE_LOCAL_H
+#define DRV_MEMORY_STRIPE_LOCAL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "configuration.h"
+#include "driver/memory/drv_memory_stripe.h"
+
+#include "osal/osal.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Maximum number of MEMORY driver instances of a stripe instance */
+#ifndef DRV_MEMORY_STRIPE_MEMBERS_MAX
+#define DRV_MEMORY_STRIPE_MEMBERS_MAX                   (4U)
+#endif
+
+/* Register the striped devices with the file system media manager. Requires
+ * the file system service in the project. */
+#ifndef DRV_MEMORY_STRIPE_SYS_FS_REGISTER
+#define DRV_MEMORY_STRIPE_SYS_FS_REGISTER               false
+#endif
+
+typedef enum
+{
+    /* Process the operations queued. */
+    DRV_MEMORY_STRIPE_PROCESS_QUEUE,
+
+    /* Split the current request into transfers of the MEMORY driver instances */
+    DRV_MEMORY_STRIPE_TRANSFER
+
+} DRV_MEMORY_STRIPE_STATE;
+
+/*******************************************
+ * MEMORY Stripe Driver Buffer Object that
+ * services a driver request.
+ ******************************************/
+typedef struct DRV_MEMORY_STRIPE_BUFFER_OBJECT_T
+{
+    /* Buffer Object array index */
+    uint32_t index;
+
+    /* Present status of this command */
+    DRV_MEMORY_COMMAND_STATUS status;
+
+    /* Current command handle of this buffer object */
+    DRV_MEMORY_COMMAND_HANDLE commandHandle;
+
+    /* Pointer to the source/destination buffer */
+    uint8_t *buffer;
+
+    /* Start address of the operation. */
+    uint32_t blockStart;
+
+    /* Number of blocks */
+    uint32_t nBlocks;
+
+    /* Operation type - read/write/erase/erasewrite */
+    DRV_MEM_OP_TYPE opType;
+
+    /* Pointer to the next buffer in the queue */
+    struct DRV_MEMORY_STRIPE_BUFFER_OBJECT_T *next;
+
+} DRV_MEMORY_STRIPE_BUFFER_OBJECT;
+
+/**************************************
+ * MEMORY driver instance of a stripe
+ **************************************/
+typedef struct
+{
+    /* MEMORY driver instance index */
+    SYS_MODULE_INDEX drvIndex;
+
+    /* Client handle of the MEMORY driver instance */
+    DRV_HANDLE handle;
+
+    /* Geometry of the MEMORY driver instance */
+    SYS_MEDIA_GEOMETRY *geometry;
+
+    /* Command in flight on the MEMORY driver instance */
+    DRV_MEMORY_COMMAND_HANDLE commandHandle;
+
+    /* Status of that command, updated by the transfer handler */
+    volatile DRV_MEMORY_COMMAND_STATUS status;
+
+    /* Next stripe unit of the current request held by this instance */
+    uint32_t unit;
+
+} DRV_MEMORY_STRIPE_MEMBER;
+
+/**************************************
+ * MEMORY Stripe Driver Hardware Instance Object
+ **************************************/
+typedef struct
+{
+    /* The status of the driver */
+    SYS_STATUS status;
+
+    /* Main task routine's states */
+    DRV_MEMORY_STRIPE_STATE state;
+
+    /* Flag to indicate in use  */
+    bool inUse;
+
+    /* Index of this instance */
+    uint8_t drvIndex;
+
+    /* Flag to indicate that the driver is opened by its client */
+    bool isOpen;
+
+    /* Intent with which the client opened the driver */
+    DRV_IO_INTENT intent;
+
+    /* Client handle of the opened driver */
+    DRV_HANDLE clientHandle;
+
+    /* Client event handler and context */
+    DRV_MEMORY_TRANSFER_HANDLER transferHandler;
+
+    uintptr_t context;
+
+    /* MEMORY driver instances in stripe order */
+    DRV_MEMORY_STRIPE_MEMBER members[DRV_MEMORY_STRIPE_MEMBERS_MAX];
+
+    uint32_t nMembers;
+
+    /* Stripe unit size in bytes */
+    uint32_t unitSize;
+
+    /* First and last byte + 1 of the current request */
+    uint32_t xferStart;
+
+    uint32_t xferEnd;
+
+    /* Flag to indicate a transfer of the current request failed */
+    bool isXferError;
+
+    /* Flag to indicate the client closed the driver during the request */
+    bool isXferDiscarded;
+
+    /* Pointer to Buffer Objects array */
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *buffObjArr;
+
+    /* Size of the buffer objects array */
+    size_t queueSize;
+
+    /* Linked list of free buffer objects */
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *buffObjFree;
+
+    /* Head and tail of the request queue */
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *queueHead;
+
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *queueTail;
+
+    /* Token used to build the client and command handles */
+    uint16_t bufferToken;
+
+    uint16_t clientToken;
+
+    /* Geometry of the logical device */
+    SYS_MEDIA_REGION_GEOMETRY mediaGeometryTable[3];
+
+    SYS_MEDIA_GEOMETRY mediaGeometryObj;
+
+    /* FS enabled and media type */
+    bool isFsEnabled;
+
+    uint8_t deviceMediaType;
+
+    /* Mutex to protect the request queue */
+    OSAL_MUTEX_DECLARE(transferMutex);
+
+} DRV_MEMORY_STRIPE_OBJECT;
+
+#endif //#ifndef DRV_MEMORY_STRIPE_LOCAL_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -120,7 +120,9 @@ static const DRV_MEMORY_DEVICE_INTERFACE drvMemory0DeviceAPI = {
     .PageWrite          = DRV_SST26_PageWrite,
     .EventHandlerSet    = NULL,
     .GeometryGet        = (DRV_MEMORY_DEVICE_GEOMETRY_GET)DRV_SST26_GeometryGet,
-    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_SST26_TransferStatusGet
+    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_SST26_TransferStatusGet,
+    .Suspend            = DRV_SST26_Suspend,
+    .Resume             = DRV_SST26_Resume
 };
 static const DRV_MEMORY_INIT drvMemory0InitData =
 {
@@ -135,6 +137,27 @@ static const DRV_MEMORY_INIT drvMemory0InitData =
     .nClientsMax                = DRV_MEMORY_CLIENTS_NUMBER_IDX0
 };
 
+// </editor-fold>
+// <editor-fold defaultstate="collapsed" desc="DRV_MEMORY_STRIPE Instance 0 Initialization Data">
+
+/* SST26 and EFC, in stripe order */
+static const SYS_MODULE_INDEX drvMemoryStripe0Members[] =
+{
+    DRV_MEMORY_INDEX_0,
+    DRV_MEMORY_INDEX_1
+};
+
+static DRV_MEMORY_STRIPE_BUFFER_OBJECT gDrvMemoryStripe0BufferObject[DRV_MEMORY_STRIPE_BUF_Q_SIZE_IDX0];
+
+static const DRV_MEMORY_STRIPE_INIT drvMemoryStripe0InitData =
+{
+    .memberIndex                = &drvMemoryStripe0Members[0],
+    .nMembers                   = 2,
+    .isFsEnabled                = false,
+    .bufferObj                  = (uintptr_t)&gDrvMemoryStripe0BufferObject[0],
+    .queueSize                  = DRV_MEMORY_STRIPE_BUF_Q_SIZE_IDX0
+};
+
 // </editor-fold>
 // <editor-fold defaultstate="collapsed" desc="DRV_SST26 Initialization Data">
 
@@ -208,6 +231,9 @@ void SYS_Initialize ( void* data )
     CLOCK_Initialize();
 	PIO_Initialize();
 
+    /* Skip cache maintenance for the non-cacheable MPU regions */
+    SYS_CACHE_NonCacheableRegionsLoad();
+
 
 
     QSPI_Initialize();
@@ -229,6 +255,8 @@ void SYS_Initialize ( void* data )
 
     sysObj.drvMemory0 = DRV_MEMORY_Initialize((SYS_MODULE_INDEX)DRV_MEMORY_INDEX_0, (SYS_MODULE_INIT *)&drvMemory0InitData);
 
+    sysObj.drvMemoryStripe0 = DRV_MEMORY_STRIPE_Initialize((SYS_MODULE_INDEX)DRV_MEMORY_STRIPE_INDEX_0, (SYS_MODULE_INIT *)&drvMemoryStripe0InitData);
+
     sysObj.drvSST26 = DRV_SST26_Initialize((SYS_MODULE_INDEX)DRV_SST26_INDEX, (SYS_MODULE_INIT *)&drvSST26InitData);
 
 
@@ -237,6 +265,7 @@ void SYS_Initialize ( void* data )
     /* MISRAC 2012 deviation block end */
     APP_SST26_Initialize();
     APP_NVM_Initialize();
+    APP_STRIPE_Initialize();
     APP_MONITOR_Initialize();
 
 
@@ -80,6 +80,8 @@ void SYS_Tasks ( void )
 
 DRV_MEMORY_Tasks(sysObj.drvMemory0);
 
+    DRV_MEMORY_STRIPE_Tasks(sysObj.drvMemoryStripe0);
+
 
 
     /* Maintain Middleware & Other Libraries */
@@ -92,6 +94,9 @@ DRV_MEMORY_Tasks(sysObj.drvMemory0);
     /* Call Application task APP_NVM. */
     APP_NVM_Tasks();
 
+    /* Call Application task APP_STRIPE. */
+    APP_STRIPE_Tasks();
+
     /* Call Application task APP_MONITOR. */
     APP_MONITOR_Tasks();
 
@@ -72,6 +72,12 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* OSAL semaphores and mutexes created from static storage */
+#define OSAL_STATIC_SEMAPHORE_COUNT                      (5U)
+
+/* Count the core clock cycles of the boot in SYS_BootCycles */
+#define SYS_BOOT_TIME_ENABLE                             true
+
 
 
 // *****************************************************************************
@@ -89,7 +95,7 @@ extern "C" {
 
 /* Memory Driver Instance 1 Configuration */
 #define DRV_MEMORY_INDEX_1                   1
-#define DRV_MEMORY_CLIENTS_NUMBER_IDX1       1
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX1       2
 #define DRV_MEMORY_BUF_Q_SIZE_IDX1    5
 #define DRV_MEMORY_DEVICE_START_ADDRESS      0x500000U
 #define DRV_MEMORY_DEVICE_MEDIA_SIZE         1024UL
@@ -104,7 +110,7 @@ extern "C" {
 
 /* Memory Driver Instance 0 Configuration */
 #define DRV_MEMORY_INDEX_0                   0
-#define DRV_MEMORY_CLIENTS_NUMBER_IDX0       1
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX0       2
 #define DRV_MEMORY_BUF_Q_SIZE_IDX0    5
 /* Memory Driver Instance 0 RTOS Configurations*/
 #define DRV_MEMORY_STACK_SIZE_IDX0               1024
@@ -120,6 +126,18 @@ extern "C" {
 #define DRV_SST26_PAGE_SIZE             (256U)
 #define DRV_SST26_ERASE_BUFFER_SIZE     (4096U)
 
+/* Memory Stripe Driver Instance 0 Configuration */
+#define DRV_MEMORY_STRIPE_INDEX_0                0
+#define DRV_MEMORY_STRIPE_BUF_Q_SIZE_IDX0        2
+
+/* Memory Stripe Driver Instance 0 RTOS Configurations*/
+#define DRV_MEMORY_STRIPE_STACK_SIZE_IDX0        1024
+#define DRV_MEMORY_STRIPE_PRIORITY_IDX0          1
+#define DRV_MEMORY_STRIPE_RTOS_DELAY_IDX0        1U
+
+/* Memory Stripe Driver Global Configuration Options */
+#define DRV_MEMORY_STRIPE_INSTANCES_NUMBER       (1U)
+
 
 
 // *****************************************************************************
@@ -55,6 +55,7 @@
 #include "peripheral/nvic/plib_nvic.h"
 #include "peripheral/mpu/plib_mpu.h"
 #include "driver/memory/drv_memory.h"
+#include "driver/memory/drv_memory_stripe.h"
 #include "peripheral/efc/plib_efc.h"
 #include "bsp/bsp.h"
 #include "FreeRTOS.h"
@@ -66,6 +67,7 @@
 #include "system/debug/sys_debug.h"
 #include "app_sst26.h"
 #include "app_nvm.h"
+#include "app_stripe.h"
 #include "app_monitor.h"
 
 
@@ -199,6 +201,7 @@ typedef struct
 {
     SYS_MODULE_OBJ  drvMemory1;
     SYS_MODULE_OBJ  drvMemory0;
+    SYS_MODULE_OBJ  drvMemoryStripe0;
     SYS_MODULE_OBJ  drvSST26;
 
 } SYSTEM_OBJECTS;
@@ -213,6 +216,18 @@ typedef struct
 
 extern SYSTEM_OBJECTS sysObj;
 
+#ifndef SYS_BOOT_TIME_ENABLE
+#define SYS_BOOT_TIME_ENABLE    false
+#endif
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+/* Core clock cycles from the end of CLOCK_Initialize in SYS_Initialize to the
+   call of vTaskStartScheduler in SYS_Tasks, counted by the DWT cycle counter.
+   Divide by configCPU_CLOCK_HZ for the boot time in seconds. The C startup
+   code that runs before main is not included. */
+extern uint32_t SYS_BootCycles;
+#endif
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
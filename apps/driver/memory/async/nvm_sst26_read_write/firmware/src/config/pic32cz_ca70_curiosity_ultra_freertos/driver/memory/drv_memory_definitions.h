@@ -154,6 +154,12 @@ typedef void (*DRV_MEMORY_EVENT_HANDLER)( MEMORY_DEVICE_TRANSFER_STATUS status,
 /* Function pointer typedef to set the event handler with attached media */
 typedef void (*DRV_MEMORY_DEVICE_EVENT_HANDLER_SET) ( const DRV_HANDLE handle, DRV_MEMORY_EVENT_HANDLER eventHandler, uintptr_t context );
 
+/* Function pointer typedef to suspend the program or erase in progress on the attached media */
+typedef bool (*DRV_MEMORY_DEVICE_SUSPEND)( const DRV_HANDLE handle );
+
+/* Function pointer typedef to resume the suspended program or erase on the attached media */
+typedef bool (*DRV_MEMORY_DEVICE_RESUME)( const DRV_HANDLE handle );
+
 /* 
  Summary:
     Memory Device API Interface.
@@ -186,6 +192,12 @@ typedef struct
     DRV_MEMORY_DEVICE_GEOMETRY_GET GeometryGet;
 
     DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET TransferStatusGet;
+
+    /* Optional. When both are set, queued reads are served while a program
+     * or erase operation is suspended, instead of waiting for it. */
+    DRV_MEMORY_DEVICE_SUSPEND Suspend;
+
+    DRV_MEMORY_DEVICE_RESUME Resume;
 } DRV_MEMORY_DEVICE_INTERFACE;
 
 /*
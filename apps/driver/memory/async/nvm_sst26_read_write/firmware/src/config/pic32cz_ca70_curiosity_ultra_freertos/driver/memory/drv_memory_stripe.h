@@ -0,0 +1,468 @@
+/******************************************************************************
+  MEMORY Stripe Driver Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_memory_stripe.h
+
+  Summary:
+    MEMORY Stripe Driver Interface Definition
+
+  Description:
+    The MEMORY Stripe Driver presents several MEMORY driver instances as one
+    block device. Consecutive stripe units of the logical device are spread
+    over the instances in turn, the same way as a RAID-0 array, and each
+    request is split into one transfer per instance which all run at the same
+    time. The erase and program time of one memory device is then hidden
+    behind the transfers of the others.
+
+    The stripe unit is the largest erase block size of the instances. The
+    logical device has the largest read, write and erase block sizes of the
+    instances and as many stripe units per instance as the smallest instance
+    can hold.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_MEMORY_STRIPE_H
+#define DRV_MEMORY_STRIPE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/memory/drv_memory.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* MEMORY Stripe Driver Initialization Data
+
+  Summary:
+    Defines the data required to initialize the MEMORY Stripe driver.
+
+  Remarks:
+    The MEMORY driver instances must allow one more client than the
+    application opens directly, the stripe driver keeps one client of each
+    instance open.
+*/
+
+typedef struct
+{
+    /* MEMORY driver instances striped over, in stripe order */
+    const SYS_MODULE_INDEX *memberIndex;
+
+    /* Number of MEMORY driver instances, up to DRV_MEMORY_STRIPE_MEMBERS_MAX */
+    uint32_t nMembers;
+
+    /* FS enabled */
+    bool isFsEnabled;
+
+    /* Memory Device Type */
+    uint8_t deviceMediaType;
+
+    /* Pointer to Buffer Objects array */
+    uintptr_t bufferObj;
+
+    /* Buffer Queue Size */
+    size_t queueSize;
+
+} DRV_MEMORY_STRIPE_INIT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Stripe Driver System Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// ****************************************************************************
+/* Function:
+    SYS_MODULE_OBJ DRV_MEMORY_STRIPE_Initialize
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const SYS_MODULE_INIT *const init
+    );
+
+  Summary:
+    Initializes the MEMORY Stripe Driver
+
+  Description:
+    This routine initializes the driver instance. The MEMORY driver instances
+    are opened and their geometry combined later, by DRV_MEMORY_STRIPE_Tasks,
+    once they are ready.
+
+  Precondition:
+    None.
+
+  Parameters:
+    drvIndex    - Identifier for the instance to be initialized
+
+    init        - Pointer to the init data structure containing any data
+                  necessary to initialize the driver.
+
+  Returns:
+    If successful, returns a valid handle to a driver instance object.
+    Otherwise, returns SYS_MODULE_OBJ_INVALID.
+
+  Example:
+    <code>
+    static const SYS_MODULE_INDEX drvMemoryStripe0Members[] =
+    {
+        DRV_MEMORY_INDEX_0,
+        DRV_MEMORY_INDEX_1
+    };
+
+    static DRV_MEMORY_STRIPE_BUFFER_OBJECT gDrvMemoryStripe0BufferObject[2];
+
+    static const DRV_MEMORY_STRIPE_INIT drvMemoryStripe0InitData =
+    {
+        .memberIndex    = &drvMemoryStripe0Members[0],
+        .nMembers       = 2,
+        .isFsEnabled    = false,
+        .bufferObj      = (uintptr_t)&gDrvMemoryStripe0BufferObject[0],
+        .queueSize      = 2
+    };
+
+    sysObj.drvMemoryStripe0 = DRV_MEMORY_STRIPE_Initialize(DRV_MEMORY_STRIPE_INDEX_0, (SYS_MODULE_INIT *)&drvMemoryStripe0InitData);
+    </code>
+
+  Remarks:
+    This routine must be called before any other MEMORY Stripe routine is
+    called, after the MEMORY driver instances are initialized.
+*/
+
+SYS_MODULE_OBJ DRV_MEMORY_STRIPE_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT *const init
+);
+
+// *************************************************************************
+/* Function:
+    SYS_STATUS DRV_MEMORY_STRIPE_Status( SYS_MODULE_OBJ object );
+
+  Summary:
+    Gets the current status of the MEMORY Stripe driver module.
+
+  Returns:
+    SYS_STATUS_READY - Indicates that all the MEMORY driver instances are
+    open and the driver is ready to accept requests.
+
+    SYS_STATUS_BUSY - Indicates that the driver is still opening the MEMORY
+    driver instances.
+
+    SYS_STATUS_ERROR - Indicates that the geometries of the MEMORY driver
+    instances can not be striped.
+*/
+
+SYS_STATUS DRV_MEMORY_STRIPE_Status( SYS_MODULE_OBJ object );
+
+// ****************************************************************************
+/* Function:
+    void DRV_MEMORY_STRIPE_Tasks( SYS_MODULE_OBJ object );
+
+  Summary:
+    Maintains the MEMORY Stripe driver's internal state machine.
+
+  Description:
+    This routine splits the request at the head of the queue into transfers
+    of the MEMORY driver instances and completes it once they have all
+    completed.
+
+  Remarks:
+    This routine must be called from SYS_Tasks or from an RTOS task, along
+    with the DRV_MEMORY_Tasks routines of the MEMORY driver instances.
+*/
+
+void DRV_MEMORY_STRIPE_Tasks( SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Stripe Driver Client Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// ****************************************************************************
+/* Function:
+    DRV_HANDLE DRV_MEMORY_STRIPE_Open
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const DRV_IO_INTENT ioIntent
+    );
+
+  Summary:
+    Opens the specified MEMORY Stripe driver instance and returns a handle to
+    it
+
+  Returns:
+    If successful, the routine returns a valid open-instance handle.
+    Otherwise, it returns DRV_HANDLE_INVALID.
+
+  Remarks:
+    An instance has a single client. The routine fails while it is already
+    open or while DRV_MEMORY_STRIPE_Status is not SYS_STATUS_READY.
+*/
+
+DRV_HANDLE DRV_MEMORY_STRIPE_Open
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const DRV_IO_INTENT ioIntent
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_MEMORY_STRIPE_Close( const DRV_HANDLE handle );
+
+  Summary:
+    Closes an opened-instance of the MEMORY Stripe driver
+
+  Remarks:
+    Queued requests are discarded. A request already split into transfers of
+    the MEMORY driver instances completes without a callback.
+*/
+
+void DRV_MEMORY_STRIPE_Close( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    void DRV_MEMORY_STRIPE_AsyncErase
+    (
+        const DRV_HANDLE handle,
+        DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+        uint32_t blockStart,
+        uint32_t nBlock
+    );
+
+  Summary:
+    Erase the specified number of logical erase blocks, in non-blocking mode.
+
+  Description:
+    Queues the request and returns. Each MEMORY driver instance erases its
+    share of the blocks at the same time as the others. The completion is
+    reported through the transfer handler or DRV_MEMORY_STRIPE_CommandStatusGet.
+
+  Returns:
+    The command handle is returned in the commandHandle argument. It will be
+    DRV_MEMORY_COMMAND_HANDLE_INVALID if the request was not queued.
+*/
+
+void DRV_MEMORY_STRIPE_AsyncErase
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    uint32_t blockStart,
+    uint32_t nBlock
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_MEMORY_STRIPE_AsyncEraseWrite
+    (
+        const DRV_HANDLE handle,
+        DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+        void *sourceBuffer,
+        uint32_t blockStart,
+        uint32_t nBlock
+    );
+
+  Summary:
+    Erase and write the specified number of logical write blocks, in
+    non-blocking mode.
+
+  Remarks:
+    Same as DRV_MEMORY_AsyncEraseWrite. The MEMORY driver instances preserve
+    the data of the erase blocks outside of the range written.
+*/
+
+void DRV_MEMORY_STRIPE_AsyncEraseWrite
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    void *sourceBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_MEMORY_STRIPE_AsyncWrite
+    (
+        const DRV_HANDLE handle,
+        DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+        void *sourceBuffer,
+        uint32_t blockStart,
+        uint32_t nBlock
+    );
+
+  Summary:
+    Writes the specified number of logical write blocks, in non-blocking mode.
+
+  Remarks:
+    The blocks must have been erased.
+*/
+
+void DRV_MEMORY_STRIPE_AsyncWrite
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    void *sourceBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_MEMORY_STRIPE_AsyncRead
+    (
+        const DRV_HANDLE handle,
+        DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+        void *targetBuffer,
+        uint32_t blockStart,
+        uint32_t nBlock
+    );
+
+  Summary:
+    Reads the specified number of logical read blocks, in non-blocking mode.
+*/
+
+void DRV_MEMORY_STRIPE_AsyncRead
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    void *targetBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+);
+
+// *****************************************************************************
+/* Function:
+    DRV_MEMORY_COMMAND_STATUS DRV_MEMORY_STRIPE_CommandStatusGet
+    (
+        const DRV_HANDLE handle,
+        const DRV_MEMORY_COMMAND_HANDLE commandHandle
+    );
+
+  Summary:
+    Gets the current status of the command.
+
+  Returns:
+    A DRV_MEMORY_COMMAND_STATUS value describing the current status of the
+    command. Returns DRV_MEMORY_COMMAND_ERROR_UNKNOWN if the client handle or
+    the command handle is not valid.
+*/
+
+DRV_MEMORY_COMMAND_STATUS DRV_MEMORY_STRIPE_CommandStatusGet
+(
+    const DRV_HANDLE handle,
+    const DRV_MEMORY_COMMAND_HANDLE commandHandle
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_MEMORY_STRIPE_TransferHandlerSet
+    (
+        const DRV_HANDLE handle,
+        const void * transferHandler,
+        const uintptr_t context
+    );
+
+  Summary:
+    Sets the pointer to the function, of type DRV_MEMORY_TRANSFER_HANDLER,
+    called once a request completes.
+
+  Remarks:
+    The handler is called from DRV_MEMORY_STRIPE_Tasks and must not queue a
+    new request.
+*/
+
+void DRV_MEMORY_STRIPE_TransferHandlerSet
+(
+    const DRV_HANDLE handle,
+    const void * transferHandler,
+    const uintptr_t context
+);
+
+// *****************************************************************************
+/* Function:
+    SYS_MEDIA_GEOMETRY * DRV_MEMORY_STRIPE_GeometryGet
+    (
+        const DRV_HANDLE handle
+    );
+
+  Summary:
+    Returns the geometry of the striped device.
+
+  Returns:
+    Pointer to the SYS_MEDIA_GEOMETRY of the logical device, NULL if the
+    handle is not valid.
+*/
+
+SYS_MEDIA_GEOMETRY * DRV_MEMORY_STRIPE_GeometryGet
+(
+    const DRV_HANDLE handle
+);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_MEMORY_STRIPE_IsAttached
+    (
+        const DRV_HANDLE handle
+    );
+
+  Summary:
+    Returns the physical attach status of the striped device.
+
+  Returns:
+    true when the handle is valid, false otherwise.
+*/
+
+bool DRV_MEMORY_STRIPE_IsAttached
+(
+    const DRV_HANDLE handle
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "driver/memory/src/drv_memory_stripe_local.h"
+
+#endif // #ifndef DRV_MEMORY_STRIPE_H
+/*******************************************************************************
+ End of File
+*/
@@ -259,6 +259,197 @@ static DRV_MEMORY_CLIENT_OBJECT * DRV_MEMORY_DriverHandleValidate
     return (clientObj);
 }
 
+/* This function removes a buffer object other than the queue head from the
+ * queue and returns it to the free list. */
+static void DRV_MEMORY_QueueRemove
+(
+    DRV_MEMORY_OBJECT *dObj,
+    DRV_MEMORY_BUFFER_OBJECT *bufferObj
+)
+{
+    DRV_MEMORY_BUFFER_OBJECT *previous = dObj->queueHead;
+
+    while (previous->next != bufferObj)
+    {
+        previous = previous->next;
+    }
+
+    previous->next = bufferObj->next;
+
+    if (dObj->queueTail == bufferObj)
+    {
+        dObj->queueTail = previous;
+    }
+
+    bufferObj->next = dObj->buffObjFree;
+    dObj->buffObjFree = bufferObj;
+}
+
+/* This function returns the range of memory offsets [start, end) that a
+ * request reads or modifies. An erase-write modifies whole erase blocks. */
+static void DRV_MEMORY_BufferRangeGet
+(
+    DRV_MEMORY_OBJECT *dObj,
+    DRV_MEMORY_BUFFER_OBJECT *bufferObj,
+    uint32_t *start,
+    uint32_t *end
+)
+{
+    uint32_t blockSize;
+
+    if (bufferObj->opType == DRV_MEM_OP_TYPE_READ)
+    {
+        blockSize = dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].blockSize;
+    }
+    else if (bufferObj->opType == DRV_MEM_OP_TYPE_ERASE)
+    {
+        blockSize = dObj->eraseBlockSize;
+    }
+    else
+    {
+        blockSize = dObj->writeBlockSize;
+    }
+
+    *start = bufferObj->blockStart * blockSize;
+    *end   = *start + (bufferObj->nBlocks * blockSize);
+
+    if (bufferObj->opType == DRV_MEM_OP_TYPE_ERASE_WRITE)
+    {
+        *start -= (*start % dObj->eraseBlockSize);
+
+        if ((*end % dObj->eraseBlockSize) != 0U)
+        {
+            *end += dObj->eraseBlockSize - (*end % dObj->eraseBlockSize);
+        }
+    }
+}
+
+/* This function returns the first queued read that may be served ahead of the
+ * request at the queue head. It must not overlap the head request nor any
+ * write or erase request queued before it. */
+static DRV_MEMORY_BUFFER_OBJECT * DRV_MEMORY_PriorityReadGet( DRV_MEMORY_OBJECT *dObj )
+{
+    DRV_MEMORY_BUFFER_OBJECT *readObj = dObj->queueHead->next;
+    DRV_MEMORY_BUFFER_OBJECT *current = NULL;
+    uint32_t readStart = 0;
+    uint32_t readEnd = 0;
+    uint32_t start = 0;
+    uint32_t end = 0;
+    bool isBlocked = false;
+
+    while (readObj != NULL)
+    {
+        if (readObj->opType == DRV_MEM_OP_TYPE_READ)
+        {
+            DRV_MEMORY_BufferRangeGet(dObj, readObj, &readStart, &readEnd);
+
+            isBlocked = false;
+            current = dObj->queueHead;
+
+            while ((current != readObj) && (isBlocked == false))
+            {
+                if (current->opType != DRV_MEM_OP_TYPE_READ)
+                {
+                    DRV_MEMORY_BufferRangeGet(dObj, current, &start, &end);
+
+                    isBlocked = ((readStart < end) && (start < readEnd));
+                }
+
+                current = current->next;
+            }
+
+            if (isBlocked == false)
+            {
+                return readObj;
+            }
+        }
+
+        readObj = readObj->next;
+    }
+
+    return NULL;
+}
+
+/* This function returns true while a page program or sector erase of the
+ * current request is in progress on the attached memory device. */
+static bool DRV_MEMORY_IsDeviceBusy( DRV_MEMORY_OBJECT *dObj )
+{
+    bool isErasing = (dObj->eraseState == DRV_MEMORY_ERASE_CMD_STATUS);
+    bool isWriting = (dObj->writeState == DRV_MEMORY_WRITE_MEM_STATUS);
+    bool isBusy = false;
+
+    switch (dObj->currentBufObj->opType)
+    {
+        case DRV_MEM_OP_TYPE_WRITE:
+        {
+            isBusy = isWriting;
+            break;
+        }
+
+        case DRV_MEM_OP_TYPE_ERASE:
+        {
+            isBusy = isErasing;
+            break;
+        }
+
+        case DRV_MEM_OP_TYPE_ERASE_WRITE:
+        {
+            isBusy = (((dObj->ewState == DRV_MEMORY_EW_ERASE_SECTOR) && isErasing) ||
+                      ((dObj->ewState == DRV_MEMORY_EW_WRITE_SECTOR) && isWriting));
+            break;
+        }
+
+        default:
+        {
+            /* Reads are not suspended */
+            break;
+        }
+    }
+
+    return isBusy;
+}
+
+/* This function suspends the page program or sector erase in progress when a
+ * queued read may be served ahead of it. */
+static void DRV_MEMORY_ReadPrioritize( DRV_MEMORY_OBJECT *dObj )
+{
+    DRV_MEMORY_BUFFER_OBJECT *readObj = NULL;
+
+    if ((dObj->memoryDevice->Suspend == NULL) || (dObj->memoryDevice->Resume == NULL))
+    {
+        return;
+    }
+
+    if ((dObj->suspendCount >= DRV_MEMORY_SUSPEND_COUNT_MAX) || (DRV_MEMORY_IsDeviceBusy(dObj) == false))
+    {
+        return;
+    }
+
+    readObj = DRV_MEMORY_PriorityReadGet(dObj);
+
+    if (readObj == NULL)
+    {
+        return;
+    }
+
+    /* Fails as well when the operation has just completed, which the next
+     * status check reports */
+    if (dObj->memoryDevice->Suspend(dObj->memDevHandle) == false)
+    {
+        return;
+    }
+
+    dObj->suspendCount++;
+
+    dObj->suspendedReadState = dObj->readState;
+    dObj->readState = DRV_MEMORY_READ_INIT;
+
+    dObj->readBufObj = readObj;
+    readObj->status = DRV_MEMORY_COMMAND_IN_PROGRESS;
+
+    dObj->state = DRV_MEMORY_SUSPENDED;
+}
+
 static void DRV_MEMORY_RemoveClientBufferObjects
 (
     DRV_MEMORY_CLIENT_OBJECT *clientObj,
@@ -427,6 +618,7 @@ static MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_HandleWrite
         case DRV_MEMORY_WRITE_MEM:
         {
             dObj->isTransferDone = false;
+            dObj->suspendCount = 0;
 
             if (dObj->memoryDevice->PageWrite(dObj->memDevHandle, (void *)dObj->writePtr, dObj->blockAddress) == true)
             {
@@ -491,6 +683,7 @@ static MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_HandleErase
         case DRV_MEMORY_ERASE_CMD:
         {
             dObj->isTransferDone = false;
+            dObj->suspendCount = 0;
 
             if (dObj->memoryDevice->SectorErase(dObj->memDevHandle, dObj->blockAddress) == true)
             {
@@ -773,6 +966,8 @@ SYS_MODULE_OBJ DRV_MEMORY_Initialize
     dObj->buffObjFree         = (DRV_MEMORY_BUFFER_OBJECT *)NULL;
     dObj->queueHead           = (DRV_MEMORY_BUFFER_OBJECT *)NULL;
     dObj->queueTail           = (DRV_MEMORY_BUFFER_OBJECT *)NULL;
+    dObj->readBufObj          = (DRV_MEMORY_BUFFER_OBJECT *)NULL;
+    dObj->suspendCount        = 0;
     dObj->bufferToken         = 1;
     dObj->clientToken         = 1;
 
@@ -1211,7 +1406,8 @@ void DRV_MEMORY_Tasks( SYS_MODULE_OBJ object )
             }
             else
             {
-                /* Nothing to do */
+                /* Let a queued read through the program or erase in progress */
+                DRV_MEMORY_ReadPrioritize(dObj);
             }
 
             if (isDone)
@@ -1239,6 +1435,59 @@ void DRV_MEMORY_Tasks( SYS_MODULE_OBJ object )
             break;
         }
 
+        case DRV_MEMORY_SUSPENDED:
+        {
+            bufferObj = dObj->readBufObj;
+
+            if (bufferObj != NULL)
+            {
+                transferStatus = DRV_MEMORY_HandleRead(dObj, &bufferObj->buffer[0], bufferObj->blockStart, bufferObj->nBlocks);
+
+                if (transferStatus == MEMORY_DEVICE_TRANSFER_BUSY)
+                {
+                    break;
+                }
+
+                if (transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED)
+                {
+                    bufferObj->status = DRV_MEMORY_COMMAND_COMPLETED;
+                    event = DRV_MEMORY_EVENT_COMMAND_COMPLETE;
+                }
+                else
+                {
+                    bufferObj->status = DRV_MEMORY_COMMAND_ERROR_UNKNOWN;
+                    event = DRV_MEMORY_EVENT_COMMAND_ERROR;
+                }
+
+                clientObj = (DRV_MEMORY_CLIENT_OBJECT *)bufferObj->hClient;
+
+                DRV_MEMORY_QueueRemove(dObj, bufferObj);
+
+                if(clientObj->transferHandler != NULL)
+                {
+                    clientObj->transferHandler((SYS_MEDIA_BLOCK_EVENT)event, (DRV_MEMORY_COMMAND_HANDLE)bufferObj->commandHandle, clientObj->context);
+                }
+
+                /* Serve the next eligible read before resuming */
+                dObj->readBufObj = DRV_MEMORY_PriorityReadGet(dObj);
+
+                if (dObj->readBufObj != NULL)
+                {
+                    dObj->readState = DRV_MEMORY_READ_INIT;
+                    dObj->readBufObj->status = DRV_MEMORY_COMMAND_IN_PROGRESS;
+                    break;
+                }
+            }
+
+            /* Retried on the next call if the device does not accept it */
+            if (dObj->memoryDevice->Resume(dObj->memDevHandle) == true)
+            {
+                dObj->readState = dObj->suspendedReadState;
+                dObj->state = DRV_MEMORY_TRANSFER;
+            }
+            break;
+        }
+
         case DRV_MEMORY_IDLE:
         {
             break;
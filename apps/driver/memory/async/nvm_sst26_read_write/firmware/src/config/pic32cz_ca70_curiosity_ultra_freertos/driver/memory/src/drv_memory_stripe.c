@@ -0,0 +1,989 @@
+/******************************************************************************
+  MEMORY Stripe Driver Interface Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_memory_stripe.c
+
+  Summary:
+    MEMORY Stripe Driver Interface Definition
+
+  Description:
+    The MEMORY Stripe Driver presents several MEMORY driver instances as one
+    block device and runs the transfers of each request on all of them at the
+    same time.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/memory/src/drv_memory_stripe_local.h"
+#include "system/debug/sys_debug.h"
+
+#if (DRV_MEMORY_STRIPE_SYS_FS_REGISTER == true)
+#include "system/fs/sys_fs_media_manager.h"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global objects
+// *****************************************************************************
+// *****************************************************************************
+
+/*************************************************
+ * Hardware instance objects
+ *************************************************/
+
+static DRV_MEMORY_STRIPE_OBJECT gDrvMemoryStripeObj[DRV_MEMORY_STRIPE_INSTANCES_NUMBER];
+
+#if (DRV_MEMORY_STRIPE_SYS_FS_REGISTER == true)
+/* MISRA C-2012 Rule 11.1 deviated:7 Deviation record ID -  H3_MISRAC_2012_R_11_1_DR_1 */
+
+static const SYS_FS_MEDIA_FUNCTIONS memoryStripeMediaFunctions =
+{
+    .mediaStatusGet     = DRV_MEMORY_STRIPE_IsAttached,
+    .mediaGeometryGet   = DRV_MEMORY_STRIPE_GeometryGet,
+    .sectorRead         = DRV_MEMORY_STRIPE_AsyncRead,
+    .sectorWrite        = DRV_MEMORY_STRIPE_AsyncEraseWrite,
+    .eventHandlerset    = DRV_MEMORY_STRIPE_TransferHandlerSet,
+    .commandStatusGet   = (CommandStatusGetType)DRV_MEMORY_STRIPE_CommandStatusGet,
+    .Read               = DRV_MEMORY_STRIPE_AsyncRead,
+    .erase              = DRV_MEMORY_STRIPE_AsyncErase,
+    .addressGet         = NULL,
+    .open               = DRV_MEMORY_STRIPE_Open,
+    .close              = DRV_MEMORY_STRIPE_Close,
+    .tasks              = DRV_MEMORY_STRIPE_Tasks,
+};
+
+/* MISRAC 2012 deviation block end */
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Stripe Driver Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static inline uint16_t DRV_MEMORY_STRIPE_UPDATE_TOKEN(uint16_t token)
+{
+    token++;
+    if (token >= DRV_MEMORY_TOKEN_MAX)
+    {
+        token = 1;
+    }
+
+    return token;
+}
+
+/* This function returns the geometry table entry giving the block size of an
+ * operation. */
+static uint8_t DRV_MEMORY_STRIPE_GeometryEntryGet( DRV_MEM_OP_TYPE opType )
+{
+    uint8_t entry = SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY;
+
+    if (opType == DRV_MEM_OP_TYPE_READ)
+    {
+        entry = SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY;
+    }
+    else if (opType == DRV_MEM_OP_TYPE_ERASE)
+    {
+        entry = SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY;
+    }
+    else
+    {
+        /* Write and erase-write use the write block size */
+    }
+
+    return entry;
+}
+
+/* This function is called by the MEMORY driver instances when a transfer of
+ * the stripe driver completes. */
+static void DRV_MEMORY_STRIPE_MemberEventHandler
+(
+    DRV_MEMORY_EVENT event,
+    DRV_MEMORY_COMMAND_HANDLE commandHandle,
+    uintptr_t context
+)
+{
+    DRV_MEMORY_STRIPE_MEMBER *member = (DRV_MEMORY_STRIPE_MEMBER *)context;
+
+    if (commandHandle == member->commandHandle)
+    {
+        if (event == DRV_MEMORY_EVENT_COMMAND_COMPLETE)
+        {
+            member->status = DRV_MEMORY_COMMAND_COMPLETED;
+        }
+        else
+        {
+            member->status = DRV_MEMORY_COMMAND_ERROR_UNKNOWN;
+        }
+    }
+}
+
+/* This functions generates the Free pool of buffer objects */
+static void DRV_MEMORY_STRIPE_BufferObjectsInit( DRV_MEMORY_STRIPE_OBJECT *dObj )
+{
+    uint32_t i;
+
+    dObj->buffObjFree = dObj->buffObjArr;
+    dObj->buffObjFree[0].index = 0;
+    dObj->buffObjFree[0].next = NULL;
+
+    for(i = 1; i < dObj->queueSize; i++ )
+    {
+        dObj->buffObjFree[i-1U].next = &dObj->buffObjFree[i];
+        dObj->buffObjFree[i].index = i;
+        dObj->buffObjFree[i].next = NULL;
+    }
+}
+
+/* This function combines the geometries of the MEMORY driver instances. The
+ * logical block sizes are the largest block sizes of the instances and the
+ * stripe unit is the logical erase block. */
+static bool DRV_MEMORY_STRIPE_UpdateGeometry( DRV_MEMORY_STRIPE_OBJECT *dObj )
+{
+    SYS_MEDIA_REGION_GEOMETRY *memberTable = NULL;
+    uint32_t unitsPerMember = 0xFFFFFFFFU;
+    uint32_t units = 0;
+    uint32_t iMember = 0;
+    uint8_t entry = 0;
+
+    for (entry = 0; entry < 3U; entry++)
+    {
+        dObj->mediaGeometryTable[entry].blockSize = 0;
+
+        for (iMember = 0; iMember < dObj->nMembers; iMember++)
+        {
+            memberTable = dObj->members[iMember].geometry->geometryTable;
+
+            if (memberTable[entry].blockSize > dObj->mediaGeometryTable[entry].blockSize)
+            {
+                dObj->mediaGeometryTable[entry].blockSize = memberTable[entry].blockSize;
+            }
+        }
+    }
+
+    dObj->unitSize = dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].blockSize;
+
+    for (iMember = 0; iMember < dObj->nMembers; iMember++)
+    {
+        memberTable = dObj->members[iMember].geometry->geometryTable;
+
+        /* Logical blocks and stripe units must split into whole blocks of
+         * every instance */
+        for (entry = 0; entry < 3U; entry++)
+        {
+            if (((dObj->mediaGeometryTable[entry].blockSize % memberTable[entry].blockSize) != 0U) ||
+                ((dObj->unitSize % dObj->mediaGeometryTable[entry].blockSize) != 0U))
+            {
+                return false;
+            }
+        }
+
+        units = (memberTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].numBlocks * memberTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].blockSize) / dObj->unitSize;
+
+        if (units < unitsPerMember)
+        {
+            unitsPerMember = units;
+        }
+    }
+
+    if (unitsPerMember == 0U)
+    {
+        return false;
+    }
+
+    for (entry = 0; entry < 3U; entry++)
+    {
+        dObj->mediaGeometryTable[entry].numBlocks = unitsPerMember * dObj->nMembers * (dObj->unitSize / dObj->mediaGeometryTable[entry].blockSize);
+    }
+
+    dObj->mediaGeometryObj.mediaProperty = (SYS_MEDIA_PROPERTY)((uint32_t)SYS_MEDIA_READ_IS_BLOCKING | (uint32_t)SYS_MEDIA_WRITE_IS_BLOCKING);
+
+    dObj->mediaGeometryObj.numReadRegions = 1;
+    dObj->mediaGeometryObj.numWriteRegions = 1;
+    dObj->mediaGeometryObj.numEraseRegions = 1;
+    dObj->mediaGeometryObj.geometryTable = (SYS_MEDIA_REGION_GEOMETRY *)&dObj->mediaGeometryTable;
+
+    return true;
+}
+
+/* This function opens the MEMORY driver instances as they become ready and
+ * sets the driver ready once all of them are open. */
+static void DRV_MEMORY_STRIPE_MembersOpen( DRV_MEMORY_STRIPE_OBJECT *dObj )
+{
+    DRV_MEMORY_STRIPE_MEMBER *member = NULL;
+    uint32_t iMember = 0;
+
+    for (iMember = 0; iMember < dObj->nMembers; iMember++)
+    {
+        member = &dObj->members[iMember];
+
+        if (member->handle == DRV_HANDLE_INVALID)
+        {
+            member->handle = DRV_MEMORY_Open(member->drvIndex, DRV_IO_INTENT_READWRITE);
+
+            if (member->handle == DRV_HANDLE_INVALID)
+            {
+                /* Retried on the next call */
+                return;
+            }
+
+            DRV_MEMORY_TransferHandlerSet(member->handle, (const void *)DRV_MEMORY_STRIPE_MemberEventHandler, (uintptr_t)member);
+
+            member->geometry = DRV_MEMORY_GeometryGet(member->handle);
+        }
+    }
+
+    if (DRV_MEMORY_STRIPE_UpdateGeometry(dObj) == true)
+    {
+        dObj->status = SYS_STATUS_READY;
+    }
+    else
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE: Geometries of the memory instances can not be striped.\n");
+        dObj->status = SYS_STATUS_ERROR;
+    }
+}
+
+/* This function queues the next transfer of the current request on a MEMORY
+ * driver instance. Stripe unit u is held by instance (u % nMembers), at
+ * offset (u / nMembers) of that instance. Each read or write transfer covers
+ * one stripe unit, as the units of an instance are not contiguous in the
+ * client buffer. An erase covers all the units of the instance at once.
+ * Returns false once the instance holds no more of the request. */
+static bool DRV_MEMORY_STRIPE_MemberXfer
+(
+    DRV_MEMORY_STRIPE_OBJECT *dObj,
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *bufferObj,
+    DRV_MEMORY_STRIPE_MEMBER *member
+)
+{
+    uint32_t unitStart = member->unit * dObj->unitSize;
+    uint32_t start = unitStart;
+    uint32_t end = unitStart + dObj->unitSize;
+    uint32_t nUnits = 1;
+    uint32_t offset = 0;
+    uint32_t blockSize = 0;
+    uint8_t *buffer = NULL;
+
+    if (unitStart >= dObj->xferEnd)
+    {
+        return false;
+    }
+
+    if (start < dObj->xferStart)
+    {
+        start = dObj->xferStart;
+    }
+
+    if (end > dObj->xferEnd)
+    {
+        end = dObj->xferEnd;
+    }
+
+    offset = ((member->unit / dObj->nMembers) * dObj->unitSize) + (start - unitStart);
+    blockSize = member->geometry->geometryTable[DRV_MEMORY_STRIPE_GeometryEntryGet(bufferObj->opType)].blockSize;
+
+    if (bufferObj->opType != DRV_MEM_OP_TYPE_ERASE)
+    {
+        buffer = &bufferObj->buffer[start - dObj->xferStart];
+    }
+
+    member->status = DRV_MEMORY_COMMAND_IN_PROGRESS;
+
+    switch (bufferObj->opType)
+    {
+        case DRV_MEM_OP_TYPE_READ:
+        {
+            DRV_MEMORY_AsyncRead(member->handle, &member->commandHandle, buffer, offset / blockSize, (end - start) / blockSize);
+            break;
+        }
+
+        case DRV_MEM_OP_TYPE_WRITE:
+        {
+            DRV_MEMORY_AsyncWrite(member->handle, &member->commandHandle, buffer, offset / blockSize, (end - start) / blockSize);
+            break;
+        }
+
+        case DRV_MEM_OP_TYPE_ERASE_WRITE:
+        {
+            DRV_MEMORY_AsyncEraseWrite(member->handle, &member->commandHandle, buffer, offset / blockSize, (end - start) / blockSize);
+            break;
+        }
+
+        case DRV_MEM_OP_TYPE_ERASE:
+        default:
+        {
+            nUnits = ((((dObj->xferEnd - 1U) / dObj->unitSize) - member->unit) / dObj->nMembers) + 1U;
+
+            DRV_MEMORY_AsyncErase(member->handle, &member->commandHandle, offset / blockSize, nUnits * (dObj->unitSize / blockSize));
+            break;
+        }
+    }
+
+    if (member->commandHandle == DRV_MEMORY_COMMAND_HANDLE_INVALID)
+    {
+        /* The queue of the instance is full, retried on the next call */
+        member->status = DRV_MEMORY_COMMAND_COMPLETED;
+    }
+    else
+    {
+        member->unit += nUnits * dObj->nMembers;
+    }
+
+    return true;
+}
+
+/* This function validates the driver handle and returns the instance object
+ * if the handle is valid and the driver is ready. Otherwise NULL is returned. */
+static DRV_MEMORY_STRIPE_OBJECT * DRV_MEMORY_STRIPE_DriverHandleValidate
+(
+    DRV_HANDLE handle
+)
+{
+    uint8_t instance = 0;
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+
+    if ((handle == DRV_HANDLE_INVALID) || (handle == 0U))
+    {
+        return (NULL);
+    }
+
+    instance = (uint8_t)((handle & DRV_MEMORY_INSTANCE_INDEX_MASK) >> 8);
+
+    if (instance >= DRV_MEMORY_STRIPE_INSTANCES_NUMBER)
+    {
+        return (NULL);
+    }
+
+    dObj = &gDrvMemoryStripeObj[instance];
+
+    if ((dObj->isOpen == false) || (dObj->clientHandle != handle) || (dObj->status != SYS_STATUS_READY))
+    {
+        return (NULL);
+    }
+
+    return (dObj);
+}
+
+static void DRV_MEMORY_STRIPE_SetupXfer
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    void *buffer,
+    uint32_t blockStart,
+    uint32_t nBlock,
+    DRV_MEM_OP_TYPE opType,
+    DRV_IO_INTENT io_intent
+)
+{
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *bufferObj = NULL;
+    uint8_t entry = DRV_MEMORY_STRIPE_GeometryEntryGet(opType);
+
+    if (commandHandle != NULL)
+    {
+        *commandHandle = DRV_MEMORY_COMMAND_HANDLE_INVALID;
+    }
+
+    dObj = DRV_MEMORY_STRIPE_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "Invalid Memory Stripe driver handle.\n");
+        return;
+    }
+
+    if (((uint32_t)dObj->intent & (uint32_t)io_intent) == 0U)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "Memory Stripe Driver Opened with invalid intent.\n");
+        return;
+    }
+
+    if ((buffer == NULL) && (opType != DRV_MEM_OP_TYPE_ERASE))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "Memory Stripe Driver Invalid Buffer.\n");
+        return;
+    }
+
+    if ((nBlock == 0U) || (((uint64_t)blockStart + nBlock) > dObj->mediaGeometryTable[entry].numBlocks))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "Memory Stripe Driver Invalid Block parameters.\n");
+        return;
+    }
+
+    if (OSAL_MUTEX_Lock(&dObj->transferMutex, OSAL_WAIT_FOREVER) == OSAL_RESULT_SUCCESS)
+    {
+        if (dObj->buffObjFree != NULL)
+        {
+            /* Get transfer object from the free list */
+            bufferObj = dObj->buffObjFree;
+            dObj->buffObjFree = dObj->buffObjFree->next;
+
+            bufferObj->commandHandle = DRV_MEMORY_MAKE_HANDLE((uint32_t)dObj->bufferToken, (uint32_t)dObj->drvIndex, bufferObj->index);
+            bufferObj->buffer        = (uint8_t *)buffer;
+            bufferObj->blockStart    = blockStart;
+            bufferObj->nBlocks       = nBlock;
+            bufferObj->opType        = opType;
+            bufferObj->status        = DRV_MEMORY_COMMAND_QUEUED;
+            bufferObj->next          = NULL;
+
+            dObj->bufferToken = DRV_MEMORY_STRIPE_UPDATE_TOKEN(dObj->bufferToken);
+
+            if (commandHandle != NULL)
+            {
+                *commandHandle = bufferObj->commandHandle;
+            }
+
+            if (dObj->queueHead == NULL)
+            {
+                dObj->queueHead = bufferObj;
+            }
+            else
+            {
+                dObj->queueTail->next = bufferObj;
+            }
+
+            dObj->queueTail = bufferObj;
+        }
+
+        (void) OSAL_MUTEX_Unlock(&dObj->transferMutex);
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Stripe Driver System Routines
+// *****************************************************************************
+// *****************************************************************************
+
+/* MISRA C-2012 Rule 11.3 and 11.8 deviated below.
+Deviation record ID -  H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1 */
+SYS_MODULE_OBJ DRV_MEMORY_STRIPE_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT *const init
+)
+{
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+    DRV_MEMORY_STRIPE_INIT *stripeInit = (DRV_MEMORY_STRIPE_INIT *)init;
+    uint32_t iMember = 0;
+
+    /* Validate the driver index */
+    if (drvIndex >= DRV_MEMORY_STRIPE_INSTANCES_NUMBER)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj = &gDrvMemoryStripeObj[drvIndex];
+
+    /* Check if the instance has already been initialized. */
+    if (dObj->inUse)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    if ((stripeInit->nMembers == 0U) || (stripeInit->nMembers > DRV_MEMORY_STRIPE_MEMBERS_MAX) || (stripeInit->queueSize == 0U))
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj->status = SYS_STATUS_UNINITIALIZED;
+
+    dObj->inUse             = true;
+    dObj->drvIndex          = (uint8_t)drvIndex;
+    dObj->isOpen            = false;
+    dObj->nMembers          = stripeInit->nMembers;
+    dObj->isFsEnabled       = stripeInit->isFsEnabled;
+    dObj->deviceMediaType   = stripeInit->deviceMediaType;
+    dObj->buffObjArr        = (DRV_MEMORY_STRIPE_BUFFER_OBJECT *)stripeInit->bufferObj;
+    dObj->queueSize         = stripeInit->queueSize;
+    dObj->queueHead         = NULL;
+    dObj->queueTail         = NULL;
+    dObj->bufferToken       = 1;
+    dObj->clientToken       = 1;
+    dObj->state             = DRV_MEMORY_STRIPE_PROCESS_QUEUE;
+
+    for (iMember = 0; iMember < dObj->nMembers; iMember++)
+    {
+        dObj->members[iMember].drvIndex      = stripeInit->memberIndex[iMember];
+        dObj->members[iMember].handle        = DRV_HANDLE_INVALID;
+        dObj->members[iMember].geometry      = NULL;
+        dObj->members[iMember].commandHandle = DRV_MEMORY_COMMAND_HANDLE_INVALID;
+        dObj->members[iMember].status        = DRV_MEMORY_COMMAND_COMPLETED;
+    }
+
+    DRV_MEMORY_STRIPE_BufferObjectsInit(dObj);
+
+    if (OSAL_MUTEX_Create(&dObj->transferMutex) == OSAL_RESULT_FAIL)
+    {
+        /* There was insufficient memory available for the mutex to be created */
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+#if (DRV_MEMORY_STRIPE_SYS_FS_REGISTER == true)
+    if (dObj->isFsEnabled == true)
+    {
+        (void) SYS_FS_MEDIA_MANAGER_Register
+        (
+            (SYS_MODULE_OBJ)drvIndex,
+            (SYS_MODULE_INDEX)drvIndex,
+            &memoryStripeMediaFunctions,
+            (SYS_FS_MEDIA_TYPE)dObj->deviceMediaType
+        );
+    }
+#endif
+
+    /* The MEMORY driver instances are opened by the tasks routine once they
+     * are ready */
+    dObj->status = SYS_STATUS_BUSY;
+
+    return drvIndex;
+}
+
+SYS_STATUS DRV_MEMORY_STRIPE_Status
+(
+    SYS_MODULE_OBJ object
+)
+{
+    /* Validate the object */
+    if ((object == (uint32_t)SYS_MODULE_OBJ_INVALID) || (object >= DRV_MEMORY_STRIPE_INSTANCES_NUMBER))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO,"DRV_MEMORY_STRIPE_Status(): Invalid parameter.\n");
+        return SYS_STATUS_UNINITIALIZED;
+    }
+
+    return (gDrvMemoryStripeObj[object].status);
+}
+
+/* MISRA C-2012 Rule 16.1, 16.3, 16.5, 16.6 deviated below.Deviation record ID -
+  H3_MISRAC_2012_R_16_1_DR_1, H3_MISRAC_2012_R_16_3_DR_1, H3_MISRAC_2012_R_16_5_DR_1 & H3_MISRAC_2012_R_16_6_DR_1*/
+void DRV_MEMORY_STRIPE_Tasks( SYS_MODULE_OBJ object )
+{
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *bufferObj = NULL;
+    DRV_MEMORY_STRIPE_MEMBER *member = NULL;
+    DRV_MEMORY_EVENT event = DRV_MEMORY_EVENT_COMMAND_ERROR;
+    uint32_t blockSize = 0;
+    uint32_t firstUnit = 0;
+    uint32_t iMember = 0;
+    bool isDone = true;
+
+    if ((object == SYS_MODULE_OBJ_INVALID) || (object >= DRV_MEMORY_STRIPE_INSTANCES_NUMBER))
+    {
+        /* Invalid system object */
+        return;
+    }
+
+    dObj = &gDrvMemoryStripeObj[object];
+
+    if (dObj->status == SYS_STATUS_BUSY)
+    {
+        DRV_MEMORY_STRIPE_MembersOpen(dObj);
+        return;
+    }
+
+    if (dObj->status != SYS_STATUS_READY)
+    {
+        return;
+    }
+
+    if (OSAL_MUTEX_Lock(&dObj->transferMutex, OSAL_WAIT_FOREVER) != OSAL_RESULT_SUCCESS)
+    {
+        return;
+    }
+
+    switch (dObj->state)
+    {
+        case DRV_MEMORY_STRIPE_PROCESS_QUEUE:
+        {
+            bufferObj = dObj->queueHead;
+
+            if (bufferObj == NULL)
+            {
+                break;
+            }
+
+            blockSize = dObj->mediaGeometryTable[DRV_MEMORY_STRIPE_GeometryEntryGet(bufferObj->opType)].blockSize;
+
+            dObj->xferStart = bufferObj->blockStart * blockSize;
+            dObj->xferEnd = dObj->xferStart + (bufferObj->nBlocks * blockSize);
+            dObj->isXferError = false;
+            dObj->isXferDiscarded = false;
+
+            /* First stripe unit of the request held by each instance */
+            firstUnit = dObj->xferStart / dObj->unitSize;
+
+            for (iMember = 0; iMember < dObj->nMembers; iMember++)
+            {
+                member = &dObj->members[iMember];
+
+                member->unit = firstUnit + (((iMember + dObj->nMembers) - (firstUnit % dObj->nMembers)) % dObj->nMembers);
+                member->status = DRV_MEMORY_COMMAND_COMPLETED;
+            }
+
+            bufferObj->status = DRV_MEMORY_COMMAND_IN_PROGRESS;
+            dObj->state = DRV_MEMORY_STRIPE_TRANSFER;
+
+            /* Fall through */
+        }
+
+        case DRV_MEMORY_STRIPE_TRANSFER:
+        {
+            bufferObj = dObj->queueHead;
+
+            for (iMember = 0; iMember < dObj->nMembers; iMember++)
+            {
+                member = &dObj->members[iMember];
+
+                if (member->status == DRV_MEMORY_COMMAND_IN_PROGRESS)
+                {
+                    isDone = false;
+                }
+                else
+                {
+                    if (member->status == DRV_MEMORY_COMMAND_ERROR_UNKNOWN)
+                    {
+                        /* Stop queuing transfers, wait for the ones in flight */
+                        dObj->isXferError = true;
+                        member->status = DRV_MEMORY_COMMAND_COMPLETED;
+                    }
+
+                    if ((dObj->isXferError == false) && (DRV_MEMORY_STRIPE_MemberXfer(dObj, bufferObj, member) == true))
+                    {
+                        isDone = false;
+                    }
+                }
+            }
+
+            if (isDone == false)
+            {
+                break;
+            }
+
+            if (dObj->isXferError == false)
+            {
+                bufferObj->status = DRV_MEMORY_COMMAND_COMPLETED;
+                event = DRV_MEMORY_EVENT_COMMAND_COMPLETE;
+            }
+            else
+            {
+                bufferObj->status = DRV_MEMORY_COMMAND_ERROR_UNKNOWN;
+                event = DRV_MEMORY_EVENT_COMMAND_ERROR;
+            }
+
+            /* Go back waiting for the next request */
+            dObj->state = DRV_MEMORY_STRIPE_PROCESS_QUEUE;
+
+            /* Get the next buffer in the queue */
+            dObj->queueHead = bufferObj->next;
+
+            /* Return the processed buffer to free list */
+            bufferObj->next = dObj->buffObjFree;
+            dObj->buffObjFree = bufferObj;
+
+            if ((dObj->isXferDiscarded == false) && (dObj->transferHandler != NULL))
+            {
+                /* Call the event handler */
+                dObj->transferHandler((SYS_MEDIA_BLOCK_EVENT)event, bufferObj->commandHandle, dObj->context);
+            }
+            break;
+        }
+
+        default:
+        {
+            /* Nothing to do */
+            break;
+        }
+    }
+
+    (void) OSAL_MUTEX_Unlock(&dObj->transferMutex);
+}
+
+/* MISRAC 2012 deviation block end */
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Stripe Driver Client Routines
+// *****************************************************************************
+// *****************************************************************************
+
+DRV_HANDLE DRV_MEMORY_STRIPE_Open
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const DRV_IO_INTENT ioIntent
+)
+{
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+    DRV_HANDLE handle = DRV_HANDLE_INVALID;
+
+    /* Validate the driver index */
+    if (drvIndex >= DRV_MEMORY_STRIPE_INSTANCES_NUMBER)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_Open(): Invalid driver index.\n");
+        return DRV_HANDLE_INVALID;
+    }
+
+    dObj = &gDrvMemoryStripeObj[drvIndex];
+
+    if (dObj->status != SYS_STATUS_READY)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_Open(): Driver is not ready.\n");
+        return DRV_HANDLE_INVALID;
+    }
+
+    if (OSAL_MUTEX_Lock(&dObj->transferMutex, OSAL_WAIT_FOREVER) == OSAL_RESULT_SUCCESS)
+    {
+        if (dObj->isOpen == false)
+        {
+            dObj->isOpen = true;
+            dObj->intent = ioIntent;
+            dObj->transferHandler = NULL;
+            dObj->clientHandle = DRV_MEMORY_MAKE_HANDLE((uint32_t)dObj->clientToken, (uint32_t)drvIndex, 0U);
+            dObj->clientToken = DRV_MEMORY_STRIPE_UPDATE_TOKEN(dObj->clientToken);
+
+            handle = dObj->clientHandle;
+        }
+        else
+        {
+            SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_Open(): Driver is already open.\n");
+        }
+
+        (void) OSAL_MUTEX_Unlock(&dObj->transferMutex);
+    }
+
+    return handle;
+}
+
+void DRV_MEMORY_STRIPE_Close
+(
+    const DRV_HANDLE handle
+)
+{
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *bufferObj = NULL;
+    DRV_MEMORY_STRIPE_BUFFER_OBJECT *next = NULL;
+
+    dObj = DRV_MEMORY_STRIPE_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_Close(): Invalid handle.\n");
+        return;
+    }
+
+    if (OSAL_MUTEX_Lock(&dObj->transferMutex, OSAL_WAIT_FOREVER) == OSAL_RESULT_SUCCESS)
+    {
+        bufferObj = dObj->queueHead;
+
+        if ((bufferObj != NULL) && (dObj->state == DRV_MEMORY_STRIPE_TRANSFER))
+        {
+            /* The transfers in flight on the instances complete silently */
+            dObj->isXferDiscarded = true;
+            bufferObj = bufferObj->next;
+            dObj->queueHead->next = NULL;
+            dObj->queueTail = dObj->queueHead;
+        }
+        else
+        {
+            dObj->queueHead = NULL;
+            dObj->queueTail = NULL;
+        }
+
+        while (bufferObj != NULL)
+        {
+            next = bufferObj->next;
+            bufferObj->next = dObj->buffObjFree;
+            dObj->buffObjFree = bufferObj;
+            bufferObj = next;
+        }
+
+        dObj->isOpen = false;
+
+        (void) OSAL_MUTEX_Unlock(&dObj->transferMutex);
+    }
+}
+
+void DRV_MEMORY_STRIPE_AsyncRead
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    void *targetBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    DRV_MEMORY_STRIPE_SetupXfer(handle, commandHandle, targetBuffer, blockStart, nBlock,
+            DRV_MEM_OP_TYPE_READ,
+            DRV_IO_INTENT_READ);
+}
+
+void DRV_MEMORY_STRIPE_AsyncWrite
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    void *sourceBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    DRV_MEMORY_STRIPE_SetupXfer(handle, commandHandle, sourceBuffer, blockStart, nBlock,
+            DRV_MEM_OP_TYPE_WRITE,
+            DRV_IO_INTENT_WRITE);
+}
+
+void DRV_MEMORY_STRIPE_AsyncErase
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    DRV_MEMORY_STRIPE_SetupXfer(handle, commandHandle, NULL, blockStart, nBlock,
+            DRV_MEM_OP_TYPE_ERASE,
+            DRV_IO_INTENT_WRITE);
+}
+
+void DRV_MEMORY_STRIPE_AsyncEraseWrite
+(
+    const DRV_HANDLE handle,
+    DRV_MEMORY_COMMAND_HANDLE *commandHandle,
+    void *sourceBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    DRV_MEMORY_STRIPE_SetupXfer(handle, commandHandle, sourceBuffer, blockStart, nBlock,
+            DRV_MEM_OP_TYPE_ERASE_WRITE,
+            DRV_IO_INTENT_WRITE);
+}
+
+DRV_MEMORY_COMMAND_STATUS DRV_MEMORY_STRIPE_CommandStatusGet
+(
+    const DRV_HANDLE handle,
+    const DRV_MEMORY_COMMAND_HANDLE commandHandle
+)
+{
+    uint16_t iEntry;
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+    DRV_MEMORY_COMMAND_STATUS status = DRV_MEMORY_COMMAND_ERROR_UNKNOWN;
+
+    dObj = DRV_MEMORY_STRIPE_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_CommandStatusGet(): Invalid driver handle.\n");
+        return status;
+    }
+
+    /* The lower 8 bits of the command handle is the buffer index */
+    iEntry = (uint16_t)(commandHandle & DRV_MEMORY_INDEX_MASK);
+
+    if (iEntry >= dObj->queueSize)
+    {
+        return status;
+    }
+
+    if (OSAL_MUTEX_Lock(&dObj->transferMutex, OSAL_WAIT_FOREVER) == OSAL_RESULT_SUCCESS)
+    {
+        /* Compare the buffer handle with buffer handle in the object */
+        if (dObj->buffObjArr[iEntry].commandHandle == commandHandle)
+        {
+            /* Return the last known buffer object status */
+            status = dObj->buffObjArr[iEntry].status;
+        }
+        (void) OSAL_MUTEX_Unlock(&dObj->transferMutex);
+    }
+
+    return status;
+}
+
+/* MISRA C-2012 Rule 11.1 deviated below. Deviation record ID -  H3_MISRAC_2012_R_11_1_DR_1 */
+void DRV_MEMORY_STRIPE_TransferHandlerSet
+(
+    const DRV_HANDLE handle,
+    const void * transferHandler,
+    const uintptr_t context
+)
+{
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+
+    dObj = DRV_MEMORY_STRIPE_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_TransferHandlerSet(): Invalid driver handle.\n");
+        return;
+    }
+
+    /* Set the event handler */
+    dObj->transferHandler = (DRV_MEMORY_TRANSFER_HANDLER)transferHandler;
+    dObj->context = context;
+}
+/* MISRAC 2012 deviation block end */
+
+SYS_MEDIA_GEOMETRY * DRV_MEMORY_STRIPE_GeometryGet
+(
+    const DRV_HANDLE handle
+)
+{
+    DRV_MEMORY_STRIPE_OBJECT *dObj = NULL;
+
+    dObj = DRV_MEMORY_STRIPE_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_GeometryGet(): Invalid driver handle.\n");
+        return NULL;
+    }
+
+    return &dObj->mediaGeometryObj;
+}
+
+bool DRV_MEMORY_STRIPE_IsAttached
+(
+    const DRV_HANDLE handle
+)
+{
+    /* Validate the driver handle */
+    if (DRV_MEMORY_STRIPE_DriverHandleValidate(handle) == NULL)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_STRIPE_IsAttached(): Invalid driver handle.\n");
+        return false;
+    }
+
+    return true;
+}
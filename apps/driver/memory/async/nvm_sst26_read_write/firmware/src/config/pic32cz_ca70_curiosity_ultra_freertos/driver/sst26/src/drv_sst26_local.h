@@ -50,6 +50,38 @@
 #include <string.h>
 #include "configuration.h"
 #include "driver/sst26/drv_sst26.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Constants
+// *****************************************************************************
+// *****************************************************************************
+
+/* Execute-in-place. While no program or erase is in progress the flash stays
+ * mapped in the QSPI memory window in continuous read mode, and reads are
+ * plain memory accesses through the data cache. The window is made cacheable
+ * with MPU region DRV_SST26_XIP_MPU_REGION, which must not be used elsewhere
+ * and takes priority over the lower regions covering the window. */
+#ifndef DRV_SST26_XIP_ENABLE
+#define DRV_SST26_XIP_ENABLE                false
+#endif
+
+#ifndef DRV_SST26_XIP_MPU_REGION
+#define DRV_SST26_XIP_MPU_REGION            (15U)
+#endif
+
+/* Mode bits sent after the address of a high speed read. 0xAX keeps the
+ * flash in continuous read mode, any other value takes it out of it. */
+#define DRV_SST26_XIP_MODE_CONTINUOUS       (0xA0U)
+#define DRV_SST26_XIP_MODE_EXIT             (0xFFU)
+
+/* Largest erase granularity, used to track the range erased in XIP mode */
+#define DRV_SST26_BULK_ERASE_SIZE           (0x10000U)
+
+/* Status register bits */
+#define DRV_SST26_STATUS_BUSY               (0x01U)
+#define DRV_SST26_STATUS_WSE                (0x04U)
+#define DRV_SST26_STATUS_WSP                (0x08U)
 // *****************************************************************************
 // *****************************************************************************
 // Section: Local Data Type Definitions
@@ -115,7 +147,13 @@ typedef enum
     SST26_CMD_UNPROTECT_GLOBAL   = 0x98,
 
     /* Command to write the Flash status register. */
-    SST26_CMD_WRITE_STATUS_REG    = 0x01
+    SST26_CMD_WRITE_STATUS_REG    = 0x01,
+
+    /* Command to suspend a program or erase operation */
+    SST26_CMD_WRITE_SUSPEND      = 0xB0,
+
+    /* Command to resume the suspended program or erase operation */
+    SST26_CMD_WRITE_RESUME       = 0x30
 
 } SST26_CMD;
 
@@ -180,6 +218,33 @@ typedef struct
     /* PLIB API list that will be used by the driver to access the hardware */
     const DRV_SST26_PLIB_INTERFACE *sst26Plib;
 
+    /* A program or erase operation is suspended */
+    bool isSuspended;
+
+    /* Operation to continue on resume */
+    DRV_SST26_OPERATION_TYPE suspendedOpType;
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    /* Flash mapped in the QSPI memory window */
+    bool isXipActive;
+
+    /* A program or erase operation was started and TransferStatusGet has
+     * not seen it complete yet */
+    bool isXipOpPending;
+
+    /* Number of DRV_SST26_XipLock calls not yet undone by DRV_SST26_XipUnlock */
+    uint32_t xipLockCount;
+
+    /* Flash size in bytes, the size of the cacheable region */
+    uint32_t xipSize;
+
+    /* Range programmed or erased since the window was last mapped, whose
+     * cache lines are stale */
+    uint32_t xipDirtyStart;
+
+    uint32_t xipDirtyEnd;
+#endif
+
 } DRV_SST26_OBJECT;
 
 
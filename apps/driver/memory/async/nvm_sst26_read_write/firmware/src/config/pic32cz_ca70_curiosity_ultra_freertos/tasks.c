@@ -60,6 +60,16 @@
 // Section: RTOS "Tasks" Routine
 // *****************************************************************************
 // *****************************************************************************
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_MEMORY_1_Tasks task. */
+static StackType_t lDRV_MEMORY_1_TasksStack[DRV_MEMORY_STACK_SIZE_IDX1];
+static StaticTask_t lDRV_MEMORY_1_TasksTCB;
+#endif
+
 static void lDRV_MEMORY_1_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -69,6 +79,12 @@ static void lDRV_MEMORY_1_Tasks(  void *pvParameters  )
     }
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_MEMORY_0_Tasks task. */
+static StackType_t lDRV_MEMORY_0_TasksStack[DRV_MEMORY_STACK_SIZE_IDX0];
+static StaticTask_t lDRV_MEMORY_0_TasksTCB;
+#endif
+
 static void lDRV_MEMORY_0_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -78,12 +94,33 @@ static void lDRV_MEMORY_0_Tasks(  void *pvParameters  )
     }
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_MEMORY_STRIPE_0_Tasks task. */
+static StackType_t lDRV_MEMORY_STRIPE_0_TasksStack[DRV_MEMORY_STRIPE_STACK_SIZE_IDX0];
+static StaticTask_t lDRV_MEMORY_STRIPE_0_TasksTCB;
+#endif
+
+static void lDRV_MEMORY_STRIPE_0_Tasks(  void *pvParameters  )
+{
+    while(true)
+    {
+        DRV_MEMORY_STRIPE_Tasks(sysObj.drvMemoryStripe0);
+        vTaskDelay(DRV_MEMORY_STRIPE_RTOS_DELAY_IDX0 / portTICK_PERIOD_MS);
+    }
+}
+
 
 /* Handle for the APP_SST26_Tasks. */
 TaskHandle_t xAPP_SST26_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_SST26_Tasks task. */
+static StackType_t lAPP_SST26_TasksStack[1024];
+static StaticTask_t lAPP_SST26_TasksTCB;
+#endif
+
 static void lAPP_SST26_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -98,6 +135,12 @@ TaskHandle_t xAPP_NVM_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_NVM_Tasks task. */
+static StackType_t lAPP_NVM_TasksStack[1024];
+static StaticTask_t lAPP_NVM_TasksTCB;
+#endif
+
 static void lAPP_NVM_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -107,11 +150,37 @@ static void lAPP_NVM_Tasks(  void *pvParameters  )
     }
 }
 
+/* Handle for the APP_STRIPE_Tasks. */
+TaskHandle_t xAPP_STRIPE_Tasks;
+
+
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_STRIPE_Tasks task. */
+static StackType_t lAPP_STRIPE_TasksStack[1024];
+static StaticTask_t lAPP_STRIPE_TasksTCB;
+#endif
+
+static void lAPP_STRIPE_Tasks(  void *pvParameters  )
+{   
+    while(true)
+    {
+        APP_STRIPE_Tasks();
+        vTaskDelay(10U / portTICK_PERIOD_MS);
+    }
+}
+
 /* Handle for the APP_MONITOR_Tasks. */
 TaskHandle_t xAPP_MONITOR_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_MONITOR_Tasks task. */
+static StackType_t lAPP_MONITOR_TasksStack[1024];
+static StaticTask_t lAPP_MONITOR_TasksTCB;
+#endif
+
 static void lAPP_MONITOR_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -143,6 +212,16 @@ void SYS_Tasks ( void )
     
 
     /* Maintain Device Drivers */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        (void)xTaskCreateStatic( lDRV_MEMORY_1_Tasks,
+        "DRV_MEM_1_TASKS",
+        DRV_MEMORY_STACK_SIZE_IDX1,
+        (void*)NULL,
+        DRV_MEMORY_PRIORITY_IDX1 ,
+        lDRV_MEMORY_1_TasksStack,
+        &lDRV_MEMORY_1_TasksTCB
+    );
+#else
         (void)xTaskCreate( lDRV_MEMORY_1_Tasks,
         "DRV_MEM_1_TASKS",
         DRV_MEMORY_STACK_SIZE_IDX1,
@@ -150,7 +229,18 @@ void SYS_Tasks ( void )
         DRV_MEMORY_PRIORITY_IDX1 ,
         (TaskHandle_t*)NULL
     );
+#endif
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void)xTaskCreateStatic( lDRV_MEMORY_0_Tasks,
+        "DRV_MEM_0_TASKS",
+        DRV_MEMORY_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_MEMORY_PRIORITY_IDX0 ,
+        lDRV_MEMORY_0_TasksStack,
+        &lDRV_MEMORY_0_TasksTCB
+    );
+#else
     (void)xTaskCreate( lDRV_MEMORY_0_Tasks,
         "DRV_MEM_0_TASKS",
         DRV_MEMORY_STACK_SIZE_IDX0,
@@ -158,6 +248,26 @@ void SYS_Tasks ( void )
         DRV_MEMORY_PRIORITY_IDX0 ,
         (TaskHandle_t*)NULL
     );
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void)xTaskCreateStatic( lDRV_MEMORY_STRIPE_0_Tasks,
+        "DRV_MEM_STRIPE_0_TASKS",
+        DRV_MEMORY_STRIPE_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_MEMORY_STRIPE_PRIORITY_IDX0 ,
+        lDRV_MEMORY_STRIPE_0_TasksStack,
+        &lDRV_MEMORY_STRIPE_0_TasksTCB
+    );
+#else
+    (void)xTaskCreate( lDRV_MEMORY_STRIPE_0_Tasks,
+        "DRV_MEM_STRIPE_0_TASKS",
+        DRV_MEMORY_STRIPE_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_MEMORY_STRIPE_PRIORITY_IDX0 ,
+        (TaskHandle_t*)NULL
+    );
+#endif
 
 
 
@@ -167,6 +277,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_SST26_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_SST26_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_SST26_Tasks,
+           "APP_SST26_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lAPP_SST26_TasksStack,
+           &lAPP_SST26_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_SST26_Tasks,
            "APP_SST26_Tasks",
@@ -174,8 +294,19 @@ void SYS_Tasks ( void )
            NULL,
            2U ,
            &xAPP_SST26_Tasks);
+#endif
 
     /* Create OS Thread for APP_NVM_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_NVM_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_NVM_Tasks,
+           "APP_NVM_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lAPP_NVM_TasksStack,
+           &lAPP_NVM_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_NVM_Tasks,
            "APP_NVM_Tasks",
@@ -183,8 +314,39 @@ void SYS_Tasks ( void )
            NULL,
            2U ,
            &xAPP_NVM_Tasks);
+#endif
+
+    /* Create OS Thread for APP_STRIPE_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_STRIPE_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_STRIPE_Tasks,
+           "APP_STRIPE_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lAPP_STRIPE_TasksStack,
+           &lAPP_STRIPE_TasksTCB);
+#else
+    (void) xTaskCreate(
+           (TaskFunction_t) lAPP_STRIPE_Tasks,
+           "APP_STRIPE_Tasks",
+           1024,
+           NULL,
+           2U ,
+           &xAPP_STRIPE_Tasks);
+#endif
 
     /* Create OS Thread for APP_MONITOR_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_MONITOR_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_MONITOR_Tasks,
+           "APP_MONITOR_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_MONITOR_TasksStack,
+           &lAPP_MONITOR_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_MONITOR_Tasks,
            "APP_MONITOR_Tasks",
@@ -192,8 +354,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_MONITOR_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -58,6 +58,7 @@
 #include "peripheral/tc/plib_tc0.h"
 #include "driver/sst26/drv_sst26.h"
 #include "system/time/sys_time.h"
+#include "system/profile/sys_profile.h"
 #include "driver/memory/drv_memory_efc.h"
 #include "peripheral/qspi/plib_qspi.h"
 #include "FreeRTOS.h"
@@ -216,6 +217,18 @@ typedef struct
 
 extern SYSTEM_OBJECTS sysObj;
 
+#ifndef SYS_BOOT_TIME_ENABLE
+#define SYS_BOOT_TIME_ENABLE    false
+#endif
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+/* Core clock cycles from the end of CLOCK_Initialize in SYS_Initialize to the
+   call of vTaskStartScheduler in SYS_Tasks, counted by the DWT cycle counter.
+   Divide by configCPU_CLOCK_HZ for the boot time in seconds. The C startup
+   code that runs before main is not included. */
+extern uint32_t SYS_BootCycles;
+#endif
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
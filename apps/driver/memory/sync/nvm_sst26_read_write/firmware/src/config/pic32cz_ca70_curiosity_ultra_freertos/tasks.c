@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP_SST26_Tasks. */
 TaskHandle_t xAPP_SST26_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_SST26_Tasks task. */
+static StackType_t lAPP_SST26_TasksStack[1024];
+static StaticTask_t lAPP_SST26_TasksTCB;
+#endif
+
 static void lAPP_SST26_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -80,6 +90,12 @@ TaskHandle_t xAPP_NVM_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_NVM_Tasks task. */
+static StackType_t lAPP_NVM_TasksStack[1024];
+static StaticTask_t lAPP_NVM_TasksTCB;
+#endif
+
 static void lAPP_NVM_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -94,6 +110,12 @@ TaskHandle_t xAPP_MONITOR_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_MONITOR_Tasks task. */
+static StackType_t lAPP_MONITOR_TasksStack[128];
+static StaticTask_t lAPP_MONITOR_TasksTCB;
+#endif
+
 static void lAPP_MONITOR_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -135,6 +157,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_SST26_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_SST26_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_SST26_Tasks,
+           "APP_SST26_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lAPP_SST26_TasksStack,
+           &lAPP_SST26_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_SST26_Tasks,
            "APP_SST26_Tasks",
@@ -142,8 +174,19 @@ void SYS_Tasks ( void )
            NULL,
            2U ,
            &xAPP_SST26_Tasks);
+#endif
 
     /* Create OS Thread for APP_NVM_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_NVM_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_NVM_Tasks,
+           "APP_NVM_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lAPP_NVM_TasksStack,
+           &lAPP_NVM_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_NVM_Tasks,
            "APP_NVM_Tasks",
@@ -151,8 +194,19 @@ void SYS_Tasks ( void )
            NULL,
            2U ,
            &xAPP_NVM_Tasks);
+#endif
 
     /* Create OS Thread for APP_MONITOR_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_MONITOR_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_MONITOR_Tasks,
+           "APP_MONITOR_Tasks",
+           128,
+           NULL,
+           1U ,
+           lAPP_MONITOR_TasksStack,
+           &lAPP_MONITOR_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_MONITOR_Tasks,
            "APP_MONITOR_Tasks",
@@ -160,8 +214,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_MONITOR_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -119,32 +119,64 @@ static DRV_SDMMC_CLIENT_OBJ* lDRV_SDMMC_DriverHandleValidate(DRV_HANDLE handle)
     return(clientObj);
 }
 
-static DRV_SDMMC_BUFFER_OBJ* lDRV_SDMMC_FreeBufferObjectGet(DRV_SDMMC_CLIENT_OBJ* clientObj)
+static void lDRV_SDMMC_FreeBufferObjectListInit(DRV_SDMMC_OBJ* dObj)
 {
     uint32_t index;
-    DRV_SDMMC_OBJ* dObj = (DRV_SDMMC_OBJ* )&gDrvSDMMCObj[clientObj->drvIndex];
     DRV_SDMMC_BUFFER_OBJ* pBufferObj = (DRV_SDMMC_BUFFER_OBJ*)dObj->bufferObjPool;
 
-    for (index = 0; index < dObj->bufferObjPoolSize; index++)
+    /* Chain all the buffer objects of the pool into the free list */
+    dObj->freeObjList = NULL;
+
+    for (index = dObj->bufferObjPoolSize; index > 0U; index--)
     {
-        if (pBufferObj[index].inUse == false)
-        {
-            pBufferObj[index].inUse = true;
-            pBufferObj[index].next = NULL;
+        pBufferObj[index - 1U].inUse = false;
+        pBufferObj[index - 1U].next = dObj->freeObjList;
+        dObj->freeObjList = &pBufferObj[index - 1U];
+    }
+}
 
-            /* Generate a unique buffer handle consisting of an incrementing
-             * token counter, driver index and the buffer index.
-             */
-            pBufferObj[index].commandHandle = (DRV_SDMMC_COMMAND_HANDLE)lDRV_SDMMC_MAKE_HANDLE(
-                dObj->sdmmcTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+static void lDRV_SDMMC_FreeBufferObjectPut(
+    DRV_SDMMC_OBJ* dObj,
+    DRV_SDMMC_BUFFER_OBJ* bufferObj
+)
+{
+    bufferObj->inUse = false;
 
-            /* Update the token for next time */
-            dObj->sdmmcTokenCount = lDRV_SDMMC_UPDATE_TOKEN(dObj->sdmmcTokenCount);
+    /* Return the buffer object to the head of the free list */
+    bufferObj->next = dObj->freeObjList;
+    dObj->freeObjList = bufferObj;
+}
 
-            return &pBufferObj[index];
-        }
+static DRV_SDMMC_BUFFER_OBJ* lDRV_SDMMC_FreeBufferObjectGet(DRV_SDMMC_CLIENT_OBJ* clientObj)
+{
+    uint32_t index;
+    DRV_SDMMC_OBJ* dObj = (DRV_SDMMC_OBJ* )&gDrvSDMMCObj[clientObj->drvIndex];
+    DRV_SDMMC_BUFFER_OBJ* pBufferObj = dObj->freeObjList;
+
+    if (pBufferObj == NULL)
+    {
+        /* All the buffer objects are in use */
+        return NULL;
     }
-    return NULL;
+
+    /* Take the buffer object at the head of the free list */
+    dObj->freeObjList = pBufferObj->next;
+
+    pBufferObj->inUse = true;
+    pBufferObj->next = NULL;
+
+    index = (uint32_t)(pBufferObj - (DRV_SDMMC_BUFFER_OBJ*)dObj->bufferObjPool);
+
+    /* Generate a unique buffer handle consisting of an incrementing
+     * token counter, driver index and the buffer index.
+     */
+    pBufferObj->commandHandle = (DRV_SDMMC_COMMAND_HANDLE)lDRV_SDMMC_MAKE_HANDLE(
+        dObj->sdmmcTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+
+    /* Update the token for next time */
+    dObj->sdmmcTokenCount = lDRV_SDMMC_UPDATE_TOKEN(dObj->sdmmcTokenCount);
+
+    return pBufferObj;
 }
 /* MISRA C-2012 Rule 11.3 deviated:12 Deviation record ID -  H3_MISRAC_2012_R_11_3_DR_1 */
 
@@ -158,6 +190,8 @@ static bool lDRV_SDMMC_BufferObjectAddToList(
 
     pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&(dObj->bufferObjList);
 
+    bufferObj->next = NULL;
+
     // Is the buffer object list empty?
     if (*pBufferObjList == NULL)
     {
@@ -166,22 +200,12 @@ static bool lDRV_SDMMC_BufferObjectAddToList(
     }
     else
     {
-        // List is not empty. Iterate to the end of the buffer object list.
-        while (*pBufferObjList != NULL)
-        {
-            if ((*pBufferObjList)->next == NULL)
-            {
-                // End of the list reached, add the buffer here.
-                (*pBufferObjList)->next = bufferObj;
-                break;
-            }
-            else
-            {
-                pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&((*pBufferObjList)->next);
-            }
-        }
+        // List is not empty. Add the buffer after the last buffer object.
+        dObj->bufferObjListTail->next = bufferObj;
     }
 
+    dObj->bufferObjListTail = bufferObj;
+
     return isFirstBufferInList;
 }
 
@@ -209,12 +233,18 @@ static void lDRV_SDMMC_RemoveBufferObjFromList(
     if (*pBufferObjList != NULL)
     {
         /* Save the buffer object to be removed. Set the next buffer object as
-         * the new head of the linked list. Reset the removed buffer object. */
+         * the new head of the linked list. Return the removed buffer object to
+         * the free list. */
 
         DRV_SDMMC_BUFFER_OBJ* temp = *pBufferObjList;
         *pBufferObjList = (*pBufferObjList)->next;
-        temp->next = NULL;
-        temp->inUse = false;
+
+        if (*pBufferObjList == NULL)
+        {
+            dObj->bufferObjListTail = NULL;
+        }
+
+        lDRV_SDMMC_FreeBufferObjectPut(dObj, temp);
     }
 }
 
@@ -225,6 +255,7 @@ static void lDRV_SDMMC_RemoveClientBuffersFromList(
 {
     DRV_SDMMC_BUFFER_OBJ** pBufferObjList;
     DRV_SDMMC_BUFFER_OBJ* delBufferObj = NULL;
+    DRV_SDMMC_BUFFER_OBJ* prevBufferObj = NULL;
 
     pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&(dObj->bufferObjList);
 
@@ -247,14 +278,20 @@ static void lDRV_SDMMC_RemoveClientBuffersFromList(
                 clientObj->eventHandler((SYS_MEDIA_BLOCK_EVENT)DRV_SDMMC_EVENT_COMMAND_ERROR, delBufferObj->commandHandle, clientObj->context);
             }
 
-            // Reset the deleted node
+            // The last node was deleted, the previous node is the new tail
+            if (dObj->bufferObjListTail == delBufferObj)
+            {
+                dObj->bufferObjListTail = prevBufferObj;
+            }
+
+            // Return the deleted node to the free list
             delBufferObj->status = DRV_SDMMC_COMMAND_COMPLETED;
-            delBufferObj->next = NULL;
-            delBufferObj->inUse = false;
+            lDRV_SDMMC_FreeBufferObjectPut(dObj, delBufferObj);
         }
         else
         {
             // Move to the next node
+            prevBufferObj = *pBufferObjList;
             pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&((*pBufferObjList)->next);
         }
     }
@@ -287,10 +324,11 @@ static void lDRV_SDMMC_RemoveBufferObjects (
             clientObj->eventHandler((SYS_MEDIA_BLOCK_EVENT)DRV_SDMMC_EVENT_COMMAND_ERROR, delBufferObj->commandHandle, clientObj->context);
         }
 
-        // Reset the deleted node
-        delBufferObj->next = NULL;
-        delBufferObj->inUse = false;
+        // Return the deleted node to the free list
+        lDRV_SDMMC_FreeBufferObjectPut(dObj, delBufferObj);
     }
+
+    dObj->bufferObjListTail = NULL;
 }
 
 static void lDRV_SDMMC_UpdateGeometry( DRV_SDMMC_OBJ* dObj )
@@ -3018,10 +3056,13 @@ SYS_MODULE_OBJ DRV_SDMMC_Initialize (
     dObj->mediaState                        = SYS_MEDIA_DETACHED;
     dObj->clockState                        = DRV_SDMMC_CLOCK_SET_DIVIDER;
     dObj->bufferObjList                     = 0U;
+    dObj->bufferObjListTail                 = NULL;
     dObj->isExclusive                       = false;
     dObj->isCmdTimerExpired                 = false;
     dObj->sleepWhenIdle                     = sdmmcInit->sleepWhenIdle;
 
+    lDRV_SDMMC_FreeBufferObjectListInit(dObj);
+
     /* Register a callback with the underlying SDMMC PLIB */
     dObj->sdmmcPlib->sdhostCallbackRegister(lDRV_SDMMC_PlibCallbackHandler, (uintptr_t)dObj);
 
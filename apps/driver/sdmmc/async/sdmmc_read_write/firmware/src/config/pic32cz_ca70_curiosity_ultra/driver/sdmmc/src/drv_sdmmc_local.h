@@ -665,7 +665,7 @@ typedef struct DRV_SDMMC_BUFFER_OBJ
     /* Operation type - read/write */
     DRV_SDMMC_OPERATION_TYPE            opType;
 
-    /* Pointer to the next buffer in the queue */
+    /* Pointer to the next buffer in the queue or in the free list */
     struct DRV_SDMMC_BUFFER_OBJ*        next;
 
     uint8_t                             fn;
@@ -728,6 +728,12 @@ typedef struct
     /* Linked list of buffer objects */
     uintptr_t                       bufferObjList;
 
+    /* Last buffer object in the buffer object list */
+    DRV_SDMMC_BUFFER_OBJ*           bufferObjListTail;
+
+    /* Linked list of free buffer objects in the buffer pool */
+    DRV_SDMMC_BUFFER_OBJ*           freeObjList;
+
     /* Number of active clients */
     size_t                          nClients;
 
@@ -142,6 +142,19 @@ typedef enum
 
 } HSMCI_READ_RESPONSE_REG;
 
+/* DMA chunk/burst size in words. The same value is used for the HSMCI chunk
+   size (HSMCI_DMA.CHKSIZE), the XDMAC chunk size (CSIZE) and the XDMAC memory
+   burst size (MBSIZE). HSMCI_DMA_BURST_AUTO selects it per transfer. */
+typedef enum
+{
+    HSMCI_DMA_BURST_AUTO = 0,
+    HSMCI_DMA_BURST_1 = 1,
+    HSMCI_DMA_BURST_4 = 4,
+    HSMCI_DMA_BURST_8 = 8,
+    HSMCI_DMA_BURST_16 = 16
+
+} HSMCI_DMA_BURST;
+
 
 typedef void (*HSMCI_CALLBACK) (HSMCI_XFER_STATUS xferStatus, uintptr_t context);
 
@@ -154,6 +167,7 @@ typedef struct
     uint32_t                nBlocks;
     HSMCI_CALLBACK          callback;
     uintptr_t               context;
+    HSMCI_DMA_BURST         dmaBurst;
 } HSMCI_OBJECT;
 
 #define HSMCI_CMD_ERROR         (HSMCI_SR_RTOE_Msk | HSMCI_SR_RENDE_Msk | HSMCI_SR_RDIRE_Msk | HSMCI_SR_RINDE_Msk | HSMCI_SR_RCRCE_Msk)
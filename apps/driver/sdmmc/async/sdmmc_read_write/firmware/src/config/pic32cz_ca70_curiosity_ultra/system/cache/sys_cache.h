@@ -71,6 +71,29 @@
 // *****************************************************************************
 // *****************************************************************************
 
+// *****************************************************************************
+/* System Cache Address Range
+
+  Summary:
+    Describes a memory block for the data cache range routines.
+
+  Description:
+    This structure describes a memory block passed to the
+    SYS_CACHE_*DCache_by_Ranges routines.
+
+  Remarks:
+    The range routines sort and merge the array in place.
+*/
+
+typedef struct
+{
+    /* Start address of the memory block */
+    void *addr;
+
+    /* Size of the memory block in bytes */
+    uint32_t size;
+
+} SYS_CACHE_RANGE;
 
 // *****************************************************************************
 // *****************************************************************************
@@ -474,6 +497,222 @@ void SYS_CACHE_CleanDCache_by_Addr (void *addr, int32_t size);
 */
 void SYS_CACHE_CleanInvalidateDCache_by_Addr (void *addr, int32_t size);
 
+/* Function:
+    SYS_CACHE_CleanDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges)
+
+  Summary:
+    Data Cache Clean of a set of address ranges.
+
+  Description:
+    Cleans Data Cache for a set of memory blocks. The blocks are widened to
+    whole cache lines, sorted and merged, so that each cache line is cleaned
+    once. Blocks inside a non-cacheable region are skipped. When the merged
+    blocks exceed SYS_CACHE_DCACHE_RANGES_THRESHOLD bytes the whole Data
+    Cache is cleaned instead.
+
+  Precondition:
+    None.
+
+  Parameters:
+    ranges  - array of memory blocks, reordered and merged by the call
+    nRanges - number of memory blocks in the array
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+
+    SYS_CACHE_RANGE ranges[2] = {{txHeader, 8U}, {txPayload, payloadSize}};
+
+    SYS_CACHE_CleanDCache_by_Ranges(ranges, 2U);
+
+    </code>
+
+  Remarks:
+    None.
+*/
+void SYS_CACHE_CleanDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges);
+
+/* Function:
+    SYS_CACHE_InvalidateDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges)
+
+  Summary:
+    Data Cache Invalidate of a set of address ranges.
+
+  Description:
+    Invalidates Data Cache for a set of memory blocks. The blocks are widened
+    to whole cache lines, sorted and merged, so that each cache line is
+    invalidated once. Blocks inside a non-cacheable region are skipped.
+
+  Precondition:
+    None.
+
+  Parameters:
+    ranges  - array of memory blocks, reordered and merged by the call
+    nRanges - number of memory blocks in the array
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+
+    SYS_CACHE_InvalidateDCache_by_Ranges(ranges, nRanges);
+
+    </code>
+
+  Remarks:
+    There is no whole cache fallback. A whole Data Cache invalidate would
+    discard the unrelated dirty lines, and a whole Data Cache clean could
+    write stale lines over data received by DMA.
+*/
+void SYS_CACHE_InvalidateDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges);
+
+/* Function:
+    SYS_CACHE_CleanInvalidateDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges)
+
+  Summary:
+    Data Cache Clean and Invalidate of a set of address ranges.
+
+  Description:
+    Cleans and invalidates Data Cache for a set of memory blocks. The blocks
+    are widened to whole cache lines, sorted and merged, so that each cache
+    line is maintained once. Blocks inside a non-cacheable region are
+    skipped. When the merged blocks exceed SYS_CACHE_DCACHE_RANGES_THRESHOLD
+    bytes the whole Data Cache is cleaned and invalidated instead.
+
+  Precondition:
+    None.
+
+  Parameters:
+    ranges  - array of memory blocks, reordered and merged by the call
+    nRanges - number of memory blocks in the array
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+
+    SYS_CACHE_CleanInvalidateDCache_by_Ranges(ranges, nRanges);
+
+    </code>
+
+  Remarks:
+    None.
+*/
+void SYS_CACHE_CleanInvalidateDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges);
+
+/* Function:
+    SYS_CACHE_NonCacheableRegionsLoad (void)
+
+  Summary:
+    Loads the non-cacheable regions from the MPU.
+
+  Description:
+    Replaces the regions loaded by the previous call with the enabled MPU
+    regions whose attributes are not cacheable (strongly-ordered, device or
+    normal non-cacheable memory). A region overlapped by a higher priority
+    region, or with disabled sub-regions, is not loaded. Data Cache
+    maintenance by address or by ranges is skipped for blocks inside these
+    regions. Regions added with SYS_CACHE_NonCacheableRegionAdd are kept.
+
+  Precondition:
+    The MPU is configured.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+
+    MPU_Initialize();
+
+    SYS_CACHE_NonCacheableRegionsLoad();
+
+    </code>
+
+  Remarks:
+    Call from initialization, before any DMA transfer is started. At most
+    SYS_CACHE_NONCACHEABLE_REGIONS_MAX regions are held.
+
+    Call again whenever the MPU regions are changed at run time, otherwise
+    maintenance stays skipped for memory that has become cacheable.
+*/
+void SYS_CACHE_NonCacheableRegionsLoad (void);
+
+/* Function:
+    SYS_CACHE_NonCacheableRegionAdd (void *addr, uint32_t size)
+
+  Summary:
+    Adds a non-cacheable region.
+
+  Description:
+    Adds a memory block to the non-cacheable region table. Data Cache
+    maintenance by address or by ranges is skipped for blocks inside it.
+
+  Precondition:
+    The block is mapped non-cacheable by the MPU.
+
+  Parameters:
+    addr - start address of the region
+    size - size of the region (in number of bytes)
+
+  Returns:
+    true  - the region was added
+    false - the region table is full
+
+  Example:
+    <code>
+
+    SYS_CACHE_NonCacheableRegionAdd(dmaPool, sizeof(dmaPool));
+
+    </code>
+
+  Remarks:
+    Call from initialization. SYS_CACHE_NonCacheableRegionsLoad keeps the
+    regions added here.
+*/
+bool SYS_CACHE_NonCacheableRegionAdd (void *addr, uint32_t size);
+
+/* Function:
+    SYS_CACHE_NonCacheableRegionRemove (void *addr, uint32_t size)
+
+  Summary:
+    Removes a non-cacheable region.
+
+  Description:
+    Removes a region added by SYS_CACHE_NonCacheableRegionAdd or loaded from
+    the MPU. Data Cache maintenance by address or by ranges is done again for
+    blocks inside it.
+
+  Precondition:
+    None.
+
+  Parameters:
+    addr - start address of the region
+    size - size of the region (in number of bytes)
+
+  Returns:
+    true  - the region was removed
+    false - no region with this start address and size is held
+
+  Example:
+    <code>
+
+    SYS_CACHE_NonCacheableRegionRemove(dmaPool, sizeof(dmaPool));
+
+    </code>
+
+  Remarks:
+    Call before the MPU maps the block cacheable again.
+*/
+bool SYS_CACHE_NonCacheableRegionRemove (void *addr, uint32_t size);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -255,7 +255,7 @@
  * memory in the build.  Set to 0 to exclude the ability to create statically
  * allocated objects from the build.  Defaults to 0 if left undefined.  See
  * https://www.freertos.org/Static_Vs_Dynamic_Memory_Allocation.html. */
-#define configSUPPORT_STATIC_ALLOCATION         0
+#define configSUPPORT_STATIC_ALLOCATION         1
 
 /* Set configSUPPORT_DYNAMIC_ALLOCATION to 1 to include FreeRTOS API functions
  * that create FreeRTOS objects (tasks, queues, etc.) using dynamically allocated
@@ -264,8 +264,15 @@
  * https://www.freertos.org/Static_Vs_Dynamic_Memory_Allocation.html. */
 #define configSUPPORT_DYNAMIC_ALLOCATION        1
 
-/* Sets the total size of the FreeRTOS heap, in bytes, when heap_1.c, heap_2.c
- * or heap_4.c are included in the build.  This value is defaulted to 4096 bytes but
+/* Set configKERNEL_PROVIDED_STATIC_MEMORY to 1 to have the kernel provide the
+ * memory of the idle task and of the timer service task when
+ * configSUPPORT_STATIC_ALLOCATION is 1.  Set to 0 to have the application
+ * provide vApplicationGetIdleTaskMemory() and
+ * vApplicationGetTimerTaskMemory().  Defaults to 0 if left undefined. */
+#define configKERNEL_PROVIDED_STATIC_MEMORY     1
+
+/* Sets the total size of the FreeRTOS heap, in bytes, when heap_1.c, heap_2.c,
+ * heap_4.c or heap_tlsf.c are included in the build.  This value is defaulted to 4096 bytes but
  * it must be tailored to each application.  Note the heap will appear in the .bss
  * section.  See https://www.freertos.org/a00111.html. */
 #define configTOTAL_HEAP_SIZE                   ( ( size_t ) 40960 )
@@ -288,6 +295,12 @@
  * corruptions. Defaults to 0 if left undefined. */
 #define configENABLE_HEAP_PROTECTOR                  0
 
+/* heap_tlsf.c hands out blocks of up to ( 1 << configTLSF_FL_INDEX_MAX ) - 1
+ * bytes, headers included, and must be larger than configTOTAL_HEAP_SIZE.
+ * Each increment adds one size class, 84 bytes of free list heads and
+ * counters. */
+#define configTLSF_FL_INDEX_MAX                      16
+
 /******************************************************************************/
 /* Interrupt nesting behaviour configuration. *********************************/
 /******************************************************************************/
@@ -346,17 +359,31 @@
 /* Run time and task stats gathering related definitions. *********************/
 /******************************************************************************/
 
+/* The SYS_PROFILE profiling build, selected with SYS_PROFILE_ENABLE in
+ * configuration.h, turns the run time statistics and the trace facility on
+ * and installs the hooks at the end of this section.  See
+ * system/profile/sys_profile.h. */
+#include "system/profile/sys_profile.h"
+
 /* Set configGENERATE_RUN_TIME_STATS to 1 to have FreeRTOS collect data on the
  * processing time used by each task.  Set to 0 to not collect the data.  The
  * application writer needs to provide a clock source if set to 1.  Defaults to 0
  * if left undefined.  See https://www.freertos.org/rtos-run-time-stats.html. */
+#if (SYS_PROFILE_ENABLE == true)
+#define configGENERATE_RUN_TIME_STATS           1
+#else
 #define configGENERATE_RUN_TIME_STATS           0
+#endif
 
 /* Set configUSE_TRACE_FACILITY to include additional task structure members
  * are used by trace and visualisation functions and tools.  Set to 0 to exclude
  * the additional information from the structures. Defaults to 0 if left
  * undefined. */
+#if (SYS_PROFILE_ENABLE == true)
+#define configUSE_TRACE_FACILITY                1
+#else
 #define configUSE_TRACE_FACILITY                0
+#endif
 
 /* Set to 1 to include the vTaskList() and vTaskGetRunTimeStats() functions in
  * the build.  Set to 0 to exclude these functions from the build.  These two
@@ -365,6 +392,28 @@
  * undefined. */
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+#if (SYS_PROFILE_ENABLE == true)
+/* The run time counter is the SYS_TIME 64-bit counter, counted from the
+ * scheduler start, so the statistics never wrap. */
+#define configRUN_TIME_COUNTER_TYPE                 uint64_t
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    SYS_PROFILE_SchedulerStart()
+#define portGET_RUN_TIME_COUNTER_VALUE()            SYS_PROFILE_RunTimeCounterGet()
+
+/* Scheduler events, expanded inside tasks.c.  The TCB number identifies the
+ * task, it is the xTaskNumber reported by uxTaskGetSystemState(). */
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )     SYS_PROFILE_TaskReady( ( uint32_t ) ( pxTCB )->uxTCBNumber )
+#define traceTASK_SWITCHED_IN()                     SYS_PROFILE_TaskSwitchedIn( ( uint32_t ) pxCurrentTCB->uxTCBNumber )
+
+/* Interrupt handlers entering the kernel to signal a task */
+#define traceENTER_xQueueGenericSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken, xCopyPosition )    SYS_PROFILE_IsrEnter()
+#define traceENTER_xQueueGiveFromISR( xQueue, pxHigherPriorityTaskWoken )                                          SYS_PROFILE_IsrEnter()
+#define traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken )                             SYS_PROFILE_IsrEnter()
+#define traceENTER_xTaskGenericNotifyFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken )    SYS_PROFILE_IsrEnter()
+#define traceENTER_vTaskGenericNotifyGiveFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken )     SYS_PROFILE_IsrEnter()
+#define traceENTER_xTaskResumeFromISR( xTaskToResume )                                                             SYS_PROFILE_IsrEnter()
+#define traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken )                SYS_PROFILE_IsrEnter()
+#endif
+
 /******************************************************************************/
 /* Co-routine related definitions. ********************************************/
 /******************************************************************************/
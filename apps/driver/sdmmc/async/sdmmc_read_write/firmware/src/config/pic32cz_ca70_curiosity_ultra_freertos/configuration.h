@@ -72,6 +72,12 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* OSAL semaphores and mutexes created from static storage */
+#define OSAL_STATIC_SEMAPHORE_COUNT                      (6U)
+
+/* Count the core clock cycles of the boot in SYS_BootCycles */
+#define SYS_BOOT_TIME_ENABLE                             true
+
 
 
 // *****************************************************************************
@@ -88,6 +94,11 @@ extern "C" {
 #define SYS_TIME_CPU_CLOCK_FREQUENCY                (300000000)
 #define SYS_TIME_COMPARE_UPDATE_EXECUTION_CYCLES    (900)
 
+/* RTOS profiling, set SYS_PROFILE_ENABLE to true for the profiling build */
+#define SYS_PROFILE_ENABLE                          false
+#define SYS_PROFILE_MAX_TASKS                       (16U)
+#define SYS_PROFILE_TRACE_SIZE                      (256U)
+
 
 
 // *****************************************************************************
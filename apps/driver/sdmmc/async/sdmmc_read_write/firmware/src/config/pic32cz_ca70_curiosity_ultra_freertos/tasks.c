@@ -60,6 +60,16 @@
 // Section: RTOS "Tasks" Routine
 // *****************************************************************************
 // *****************************************************************************
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_SDMMC0_Tasks task. */
+static StackType_t lDRV_SDMMC0_TasksStack[DRV_SDMMC_STACK_SIZE_IDX0];
+static StaticTask_t lDRV_SDMMC0_TasksTCB;
+#endif
+
 static void lDRV_SDMMC0_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -75,6 +85,12 @@ TaskHandle_t xAPP_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_Tasks task. */
+static StackType_t lAPP_TasksStack[1024];
+static StaticTask_t lAPP_TasksTCB;
+#endif
+
 static void lAPP_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -103,6 +119,16 @@ static void lAPP_Tasks(  void *pvParameters  )
 void SYS_Tasks ( void )
 {
     /* Maintain system services */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        (void) xTaskCreateStatic( lDRV_SDMMC0_Tasks,
+        "DRV_SDMMC0_Tasks",
+        DRV_SDMMC_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_SDMMC_PRIORITY_IDX0 ,
+        lDRV_SDMMC0_TasksStack,
+        &lDRV_SDMMC0_TasksTCB
+    );
+#else
         (void) xTaskCreate( lDRV_SDMMC0_Tasks,
         "DRV_SDMMC0_Tasks",
         DRV_SDMMC_STACK_SIZE_IDX0,
@@ -110,6 +136,7 @@ void SYS_Tasks ( void )
         DRV_SDMMC_PRIORITY_IDX0 ,
         (TaskHandle_t*)NULL
     );
+#endif
 
 
 
@@ -124,6 +151,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_Tasks,
+           "APP_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_TasksStack,
+           &lAPP_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_Tasks,
            "APP_Tasks",
@@ -131,8 +168,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
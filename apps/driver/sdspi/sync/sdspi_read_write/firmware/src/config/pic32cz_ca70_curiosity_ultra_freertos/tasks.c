@@ -60,6 +60,16 @@
 // Section: RTOS "Tasks" Routine
 // *****************************************************************************
 // *****************************************************************************
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_SDSPI_0_Tasks task. */
+static StackType_t lDRV_SDSPI_0_TasksStack[DRV_SDSPI_STACK_SIZE_IDX0];
+static StaticTask_t lDRV_SDSPI_0_TasksTCB;
+#endif
+
 static void lDRV_SDSPI_0_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -75,6 +85,12 @@ TaskHandle_t xAPP_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_Tasks task. */
+static StackType_t lAPP_TasksStack[1024];
+static StaticTask_t lAPP_TasksTCB;
+#endif
+
 static void lAPP_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -106,6 +122,16 @@ void SYS_Tasks ( void )
     
 
     /* Maintain Device Drivers */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        (void) xTaskCreateStatic( lDRV_SDSPI_0_Tasks,
+        "DRV_SD_0_TASKS",
+        DRV_SDSPI_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_SDSPI_PRIORITY_IDX0 ,
+        lDRV_SDSPI_0_TasksStack,
+        &lDRV_SDSPI_0_TasksTCB
+    );
+#else
         (void) xTaskCreate( lDRV_SDSPI_0_Tasks,
         "DRV_SD_0_TASKS",
         DRV_SDSPI_STACK_SIZE_IDX0,
@@ -113,6 +139,7 @@ void SYS_Tasks ( void )
         DRV_SDSPI_PRIORITY_IDX0 ,
         (TaskHandle_t*)NULL
     );
+#endif
 
 
 
@@ -122,6 +149,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_Tasks,
+           "APP_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_TasksStack,
+           &lAPP_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_Tasks,
            "APP_Tasks",
@@ -129,8 +166,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
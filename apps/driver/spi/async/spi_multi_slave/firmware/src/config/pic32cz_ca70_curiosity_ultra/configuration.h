@@ -92,10 +92,17 @@ extern "C" {
 #define DRV_SPI_DMA_MODE
 #define DRV_SPI_XMIT_DMA_CH_IDX0              SYS_DMA_CHANNEL_0
 #define DRV_SPI_RCV_DMA_CH_IDX0               SYS_DMA_CHANNEL_1
+#define DRV_SPI_PIO_THRESHOLD_IDX0            (16U)
 #define DRV_SPI_QUEUE_SIZE_IDX0               4
 
 /* SPI Driver Common Configuration Options */
 #define DRV_SPI_INSTANCES_NUMBER              (1U)
+#define DRV_SPI_PIO_POLL_MAX                  (1U)
+
+/* SPI Driver Scheduler Configuration Options */
+#define DRV_SPI_SCHED_AGING_LIMIT             (4U)
+#define DRV_SPI_SCHED_CPU_CLOCK_FREQUENCY     (300000000U)
+#define DRV_SPI_SCHED_STATISTICS_ENABLE       true
 
 
 
@@ -242,6 +242,127 @@ typedef enum
 
 typedef void (*DRV_SPI_TRANSFER_EVENT_HANDLER )( DRV_SPI_TRANSFER_EVENT event, DRV_SPI_TRANSFER_HANDLE transferHandle, uintptr_t context );
 
+// *****************************************************************************
+/* SPI Driver Transfer Segment
+
+  Summary:
+    Defines one segment of a vectored (scatter-gather) transfer.
+
+  Description:
+    This data type defines one write-read segment of a transfer queued using
+    the DRV_SPI_TransferVectorAdd function. All the segments of a vectored
+    transfer are executed back to back while the chip select remains asserted.
+    The meaning of the members is the same as the corresponding parameters of
+    the DRV_SPI_WriteReadTransferAdd function.
+
+  Remarks:
+    The segment array and the buffers it points to are owned by the driver
+    until the vectored transfer completes.
+*/
+
+typedef struct
+{
+    /* Pointer to the data to be transmitted. NULL if only receiving. */
+    void*       pTransmitData;
+
+    /* Number of words (of the SPI data width) to be transmitted */
+    size_t      txSize;
+
+    /* Pointer to the location where the received data is stored. NULL if
+     * only transmitting. */
+    void*       pReceiveData;
+
+    /* Number of words (of the SPI data width) to be received */
+    size_t      rxSize;
+
+} DRV_SPI_TRANSFER_SEGMENT;
+
+// *****************************************************************************
+/* SPI Driver Transfer Statistics
+
+  Summary:
+    Counts the transfers of a driver instance by data path.
+
+  Description:
+    In DMA mode, transfers (or segments of a vectored transfer) no larger
+    than the instance PIO threshold are moved by a polled register level
+    loop. Larger ones use the DMA channels. This structure reports how many
+    transfers took each path.
+
+  Remarks:
+    The counters wrap around at 2^32.
+*/
+
+typedef struct
+{
+    /* Number of transfers done by the polled fast path */
+    uint32_t    pioTransfers;
+
+    /* Number of transfers done by DMA */
+    uint32_t    dmaTransfers;
+
+} DRV_SPI_TRANSFER_STATISTICS;
+
+// *****************************************************************************
+/* SPI Driver Client Priority
+
+  Summary:
+    Identifies the scheduling class of a client.
+
+  Description:
+    When the bus becomes free, the driver starts a queued transfer of a
+    higher class before the queued transfers of the lower classes.
+
+  Remarks:
+    Clients are opened with DRV_SPI_CLIENT_PRIORITY_NORMAL.
+*/
+
+typedef enum
+{
+    /* Latency sensitive traffic */
+    DRV_SPI_CLIENT_PRIORITY_HIGH = 0,
+
+    /* Default class */
+    DRV_SPI_CLIENT_PRIORITY_NORMAL,
+
+    /* Bulk traffic */
+    DRV_SPI_CLIENT_PRIORITY_LOW,
+
+} DRV_SPI_CLIENT_PRIORITY;
+
+// *****************************************************************************
+/* SPI Driver Client Queue Statistics
+
+  Summary:
+    Reports how long the transfers of a client waited in the queue.
+
+  Description:
+    The wait of a transfer is the time from the transfer add call until its
+    chip select is asserted.
+
+  Remarks:
+    The counters wrap around at 2^32.
+*/
+
+typedef struct
+{
+    /* Number of transfers of the client started on the bus */
+    uint32_t    transferCount;
+
+    /* Average queue wait, in microseconds */
+    uint32_t    averageWaitUs;
+
+    /* Longest queue wait, in microseconds */
+    uint32_t    maxWaitUs;
+
+    /* Number of transfers started after the client deadline had elapsed */
+    uint32_t    deadlineMissCount;
+
+    /* Number of transfers that required the PLIB to be set up again */
+    uint32_t    setupChangeCount;
+
+} DRV_SPI_CLIENT_QUEUE_STATISTICS;
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -852,6 +973,99 @@ void DRV_SPI_ReadTransferAdd(
     size_t  rxSize,
     DRV_SPI_TRANSFER_HANDLE * const transferHandle);
 
+// *****************************************************************************
+/* Function:
+    void DRV_SPI_TransferVectorAdd
+    (
+        const DRV_HANDLE handle,
+        DRV_SPI_TRANSFER_SEGMENT* pSegments,
+        size_t nSegments,
+        DRV_SPI_TRANSFER_HANDLE * const transferHandle
+    );
+
+  Summary:
+    Queues a vectored (scatter-gather) transfer operation.
+
+  Description:
+    This function schedules a non-blocking transfer made of nSegments
+    write-read segments. The segments are executed in order under a single
+    chip select assertion, and a single event is given to the client when the
+    last segment completes. This allows protocols that send a command, an
+    address and a data payload from different buffers to be issued as one
+    queued request.
+
+    The function returns DRV_SPI_TRANSFER_HANDLE_INVALID in the
+    transferHandle argument:
+    - if pSegments is NULL or nSegments is zero.
+    - if any segment has neither a valid transmit nor a valid receive buffer.
+    - if the transfer handle is NULL.
+    - if the queue size is full or queue depth is insufficient.
+    - if the driver handle is invalid.
+
+    If the requesting client registered an event callback with the driver, the
+    driver will issue a DRV_SPI_TRANSFER_EVENT_COMPLETE event if all the
+    segments were processed successfully or DRV_SPI_TRANSFER_EVENT_ERROR event
+    if a segment was not processed successfully. The remaining segments are
+    not executed after an error.
+
+  Precondition:
+    - DRV_SPI_Open must have been called to obtain a valid opened device handle.
+    - DRV_SPI_TransferSetup must have been called if GPIO pin has to be used for
+    chip select or any of the setup parameters has to be changed dynamically.
+
+  Parameters:
+    handle -    Handle of the communication channel as returned by the
+                DRV_SPI_Open function.
+
+    pSegments - Pointer to an array of transfer segments. The array must remain
+                valid until the transfer completes.
+
+    nSegments - Number of segments in the array.
+
+    transferHandle - Handle which is returned by transfer add function.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    uint8_t command[4];
+    uint8_t pageData[256];
+    DRV_SPI_TRANSFER_SEGMENT segments[2];
+    DRV_SPI_TRANSFER_HANDLE transferHandle;
+
+    segments[0].pTransmitData = command;
+    segments[0].txSize = sizeof(command);
+    segments[0].pReceiveData = NULL;
+    segments[0].rxSize = 0;
+
+    segments[1].pTransmitData = pageData;
+    segments[1].txSize = sizeof(pageData);
+    segments[1].pReceiveData = NULL;
+    segments[1].rxSize = 0;
+
+    DRV_SPI_TransferVectorAdd(mySPIhandle, segments, 2, &transferHandle);
+
+    if(transferHandle == DRV_SPI_TRANSFER_HANDLE_INVALID)
+    {
+        
+    }
+    </code>
+
+  Remarks:
+    - This function can be called from within the SPI Driver Transfer Event
+      Handler that is registered by the client.
+    - It should not be called in the event handler associated with another SPI
+      driver instance or event handler of any other peripheral.
+    - It should not be called directly in any ISR.
+*/
+
+void DRV_SPI_TransferVectorAdd(
+    const   DRV_HANDLE  handle,
+    DRV_SPI_TRANSFER_SEGMENT* pSegments,
+    size_t  nSegments,
+    DRV_SPI_TRANSFER_HANDLE * const transferHandle);
+
 // *****************************************************************************
 /* Function:
     void DRV_SPI_TransferEventHandlerSet
@@ -1260,6 +1474,149 @@ bool DRV_SPI_WriteReadTransfer(
 */
 bool DRV_SPI_Lock( const DRV_HANDLE handle, bool lock );
 
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_TransferStatisticsGet( const DRV_HANDLE handle,
+        DRV_SPI_TRANSFER_STATISTICS* statistics )
+
+  Summary:
+    Returns the polled and DMA transfer counts of the driver instance.
+
+  Description:
+    This function copies the number of transfers that the driver instance
+    opened by the client has done by the polled fast path and by DMA.
+
+  Precondition:
+    - DRV_SPI_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle -    Handle of the communication channel as returned by the
+                DRV_SPI_Open function.
+    statistics - Pointer to the structure that receives the counts.
+
+  Returns:
+    - true - the counts were copied
+    - false - the handle or the statistics pointer is not valid
+
+  Example:
+    <code>
+
+    DRV_SPI_TRANSFER_STATISTICS statistics;
+
+    if (DRV_SPI_TransferStatisticsGet(mySPIHandle, &statistics) == true)
+    {
+        // statistics.pioTransfers and statistics.dmaTransfers are valid
+    }
+
+    </code>
+
+  Remarks:
+    - The counts are per driver instance, not per client.
+    - Only a driver instance configured for DMA uses the polled fast path.
+*/
+bool DRV_SPI_TransferStatisticsGet( const DRV_HANDLE handle, DRV_SPI_TRANSFER_STATISTICS* statistics );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_ClientSchedulingSet( const DRV_HANDLE handle,
+        DRV_SPI_CLIENT_PRIORITY priority, uint32_t deadlineUs )
+
+  Summary:
+    Sets the priority class and queue deadline of a client.
+
+  Description:
+    The driver queues the transfers of each priority class separately, in
+    the order they were added. When the bus becomes free it starts:
+    - The oldest transfer of the first class whose oldest transfer is
+      overdue. A transfer is overdue once it has waited longer than the
+      deadline of its client, or once DRV_SPI_SCHED_AGING_LIMIT other
+      transfers have been started ahead of it.
+    - Otherwise the next transfer of the client that had the bus last, if it
+      has one queued in the highest class with queued transfers. Consecutive
+      transfers of a client need no PLIB setup in between.
+    - Otherwise the oldest transfer of the highest class with queued
+      transfers.
+
+    The transfers of a client are always started in the order they were added.
+
+  Precondition:
+    - DRV_SPI_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle -    Handle of the communication channel as returned by the
+                DRV_SPI_Open function.
+    priority -  Priority class of the client.
+    deadlineUs - Longest queue wait in microseconds, or 0 for no deadline.
+
+  Returns:
+    - true - the scheduling parameters were updated
+    - false - the handle, the priority or the deadline is not valid, or the
+              priority differs from the current one while transfers of the
+              client are queued
+
+  Example:
+    <code>
+
+    // Keep the display refresh ahead of the bulk flash traffic
+    DRV_SPI_ClientSchedulingSet(myDisplayHandle, DRV_SPI_CLIENT_PRIORITY_HIGH, 500);
+    DRV_SPI_ClientSchedulingSet(myFlashHandle, DRV_SPI_CLIENT_PRIORITY_LOW, 0);
+
+    </code>
+
+  Remarks:
+    - The transfer in progress is never preempted.
+    - Deadlines need DRV_SPI_SCHED_STATISTICS_ENABLE. Without it only a
+      deadlineUs of 0 is accepted.
+    - Only the asynchronous mode of the driver queues transfers and provides
+      this API.
+*/
+bool DRV_SPI_ClientSchedulingSet( const DRV_HANDLE handle, DRV_SPI_CLIENT_PRIORITY priority, uint32_t deadlineUs );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_ClientQueueStatisticsGet( const DRV_HANDLE handle,
+        DRV_SPI_CLIENT_QUEUE_STATISTICS* statistics )
+
+  Summary:
+    Returns the queue wait counters of a client.
+
+  Description:
+    This function copies the number of transfers of the client started on the
+    bus, their average and longest queue wait, and how many of them missed the
+    deadline or required the PLIB to be set up again.
+
+  Precondition:
+    - DRV_SPI_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle -    Handle of the communication channel as returned by the
+                DRV_SPI_Open function.
+    statistics - Pointer to the structure that receives the counters.
+
+  Returns:
+    - true - the counters were copied
+    - false - the handle or the statistics pointer is not valid
+
+  Example:
+    <code>
+
+    DRV_SPI_CLIENT_QUEUE_STATISTICS statistics;
+
+    if (DRV_SPI_ClientQueueStatisticsGet(myDisplayHandle, &statistics) == true)
+    {
+        // statistics.maxWaitUs is the worst case queue latency
+    }
+
+    </code>
+
+  Remarks:
+    - The counters are cleared when the client is opened.
+    - The waits and deadline misses are only counted with
+      DRV_SPI_SCHED_STATISTICS_ENABLE, they read 0 otherwise.
+    - Only the asynchronous mode of the driver provides this API.
+*/
+bool DRV_SPI_ClientQueueStatisticsGet( const DRV_HANDLE handle, DRV_SPI_CLIENT_QUEUE_STATISTICS* statistics );
+
 /* MISRAC 2012 deviation block end */
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
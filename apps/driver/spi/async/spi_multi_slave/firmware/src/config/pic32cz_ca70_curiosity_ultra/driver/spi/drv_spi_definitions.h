@@ -200,6 +200,9 @@ typedef struct
     /* SPI PLIB writeRead API */
     DRV_SPI_PLIB_WRITE_READ              writeRead;
 
+    /* SPI PLIB polled (blocking, interrupt free) writeRead API */
+    DRV_SPI_PLIB_WRITE_READ              writeReadPolled;
+
     /* SPI PLIB Transfer status API */
     DRV_SPI_PLIB_TRANSMITTER_IS_BUSY     isTransmitterBusy;
 
@@ -238,6 +241,11 @@ typedef struct
 
     /* SPI receive register address used for DMA operation. */
     void*                           spiReceiveAddress;
+
+    /* In DMA mode, transfers of up to this many bytes are done by polling
+     * the PLIB instead of by DMA. 0 disables the polled fast path. */
+    size_t                          pioThreshold;
+
     /* Memory Pool for Client Objects */
     uintptr_t                       clientObjPool;
 
@@ -64,6 +64,18 @@
 
 #define DRV_SPI_TOKEN_MAX                       (0xFFFFU)
 
+/* Timestamping of the queued transfers with the DWT cycle counter. It is
+ * needed for client deadlines and queue wait statistics. */
+#ifndef DRV_SPI_SCHED_STATISTICS_ENABLE
+#define DRV_SPI_SCHED_STATISTICS_ENABLE         false
+#endif
+
+/* CPU cycles per microsecond, used to convert the queue wait timestamps */
+#define DRV_SPI_SCHED_CYCLES_PER_US             (DRV_SPI_SCHED_CPU_CLOCK_FREQUENCY / 1000000U)
+
+/* Number of client priority classes, each with its own transfer queue */
+#define DRV_SPI_SCHED_CLASS_NUMBER              ((uint32_t)DRV_SPI_CLIENT_PRIORITY_LOW + 1U)
+
 
 #define USE_FREQ_CONFIGURED_IN_CLOCK_MANAGER    (0)
 #define NULL_INDEX                              (0xFF)
@@ -152,6 +164,15 @@ typedef struct DRV_SPI_TRANSFER_OBJ_T
     /* Number of bytes to be read */
     size_t                          rxSize;
 
+    /* Segments of a vectored transfer. NULL for a single segment transfer. */
+    DRV_SPI_TRANSFER_SEGMENT*       pSegments;
+
+    /* Number of segments in the transfer */
+    size_t                          nSegments;
+
+    /* Index of the segment currently being transferred */
+    size_t                          segmentIndex;
+
 
     /* Current status of the buffer */
     DRV_SPI_TRANSFER_EVENT          event;
@@ -166,9 +187,19 @@ typedef struct DRV_SPI_TRANSFER_OBJ_T
      * the queue */
     DRV_SPI_TRANSFER_HANDLE         transferHandle;
 
-    /* Next buffer pointer */
+    /* Cycle counter value when the transfer was added to the queue */
+    uint32_t                        queuedAt;
+
+    /* Next buffer pointer in the free list, in the transfer list or in a
+     * class queue */
     struct DRV_SPI_TRANSFER_OBJ_T*   next;
 
+    /* Previous buffer pointer in the class queue */
+    struct DRV_SPI_TRANSFER_OBJ_T*   prev;
+
+    /* Next queued buffer of the same client */
+    struct DRV_SPI_TRANSFER_OBJ_T*   clientNext;
+
 } DRV_SPI_TRANSFER_OBJ;
 
 // *****************************************************************************
@@ -215,9 +246,26 @@ typedef struct
     /* size/depth of the queue */
     uint32_t                        transferObjPoolSize;
 
-    /* Linked list of transfer objects */
+    /* Linked list of transfer objects. It holds the transfer on the bus, the
+     * transfers waiting for the bus are in the class queues. */
     uintptr_t                       transferObjList;
 
+    /* Queued transfers of each client priority class, oldest first */
+    DRV_SPI_TRANSFER_OBJ*           schedQueueHead[DRV_SPI_SCHED_CLASS_NUMBER];
+    DRV_SPI_TRANSFER_OBJ*           schedQueueTail[DRV_SPI_SCHED_CLASS_NUMBER];
+
+    /* Number of transfers started ahead of the oldest transfer of each
+     * class, by the other classes or by the client that had the bus last,
+     * since the class last gave the bus to its oldest transfer */
+    uint32_t                        schedOvertaken[DRV_SPI_SCHED_CLASS_NUMBER];
+
+    /* Linked list of free transfer objects. Freed objects are appended at the
+     * tail so that the least recently used object is allocated first. */
+    DRV_SPI_TRANSFER_OBJ*           freeObjList;
+
+    /* Last transfer object in the free list */
+    DRV_SPI_TRANSFER_OBJ*           freeObjListTail;
+
     /* Instance specific token counter used to generate unique client/transfer handles */
     uint16_t                        spiTokenCount;
 
@@ -240,6 +288,17 @@ typedef struct
     /* This is the SPI receive register address. Used for DMA operation. */
     void*                           rxAddress;
 
+    /* Transfers of up to this many bytes are polled instead of using DMA */
+    size_t                          pioThreshold;
+
+    /* Number of transfers done by polling and by DMA */
+    uint32_t                        pioTransferCount;
+    uint32_t                        dmaTransferCount;
+
+    /* Segments polled since the last DMA transfer was started. Bounds the
+     * polling done from one XDMAC interrupt to DRV_SPI_PIO_POLL_MAX. */
+    uint32_t                        pioPollCount;
+
     bool                            dmaRxChannelIntStatus;
     bool                            dmaTxChannelIntStatus;
     bool                            dmaInterruptStatus;
@@ -274,8 +333,6 @@ typedef struct
     bool                            drvInExclusiveMode;
 
     uint32_t                        exclusiveUseCntr;
-    
-    uint32_t                        transferObjLastUsedIndex;
 
     /* Mutex to protect access to the client objects */
     OSAL_MUTEX_DECLARE(mutexClientObjects);
@@ -330,6 +387,24 @@ typedef struct DRV_SPI_CLIENT_OBJ_T
     /* Client handle assigned to this client object when it was opened */
     DRV_HANDLE                      clientHandle;
 
+    /* Scheduling class of the client */
+    DRV_SPI_CLIENT_PRIORITY         priority;
+
+    /* Longest queue wait in CPU cycles, 0 if the client has no deadline */
+    uint32_t                        deadline;
+
+    /* Queue wait statistics, waits in CPU cycles */
+    uint32_t                        transferCount;
+    uint64_t                        waitTotal;
+    uint32_t                        waitMax;
+    uint32_t                        deadlineMissCount;
+    uint32_t                        setupChangeCount;
+
+    /* Queued transfers of the client, oldest first. They are also in the
+     * queue of the client class. */
+    DRV_SPI_TRANSFER_OBJ*           queueHead;
+    DRV_SPI_TRANSFER_OBJ*           queueTail;
+
 } DRV_SPI_CLIENT_OBJ;
 
 #endif //#ifndef DRV_SPI_LOCAL_H
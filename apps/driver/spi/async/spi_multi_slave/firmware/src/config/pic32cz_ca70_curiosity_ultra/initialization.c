@@ -87,6 +87,9 @@ static const DRV_SPI_PLIB_INTERFACE drvSPI0PlibAPI = {
     /* SPI PLIB WriteRead function */
     .writeRead = (DRV_SPI_PLIB_WRITE_READ)SPI0_WriteRead,
 
+    /* SPI PLIB polled WriteRead function */
+    .writeReadPolled = (DRV_SPI_PLIB_WRITE_READ)SPI0_WriteReadPolled,
+
     /* SPI PLIB Transfer Status function */
     .isTransmitterBusy = (DRV_SPI_PLIB_TRANSMITTER_IS_BUSY)SPI0_IsTransmitterBusy,
 
@@ -139,6 +142,9 @@ static const DRV_SPI_INIT drvSPI0InitData =
     /* SPI Receive Register */
     .spiReceiveAddress  = (void *)&(SPI0_REGS->SPI_RDR),
 
+    /* Largest transfer done by polling instead of DMA */
+    .pioThreshold       = DRV_SPI_PIO_THRESHOLD_IDX0,
+
     /* SPI Queue Size */
     .transferObjPoolSize = DRV_SPI_QUEUE_SIZE_IDX0,
 
@@ -255,46 +255,174 @@ static DRV_SPI_CLIENT_OBJ * lDRV_SPI_DriverHandleValidate(DRV_HANDLE handle)
     return(clientObj);
 }
 
+static void lDRV_SPI_FreeTransferObjPut(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_FREE;
+    transferObj->inUse = false;
+    transferObj->next = NULL;
+
+    /* Append the transfer object to the tail of the free list */
+    if (dObj->freeObjList == NULL)
+    {
+        dObj->freeObjList = transferObj;
+    }
+    else
+    {
+        dObj->freeObjListTail->next = transferObj;
+    }
+
+    dObj->freeObjListTail = transferObj;
+}
+
+static void lDRV_SPI_FreeTransferObjListInit(DRV_SPI_OBJ* dObj)
+{
+    uint32_t index;
+
+    dObj->freeObjList = NULL;
+    dObj->freeObjListTail = NULL;
+
+    for (index = 0; index < dObj->transferObjPoolSize; index++)
+    {
+        lDRV_SPI_FreeTransferObjPut(dObj, &dObj->transferObjPool[index]);
+    }
+}
+
 static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_FreeTransferObjGet(DRV_SPI_CLIENT_OBJ* clientObj)
 {
-    uint32_t i;
     uint32_t index;
     DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ* )&gDrvSPIObj[clientObj->drvIndex];
-    DRV_SPI_TRANSFER_OBJ* pTransferObj = (DRV_SPI_TRANSFER_OBJ*)dObj->transferObjPool;
+    DRV_SPI_TRANSFER_OBJ* pTransferObj = dObj->freeObjList;
 
-    i = 0;
-    index = dObj->transferObjLastUsedIndex;
-    while(i < dObj->transferObjPoolSize)
+    if (pTransferObj == NULL)
     {
-        if (index >= dObj->transferObjPoolSize)
+        /* All the transfer objects are in use */
+        return NULL;
+    }
+
+    /* Take the transfer object at the head of the free list */
+    dObj->freeObjList = pTransferObj->next;
+
+    if (dObj->freeObjList == NULL)
+    {
+        dObj->freeObjListTail = NULL;
+    }
+
+    pTransferObj->inUse = true;
+    pTransferObj->next = NULL;
+
+    index = (uint32_t)(pTransferObj - dObj->transferObjPool);
+
+    /* Generate a unique buffer handle consisting of an incrementing
+     * token counter, driver index and the buffer index.
+     */
+    pTransferObj->transferHandle = (DRV_SPI_TRANSFER_HANDLE)lDRV_SPI_MAKE_HANDLE(
+        dObj->spiTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+
+    /* Update the token for next time */
+    dObj->spiTokenCount = lDRV_SPI_UPDATE_TOKEN(dObj->spiTokenCount);
+
+    return pTransferObj;
+}
+/* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -
+   H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1*/
+
+static bool lDRV_SPI_TransferObjQueueIsEmpty( const DRV_SPI_OBJ* dObj )
+{
+    uint32_t priority;
+    bool isEmpty = true;
+
+    for (priority = 0U; priority < DRV_SPI_SCHED_CLASS_NUMBER; priority++)
+    {
+        if (dObj->schedQueueHead[priority] != NULL)
         {
-            index = 0;
+            isEmpty = false;
         }
-        if (pTransferObj[index].inUse == false)
-        {
-            pTransferObj[index].inUse = true;
-            pTransferObj[index].next = NULL;
+    }
 
-            /* Generate a unique buffer handle consisting of an incrementing
-             * token counter, driver index and the buffer index.
-             */
-            pTransferObj[index].transferHandle = (DRV_SPI_TRANSFER_HANDLE)lDRV_SPI_MAKE_HANDLE(
-                dObj->spiTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+    return isEmpty;
+}
 
-            /* Update the token for next time */
-            dObj->spiTokenCount = lDRV_SPI_UPDATE_TOKEN(dObj->spiTokenCount);
+/* Appends the transfer to the queue of the client class and to the queue of
+ * the client */
+static void lDRV_SPI_TransferObjEnqueue(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_CLIENT_OBJ* clientObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    uint32_t priority = (uint32_t)clientObj->priority;
 
-            dObj->transferObjLastUsedIndex = index + 1U;
+    transferObj->next       = NULL;
+    transferObj->prev       = dObj->schedQueueTail[priority];
+    transferObj->clientNext = NULL;
 
-            return &pTransferObj[index];
-        }
-        i++;
-        index++;
+    if (dObj->schedQueueHead[priority] == NULL)
+    {
+        dObj->schedQueueHead[priority] = transferObj;
     }
-    return NULL;
+    else
+    {
+        dObj->schedQueueTail[priority]->next = transferObj;
+    }
+
+    dObj->schedQueueTail[priority] = transferObj;
+
+    if (clientObj->queueHead == NULL)
+    {
+        clientObj->queueHead = transferObj;
+    }
+    else
+    {
+        clientObj->queueTail->clientNext = transferObj;
+    }
+
+    clientObj->queueTail = transferObj;
+}
+
+/* Takes the oldest queued transfer of the client off the queues. The oldest
+ * transfer of a class is also the oldest of its client. */
+static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_TransferObjDequeue(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_CLIENT_OBJ* clientObj
+)
+{
+    DRV_SPI_TRANSFER_OBJ* transferObj = clientObj->queueHead;
+    uint32_t priority = (uint32_t)clientObj->priority;
+
+    clientObj->queueHead = transferObj->clientNext;
+
+    if (clientObj->queueHead == NULL)
+    {
+        clientObj->queueTail = NULL;
+    }
+
+    if (transferObj->prev == NULL)
+    {
+        dObj->schedQueueHead[priority] = transferObj->next;
+    }
+    else
+    {
+        transferObj->prev->next = transferObj->next;
+    }
+
+    if (transferObj->next == NULL)
+    {
+        dObj->schedQueueTail[priority] = transferObj->prev;
+    }
+    else
+    {
+        transferObj->next->prev = transferObj->prev;
+    }
+
+    transferObj->next       = NULL;
+    transferObj->prev       = NULL;
+    transferObj->clientNext = NULL;
+
+    return transferObj;
 }
-/* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -
-   H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1*/
 
 static bool lDRV_SPI_TransferObjAddToList(
     DRV_SPI_OBJ* dObj,
@@ -304,30 +432,24 @@ static bool lDRV_SPI_TransferObjAddToList(
     DRV_SPI_TRANSFER_OBJ** pTransferObjList;
     bool isFirstTransferInList = false;
 
+    DRV_SPI_CLIENT_OBJ* clientObj;
+
     pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&(dObj->transferObjList);
 
-    // Is the buffer object list empty?
-    if (*pTransferObjList == NULL)
+    transferObj->next = NULL;
+
+    // Is the bus free with no transfer waiting for it?
+    if ((*pTransferObjList == NULL) && (lDRV_SPI_TransferObjQueueIsEmpty(dObj) == true))
     {
         *pTransferObjList = transferObj;
         isFirstTransferInList = true;
     }
     else
     {
-        // List is not empty. Iterate to the end of the buffer object list.
-        while (*pTransferObjList != NULL)
-        {
-            if ((*pTransferObjList)->next == NULL)
-            {
-                // End of the list reached, add the buffer here.
-                (*pTransferObjList)->next = transferObj;
-                break;
-            }
-            else
-            {
-                pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&((*pTransferObjList)->next);
-            }
-        }
+        // Add the buffer after the last buffer object of the client and class
+        clientObj = &((DRV_SPI_CLIENT_OBJ *)dObj->clientObjPool)[transferObj->clientHandle & DRV_SPI_INDEX_MASK];
+
+        lDRV_SPI_TransferObjEnqueue(dObj, clientObj, transferObj);
     }
 
     return isFirstTransferInList;
@@ -343,6 +465,136 @@ static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_TransferObjListGet( DRV_SPI_OBJ* dObj )
     return pTransferObj;
 }
 
+#if (DRV_SPI_SCHED_STATISTICS_ENABLE == true)
+static inline uint32_t lDRV_SPI_TimestampGet(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
+/* Tells whether the transfer at the head of a class queue must go next. This
+ * is the case once it has waited longer than the deadline of its client, or
+ * once DRV_SPI_SCHED_AGING_LIMIT other transfers have been started ahead of
+ * it. */
+static bool lDRV_SPI_TransferObjIsOverdue(
+    const DRV_SPI_OBJ* dObj,
+    const DRV_SPI_TRANSFER_OBJ* transferObj,
+    uint32_t priority
+)
+{
+    bool isOverdue = (dObj->schedOvertaken[priority] >= DRV_SPI_SCHED_AGING_LIMIT);
+
+#if (DRV_SPI_SCHED_STATISTICS_ENABLE == true)
+    const DRV_SPI_CLIENT_OBJ* clientObj;
+
+    clientObj = &((DRV_SPI_CLIENT_OBJ *)dObj->clientObjPool)[transferObj->clientHandle & DRV_SPI_INDEX_MASK];
+
+    if ((clientObj->deadline != 0U) && ((lDRV_SPI_TimestampGet() - transferObj->queuedAt) >= clientObj->deadline))
+    {
+        isOverdue = true;
+    }
+#else
+    (void)transferObj;
+#endif
+
+    return isOverdue;
+}
+
+/* Returns the client whose setup the PLIB holds, NULL if it has closed */
+static DRV_SPI_CLIENT_OBJ* lDRV_SPI_LastClientObjGet( const DRV_SPI_OBJ* dObj )
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    uint32_t index = dObj->lastClientHandle & DRV_SPI_INDEX_MASK;
+
+    if ((dObj->lastClientHandle != DRV_HANDLE_INVALID) && (index < dObj->nClientsMax))
+    {
+        clientObj = &((DRV_SPI_CLIENT_OBJ *)dObj->clientObjPool)[index];
+
+        if (clientObj->clientHandle != dObj->lastClientHandle)
+        {
+            clientObj = NULL;
+        }
+    }
+
+    return clientObj;
+}
+
+/* Moves the next queued transfer to the head of the transfer list and returns
+ * it. Only the oldest transfer of each priority class is looked at: the first
+ * overdue one goes first, otherwise the highest class gets the bus. Within
+ * that class, the client that had the bus last keeps it while it has
+ * transfers queued, which saves reprogramming the PLIB for every transfer of
+ * interleaved clients. The classes that get overtaken are aged, including
+ * the class whose oldest transfer waits behind the last client. */
+static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_TransferObjSchedule( DRV_SPI_OBJ* dObj )
+{
+    DRV_SPI_TRANSFER_OBJ* pSelectedObj = lDRV_SPI_TransferObjListGet(dObj);
+    DRV_SPI_CLIENT_OBJ* clientObj;
+    DRV_SPI_CLIENT_OBJ* lastClientObj;
+    uint32_t selected = DRV_SPI_SCHED_CLASS_NUMBER;
+    uint32_t priority;
+    bool isOverdue = false;
+
+    if (pSelectedObj == NULL)
+    {
+        for (priority = 0U; priority < DRV_SPI_SCHED_CLASS_NUMBER; priority++)
+        {
+            if (dObj->schedQueueHead[priority] != NULL)
+            {
+                if (selected == DRV_SPI_SCHED_CLASS_NUMBER)
+                {
+                    selected = priority;
+                }
+
+                if (lDRV_SPI_TransferObjIsOverdue(dObj, dObj->schedQueueHead[priority], priority) == true)
+                {
+                    selected = priority;
+                    isOverdue = true;
+                    break;
+                }
+            }
+        }
+
+        if (selected != DRV_SPI_SCHED_CLASS_NUMBER)
+        {
+            /* Owner of the oldest transfer of the class */
+            clientObj = &((DRV_SPI_CLIENT_OBJ *)dObj->clientObjPool)[dObj->schedQueueHead[selected]->clientHandle & DRV_SPI_INDEX_MASK];
+
+            if (isOverdue == false)
+            {
+                lastClientObj = lDRV_SPI_LastClientObjGet(dObj);
+
+                if ((lastClientObj != NULL) && (lastClientObj->queueHead != NULL) &&
+                    ((uint32_t)lastClientObj->priority == selected))
+                {
+                    clientObj = lastClientObj;
+                }
+            }
+
+            for (priority = 0U; priority < DRV_SPI_SCHED_CLASS_NUMBER; priority++)
+            {
+                if ((priority == selected) && (clientObj->queueHead == dObj->schedQueueHead[priority]))
+                {
+                    dObj->schedOvertaken[priority] = 0U;
+                }
+                else if (dObj->schedQueueHead[priority] != NULL)
+                {
+                    dObj->schedOvertaken[priority]++;
+                }
+                else
+                {
+                    /* Nothing waiting in this class */
+                }
+            }
+
+            pSelectedObj = lDRV_SPI_TransferObjDequeue(dObj, clientObj);
+            dObj->transferObjList = (uintptr_t)pSelectedObj;
+        }
+    }
+
+    return pSelectedObj;
+}
+
 static void lDRV_SPI_RemoveTransferObjFromList( DRV_SPI_OBJ* dObj )
 {
     DRV_SPI_TRANSFER_OBJ** pTransferObjList;
@@ -353,13 +605,13 @@ static void lDRV_SPI_RemoveTransferObjFromList( DRV_SPI_OBJ* dObj )
     if (*pTransferObjList != NULL)
     {
         /* Save the buffer object to be removed. Set the next buffer object as
-         * the new head of the linked list. Reset the removed buffer object. */
+         * the new head of the linked list. Return the removed buffer object to
+         * the free list. */
 
         DRV_SPI_TRANSFER_OBJ* temp = *pTransferObjList;
         *pTransferObjList = (*pTransferObjList)->next;
-        temp->currentState = DRV_SPI_TRANSFER_OBJ_IS_FREE;
-        temp->next = NULL;
-        temp->inUse = false;
+
+        lDRV_SPI_FreeTransferObjPut(dObj, temp);
     }
 }
 
@@ -368,34 +620,17 @@ static void lDRV_SPI_RemoveClientTransfersFromList(
     DRV_SPI_CLIENT_OBJ* clientObj
 )
 {
-    DRV_SPI_TRANSFER_OBJ** pTransferObjList;
     DRV_SPI_TRANSFER_OBJ* delTransferObj = NULL;
 
-    pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&(dObj->transferObjList);
-
-    while (*pTransferObjList != NULL)
+    /* The transfer in process is at the head of the transfer list and is not
+     * removed. The queued transfers are in the queue of the client. */
+    while (clientObj->queueHead != NULL)
     {
-        // Do not remove the buffer object that is already in process
-        if (((*pTransferObjList)->clientHandle == clientObj->clientHandle) &&
-                ((*pTransferObjList)->currentState == DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE))
-        {
-            // Save the node to be deleted off the list
-            delTransferObj = *pTransferObjList;
-
-            // Update the current node to point to the deleted node's next
-            *pTransferObjList = (DRV_SPI_TRANSFER_OBJ*)(*pTransferObjList)->next;
+        delTransferObj = lDRV_SPI_TransferObjDequeue(dObj, clientObj);
 
-            // Reset the deleted node
-            delTransferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_FREE;
-            delTransferObj->event = DRV_SPI_TRANSFER_EVENT_COMPLETE;
-            delTransferObj->next = NULL;
-            delTransferObj->inUse = false;
-        }
-        else
-        {
-            // Move to the next node
-            pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&((*pTransferObjList)->next);
-        }
+        // Return the deleted node to the free list
+        delTransferObj->event = DRV_SPI_TRANSFER_EVENT_COMPLETE;
+        lDRV_SPI_FreeTransferObjPut(dObj, delTransferObj);
     }
 }
 
@@ -496,6 +731,54 @@ static void lDRV_SPI_StartDMATransfer(DRV_SPI_TRANSFER_OBJ* transferObj)
 }
 /* MISRAC 2012 deviation block end */
 
+static void lDRV_SPI_TransferSegmentLoad(
+    DRV_SPI_CLIENT_OBJ* clientObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj,
+    const DRV_SPI_TRANSFER_SEGMENT* segment
+)
+{
+    transferObj->pReceiveData   = segment->pReceiveData;
+    transferObj->pTransmitData  = segment->pTransmitData;
+
+    if (clientObj->setup.dataBits == DRV_SPI_DATA_BITS_8)
+    {
+        transferObj->txSize = segment->txSize;
+        transferObj->rxSize = segment->rxSize;
+    }
+    else if (clientObj->setup.dataBits <= DRV_SPI_DATA_BITS_16)
+    {
+        /* Both SPI and DMA PLIB expect size to be in terms of bytes */
+        transferObj->txSize = segment->txSize << 1;
+        transferObj->rxSize = segment->rxSize << 1;
+    }
+    else
+    {
+        /* Both SPI and DMA PLIB expect size to be in terms of bytes */
+        transferObj->txSize = segment->txSize << 2;
+        transferObj->rxSize = segment->rxSize << 2;
+    }
+}
+
+static bool lDRV_SPI_TransferNextSegmentLoad(
+    DRV_SPI_CLIENT_OBJ* clientObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    /* Stop the vectored transfer if the client that submitted it has closed
+     * the driver or if the last segment has been transferred */
+    if ((clientObj->clientHandle != transferObj->clientHandle) ||
+        ((transferObj->segmentIndex + 1U) >= transferObj->nSegments))
+    {
+        return false;
+    }
+
+    transferObj->segmentIndex++;
+
+    lDRV_SPI_TransferSegmentLoad(clientObj, transferObj, &transferObj->pSegments[transferObj->segmentIndex]);
+
+    return true;
+}
+
 static void lDRV_SPI_UpdateTransferSetupAndAssertCS(
     DRV_SPI_TRANSFER_OBJ* transferObj
 )
@@ -503,6 +786,9 @@ static void lDRV_SPI_UpdateTransferSetupAndAssertCS(
     DRV_SPI_OBJ* dObj;
     DRV_SPI_CLIENT_OBJ* clientObj;
     DRV_SPI_TRANSFER_SETUP setupRemap;
+#if (DRV_SPI_SCHED_STATISTICS_ENABLE == true)
+    uint32_t wait;
+#endif
 
     /* Get the client object that owns this buffer */
     clientObj = &((DRV_SPI_CLIENT_OBJ *)gDrvSPIObj[((transferObj->clientHandle & DRV_SPI_INSTANCE_MASK) >> 8)].clientObjPool)
@@ -510,10 +796,31 @@ static void lDRV_SPI_UpdateTransferSetupAndAssertCS(
 
     dObj = (DRV_SPI_OBJ*)&gDrvSPIObj[clientObj->drvIndex];
 
+    clientObj->transferCount++;
+
+#if (DRV_SPI_SCHED_STATISTICS_ENABLE == true)
+    /* Update the queue wait statistics of the client */
+    wait = lDRV_SPI_TimestampGet() - transferObj->queuedAt;
+
+    clientObj->waitTotal += wait;
+
+    if (wait > clientObj->waitMax)
+    {
+        clientObj->waitMax = wait;
+    }
+
+    if ((clientObj->deadline != 0U) && (wait > clientObj->deadline))
+    {
+        clientObj->deadlineMissCount++;
+    }
+#endif
+
     /* Update the PLIB Setup if current request is from a different client or
      * setup has been changed dynamically for the client */
     if((transferObj->clientHandle != dObj->lastClientHandle) || (clientObj->setupChanged == true))
     {
+        clientObj->setupChangeCount++;
+
         setupRemap = clientObj->setup;
         setupRemap.clockPolarity = (DRV_SPI_CLOCK_POLARITY)dObj->remapClockPolarity[clientObj->setup.clockPolarity];
         setupRemap.clockPhase = (DRV_SPI_CLOCK_PHASE)dObj->remapClockPhase[clientObj->setup.clockPhase];
@@ -538,6 +845,144 @@ static void lDRV_SPI_UpdateTransferSetupAndAssertCS(
     }
 }
 
+/* Ends the transfer at the head of the queue: de-asserts the chip select,
+ * frees the transfer object and gives the event to its client. Returns the
+ * next queued transfer, already set up and with its chip select asserted, or
+ * NULL if there is none to start. */
+static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_TransferComplete(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_CLIENT_OBJ* clientObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj,
+    DRV_SPI_TRANSFER_EVENT event
+)
+{
+    DRV_SPI_TRANSFER_HANDLE transferHandle;
+
+    /* Make sure the shift register is empty before de-asserting the CS line */
+    while (dObj->spiPlib->isTransmitterBusy())
+    {
+        /* Do Nothing */
+    }
+
+    /* De-assert Chip Select if it is defined by user */
+    if(clientObj->setup.chipSelect != SYS_PORT_PIN_NONE)
+    {
+        if (clientObj->setup.csPolarity == DRV_SPI_CS_POLARITY_ACTIVE_LOW)
+        {
+            SYS_PORT_PinSet(clientObj->setup.chipSelect);
+        }
+        else
+        {
+            SYS_PORT_PinClear(clientObj->setup.chipSelect);
+        }
+    }
+
+    /* Check if the client that submitted the request is active? */
+    if (clientObj->clientHandle == transferObj->clientHandle)
+    {
+        transferObj->event = event;
+
+        /* Save the transfer handle locally before freeing the transfer object*/
+        transferHandle = transferObj->transferHandle;
+
+        /* Free the completed buffer.
+         * This is done before giving callback to allow application to use the freed
+         * buffer and queue in a new request from within the callback */
+
+        lDRV_SPI_RemoveTransferObjFromList(dObj);
+
+        if(clientObj->eventHandler != NULL)
+        {
+            /* Call the event handler. We additionally increment the
+            interrupt nesting count which lets the driver functions
+            that are called from the event handler know that an
+            interrupt context is active. */
+            dObj->interruptNestingCount++;
+
+            clientObj->eventHandler(event, transferHandle, clientObj->context);
+
+            /* Event handler has completed, so decrement the nesting count now */
+            dObj->interruptNestingCount--;
+        }
+    }
+    else
+    {
+        /* Free the completed buffer */
+        lDRV_SPI_RemoveTransferObjFromList(dObj);
+    }
+
+    /* Move the next queued transfer to the head of the list */
+    transferObj = lDRV_SPI_TransferObjSchedule(dObj);
+
+    if((transferObj != NULL) && (transferObj->currentState == DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE))
+    {
+        /* Process the next transfer buffer */
+        lDRV_SPI_UpdateTransferSetupAndAssertCS(transferObj);
+        transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_PROCESSING;
+
+        return transferObj;
+    }
+
+    return NULL;
+}
+
+/* Transfers no larger than the PIO threshold cost less to poll than to set
+ * up the DMA channels and maintain the cache for */
+static bool lDRV_SPI_PIOTransferIsSelected(const DRV_SPI_OBJ* dObj, const DRV_SPI_TRANSFER_OBJ* transferObj)
+{
+    size_t size = (transferObj->txSize > transferObj->rxSize) ? transferObj->txSize : transferObj->rxSize;
+
+    return ((dObj->spiPlib->writeReadPolled != NULL) && (size <= dObj->pioThreshold));
+}
+
+/* Runs the current segment of transferObj in DMA mode. Short segments are
+ * polled to completion here, followed by the next segments and queued
+ * transfers, until one needs DMA or the queue is empty. This runs from the
+ * XDMAC interrupt, so at most DRV_SPI_PIO_POLL_MAX segments are polled before
+ * a DMA transfer is started; the segment after that goes by DMA whatever its
+ * size, and its completion interrupt carries on with the queue. Transfers
+ * queued by the event handlers are picked up by this loop, it is never
+ * entered again from within itself. */
+static void lDRV_SPI_TransferProcess(DRV_SPI_OBJ* dObj, DRV_SPI_TRANSFER_OBJ* transferObj)
+{
+    DRV_SPI_CLIENT_OBJ* clientObj;
+
+    while (transferObj != NULL)
+    {
+        if ((dObj->pioPollCount >= DRV_SPI_PIO_POLL_MAX) || (lDRV_SPI_PIOTransferIsSelected(dObj, transferObj) == false))
+        {
+            dObj->pioPollCount = 0U;
+            dObj->dmaTransferCount++;
+            lDRV_SPI_StartDMATransfer(transferObj);
+            return;
+        }
+
+        /* Get the client object that owns this buffer */
+        clientObj = &((DRV_SPI_CLIENT_OBJ *)dObj->clientObjPool)[transferObj->clientHandle & DRV_SPI_INDEX_MASK];
+
+        dObj->pioTransferCount++;
+        dObj->pioPollCount++;
+
+        /* The polled transfer has completed on return */
+        if (dObj->spiPlib->writeReadPolled(transferObj->pTransmitData, transferObj->txSize,
+                transferObj->pReceiveData, transferObj->rxSize) == false)
+        {
+            transferObj = lDRV_SPI_TransferComplete(dObj, clientObj, transferObj, DRV_SPI_TRANSFER_EVENT_ERROR);
+        }
+        else if (lDRV_SPI_TransferNextSegmentLoad(clientObj, transferObj) == false)
+        {
+            transferObj = lDRV_SPI_TransferComplete(dObj, clientObj, transferObj, DRV_SPI_TRANSFER_EVENT_COMPLETE);
+        }
+        else
+        {
+            /* Poll the next segment with the chip select still asserted */
+        }
+    }
+
+    /* The queue is empty, the next transfer starts a new budget */
+    dObj->pioPollCount = 0U;
+}
+
 static void lDRV_SPI_PlibCallbackHandler(uintptr_t contextHandle)
 {
     DRV_SPI_OBJ* dObj                    = (DRV_SPI_OBJ*)contextHandle;
@@ -560,6 +1005,19 @@ static void lDRV_SPI_PlibCallbackHandler(uintptr_t contextHandle)
     clientObj = &((DRV_SPI_CLIENT_OBJ *)gDrvSPIObj[((transferObj->clientHandle & DRV_SPI_INSTANCE_MASK) >> 8)].clientObjPool)
     [transferObj->clientHandle & DRV_SPI_INDEX_MASK];
 
+    /* Transfer the next segment of a vectored transfer with the chip select
+     * still asserted */
+    if (lDRV_SPI_TransferNextSegmentLoad(clientObj, transferObj) == true)
+    {
+        (void) dObj->spiPlib->writeRead(
+            transferObj->pTransmitData,
+            transferObj->txSize,
+            transferObj->pReceiveData,
+            transferObj->rxSize
+        );
+        return;
+    }
+
     /* De-assert Chip Select if it is defined by user */
     if(clientObj->setup.chipSelect != SYS_PORT_PIN_NONE)
     {
@@ -608,8 +1066,8 @@ static void lDRV_SPI_PlibCallbackHandler(uintptr_t contextHandle)
         lDRV_SPI_RemoveTransferObjFromList(dObj);
     }
 
-     /* Get the transfer object at the head of the list */
-    transferObj = lDRV_SPI_TransferObjListGet(dObj);
+    /* Move the next queued transfer to the head of the list */
+    transferObj = lDRV_SPI_TransferObjSchedule(dObj);
 
     /* Process the next transfer buffer */
     if((transferObj != NULL) && (transferObj->currentState == DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE))
@@ -727,8 +1185,6 @@ static void lDRV_SPI_RX_DMA_CallbackHandler(
     DRV_SPI_TRANSFER_OBJ* transferObj = (DRV_SPI_TRANSFER_OBJ*)context;
     DRV_SPI_CLIENT_OBJ* clientObj;
     DRV_SPI_OBJ* dObj;
-    DRV_SPI_TRANSFER_EVENT transferEvent;
-    DRV_SPI_TRANSFER_HANDLE transferHandle;
 
     /* Get the client object that owns this buffer */
     clientObj = &((DRV_SPI_CLIENT_OBJ *)gDrvSPIObj[((transferObj->clientHandle & DRV_SPI_INSTANCE_MASK) >> 8)].clientObjPool)
@@ -747,84 +1203,16 @@ static void lDRV_SPI_RX_DMA_CallbackHandler(
 
         dObj->rxDummyDataSize = 0;
     }
+    else if ((event == SYS_DMA_TRANSFER_COMPLETE) && (lDRV_SPI_TransferNextSegmentLoad(clientObj, transferObj) == true))
+    {
+        /* Transfer the next segment of a vectored transfer with the chip
+         * select still asserted */
+        lDRV_SPI_TransferProcess(dObj, transferObj);
+    }
     else
     {
-        /* Make sure the shift register is empty before de-asserting the CS line */
-        while (dObj->spiPlib->isTransmitterBusy())
-        {
-            /* Do Nothing */
-        }
-
-        /* De-assert Chip Select if it is defined by user */
-        if(clientObj->setup.chipSelect != SYS_PORT_PIN_NONE)
-        {
-            if (clientObj->setup.csPolarity == DRV_SPI_CS_POLARITY_ACTIVE_LOW)
-            {
-                SYS_PORT_PinSet(clientObj->setup.chipSelect);
-            }
-            else
-            {
-                SYS_PORT_PinClear(clientObj->setup.chipSelect);
-            }
-        }
-
-        /* Check if the client that submitted the request is active? */
-        if (clientObj->clientHandle == transferObj->clientHandle)
-        {
-            /* Set the events */
-            if(event == SYS_DMA_TRANSFER_COMPLETE)
-            {
-                transferObj->event = DRV_SPI_TRANSFER_EVENT_COMPLETE;
-            }
-            else if(event == SYS_DMA_TRANSFER_ERROR)
-            {
-                transferObj->event = DRV_SPI_TRANSFER_EVENT_ERROR;
-            }
-            else
-            {
-                /* Do Nothing */
-            }
-
-            /* Save the transfer handle and event locally before freeing the transfer object*/
-            transferEvent = transferObj->event;
-            transferHandle = transferObj->transferHandle;
-
-            /* Free the completed buffer.
-             * This is done before giving callback to allow application to use the freed
-             * buffer and queue in a new request from within the callback */
-
-            lDRV_SPI_RemoveTransferObjFromList(dObj);
-
-            if(clientObj->eventHandler != NULL)
-            {
-                /* Call the event handler. We additionally increment the
-                interrupt nesting count which lets the driver functions
-                that are called from the event handler know that an
-                interrupt context is active. */
-                dObj->interruptNestingCount++;
-
-                clientObj->eventHandler(transferEvent, transferHandle, clientObj->context);
-
-                /* Event handler has completed, so decrement the nesting count now */
-                dObj->interruptNestingCount--;
-            }
-        }
-        else
-        {
-            /* Free the completed buffer */
-            lDRV_SPI_RemoveTransferObjFromList(dObj);
-        }
-
-        /* Get the next transfer object at the head of the list */
-        transferObj = lDRV_SPI_TransferObjListGet(dObj);
-
-        if((transferObj != NULL) && (transferObj->currentState == DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE))
-        {
-            /* Process the next transfer buffer */
-            lDRV_SPI_UpdateTransferSetupAndAssertCS(transferObj);
-            transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_PROCESSING;
-            lDRV_SPI_StartDMATransfer(transferObj);
-        }
+        lDRV_SPI_TransferProcess(dObj, lDRV_SPI_TransferComplete(dObj, clientObj, transferObj,
+            (event == SYS_DMA_TRANSFER_COMPLETE) ? DRV_SPI_TRANSFER_EVENT_COMPLETE : DRV_SPI_TRANSFER_EVENT_ERROR));
     }
 }
 
@@ -843,6 +1231,7 @@ SYS_MODULE_OBJ DRV_SPI_Initialize (
     DRV_SPI_INIT* spiInit = (DRV_SPI_INIT*)init;
 
     size_t  txDummyDataIdx;
+    uint32_t priority;
 
     /* Validate the request */
     if(drvIndex >= DRV_SPI_INSTANCES_NUMBER)
@@ -897,10 +1286,29 @@ SYS_MODULE_OBJ DRV_SPI_Initialize (
     dObj->remapDataBits             = spiInit->remapDataBits;
     dObj->remapClockPolarity        = spiInit->remapClockPolarity;
     dObj->remapClockPhase           = spiInit->remapClockPhase;
+    dObj->pioThreshold              = spiInit->pioThreshold;
+    dObj->pioTransferCount          = 0;
+    dObj->dmaTransferCount          = 0;
+    dObj->pioPollCount              = 0;
     dObj->interruptSources          = spiInit->interruptSources;
     dObj->drvInExclusiveMode        = false;
     dObj->exclusiveUseCntr          = 0;
-    dObj->transferObjLastUsedIndex  = 0;
+
+    for (priority = 0U; priority < DRV_SPI_SCHED_CLASS_NUMBER; priority++)
+    {
+        dObj->schedQueueHead[priority] = NULL;
+        dObj->schedQueueTail[priority] = NULL;
+        dObj->schedOvertaken[priority] = 0U;
+    }
+
+    lDRV_SPI_FreeTransferObjListInit(dObj);
+
+#if (DRV_SPI_SCHED_STATISTICS_ENABLE == true)
+    /* Start the cycle counter used to timestamp the queued transfers */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 
     for (txDummyDataIdx = 0; txDummyDataIdx < sizeof(txDummyData); txDummyDataIdx++)
     {
@@ -1028,6 +1436,15 @@ DRV_HANDLE DRV_SPI_Open(
             clientObj->setup.chipSelect     = SYS_PORT_PIN_NONE;
             clientObj->setupChanged         = false;
             clientObj->drvIndex             = drvIndex;
+            clientObj->priority             = DRV_SPI_CLIENT_PRIORITY_NORMAL;
+            clientObj->deadline             = 0U;
+            clientObj->transferCount        = 0U;
+            clientObj->waitTotal            = 0U;
+            clientObj->waitMax              = 0U;
+            clientObj->deadlineMissCount    = 0U;
+            clientObj->setupChangeCount     = 0U;
+            clientObj->queueHead            = NULL;
+            clientObj->queueTail            = NULL;
 
             return clientObj->clientHandle;
         }
@@ -1164,18 +1581,24 @@ bool DRV_SPI_TransferSetup (
     return isSuccess;
 }
 
-void DRV_SPI_WriteReadTransferAdd (
+static bool lDRV_SPI_TransferSegmentIsValid(const DRV_SPI_TRANSFER_SEGMENT* segment)
+{
+    return (((segment->txSize > 0U) && (segment->pTransmitData != NULL)) ||
+            ((segment->rxSize > 0U) && (segment->pReceiveData != NULL)));
+}
+
+static void lDRV_SPI_TransferAdd (
     const DRV_HANDLE handle,
-    void* pTransmitData,
-    size_t txSize,
-    void* pReceiveData,
-    size_t rxSize,
+    DRV_SPI_TRANSFER_SEGMENT* pSegments,
+    size_t nSegments,
     DRV_SPI_TRANSFER_HANDLE* const transferHandle
 )
 {
     DRV_SPI_CLIENT_OBJ* clientObj = (DRV_SPI_CLIENT_OBJ*)NULL;
     DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
     DRV_SPI_TRANSFER_OBJ* transferObj = (DRV_SPI_TRANSFER_OBJ*)NULL;
+    bool isValid = true;
+    size_t i;
 
     if (transferHandle == NULL)
     {
@@ -1191,7 +1614,16 @@ void DRV_SPI_WriteReadTransferAdd (
         return;
     }
 
-    if( ((txSize > 0U) && (pTransmitData != NULL)) || ((rxSize > 0U) && (pReceiveData != NULL)) )
+    for (i = 0; i < nSegments; i++)
+    {
+        if (lDRV_SPI_TransferSegmentIsValid(&pSegments[i]) == false)
+        {
+            isValid = false;
+            break;
+        }
+    }
+
+    if (isValid == true)
     {
         dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
 
@@ -1222,37 +1654,30 @@ void DRV_SPI_WriteReadTransferAdd (
             return;
         }
 
-        /* Configure the object */
-        transferObj->pReceiveData   = pReceiveData;
-        transferObj->pTransmitData  = pTransmitData;
+        /* Configure the object. The segment array is only referenced after
+         * this call for a vectored transfer. */
         transferObj->currentState   = DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE;
         transferObj->event          = DRV_SPI_TRANSFER_EVENT_PENDING;
         transferObj->clientHandle   = handle;
+        transferObj->pSegments      = (nSegments > 1U) ? pSegments : NULL;
+        transferObj->nSegments      = nSegments;
+        transferObj->segmentIndex   = 0;
+#if (DRV_SPI_SCHED_STATISTICS_ENABLE == true)
+        transferObj->queuedAt       = lDRV_SPI_TimestampGet();
+#endif
 
-        if (clientObj->setup.dataBits == DRV_SPI_DATA_BITS_8)
-        {
-            transferObj->txSize = txSize;
-            transferObj->rxSize = rxSize;
-        }
-        else if (clientObj->setup.dataBits <= DRV_SPI_DATA_BITS_16)
-        {
-            /* Both SPI and DMA PLIB expect size to be in terms of bytes */
-            transferObj->txSize = txSize << 1;
-            transferObj->rxSize = rxSize << 1;
-        }
-        else
-        {
-            /* Both SPI and DMA PLIB expect size to be in terms of bytes */
-            transferObj->txSize = txSize << 2;
-            transferObj->rxSize = rxSize << 2;
-        }
+        lDRV_SPI_TransferSegmentLoad(clientObj, transferObj, &pSegments[0]);
 
         /* Update the unique transfer handle in output parameter.This handle can
          * be used by user to poll the status of transfer operation */
         *transferHandle = transferObj->transferHandle;
 
-        /* Add the buffer object to the transfer buffer list */
-        if (lDRV_SPI_TransferObjAddToList(dObj, transferObj) == true)
+        /* Add the buffer object to the transfer buffer list. From an event
+         * handler the transfer is only queued: the completion that called the
+         * handler starts it once the handler returns. Starting it here would
+         * nest the polling of a short transfer, and the handler it calls,
+         * once per transfer queued from a handler. */
+        if ((lDRV_SPI_TransferObjAddToList(dObj, transferObj) == true) && (dObj->interruptNestingCount == 0U))
         {
             transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_PROCESSING;
 
@@ -1261,7 +1686,7 @@ void DRV_SPI_WriteReadTransferAdd (
 
             if((dObj->txDMAChannel != SYS_DMA_CHANNEL_NONE) && (dObj->rxDMAChannel != SYS_DMA_CHANNEL_NONE))
             {
-                lDRV_SPI_StartDMATransfer(transferObj);
+                lDRV_SPI_TransferProcess(dObj, transferObj);
             }
             else
             {
@@ -1273,6 +1698,47 @@ void DRV_SPI_WriteReadTransferAdd (
     }
 }
 
+void DRV_SPI_WriteReadTransferAdd (
+    const DRV_HANDLE handle,
+    void* pTransmitData,
+    size_t txSize,
+    void* pReceiveData,
+    size_t rxSize,
+    DRV_SPI_TRANSFER_HANDLE* const transferHandle
+)
+{
+    DRV_SPI_TRANSFER_SEGMENT segment;
+
+    segment.pTransmitData   = pTransmitData;
+    segment.txSize          = txSize;
+    segment.pReceiveData    = pReceiveData;
+    segment.rxSize          = rxSize;
+
+    lDRV_SPI_TransferAdd(handle, &segment, 1U, transferHandle);
+}
+
+void DRV_SPI_TransferVectorAdd (
+    const DRV_HANDLE handle,
+    DRV_SPI_TRANSFER_SEGMENT* pSegments,
+    size_t nSegments,
+    DRV_SPI_TRANSFER_HANDLE* const transferHandle
+)
+{
+    if (transferHandle == NULL)
+    {
+        return;
+    }
+
+    *transferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+
+    if ((pSegments == NULL) || (nSegments == 0U))
+    {
+        return;
+    }
+
+    lDRV_SPI_TransferAdd(handle, pSegments, nSegments, transferHandle);
+}
+
 void DRV_SPI_WriteTransferAdd (
     const   DRV_HANDLE  handle,
     void*   pTransmitData,
@@ -1333,4 +1799,105 @@ DRV_SPI_TRANSFER_EVENT DRV_SPI_TransferStatusGet(const DRV_SPI_TRANSFER_HANDLE t
 bool DRV_SPI_Lock( const DRV_HANDLE handle, bool lock )
 {
     return DRV_SPI_ExclusiveUse(handle, lock );
-}
\ No newline at end of file
+}
+
+bool DRV_SPI_TransferStatisticsGet( const DRV_HANDLE handle, DRV_SPI_TRANSFER_STATISTICS* statistics )
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
+    bool isSuccess = false;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+    if ((clientObj != NULL) && (statistics != NULL))
+    {
+        dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
+
+        statistics->pioTransfers = dObj->pioTransferCount;
+        statistics->dmaTransfers = dObj->dmaTransferCount;
+
+        isSuccess = true;
+    }
+
+    return isSuccess;
+}
+
+bool DRV_SPI_ClientSchedulingSet( const DRV_HANDLE handle, DRV_SPI_CLIENT_PRIORITY priority, uint32_t deadlineUs )
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
+    bool isSuccess = false;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+#if (DRV_SPI_SCHED_STATISTICS_ENABLE == true)
+    if ((clientObj != NULL) && (priority <= DRV_SPI_CLIENT_PRIORITY_LOW) &&
+        (deadlineUs <= (0x7FFFFFFFU / DRV_SPI_SCHED_CYCLES_PER_US)))
+#else
+    /* Deadlines need the cycle counter timestamps */
+    if ((clientObj != NULL) && (priority <= DRV_SPI_CLIENT_PRIORITY_LOW) && (deadlineUs == 0U))
+#endif
+    {
+        dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
+
+        /* The scheduler reads these from the interrupt context */
+        if (lDRV_SPI_ResourceLock(dObj) == true)
+        {
+            /* The queued transfers of the client stay in the queue of the
+             * current class, so the class can only change while none are
+             * queued. This keeps the transfers of a client in order. */
+            if ((priority == clientObj->priority) || (clientObj->queueHead == NULL))
+            {
+                clientObj->priority = priority;
+                clientObj->deadline = deadlineUs * DRV_SPI_SCHED_CYCLES_PER_US;
+
+                isSuccess = true;
+            }
+
+            lDRV_SPI_ResourceUnlock(dObj);
+        }
+    }
+
+    return isSuccess;
+}
+
+bool DRV_SPI_ClientQueueStatisticsGet( const DRV_HANDLE handle, DRV_SPI_CLIENT_QUEUE_STATISTICS* statistics )
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
+    uint64_t waitTotal;
+    bool isSuccess = false;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+    if ((clientObj != NULL) && (statistics != NULL))
+    {
+        dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
+
+        /* Take a consistent snapshot of the counters updated by the interrupt */
+        if (lDRV_SPI_ResourceLock(dObj) == true)
+        {
+            statistics->transferCount       = clientObj->transferCount;
+            statistics->maxWaitUs           = clientObj->waitMax / DRV_SPI_SCHED_CYCLES_PER_US;
+            statistics->deadlineMissCount   = clientObj->deadlineMissCount;
+            statistics->setupChangeCount    = clientObj->setupChangeCount;
+            waitTotal                       = clientObj->waitTotal;
+
+            lDRV_SPI_ResourceUnlock(dObj);
+
+            statistics->averageWaitUs = 0U;
+
+            if (statistics->transferCount != 0U)
+            {
+                statistics->averageWaitUs = (uint32_t)((waitTotal / statistics->transferCount) / DRV_SPI_SCHED_CYCLES_PER_US);
+            }
+
+            isSuccess = true;
+        }
+    }
+
+    return isSuccess;
+}
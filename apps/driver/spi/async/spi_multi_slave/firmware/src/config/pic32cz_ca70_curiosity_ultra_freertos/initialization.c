@@ -87,6 +87,9 @@ static const DRV_SPI_PLIB_INTERFACE drvSPI0PlibAPI = {
     /* SPI PLIB WriteRead function */
     .writeRead = (DRV_SPI_PLIB_WRITE_READ)SPI0_WriteRead,
 
+    /* SPI PLIB polled WriteRead function */
+    .writeReadPolled = (DRV_SPI_PLIB_WRITE_READ)SPI0_WriteReadPolled,
+
     /* SPI PLIB Transfer Status function */
     .isTransmitterBusy = (DRV_SPI_PLIB_TRANSMITTER_IS_BUSY)SPI0_IsTransmitterBusy,
 
@@ -139,6 +142,9 @@ static const DRV_SPI_INIT drvSPI0InitData =
     /* SPI Receive Register */
     .spiReceiveAddress  = (void *)&(SPI0_REGS->SPI_RDR),
 
+    /* Largest transfer done by polling instead of DMA */
+    .pioThreshold       = DRV_SPI_PIO_THRESHOLD_IDX0,
+
     /* SPI Queue Size */
     .transferObjPoolSize = DRV_SPI_QUEUE_SIZE_IDX0,
 
@@ -203,6 +209,15 @@ void SYS_Initialize ( void* data )
     EFC_Initialize();
   
     CLOCK_Initialize();
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+    /* Count the core clock cycles up to the start of the scheduler */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
 	PIO_Initialize();
 
     XDMAC_Initialize();
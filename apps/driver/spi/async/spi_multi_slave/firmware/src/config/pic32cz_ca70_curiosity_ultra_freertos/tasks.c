@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP_EEPROM1_Tasks. */
 TaskHandle_t xAPP_EEPROM1_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_EEPROM1_Tasks task. */
+static StackType_t lAPP_EEPROM1_TasksStack[1024];
+static StaticTask_t lAPP_EEPROM1_TasksTCB;
+#endif
+
 static void lAPP_EEPROM1_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -80,6 +90,12 @@ TaskHandle_t xAPP_EEPROM2_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_EEPROM2_Tasks task. */
+static StackType_t lAPP_EEPROM2_TasksStack[1024];
+static StaticTask_t lAPP_EEPROM2_TasksTCB;
+#endif
+
 static void lAPP_EEPROM2_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -94,6 +110,12 @@ TaskHandle_t xAPP_MONITOR_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_MONITOR_Tasks task. */
+static StackType_t lAPP_MONITOR_TasksStack[1024];
+static StaticTask_t lAPP_MONITOR_TasksTCB;
+#endif
+
 static void lAPP_MONITOR_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -133,6 +155,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_EEPROM1_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_EEPROM1_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_EEPROM1_Tasks,
+           "APP_EEPROM1_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_EEPROM1_TasksStack,
+           &lAPP_EEPROM1_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_EEPROM1_Tasks,
            "APP_EEPROM1_Tasks",
@@ -140,8 +172,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_EEPROM1_Tasks);
+#endif
 
     /* Create OS Thread for APP_EEPROM2_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_EEPROM2_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_EEPROM2_Tasks,
+           "APP_EEPROM2_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_EEPROM2_TasksStack,
+           &lAPP_EEPROM2_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_EEPROM2_Tasks,
            "APP_EEPROM2_Tasks",
@@ -149,8 +192,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_EEPROM2_Tasks);
+#endif
 
     /* Create OS Thread for APP_MONITOR_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_MONITOR_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_MONITOR_Tasks,
+           "APP_MONITOR_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_MONITOR_TasksStack,
+           &lAPP_MONITOR_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_MONITOR_Tasks,
            "APP_MONITOR_Tasks",
@@ -158,8 +212,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_MONITOR_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
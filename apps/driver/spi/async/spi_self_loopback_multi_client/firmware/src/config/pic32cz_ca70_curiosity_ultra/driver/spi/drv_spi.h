@@ -242,6 +242,41 @@ typedef enum
 
 typedef void (*DRV_SPI_TRANSFER_EVENT_HANDLER )( DRV_SPI_TRANSFER_EVENT event, DRV_SPI_TRANSFER_HANDLE transferHandle, uintptr_t context );
 
+// *****************************************************************************
+/* SPI Driver Transfer Segment
+
+  Summary:
+    Defines one segment of a vectored (scatter-gather) transfer.
+
+  Description:
+    This data type defines one write-read segment of a transfer queued using
+    the DRV_SPI_TransferVectorAdd function. All the segments of a vectored
+    transfer are executed back to back while the chip select remains asserted.
+    The meaning of the members is the same as the corresponding parameters of
+    the DRV_SPI_WriteReadTransferAdd function.
+
+  Remarks:
+    The segment array and the buffers it points to are owned by the driver
+    until the vectored transfer completes.
+*/
+
+typedef struct
+{
+    /* Pointer to the data to be transmitted. NULL if only receiving. */
+    void*       pTransmitData;
+
+    /* Number of words (of the SPI data width) to be transmitted */
+    size_t      txSize;
+
+    /* Pointer to the location where the received data is stored. NULL if
+     * only transmitting. */
+    void*       pReceiveData;
+
+    /* Number of words (of the SPI data width) to be received */
+    size_t      rxSize;
+
+} DRV_SPI_TRANSFER_SEGMENT;
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -852,6 +887,99 @@ void DRV_SPI_ReadTransferAdd(
     size_t  rxSize,
     DRV_SPI_TRANSFER_HANDLE * const transferHandle);
 
+// *****************************************************************************
+/* Function:
+    void DRV_SPI_TransferVectorAdd
+    (
+        const DRV_HANDLE handle,
+        DRV_SPI_TRANSFER_SEGMENT* pSegments,
+        size_t nSegments,
+        DRV_SPI_TRANSFER_HANDLE * const transferHandle
+    );
+
+  Summary:
+    Queues a vectored (scatter-gather) transfer operation.
+
+  Description:
+    This function schedules a non-blocking transfer made of nSegments
+    write-read segments. The segments are executed in order under a single
+    chip select assertion, and a single event is given to the client when the
+    last segment completes. This allows protocols that send a command, an
+    address and a data payload from different buffers to be issued as one
+    queued request.
+
+    The function returns DRV_SPI_TRANSFER_HANDLE_INVALID in the
+    transferHandle argument:
+    - if pSegments is NULL or nSegments is zero.
+    - if any segment has neither a valid transmit nor a valid receive buffer.
+    - if the transfer handle is NULL.
+    - if the queue size is full or queue depth is insufficient.
+    - if the driver handle is invalid.
+
+    If the requesting client registered an event callback with the driver, the
+    driver will issue a DRV_SPI_TRANSFER_EVENT_COMPLETE event if all the
+    segments were processed successfully or DRV_SPI_TRANSFER_EVENT_ERROR event
+    if a segment was not processed successfully. The remaining segments are
+    not executed after an error.
+
+  Precondition:
+    - DRV_SPI_Open must have been called to obtain a valid opened device handle.
+    - DRV_SPI_TransferSetup must have been called if GPIO pin has to be used for
+    chip select or any of the setup parameters has to be changed dynamically.
+
+  Parameters:
+    handle -    Handle of the communication channel as returned by the
+                DRV_SPI_Open function.
+
+    pSegments - Pointer to an array of transfer segments. The array must remain
+                valid until the transfer completes.
+
+    nSegments - Number of segments in the array.
+
+    transferHandle - Handle which is returned by transfer add function.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    uint8_t command[4];
+    uint8_t pageData[256];
+    DRV_SPI_TRANSFER_SEGMENT segments[2];
+    DRV_SPI_TRANSFER_HANDLE transferHandle;
+
+    segments[0].pTransmitData = command;
+    segments[0].txSize = sizeof(command);
+    segments[0].pReceiveData = NULL;
+    segments[0].rxSize = 0;
+
+    segments[1].pTransmitData = pageData;
+    segments[1].txSize = sizeof(pageData);
+    segments[1].pReceiveData = NULL;
+    segments[1].rxSize = 0;
+
+    DRV_SPI_TransferVectorAdd(mySPIhandle, segments, 2, &transferHandle);
+
+    if(transferHandle == DRV_SPI_TRANSFER_HANDLE_INVALID)
+    {
+        
+    }
+    </code>
+
+  Remarks:
+    - This function can be called from within the SPI Driver Transfer Event
+      Handler that is registered by the client.
+    - It should not be called in the event handler associated with another SPI
+      driver instance or event handler of any other peripheral.
+    - It should not be called directly in any ISR.
+*/
+
+void DRV_SPI_TransferVectorAdd(
+    const   DRV_HANDLE  handle,
+    DRV_SPI_TRANSFER_SEGMENT* pSegments,
+    size_t  nSegments,
+    DRV_SPI_TRANSFER_HANDLE * const transferHandle);
+
 // *****************************************************************************
 /* Function:
     void DRV_SPI_TransferEventHandlerSet
@@ -211,43 +211,76 @@ static DRV_SPI_CLIENT_OBJ * lDRV_SPI_DriverHandleValidate(DRV_HANDLE handle)
     return(clientObj);
 }
 
+static void lDRV_SPI_FreeTransferObjPut(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_FREE;
+    transferObj->inUse = false;
+    transferObj->next = NULL;
+
+    /* Append the transfer object to the tail of the free list */
+    if (dObj->freeObjList == NULL)
+    {
+        dObj->freeObjList = transferObj;
+    }
+    else
+    {
+        dObj->freeObjListTail->next = transferObj;
+    }
+
+    dObj->freeObjListTail = transferObj;
+}
+
+static void lDRV_SPI_FreeTransferObjListInit(DRV_SPI_OBJ* dObj)
+{
+    uint32_t index;
+
+    dObj->freeObjList = NULL;
+    dObj->freeObjListTail = NULL;
+
+    for (index = 0; index < dObj->transferObjPoolSize; index++)
+    {
+        lDRV_SPI_FreeTransferObjPut(dObj, &dObj->transferObjPool[index]);
+    }
+}
+
 static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_FreeTransferObjGet(DRV_SPI_CLIENT_OBJ* clientObj)
 {
-    uint32_t i;
     uint32_t index;
     DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ* )&gDrvSPIObj[clientObj->drvIndex];
-    DRV_SPI_TRANSFER_OBJ* pTransferObj = (DRV_SPI_TRANSFER_OBJ*)dObj->transferObjPool;
+    DRV_SPI_TRANSFER_OBJ* pTransferObj = dObj->freeObjList;
 
-    i = 0;
-    index = dObj->transferObjLastUsedIndex;
-    while(i < dObj->transferObjPoolSize)
+    if (pTransferObj == NULL)
     {
-        if (index >= dObj->transferObjPoolSize)
-        {
-            index = 0;
-        }
-        if (pTransferObj[index].inUse == false)
-        {
-            pTransferObj[index].inUse = true;
-            pTransferObj[index].next = NULL;
+        /* All the transfer objects are in use */
+        return NULL;
+    }
 
-            /* Generate a unique buffer handle consisting of an incrementing
-             * token counter, driver index and the buffer index.
-             */
-            pTransferObj[index].transferHandle = (DRV_SPI_TRANSFER_HANDLE)lDRV_SPI_MAKE_HANDLE(
-                dObj->spiTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+    /* Take the transfer object at the head of the free list */
+    dObj->freeObjList = pTransferObj->next;
 
-            /* Update the token for next time */
-            dObj->spiTokenCount = lDRV_SPI_UPDATE_TOKEN(dObj->spiTokenCount);
+    if (dObj->freeObjList == NULL)
+    {
+        dObj->freeObjListTail = NULL;
+    }
 
-            dObj->transferObjLastUsedIndex = index + 1U;
+    pTransferObj->inUse = true;
+    pTransferObj->next = NULL;
 
-            return &pTransferObj[index];
-        }
-        i++;
-        index++;
-    }
-    return NULL;
+    index = (uint32_t)(pTransferObj - dObj->transferObjPool);
+
+    /* Generate a unique buffer handle consisting of an incrementing
+     * token counter, driver index and the buffer index.
+     */
+    pTransferObj->transferHandle = (DRV_SPI_TRANSFER_HANDLE)lDRV_SPI_MAKE_HANDLE(
+        dObj->spiTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+
+    /* Update the token for next time */
+    dObj->spiTokenCount = lDRV_SPI_UPDATE_TOKEN(dObj->spiTokenCount);
+
+    return pTransferObj;
 }
 /* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -
    H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1*/
@@ -262,6 +295,8 @@ static bool lDRV_SPI_TransferObjAddToList(
 
     pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&(dObj->transferObjList);
 
+    transferObj->next = NULL;
+
     // Is the buffer object list empty?
     if (*pTransferObjList == NULL)
     {
@@ -270,22 +305,12 @@ static bool lDRV_SPI_TransferObjAddToList(
     }
     else
     {
-        // List is not empty. Iterate to the end of the buffer object list.
-        while (*pTransferObjList != NULL)
-        {
-            if ((*pTransferObjList)->next == NULL)
-            {
-                // End of the list reached, add the buffer here.
-                (*pTransferObjList)->next = transferObj;
-                break;
-            }
-            else
-            {
-                pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&((*pTransferObjList)->next);
-            }
-        }
+        // List is not empty. Add the buffer after the last buffer object.
+        dObj->transferObjListTail->next = transferObj;
     }
 
+    dObj->transferObjListTail = transferObj;
+
     return isFirstTransferInList;
 }
 
@@ -309,13 +334,18 @@ static void lDRV_SPI_RemoveTransferObjFromList( DRV_SPI_OBJ* dObj )
     if (*pTransferObjList != NULL)
     {
         /* Save the buffer object to be removed. Set the next buffer object as
-         * the new head of the linked list. Reset the removed buffer object. */
+         * the new head of the linked list. Return the removed buffer object to
+         * the free list. */
 
         DRV_SPI_TRANSFER_OBJ* temp = *pTransferObjList;
         *pTransferObjList = (*pTransferObjList)->next;
-        temp->currentState = DRV_SPI_TRANSFER_OBJ_IS_FREE;
-        temp->next = NULL;
-        temp->inUse = false;
+
+        if (*pTransferObjList == NULL)
+        {
+            dObj->transferObjListTail = NULL;
+        }
+
+        lDRV_SPI_FreeTransferObjPut(dObj, temp);
     }
 }
 
@@ -326,6 +356,7 @@ static void lDRV_SPI_RemoveClientTransfersFromList(
 {
     DRV_SPI_TRANSFER_OBJ** pTransferObjList;
     DRV_SPI_TRANSFER_OBJ* delTransferObj = NULL;
+    DRV_SPI_TRANSFER_OBJ* prevTransferObj = NULL;
 
     pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&(dObj->transferObjList);
 
@@ -341,21 +372,74 @@ static void lDRV_SPI_RemoveClientTransfersFromList(
             // Update the current node to point to the deleted node's next
             *pTransferObjList = (DRV_SPI_TRANSFER_OBJ*)(*pTransferObjList)->next;
 
-            // Reset the deleted node
-            delTransferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_FREE;
+            // The last node was deleted, the previous node is the new tail
+            if (dObj->transferObjListTail == delTransferObj)
+            {
+                dObj->transferObjListTail = prevTransferObj;
+            }
+
+            // Return the deleted node to the free list
             delTransferObj->event = DRV_SPI_TRANSFER_EVENT_COMPLETE;
-            delTransferObj->next = NULL;
-            delTransferObj->inUse = false;
+            lDRV_SPI_FreeTransferObjPut(dObj, delTransferObj);
         }
         else
         {
             // Move to the next node
+            prevTransferObj = *pTransferObjList;
             pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&((*pTransferObjList)->next);
         }
     }
 }
 
 
+static void lDRV_SPI_TransferSegmentLoad(
+    DRV_SPI_CLIENT_OBJ* clientObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj,
+    const DRV_SPI_TRANSFER_SEGMENT* segment
+)
+{
+    transferObj->pReceiveData   = segment->pReceiveData;
+    transferObj->pTransmitData  = segment->pTransmitData;
+
+    if (clientObj->setup.dataBits == DRV_SPI_DATA_BITS_8)
+    {
+        transferObj->txSize = segment->txSize;
+        transferObj->rxSize = segment->rxSize;
+    }
+    else if (clientObj->setup.dataBits <= DRV_SPI_DATA_BITS_16)
+    {
+        /* Both SPI and DMA PLIB expect size to be in terms of bytes */
+        transferObj->txSize = segment->txSize << 1;
+        transferObj->rxSize = segment->rxSize << 1;
+    }
+    else
+    {
+        /* Both SPI and DMA PLIB expect size to be in terms of bytes */
+        transferObj->txSize = segment->txSize << 2;
+        transferObj->rxSize = segment->rxSize << 2;
+    }
+}
+
+static bool lDRV_SPI_TransferNextSegmentLoad(
+    DRV_SPI_CLIENT_OBJ* clientObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    /* Stop the vectored transfer if the client that submitted it has closed
+     * the driver or if the last segment has been transferred */
+    if ((clientObj->clientHandle != transferObj->clientHandle) ||
+        ((transferObj->segmentIndex + 1U) >= transferObj->nSegments))
+    {
+        return false;
+    }
+
+    transferObj->segmentIndex++;
+
+    lDRV_SPI_TransferSegmentLoad(clientObj, transferObj, &transferObj->pSegments[transferObj->segmentIndex]);
+
+    return true;
+}
+
 static void lDRV_SPI_UpdateTransferSetupAndAssertCS(
     DRV_SPI_TRANSFER_OBJ* transferObj
 )
@@ -420,6 +504,19 @@ static void lDRV_SPI_PlibCallbackHandler(uintptr_t contextHandle)
     clientObj = &((DRV_SPI_CLIENT_OBJ *)gDrvSPIObj[((transferObj->clientHandle & DRV_SPI_INSTANCE_MASK) >> 8)].clientObjPool)
     [transferObj->clientHandle & DRV_SPI_INDEX_MASK];
 
+    /* Transfer the next segment of a vectored transfer with the chip select
+     * still asserted */
+    if (lDRV_SPI_TransferNextSegmentLoad(clientObj, transferObj) == true)
+    {
+        (void) dObj->spiPlib->writeRead(
+            transferObj->pTransmitData,
+            transferObj->txSize,
+            transferObj->pReceiveData,
+            transferObj->rxSize
+        );
+        return;
+    }
+
     /* De-assert Chip Select if it is defined by user */
     if(clientObj->setup.chipSelect != SYS_PORT_PIN_NONE)
     {
@@ -605,6 +702,7 @@ SYS_MODULE_OBJ DRV_SPI_Initialize (
     dObj->transferObjPool           = (DRV_SPI_TRANSFER_OBJ*)spiInit->transferObjPool;
     dObj->transferObjPoolSize       = spiInit->transferObjPoolSize;
     dObj->transferObjList           = 0U;
+    dObj->transferObjListTail       = NULL;
     dObj->clientObjPool             = spiInit->clientObjPool;
     dObj->nClientsMax               = spiInit->numClients;
     dObj->nClients                  = 0;
@@ -618,7 +716,8 @@ SYS_MODULE_OBJ DRV_SPI_Initialize (
     dObj->interruptSources          = spiInit->interruptSources;
     dObj->drvInExclusiveMode        = false;
     dObj->exclusiveUseCntr          = 0;
-    dObj->transferObjLastUsedIndex  = 0;
+
+    lDRV_SPI_FreeTransferObjListInit(dObj);
 
 
     /* Register a callback with SPI PLIB.
@@ -865,18 +964,24 @@ bool DRV_SPI_TransferSetup (
     return isSuccess;
 }
 
-void DRV_SPI_WriteReadTransferAdd (
+static bool lDRV_SPI_TransferSegmentIsValid(const DRV_SPI_TRANSFER_SEGMENT* segment)
+{
+    return (((segment->txSize > 0U) && (segment->pTransmitData != NULL)) ||
+            ((segment->rxSize > 0U) && (segment->pReceiveData != NULL)));
+}
+
+static void lDRV_SPI_TransferAdd (
     const DRV_HANDLE handle,
-    void* pTransmitData,
-    size_t txSize,
-    void* pReceiveData,
-    size_t rxSize,
+    DRV_SPI_TRANSFER_SEGMENT* pSegments,
+    size_t nSegments,
     DRV_SPI_TRANSFER_HANDLE* const transferHandle
 )
 {
     DRV_SPI_CLIENT_OBJ* clientObj = (DRV_SPI_CLIENT_OBJ*)NULL;
     DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
     DRV_SPI_TRANSFER_OBJ* transferObj = (DRV_SPI_TRANSFER_OBJ*)NULL;
+    bool isValid = true;
+    size_t i;
 
     if (transferHandle == NULL)
     {
@@ -892,7 +997,16 @@ void DRV_SPI_WriteReadTransferAdd (
         return;
     }
 
-    if( ((txSize > 0U) && (pTransmitData != NULL)) || ((rxSize > 0U) && (pReceiveData != NULL)) )
+    for (i = 0; i < nSegments; i++)
+    {
+        if (lDRV_SPI_TransferSegmentIsValid(&pSegments[i]) == false)
+        {
+            isValid = false;
+            break;
+        }
+    }
+
+    if (isValid == true)
     {
         dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
 
@@ -923,30 +1037,16 @@ void DRV_SPI_WriteReadTransferAdd (
             return;
         }
 
-        /* Configure the object */
-        transferObj->pReceiveData   = pReceiveData;
-        transferObj->pTransmitData  = pTransmitData;
+        /* Configure the object. The segment array is only referenced after
+         * this call for a vectored transfer. */
         transferObj->currentState   = DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE;
         transferObj->event          = DRV_SPI_TRANSFER_EVENT_PENDING;
         transferObj->clientHandle   = handle;
+        transferObj->pSegments      = (nSegments > 1U) ? pSegments : NULL;
+        transferObj->nSegments      = nSegments;
+        transferObj->segmentIndex   = 0;
 
-        if (clientObj->setup.dataBits == DRV_SPI_DATA_BITS_8)
-        {
-            transferObj->txSize = txSize;
-            transferObj->rxSize = rxSize;
-        }
-        else if (clientObj->setup.dataBits <= DRV_SPI_DATA_BITS_16)
-        {
-            /* Both SPI and DMA PLIB expect size to be in terms of bytes */
-            transferObj->txSize = txSize << 1;
-            transferObj->rxSize = rxSize << 1;
-        }
-        else
-        {
-            /* Both SPI and DMA PLIB expect size to be in terms of bytes */
-            transferObj->txSize = txSize << 2;
-            transferObj->rxSize = rxSize << 2;
-        }
+        lDRV_SPI_TransferSegmentLoad(clientObj, transferObj, &pSegments[0]);
 
         /* Update the unique transfer handle in output parameter.This handle can
          * be used by user to poll the status of transfer operation */
@@ -967,6 +1067,47 @@ void DRV_SPI_WriteReadTransferAdd (
     }
 }
 
+void DRV_SPI_WriteReadTransferAdd (
+    const DRV_HANDLE handle,
+    void* pTransmitData,
+    size_t txSize,
+    void* pReceiveData,
+    size_t rxSize,
+    DRV_SPI_TRANSFER_HANDLE* const transferHandle
+)
+{
+    DRV_SPI_TRANSFER_SEGMENT segment;
+
+    segment.pTransmitData   = pTransmitData;
+    segment.txSize          = txSize;
+    segment.pReceiveData    = pReceiveData;
+    segment.rxSize          = rxSize;
+
+    lDRV_SPI_TransferAdd(handle, &segment, 1U, transferHandle);
+}
+
+void DRV_SPI_TransferVectorAdd (
+    const DRV_HANDLE handle,
+    DRV_SPI_TRANSFER_SEGMENT* pSegments,
+    size_t nSegments,
+    DRV_SPI_TRANSFER_HANDLE* const transferHandle
+)
+{
+    if (transferHandle == NULL)
+    {
+        return;
+    }
+
+    *transferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+
+    if ((pSegments == NULL) || (nSegments == 0U))
+    {
+        return;
+    }
+
+    lDRV_SPI_TransferAdd(handle, pSegments, nSegments, transferHandle);
+}
+
 void DRV_SPI_WriteTransferAdd (
     const   DRV_HANDLE  handle,
     void*   pTransmitData,
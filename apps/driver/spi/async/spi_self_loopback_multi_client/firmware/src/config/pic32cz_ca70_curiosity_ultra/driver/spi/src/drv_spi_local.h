@@ -152,6 +152,15 @@ typedef struct DRV_SPI_TRANSFER_OBJ_T
     /* Number of bytes to be read */
     size_t                          rxSize;
 
+    /* Segments of a vectored transfer. NULL for a single segment transfer. */
+    DRV_SPI_TRANSFER_SEGMENT*       pSegments;
+
+    /* Number of segments in the transfer */
+    size_t                          nSegments;
+
+    /* Index of the segment currently being transferred */
+    size_t                          segmentIndex;
+
 
     /* Current status of the buffer */
     DRV_SPI_TRANSFER_EVENT          event;
@@ -166,7 +175,7 @@ typedef struct DRV_SPI_TRANSFER_OBJ_T
      * the queue */
     DRV_SPI_TRANSFER_HANDLE         transferHandle;
 
-    /* Next buffer pointer */
+    /* Next buffer pointer in the free list or in the transfer list */
     struct DRV_SPI_TRANSFER_OBJ_T*   next;
 
 } DRV_SPI_TRANSFER_OBJ;
@@ -218,6 +227,16 @@ typedef struct
     /* Linked list of transfer objects */
     uintptr_t                       transferObjList;
 
+    /* Last transfer object in the transfer list */
+    DRV_SPI_TRANSFER_OBJ*           transferObjListTail;
+
+    /* Linked list of free transfer objects. Freed objects are appended at the
+     * tail so that the least recently used object is allocated first. */
+    DRV_SPI_TRANSFER_OBJ*           freeObjList;
+
+    /* Last transfer object in the free list */
+    DRV_SPI_TRANSFER_OBJ*           freeObjListTail;
+
     /* Instance specific token counter used to generate unique client/transfer handles */
     uint16_t                        spiTokenCount;
 
@@ -250,8 +269,6 @@ typedef struct
     bool                            drvInExclusiveMode;
 
     uint32_t                        exclusiveUseCntr;
-    
-    uint32_t                        transferObjLastUsedIndex;
 
     /* Mutex to protect access to the client objects */
     OSAL_MUTEX_DECLARE(mutexClientObjects);
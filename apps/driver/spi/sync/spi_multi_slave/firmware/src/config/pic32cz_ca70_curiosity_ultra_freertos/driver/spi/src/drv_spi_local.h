@@ -136,6 +136,13 @@ typedef struct
     /* This is the SPI receive register address. Used for DMA operation. */
     void*                               rxAddress;
 
+    /* Transfers of up to this many bytes are polled instead of using DMA */
+    size_t                              pioThreshold;
+
+    /* Number of transfers done by polling and by DMA */
+    uint32_t                            pioTransferCount;
+    uint32_t                            dmaTransferCount;
+
     /* Dummy data is read into this variable by RX DMA */
     uint32_t                            rxDummyData;
 
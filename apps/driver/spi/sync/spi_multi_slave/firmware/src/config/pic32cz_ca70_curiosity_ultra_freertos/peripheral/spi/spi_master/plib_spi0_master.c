@@ -191,6 +191,104 @@ bool SPI0_WriteRead( void* pTransmitData, size_t txSize, void* pReceiveData, siz
     return isRequestAccepted;
 }
 
+/* Blocking transfer that polls the status register instead of using the
+ * interrupt. Meant for transfers too short to be worth an interrupt or a DMA
+ * setup; the sizes are in bytes as for SPI0_WriteRead. */
+bool SPI0_WriteReadPolled( void* pTransmitData, size_t txSize, void* pReceiveData, size_t rxSize )
+{
+    bool isRequestAccepted = false;
+    uint32_t dataBits;
+    uint32_t receivedData;
+    size_t txCount = 0;
+    size_t rxCount = 0;
+    size_t dummySize = 0;
+
+    /* Verify the request */
+    if((spi0Obj.transferIsBusy == false) && (((txSize > 0U) && (pTransmitData != NULL)) || ((rxSize > 0U) && (pReceiveData != NULL))))
+    {
+        isRequestAccepted = true;
+
+        if (pTransmitData == NULL)
+        {
+            txSize = 0;
+        }
+
+        if (pReceiveData == NULL)
+        {
+            rxSize = 0;
+        }
+
+        dataBits = SPI0_REGS->SPI_CSR[0] & SPI_CSR_BITS_Msk;
+
+        if (dataBits != SPI_CSR_BITS_8_BIT)
+        {
+            txSize >>= 1;
+            rxSize >>= 1;
+        }
+
+        if (rxSize > txSize)
+        {
+            dummySize = rxSize - txSize;
+        }
+
+        /* Flush out any unread data in SPI read buffer */
+        receivedData = (SPI0_REGS->SPI_RDR & SPI_RDR_RD_Msk) >> SPI_RDR_RD_Pos;
+        (void)receivedData;
+
+        while ((txCount < txSize) || (dummySize > 0U))
+        {
+            if (txCount < txSize)
+            {
+                if (dataBits == SPI_CSR_BITS_8_BIT)
+                {
+                    SPI0_REGS->SPI_TDR = ((uint8_t*)pTransmitData)[txCount];
+                }
+                else
+                {
+                    SPI0_REGS->SPI_TDR = ((uint16_t*)pTransmitData)[txCount];
+                }
+                txCount++;
+            }
+            else
+            {
+                SPI0_REGS->SPI_TDR = (dataBits == SPI_CSR_BITS_8_BIT) ? 0xffU : 0xffffU;
+                dummySize--;
+            }
+
+            /* Wait for the word clocked in by the one just written */
+            while ((SPI0_REGS->SPI_SR & SPI_SR_RDRF_Msk) == 0U)
+            {
+                /* Do Nothing */
+            }
+
+            receivedData = (SPI0_REGS->SPI_RDR & SPI_RDR_RD_Msk) >> SPI_RDR_RD_Pos;
+
+            if (rxCount < rxSize)
+            {
+                if (dataBits == SPI_CSR_BITS_8_BIT)
+                {
+                    ((uint8_t*)pReceiveData)[rxCount] = (uint8_t)receivedData;
+                }
+                else
+                {
+                    ((uint16_t*)pReceiveData)[rxCount] = (uint16_t)receivedData;
+                }
+                rxCount++;
+            }
+        }
+
+        /* Make sure no data is pending in the shift register */
+        while ((SPI0_REGS->SPI_SR & SPI_SR_TXEMPTY_Msk) == 0U)
+        {
+            /* Do Nothing */
+        }
+
+        /* Set Last transfer to deassert NPCS after the last byte written in TDR has been transferred. */
+        SPI0_REGS->SPI_CR = SPI_CR_LASTXFER_Msk;
+    }
+
+    return isRequestAccepted;
+}
 
 bool SPI0_Write( void* pTransmitData, size_t txSize )
 {
@@ -58,6 +58,8 @@ void SPI0_Initialize( void );
 
 bool SPI0_WriteRead( void* pTransmitData, size_t txSize, void* pReceiveData, size_t rxSize );
 
+bool SPI0_WriteReadPolled( void* pTransmitData, size_t txSize, void* pReceiveData, size_t rxSize );
+
 bool SPI0_Write( void* pTransmitData, size_t txSize );
 
 bool SPI0_Read( void* pReceiveData, size_t rxSize );
@@ -122,6 +122,15 @@ static DRV_SPI_CLIENT_OBJ* lDRV_SPI_DriverHandleValidate(DRV_HANDLE handle)
     return(clientObj);
 }
 
+/* Transfers no larger than the PIO threshold cost less to poll than to set
+ * up the DMA channels and maintain the cache for */
+static bool lDRV_SPI_PIOTransferIsSelected(const DRV_SPI_OBJ* dObj, size_t txSize, size_t rxSize)
+{
+    size_t size = (txSize > rxSize) ? txSize : rxSize;
+
+    return ((dObj->spiPlib->writeReadPolled != NULL) && (size <= dObj->pioThreshold));
+}
+
 static bool lDRV_SPI_StartDMATransfer(
     DRV_SPI_OBJ* dObj,
     void* pTransmitData,
@@ -430,6 +439,9 @@ SYS_MODULE_OBJ DRV_SPI_Initialize( const SYS_MODULE_INDEX drvIndex, const SYS_MO
     dObj->remapDataBits         = spiInit->remapDataBits;
     dObj->remapClockPolarity    = spiInit->remapClockPolarity;
     dObj->remapClockPhase       = spiInit->remapClockPhase;
+    dObj->pioThreshold          = spiInit->pioThreshold;
+    dObj->pioTransferCount      = 0;
+    dObj->dmaTransferCount      = 0;
     dObj->drvInExclusiveMode        = false;
     dObj->exclusiveUseCntr          = 0;
 
@@ -756,11 +768,34 @@ bool DRV_SPI_WriteReadTransfer(const DRV_HANDLE handle,
 
             if((dObj->txDMAChannel != SYS_DMA_CHANNEL_NONE) && ((dObj->rxDMAChannel != SYS_DMA_CHANNEL_NONE)))
             {
+                if (lDRV_SPI_PIOTransferIsSelected(dObj, txSize, rxSize) == true)
+                {
+                    /* The polled transfer has completed on return */
+                    isSuccess = dObj->spiPlib->writeReadPolled(pTransmitData, txSize, pReceiveData, rxSize);
+                    dObj->pioTransferCount++;
 
-                if (lDRV_SPI_StartDMATransfer(dObj, pTransmitData, txSize, pReceiveData, rxSize) == true)
+                    /* De-assert Chip Select if it is defined by user */
+                    if(clientObj->setup.chipSelect != SYS_PORT_PIN_NONE)
+                    {
+                        if (clientObj->setup.csPolarity == DRV_SPI_CS_POLARITY_ACTIVE_LOW)
+                        {
+                            SYS_PORT_PinSet(clientObj->setup.chipSelect);
+                        }
+                        else
+                        {
+                            SYS_PORT_PinClear(clientObj->setup.chipSelect);
+                        }
+                    }
+                }
+                else if (lDRV_SPI_StartDMATransfer(dObj, pTransmitData, txSize, pReceiveData, rxSize) == true)
                 {
+                    dObj->dmaTransferCount++;
                     isTransferInProgress = true;
                 }
+                else
+                {
+                    /* Nothing to do */
+                }
             }
             else
             {
@@ -800,4 +835,22 @@ bool DRV_SPI_WriteReadTransfer(const DRV_HANDLE handle,
 bool DRV_SPI_Lock( const DRV_HANDLE handle, bool lock )
 {
     return DRV_SPI_ExclusiveUse( handle, lock );
-}
\ No newline at end of file
+}
+
+bool DRV_SPI_TransferStatisticsGet( const DRV_HANDLE handle, DRV_SPI_TRANSFER_STATISTICS* statistics )
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    bool isSuccess = false;
+
+    /* Validate the handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+    if ((clientObj != NULL) && (statistics != NULL))
+    {
+        statistics->pioTransfers = clientObj->dObj->pioTransferCount;
+        statistics->dmaTransfers = clientObj->dObj->dmaTransferCount;
+
+        isSuccess = true;
+    }
+    return isSuccess;
+}
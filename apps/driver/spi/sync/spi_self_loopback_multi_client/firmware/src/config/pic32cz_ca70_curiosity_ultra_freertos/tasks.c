@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP_CLIENT1_Tasks. */
 TaskHandle_t xAPP_CLIENT1_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_CLIENT1_Tasks task. */
+static StackType_t lAPP_CLIENT1_TasksStack[1024];
+static StaticTask_t lAPP_CLIENT1_TasksTCB;
+#endif
+
 static void lAPP_CLIENT1_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -80,6 +90,12 @@ TaskHandle_t xAPP_CLIENT2_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_CLIENT2_Tasks task. */
+static StackType_t lAPP_CLIENT2_TasksStack[1024];
+static StaticTask_t lAPP_CLIENT2_TasksTCB;
+#endif
+
 static void lAPP_CLIENT2_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -94,6 +110,12 @@ TaskHandle_t xAPP_MONITOR_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_MONITOR_Tasks task. */
+static StackType_t lAPP_MONITOR_TasksStack[1024];
+static StaticTask_t lAPP_MONITOR_TasksTCB;
+#endif
+
 static void lAPP_MONITOR_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -133,6 +155,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_CLIENT1_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_CLIENT1_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_CLIENT1_Tasks,
+           "APP_CLIENT1_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_CLIENT1_TasksStack,
+           &lAPP_CLIENT1_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_CLIENT1_Tasks,
            "APP_CLIENT1_Tasks",
@@ -140,8 +172,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_CLIENT1_Tasks);
+#endif
 
     /* Create OS Thread for APP_CLIENT2_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_CLIENT2_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_CLIENT2_Tasks,
+           "APP_CLIENT2_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_CLIENT2_TasksStack,
+           &lAPP_CLIENT2_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_CLIENT2_Tasks,
            "APP_CLIENT2_Tasks",
@@ -149,8 +192,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_CLIENT2_Tasks);
+#endif
 
     /* Create OS Thread for APP_MONITOR_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_MONITOR_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_MONITOR_Tasks,
+           "APP_MONITOR_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_MONITOR_TasksStack,
+           &lAPP_MONITOR_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_MONITOR_Tasks,
            "APP_MONITOR_Tasks",
@@ -158,8 +212,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_MONITOR_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -189,7 +189,37 @@ void APP_Tasks ( void )
             if (appData.isTransferDone == true)
             {
                 appData.isTransferDone = false;
-                appData.state = APP_STATE_READ;
+                appData.state = APP_STATE_FLUSH;
+            }
+            break;
+
+        case APP_STATE_FLUSH:
+
+            /* The write may only have been merged into the RAM cache of the
+             * driver, program it to the EEPROM before reading it back */
+            appData.state = APP_STATE_WAIT_FLUSH_COMPLETE;
+
+            if (DRV_AT25_CacheFlush(appData.drvHandle) == false)
+            {
+                appData.state = APP_STATE_ERROR;
+            }
+            break;
+
+        case APP_STATE_WAIT_FLUSH_COMPLETE:
+
+            if (appData.isTransferDone == true)
+            {
+                appData.isTransferDone = false;
+
+                /* Drop the cached pages so that the data is read back from the EEPROM */
+                if (DRV_AT25_CacheInvalidate(appData.drvHandle) == true)
+                {
+                    appData.state = APP_STATE_READ;
+                }
+                else
+                {
+                    appData.state = APP_STATE_ERROR;
+                }
             }
             break;
 
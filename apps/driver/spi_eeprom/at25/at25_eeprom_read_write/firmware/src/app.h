@@ -90,6 +90,8 @@ typedef enum
     APP_STATE_INIT=0,
     APP_STATE_WRITE,
     APP_STATE_WAIT_WRITE_COMPLETE,
+    APP_STATE_FLUSH,
+    APP_STATE_WAIT_FLUSH_COMPLETE,
     APP_STATE_READ,
     APP_STATE_WAIT_READ_COMPLETE,
     APP_STATE_VERIFY,
@@ -53,6 +53,8 @@
 #include "peripheral/nvic/plib_nvic.h"
 #include "driver/at25/drv_at25.h"
 #include "peripheral/spi/spi_master/plib_spi0_master.h"
+#include "peripheral/tc/plib_tc0.h"
+#include "system/time/sys_time.h"
 #include "peripheral/efc/plib_efc.h"
 #include "bsp/bsp.h"
 #include "system/int/sys_int.h"
@@ -194,6 +196,8 @@ typedef struct
     /* AT25 Driver Object */
     SYS_MODULE_OBJ drvAT25;
 
+    SYS_MODULE_OBJ  sysTime;
+
 
 } SYSTEM_OBJECTS;
 
@@ -114,6 +114,45 @@ typedef struct
 
 } DRV_AT25_PLIB_INTERFACE;
 
+// *****************************************************************************
+/* AT25 Driver Cache Page
+
+  Summary:
+    Defines the bookkeeping data of one page of the AT25 driver RAM cache.
+
+  Description:
+    The application allocates an array of these objects, together with a data
+    buffer of (cacheNumPages * pageSize) bytes, and passes both to the driver
+    through the initialization data. The members are owned by the driver.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Cached copy of the EEPROM page */
+    uint8_t*                            data;
+
+    /* EEPROM address of the first byte of the page */
+    uint32_t                            address;
+
+    /* Value of the cache use counter when the page was last accessed */
+    uint32_t                            lastUsed;
+
+    /* Modified byte range [dirtyStart, dirtyEnd) that is yet to be programmed */
+    uint32_t                            dirtyStart;
+
+    uint32_t                            dirtyEnd;
+
+    /* Page holds the EEPROM contents */
+    bool                                isValid;
+
+    /* Page holds data that is yet to be programmed */
+    bool                                isDirty;
+
+} DRV_AT25_CACHE_PAGE;
+
 // *****************************************************************************
 /* AT25 Driver Initialization Data
 
@@ -150,6 +189,19 @@ typedef struct
 
     uint32_t                            blockStartAddress;
 
+    /* Bookkeeping array of the RAM page cache, NULL if the cache is not used */
+    DRV_AT25_CACHE_PAGE*                cachePages;
+
+    /* Data buffer of the RAM page cache, cacheNumPages * pageSize bytes */
+    uint8_t*                            cacheBuffer;
+
+    /* Number of pages in the RAM page cache, 0 disables the cache */
+    uint32_t                            cacheNumPages;
+
+    /* Time (in milliseconds) after which modified pages are programmed to
+     * the EEPROM, 0 if they are programmed only by DRV_AT25_CacheFlush */
+    uint32_t                            cacheFlushTimeout;
+
 } DRV_AT25_INIT;
 
 
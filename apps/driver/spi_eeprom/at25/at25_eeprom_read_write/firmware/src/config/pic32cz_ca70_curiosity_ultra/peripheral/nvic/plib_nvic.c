@@ -61,6 +61,8 @@ void NVIC_Initialize( void )
      * from within the "Interrupt Manager" of MHC. */
     NVIC_SetPriority(SPI0_IRQn, 7);
     NVIC_EnableIRQ(SPI0_IRQn);
+    NVIC_SetPriority(TC0_CH0_IRQn, 7);
+    NVIC_EnableIRQ(TC0_CH0_IRQn);
 
     /* Enable Usage fault */
     SCB->SHCSR |= (SCB_SHCSR_USGFAULTENA_Msk);
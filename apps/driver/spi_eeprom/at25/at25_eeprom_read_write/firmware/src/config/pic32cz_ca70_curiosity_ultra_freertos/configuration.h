@@ -72,6 +72,12 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* OSAL semaphores and mutexes created from static storage */
+#define OSAL_STATIC_SEMAPHORE_COUNT                      (4U)
+
+/* Count the core clock cycles of the boot in SYS_BootCycles */
+#define SYS_BOOT_TIME_ENABLE                             true
+
 
 
 // *****************************************************************************
@@ -79,6 +85,19 @@ extern "C" {
 // Section: System Service Configuration
 // *****************************************************************************
 // *****************************************************************************
+/* TIME System Service Configuration Options */
+#define SYS_TIME_INDEX_0                            (0)
+#define SYS_TIME_MAX_TIMERS                         (5)
+#define SYS_TIME_HW_COUNTER_WIDTH                   (16)
+#define SYS_TIME_HW_COUNTER_PERIOD                  (65535U)
+#define SYS_TIME_HW_COUNTER_HALF_PERIOD             (SYS_TIME_HW_COUNTER_PERIOD>>1)
+#define SYS_TIME_CPU_CLOCK_FREQUENCY                (300000000)
+#define SYS_TIME_COMPARE_UPDATE_EXECUTION_CYCLES    (900)
+
+/* RTOS profiling, set SYS_PROFILE_ENABLE to true for the profiling build */
+#define SYS_PROFILE_ENABLE                          false
+#define SYS_PROFILE_MAX_TASKS                       (16U)
+#define SYS_PROFILE_TRACE_SIZE                      (256U)
 
 
 // *****************************************************************************
@@ -93,6 +112,8 @@ extern "C" {
 #define DRV_AT25_INT_SRC_IDX                   SPI0_IRQn
 #define DRV_AT25_EEPROM_FLASH_SIZE             262144U
 #define DRV_AT25_EEPROM_PAGE_SIZE              256U
+#define DRV_AT25_CACHE_NUM_PAGES               (4U)
+#define DRV_AT25_CACHE_FLUSH_TIMEOUT_MS        (100U)
 #define DRV_AT25_CHIP_SELECT_PIN_IDX           SYS_PORT_PIN_PA10
 #define DRV_AT25_HOLD_PIN_IDX                  SYS_PORT_PIN_PA0
 #define DRV_AT25_WP_PIN_IDX                    SYS_PORT_PIN_PD11
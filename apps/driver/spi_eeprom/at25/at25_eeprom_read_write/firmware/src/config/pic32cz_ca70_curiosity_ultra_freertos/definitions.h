@@ -53,6 +53,9 @@
 #include "peripheral/nvic/plib_nvic.h"
 #include "driver/at25/drv_at25.h"
 #include "peripheral/spi/spi_master/plib_spi0_master.h"
+#include "peripheral/tc/plib_tc0.h"
+#include "system/time/sys_time.h"
+#include "system/profile/sys_profile.h"
 #include "peripheral/efc/plib_efc.h"
 #include "bsp/bsp.h"
 #include "FreeRTOS.h"
@@ -196,6 +199,8 @@ typedef struct
     /* AT25 Driver Object */
     SYS_MODULE_OBJ drvAT25;
 
+    SYS_MODULE_OBJ  sysTime;
+
 
 } SYSTEM_OBJECTS;
 
@@ -209,6 +214,18 @@ typedef struct
 
 extern SYSTEM_OBJECTS sysObj;
 
+#ifndef SYS_BOOT_TIME_ENABLE
+#define SYS_BOOT_TIME_ENABLE    false
+#endif
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+/* Core clock cycles from the end of CLOCK_Initialize in SYS_Initialize to the
+   call of vTaskStartScheduler in SYS_Tasks, counted by the DWT cycle counter.
+   Divide by configCPU_CLOCK_HZ for the boot time in seconds. The C startup
+   code that runs before main is not included. */
+extern uint32_t SYS_BootCycles;
+#endif
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
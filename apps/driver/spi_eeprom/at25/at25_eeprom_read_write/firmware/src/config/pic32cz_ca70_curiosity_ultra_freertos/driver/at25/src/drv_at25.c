@@ -45,8 +45,10 @@
 // Section: Include Files
 // *****************************************************************************
 // *****************************************************************************
+#include <string.h>
 #include "configuration.h"
 #include "driver/at25/drv_at25.h"
+#include "system/int/sys_int.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -209,6 +211,31 @@ static bool lDRV_AT25_Write( void* txData, uint32_t txDataLength, uint32_t addre
 }
 
 
+static bool lDRV_AT25_Read( void* rxData, uint32_t rxDataLength, uint32_t address )
+{
+    bool status = false;
+
+    gDrvAT25Obj.transferStatus = DRV_AT25_TRANSFER_STATUS_BUSY;
+
+    /* save the request */
+    gDrvAT25Obj.nPendingBytes = rxDataLength;
+    gDrvAT25Obj.bufferAddr = rxData;
+    gDrvAT25Obj.memoryAddr = address;
+
+    gDrvAT25Obj.state = DRV_AT25_STATE_READ_DATA;
+
+    if (lDRV_AT25_WriteMemoryAddress((uint8_t)DRV_AT25_CMD_READ, address) == true)
+    {
+        status = true;
+    }
+    else
+    {
+        gDrvAT25Obj.transferStatus = DRV_AT25_TRANSFER_STATUS_ERROR;
+    }
+
+    return status;
+}
+
 static bool lDRV_AT25_ReadStatus(void)
 {
     bool status = false;
@@ -231,6 +258,534 @@ static bool lDRV_AT25_ReadStatus(void)
     return status;
 }
 
+/* Ends the client request with the given status and notifies the client */
+static void lDRV_AT25_ClientRequestComplete(DRV_AT25_TRANSFER_STATUS status)
+{
+    gDrvAT25Obj.clientStatus = status;
+
+    if ((gDrvAT25Obj.eventHandler) != NULL)
+    {
+        gDrvAT25Obj.eventHandler(status, gDrvAT25Obj.context);
+    }
+}
+
+/* Returns the cached page holding the given address, NULL if it is not cached */
+static DRV_AT25_CACHE_PAGE* lDRV_AT25_CachePageGet(uint32_t address)
+{
+    uint32_t i;
+    uint32_t pageAddr = address - (address % gDrvAT25Obj.pageSize);
+
+    for (i = 0; i < gDrvAT25Obj.cacheNumPages; i++)
+    {
+        if ((gDrvAT25Obj.cachePages[i].isValid == true) && (gDrvAT25Obj.cachePages[i].address == pageAddr))
+        {
+            return &gDrvAT25Obj.cachePages[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Returns a free page, or else the least recently used clean page. Dirty
+ * pages are never evicted, NULL is returned if all the pages are dirty. */
+static DRV_AT25_CACHE_PAGE* lDRV_AT25_CachePageAllocate(uint32_t address)
+{
+    DRV_AT25_CACHE_PAGE* page;
+    DRV_AT25_CACHE_PAGE* victim = NULL;
+    uint32_t i;
+
+    for (i = 0; i < gDrvAT25Obj.cacheNumPages; i++)
+    {
+        page = &gDrvAT25Obj.cachePages[i];
+
+        if (page->isValid == false)
+        {
+            victim = page;
+            break;
+        }
+        if ((page->isDirty == false) && ((victim == NULL) || \
+                ((gDrvAT25Obj.cacheUseCount - page->lastUsed) > (gDrvAT25Obj.cacheUseCount - victim->lastUsed))))
+        {
+            victim = page;
+        }
+    }
+
+    if (victim != NULL)
+    {
+        victim->isValid = false;
+        victim->isDirty = false;
+        victim->address = address - (address % gDrvAT25Obj.pageSize);
+    }
+
+    return victim;
+}
+
+/* Returns the first page that is yet to be programmed, NULL if there is none */
+static DRV_AT25_CACHE_PAGE* lDRV_AT25_CacheDirtyPageGet(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < gDrvAT25Obj.cacheNumPages; i++)
+    {
+        if (gDrvAT25Obj.cachePages[i].isDirty == true)
+        {
+            return &gDrvAT25Obj.cachePages[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Copies data between the client buffer and the cached pages. If any page
+ * of the address range is not cached, nothing is copied and false is returned. */
+static bool lDRV_AT25_CacheAccess(uint8_t* buffer, uint32_t length, uint32_t address, bool isWrite)
+{
+    DRV_AT25_CACHE_PAGE* page;
+    uint32_t offset;
+    uint32_t pageOffset;
+    uint32_t nBytes = 0;
+
+    for (offset = 0; offset < length; offset += nBytes)
+    {
+        pageOffset = (address + offset) % gDrvAT25Obj.pageSize;
+        nBytes = gDrvAT25Obj.pageSize - pageOffset;
+        nBytes = (length - offset) >= nBytes? nBytes: (length - offset);
+
+        if (lDRV_AT25_CachePageGet(address + offset) == NULL)
+        {
+            return false;
+        }
+    }
+
+    for (offset = 0; offset < length; offset += nBytes)
+    {
+        pageOffset = (address + offset) % gDrvAT25Obj.pageSize;
+        nBytes = gDrvAT25Obj.pageSize - pageOffset;
+        nBytes = (length - offset) >= nBytes? nBytes: (length - offset);
+
+        page = lDRV_AT25_CachePageGet(address + offset);
+
+        if (isWrite == true)
+        {
+            (void) memcpy(&page->data[pageOffset], &buffer[offset], nBytes);
+
+            /* Grow the dirty range so that one page program covers all the writes */
+            if (page->isDirty == false)
+            {
+                page->dirtyStart = pageOffset;
+                page->dirtyEnd = pageOffset + nBytes;
+                page->isDirty = true;
+            }
+            else
+            {
+                page->dirtyStart = (pageOffset < page->dirtyStart)? pageOffset: page->dirtyStart;
+                page->dirtyEnd = ((pageOffset + nBytes) > page->dirtyEnd)? (pageOffset + nBytes): page->dirtyEnd;
+            }
+        }
+        else
+        {
+            (void) memcpy(&buffer[offset], &page->data[pageOffset], nBytes);
+        }
+
+        gDrvAT25Obj.cacheUseCount++;
+        page->lastUsed = gDrvAT25Obj.cacheUseCount;
+    }
+
+    return true;
+}
+
+/* Copies the overlapping part of every cached page into the buffer of a
+ * completed read, or the written data into the cached pages after a write,
+ * so that the client and the cache always see the latest data. */
+static void lDRV_AT25_CacheSync(uint8_t* buffer, uint32_t length, uint32_t address, bool isWrite)
+{
+    DRV_AT25_CACHE_PAGE* page;
+    uint32_t startAddr;
+    uint32_t endAddr;
+    uint32_t i;
+
+    for (i = 0; i < gDrvAT25Obj.cacheNumPages; i++)
+    {
+        page = &gDrvAT25Obj.cachePages[i];
+
+        if (page->isValid == false)
+        {
+            continue;
+        }
+
+        startAddr = (page->address > address)? page->address: address;
+        endAddr = ((page->address + gDrvAT25Obj.pageSize) < (address + length))? \
+                (page->address + gDrvAT25Obj.pageSize): (address + length);
+
+        if (startAddr < endAddr)
+        {
+            if (isWrite == true)
+            {
+                (void) memcpy(&page->data[startAddr - page->address], &buffer[startAddr - address], (endAddr - startAddr));
+            }
+            else
+            {
+                (void) memcpy(&buffer[startAddr - address], &page->data[startAddr - page->address], (endAddr - startAddr));
+            }
+        }
+    }
+}
+
+/* Submits the page program of the dirty range of a cached page */
+static bool lDRV_AT25_CacheFlushPage(DRV_AT25_CACHE_PAGE* page, DRV_AT25_CACHE_OP cacheOp)
+{
+    gDrvAT25Obj.cacheOp = cacheOp;
+    gDrvAT25Obj.cachePage = page;
+
+    if (lDRV_AT25_Write(&page->data[page->dirtyStart], (page->dirtyEnd - page->dirtyStart), \
+            (page->address + page->dirtyStart)) == false)
+    {
+        gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_NONE;
+        return false;
+    }
+
+    return true;
+}
+
+static void lDRV_AT25_CacheFlushTimerStart(void);
+
+/* Called by SYS_TIME when the flush timeout has expired */
+static void lDRV_AT25_CacheFlushTimerHandler(uintptr_t context)
+{
+    DRV_AT25_CACHE_PAGE* page;
+
+    gDrvAT25Obj.cacheFlushTimer = SYS_TIME_HANDLE_INVALID;
+
+    if ((gDrvAT25Obj.isClientCall == true) || (gDrvAT25Obj.transferStatus == DRV_AT25_TRANSFER_STATUS_BUSY))
+    {
+        /* Driver is in use, try again after another timeout period */
+        lDRV_AT25_CacheFlushTimerStart();
+    }
+    else
+    {
+        page = lDRV_AT25_CacheDirtyPageGet();
+
+        if (page != NULL)
+        {
+            /* The client status is left as is, client requests submitted
+             * meanwhile are queued until the page program has ended */
+            gDrvAT25Obj.isCacheFlushBusy = true;
+
+            if (lDRV_AT25_CacheFlushPage(page, DRV_AT25_CACHE_OP_FLUSH_TIMEOUT) == false)
+            {
+                gDrvAT25Obj.isCacheFlushBusy = false;
+            }
+        }
+    }
+}
+
+/* Starts the flush timeout, unless it is already running. SYS_TIME may not be
+ * called from the SPI interrupt context, so this is only called from the
+ * client's context and from the flush timer callback. A queued request
+ * started by the SPI interrupt had the timer started when it was queued. */
+static void lDRV_AT25_CacheFlushTimerStart(void)
+{
+    if ((gDrvAT25Obj.cacheFlushTimeout != 0U) && (gDrvAT25Obj.cacheFlushTimer == SYS_TIME_HANDLE_INVALID) \
+            && (gDrvAT25Obj.isCachePendingStart == false))
+    {
+        gDrvAT25Obj.cacheFlushTimer = SYS_TIME_CallbackRegisterMS(lDRV_AT25_CacheFlushTimerHandler, 0, \
+                gDrvAT25Obj.cacheFlushTimeout, SYS_TIME_SINGLE);
+    }
+}
+
+/* Serves a client read from the cache, or reads the page into the cache */
+static bool lDRV_AT25_CacheRead(uint8_t* rxData, uint32_t rxDataLength, uint32_t address)
+{
+    DRV_AT25_CACHE_PAGE* page = NULL;
+    bool status = false;
+
+    if (lDRV_AT25_CacheAccess(rxData, rxDataLength, address, false) == true)
+    {
+        gDrvAT25Obj.cacheStats.readHits++;
+
+        lDRV_AT25_ClientRequestComplete(DRV_AT25_TRANSFER_STATUS_COMPLETED);
+
+        return true;
+    }
+
+    gDrvAT25Obj.cacheStats.readMisses++;
+
+    gDrvAT25Obj.cacheClientBuffer = rxData;
+    gDrvAT25Obj.cacheClientLength = rxDataLength;
+    gDrvAT25Obj.cacheClientAddr = address;
+
+    /* Reads within one page bring the whole page into the cache */
+    if (((address % gDrvAT25Obj.pageSize) + rxDataLength) <= gDrvAT25Obj.pageSize)
+    {
+        page = lDRV_AT25_CachePageAllocate(address);
+    }
+
+    if (page != NULL)
+    {
+        gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_FILL_READ;
+        gDrvAT25Obj.cachePage = page;
+
+        status = lDRV_AT25_Read(page->data, gDrvAT25Obj.pageSize, page->address);
+    }
+    else
+    {
+        gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_READ;
+
+        status = lDRV_AT25_Read(rxData, rxDataLength, address);
+    }
+
+    if (status == false)
+    {
+        gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_NONE;
+    }
+
+    return status;
+}
+
+/* Merges a client write into the cache, or writes it through to the EEPROM */
+static bool lDRV_AT25_CacheWrite(uint8_t* txData, uint32_t txDataLength, uint32_t address)
+{
+    DRV_AT25_CACHE_PAGE* page = NULL;
+    bool status = false;
+
+    if (lDRV_AT25_CacheAccess(txData, txDataLength, address, true) == true)
+    {
+        gDrvAT25Obj.cacheStats.writeHits++;
+
+        lDRV_AT25_CacheFlushTimerStart();
+
+        lDRV_AT25_ClientRequestComplete(DRV_AT25_TRANSFER_STATUS_COMPLETED);
+
+        return true;
+    }
+
+    gDrvAT25Obj.cacheStats.writeMisses++;
+
+    gDrvAT25Obj.cacheClientBuffer = txData;
+    gDrvAT25Obj.cacheClientLength = txDataLength;
+    gDrvAT25Obj.cacheClientAddr = address;
+
+    /* Writes within one page are merged into a cached copy of the page */
+    if (((address % gDrvAT25Obj.pageSize) + txDataLength) <= gDrvAT25Obj.pageSize)
+    {
+        page = lDRV_AT25_CachePageAllocate(address);
+    }
+
+    if (page == NULL)
+    {
+        gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_WRITE;
+
+        status = lDRV_AT25_Write(txData, txDataLength, address);
+    }
+    else if (txDataLength == gDrvAT25Obj.pageSize)
+    {
+        /* The whole page is overwritten, there is nothing to read */
+        page->isValid = true;
+
+        (void) lDRV_AT25_CacheAccess(txData, txDataLength, address, true);
+
+        lDRV_AT25_CacheFlushTimerStart();
+
+        lDRV_AT25_ClientRequestComplete(DRV_AT25_TRANSFER_STATUS_COMPLETED);
+
+        return true;
+    }
+    else
+    {
+        gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_FILL_WRITE;
+        gDrvAT25Obj.cachePage = page;
+
+        /* Page turns dirty once the read completes, start the timeout now
+         * as the timer can not be started from the interrupt context */
+        lDRV_AT25_CacheFlushTimerStart();
+
+        status = lDRV_AT25_Read(page->data, gDrvAT25Obj.pageSize, page->address);
+    }
+
+    if (status == false)
+    {
+        gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_NONE;
+    }
+
+    return status;
+}
+
+/* Starts a client read, write or flush on the cache */
+static bool lDRV_AT25_CacheRequestStart(DRV_AT25_CACHE_OP request, uint8_t* buffer, uint32_t length, uint32_t address)
+{
+    DRV_AT25_CACHE_PAGE* page;
+    bool status = true;
+
+    switch (request)
+    {
+        case DRV_AT25_CACHE_OP_READ:
+            status = lDRV_AT25_CacheRead(buffer, length, address);
+            break;
+
+        case DRV_AT25_CACHE_OP_WRITE:
+            status = lDRV_AT25_CacheWrite(buffer, length, address);
+            break;
+
+        default:
+            page = lDRV_AT25_CacheDirtyPageGet();
+
+            if (page != NULL)
+            {
+                status = lDRV_AT25_CacheFlushPage(page, DRV_AT25_CACHE_OP_FLUSH);
+            }
+            else
+            {
+                /* Nothing to program */
+                lDRV_AT25_ClientRequestComplete(DRV_AT25_TRANSFER_STATUS_COMPLETED);
+            }
+            break;
+    }
+
+    return status;
+}
+
+/* Submits a client request on the cache. While a flush on timeout is on the
+ * bus the request is queued instead, and started by the SPI interrupt as soon
+ * as the page program has ended. Called from the client's context only. */
+static bool lDRV_AT25_CacheRequestSubmit(DRV_AT25_CACHE_OP request, uint8_t* buffer, uint32_t length, uint32_t address)
+{
+    bool interruptState;
+    bool isQueued = false;
+    bool status = true;
+
+    gDrvAT25Obj.clientStatus = DRV_AT25_TRANSFER_STATUS_BUSY;
+
+    interruptState = SYS_INT_Disable();
+
+    if (gDrvAT25Obj.isCacheFlushBusy == true)
+    {
+        gDrvAT25Obj.cachePendingBuffer = buffer;
+        gDrvAT25Obj.cachePendingLength = length;
+        gDrvAT25Obj.cachePendingAddr = address;
+        gDrvAT25Obj.cachePendingOp = request;
+
+        isQueued = true;
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    if (isQueued == true)
+    {
+        /* The flush stops after the current page, restart the timeout for
+         * the pages it leaves behind and for the pages this request dirties */
+        lDRV_AT25_CacheFlushTimerStart();
+    }
+    else
+    {
+        status = lDRV_AT25_CacheRequestStart(request, buffer, length, address);
+    }
+
+    if (status == false)
+    {
+        gDrvAT25Obj.clientStatus = DRV_AT25_TRANSFER_STATUS_ERROR;
+    }
+
+    return status;
+}
+
+/* Starts the client request queued behind a flush on timeout, if any. Called
+ * from the SPI interrupt once the flush has released the bus. */
+static void lDRV_AT25_CachePendingStart(void)
+{
+    DRV_AT25_CACHE_OP request = gDrvAT25Obj.cachePendingOp;
+    bool status;
+
+    if (request != DRV_AT25_CACHE_OP_NONE)
+    {
+        gDrvAT25Obj.cachePendingOp = DRV_AT25_CACHE_OP_NONE;
+
+        gDrvAT25Obj.isCachePendingStart = true;
+
+        status = lDRV_AT25_CacheRequestStart(request, gDrvAT25Obj.cachePendingBuffer, \
+                gDrvAT25Obj.cachePendingLength, gDrvAT25Obj.cachePendingAddr);
+
+        gDrvAT25Obj.isCachePendingStart = false;
+
+        if (status == false)
+        {
+            lDRV_AT25_ClientRequestComplete(DRV_AT25_TRANSFER_STATUS_ERROR);
+        }
+    }
+}
+
+/* Called when a transfer that involves the cache has ended. Continues a
+ * flush with the next dirty page. Returns true if the client must be
+ * notified of the end of its request. */
+static bool lDRV_AT25_CacheTransferComplete(void)
+{
+    DRV_AT25_CACHE_OP cacheOp = gDrvAT25Obj.cacheOp;
+    DRV_AT25_CACHE_PAGE* page = gDrvAT25Obj.cachePage;
+    bool isTransferOk = (gDrvAT25Obj.transferStatus == DRV_AT25_TRANSFER_STATUS_COMPLETED);
+    bool notifyClient = true;
+
+    gDrvAT25Obj.cacheOp = DRV_AT25_CACHE_OP_NONE;
+
+    switch (cacheOp)
+    {
+        case DRV_AT25_CACHE_OP_READ:
+        case DRV_AT25_CACHE_OP_WRITE:
+            if (isTransferOk == true)
+            {
+                lDRV_AT25_CacheSync(gDrvAT25Obj.cacheClientBuffer, gDrvAT25Obj.cacheClientLength, \
+                        gDrvAT25Obj.cacheClientAddr, (cacheOp == DRV_AT25_CACHE_OP_WRITE));
+            }
+            break;
+
+        case DRV_AT25_CACHE_OP_FILL_READ:
+        case DRV_AT25_CACHE_OP_FILL_WRITE:
+            if (isTransferOk == true)
+            {
+                page->isValid = true;
+
+                (void) lDRV_AT25_CacheAccess(gDrvAT25Obj.cacheClientBuffer, gDrvAT25Obj.cacheClientLength, \
+                        gDrvAT25Obj.cacheClientAddr, (cacheOp == DRV_AT25_CACHE_OP_FILL_WRITE));
+            }
+            break;
+
+        case DRV_AT25_CACHE_OP_FLUSH:
+        case DRV_AT25_CACHE_OP_FLUSH_TIMEOUT:
+            if (isTransferOk == true)
+            {
+                page->isDirty = false;
+                gDrvAT25Obj.cacheStats.flushes++;
+
+                page = lDRV_AT25_CacheDirtyPageGet();
+
+                /* A client request queued behind a flush on timeout goes
+                 * first, the remaining pages wait for the next timeout */
+                if ((page != NULL) && ((cacheOp == DRV_AT25_CACHE_OP_FLUSH) || \
+                        (gDrvAT25Obj.cachePendingOp == DRV_AT25_CACHE_OP_NONE)) && \
+                        (lDRV_AT25_CacheFlushPage(page, cacheOp) == true))
+                {
+                    /* Flush continues with the next page */
+                    return false;
+                }
+            }
+
+            if (cacheOp == DRV_AT25_CACHE_OP_FLUSH_TIMEOUT)
+            {
+                /* The client did not request this flush. Pages that failed
+                 * to program stay dirty and are retried on the next flush. */
+                gDrvAT25Obj.isCacheFlushBusy = false;
+                notifyClient = false;
+
+                lDRV_AT25_CachePendingStart();
+            }
+            break;
+
+        default:
+                /* Nothing to do */
+            break;
+    }
+
+    return notifyClient;
+}
+
 static void lDRV_AT25_Handler( void )
 {
     switch(gDrvAT25Obj.state)
@@ -339,9 +894,13 @@ static void lSPIEventHandler(uintptr_t context )
     /* If transfer is complete, notify the application */
     if (gDrvAT25Obj.transferStatus != DRV_AT25_TRANSFER_STATUS_BUSY)
     {
-        if ((gDrvAT25Obj.eventHandler) != NULL)
+        if ((gDrvAT25Obj.cacheOp != DRV_AT25_CACHE_OP_NONE) && (lDRV_AT25_CacheTransferComplete() == false))
+        {
+            /* Transfer was internal to the cache */
+        }
+        else
         {
-            gDrvAT25Obj.eventHandler(gDrvAT25Obj.transferStatus, gDrvAT25Obj.context);
+            lDRV_AT25_ClientRequestComplete(gDrvAT25Obj.transferStatus);
         }
     }
 }
@@ -360,6 +919,7 @@ SYS_MODULE_OBJ DRV_AT25_Initialize(
 )
 {
     DRV_AT25_INIT* at25Init = (DRV_AT25_INIT *)init;
+    uint32_t i;
 
     /* Validate the request */
     if(drvIndex >= DRV_AT25_INSTANCES_NUMBER)
@@ -377,6 +937,7 @@ SYS_MODULE_OBJ DRV_AT25_Initialize(
     gDrvAT25Obj.inUse                 = true;
     gDrvAT25Obj.nClients              = 0;
     gDrvAT25Obj.transferStatus        = DRV_AT25_TRANSFER_STATUS_COMPLETED;
+    gDrvAT25Obj.clientStatus          = DRV_AT25_TRANSFER_STATUS_COMPLETED;
     gDrvAT25Obj.writeCompleted        = true;
 
     gDrvAT25Obj.spiPlib               = at25Init->spiPlib;
@@ -388,6 +949,26 @@ SYS_MODULE_OBJ DRV_AT25_Initialize(
     gDrvAT25Obj.holdPin               = at25Init->holdPin;
     gDrvAT25Obj.writeProtectPin       = at25Init->writeProtectPin;
 
+    gDrvAT25Obj.cachePages            = at25Init->cachePages;
+    gDrvAT25Obj.cacheNumPages         = (at25Init->cachePages != NULL)? at25Init->cacheNumPages: 0U;
+    gDrvAT25Obj.cacheFlushTimeout     = at25Init->cacheFlushTimeout;
+    gDrvAT25Obj.cacheFlushTimer       = SYS_TIME_HANDLE_INVALID;
+    gDrvAT25Obj.cacheOp               = DRV_AT25_CACHE_OP_NONE;
+    gDrvAT25Obj.cacheUseCount         = 0;
+    gDrvAT25Obj.isClientCall          = false;
+    gDrvAT25Obj.isCacheFlushBusy      = false;
+    gDrvAT25Obj.cachePendingOp        = DRV_AT25_CACHE_OP_NONE;
+    gDrvAT25Obj.isCachePendingStart   = false;
+
+    (void) memset(&gDrvAT25Obj.cacheStats, 0, sizeof(DRV_AT25_CACHE_STATS));
+
+    for (i = 0; i < gDrvAT25Obj.cacheNumPages; i++)
+    {
+        gDrvAT25Obj.cachePages[i].data = &at25Init->cacheBuffer[i * gDrvAT25Obj.pageSize];
+        gDrvAT25Obj.cachePages[i].isValid = false;
+        gDrvAT25Obj.cachePages[i].isDirty = false;
+    }
+
     gDrvAT25Obj.spiPlib->callbackRegister(lSPIEventHandler, 0U);
 
     /* De-assert Chip Select, Hold and Write protect pin to begin with. */
@@ -469,55 +1050,137 @@ bool DRV_AT25_Read(
 {
     bool isRequestAccepted = false;
 
+    /* Keep the cache flush timer off the bus while the request is submitted */
+    gDrvAT25Obj.isClientCall = true;
+
     if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (rxData == NULL) \
-            || (rxDataLength == 0U) || (gDrvAT25Obj.transferStatus == DRV_AT25_TRANSFER_STATUS_BUSY))
+            || (rxDataLength == 0U) || (gDrvAT25Obj.clientStatus == DRV_AT25_TRANSFER_STATUS_BUSY))
+    {
+        /* Invalid request */
+    }
+    else if ((address + rxDataLength) > gDrvAT25Obj.flashSize)
     {
-        return isRequestAccepted;
+        /* Reading past the flash size results in an error */
+    }
+    else if (gDrvAT25Obj.cacheNumPages != 0U)
+    {
+        isRequestAccepted = lDRV_AT25_CacheRequestSubmit(DRV_AT25_CACHE_OP_READ, (uint8_t*)rxData, rxDataLength, address);
+    }
+    else
+    {
+        gDrvAT25Obj.clientStatus = DRV_AT25_TRANSFER_STATUS_BUSY;
+
+        isRequestAccepted = lDRV_AT25_Read(rxData, rxDataLength, address);
+
+        if (isRequestAccepted == false)
+        {
+            gDrvAT25Obj.clientStatus = DRV_AT25_TRANSFER_STATUS_ERROR;
+        }
     }
 
-    if ((address + rxDataLength) > gDrvAT25Obj.flashSize)
+    gDrvAT25Obj.isClientCall = false;
+
+    return isRequestAccepted;
+}
+
+bool DRV_AT25_Write( const DRV_HANDLE handle, void *txData, uint32_t txDataLength, uint32_t address )
+{
+    bool isRequestAccepted = false;
+
+    /* Keep the cache flush timer off the bus while the request is submitted */
+    gDrvAT25Obj.isClientCall = true;
+
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (txData == NULL) \
+            || (txDataLength == 0U) || (gDrvAT25Obj.clientStatus == DRV_AT25_TRANSFER_STATUS_BUSY))
+    {
+        /* Invalid request */
+    }
+    else if ((address + txDataLength) > gDrvAT25Obj.flashSize)
     {
         /* Writing past the flash size results in an error */
-        return isRequestAccepted;
     }
+    else if (gDrvAT25Obj.cacheNumPages != 0U)
+    {
+        isRequestAccepted = lDRV_AT25_CacheRequestSubmit(DRV_AT25_CACHE_OP_WRITE, (uint8_t*)txData, txDataLength, address);
+    }
+    else
+    {
+        gDrvAT25Obj.clientStatus = DRV_AT25_TRANSFER_STATUS_BUSY;
 
-    gDrvAT25Obj.transferStatus = DRV_AT25_TRANSFER_STATUS_BUSY;
+        isRequestAccepted = lDRV_AT25_Write(txData, txDataLength, address);
 
-    /* save the request */
-    gDrvAT25Obj.nPendingBytes = rxDataLength;
-    gDrvAT25Obj.bufferAddr = rxData;
-    gDrvAT25Obj.memoryAddr = address;
+        if (isRequestAccepted == false)
+        {
+            gDrvAT25Obj.clientStatus = DRV_AT25_TRANSFER_STATUS_ERROR;
+        }
+    }
 
-    gDrvAT25Obj.state = DRV_AT25_STATE_READ_DATA;
+    gDrvAT25Obj.isClientCall = false;
 
-    if (lDRV_AT25_WriteMemoryAddress((uint8_t)DRV_AT25_CMD_READ, address) == true)
+    return isRequestAccepted;
+}
+
+bool DRV_AT25_PageWrite(const DRV_HANDLE handle, void *txData, uint32_t address )
+{
+    return DRV_AT25_Write(handle, txData, gDrvAT25Obj.pageSize, address );
+}
+
+bool DRV_AT25_CacheFlush(const DRV_HANDLE handle)
+{
+    bool isRequestAccepted = false;
+
+    /* Keep the cache flush timer off the bus while the request is submitted */
+    gDrvAT25Obj.isClientCall = true;
+
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (gDrvAT25Obj.cacheNumPages == 0U) \
+            || (gDrvAT25Obj.clientStatus == DRV_AT25_TRANSFER_STATUS_BUSY))
     {
-        isRequestAccepted = true;
+        /* Invalid request */
     }
     else
     {
-        gDrvAT25Obj.transferStatus = DRV_AT25_TRANSFER_STATUS_ERROR;
+        isRequestAccepted = lDRV_AT25_CacheRequestSubmit(DRV_AT25_CACHE_OP_FLUSH, NULL, 0U, 0U);
     }
 
+    gDrvAT25Obj.isClientCall = false;
+
     return isRequestAccepted;
 }
 
-bool DRV_AT25_Write( const DRV_HANDLE handle, void *txData, uint32_t txDataLength, uint32_t address )
+bool DRV_AT25_CacheInvalidate(const DRV_HANDLE handle)
 {
-    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (txData == NULL) \
-            || (txDataLength == 0U) || (gDrvAT25Obj.transferStatus == DRV_AT25_TRANSFER_STATUS_BUSY))
+    uint32_t i;
+
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (gDrvAT25Obj.cacheNumPages == 0U) \
+            || (gDrvAT25Obj.clientStatus == DRV_AT25_TRANSFER_STATUS_BUSY) || (gDrvAT25Obj.isCacheFlushBusy == true))
     {
         return false;
     }
-    else
+
+    /* Modified pages must be flushed first, their data would be lost */
+    if (lDRV_AT25_CacheDirtyPageGet() != NULL)
+    {
+        return false;
+    }
+
+    for (i = 0; i < gDrvAT25Obj.cacheNumPages; i++)
     {
-        return lDRV_AT25_Write(txData, txDataLength, address);
+        gDrvAT25Obj.cachePages[i].isValid = false;
     }
+
+    return true;
 }
 
-bool DRV_AT25_PageWrite(const DRV_HANDLE handle, void *txData, uint32_t address )
+bool DRV_AT25_CacheStatsGet(const DRV_HANDLE handle, DRV_AT25_CACHE_STATS *stats)
 {
-    return DRV_AT25_Write(handle, txData, gDrvAT25Obj.pageSize, address );
+    if((handle == DRV_HANDLE_INVALID) || (handle > 0U) || (stats == NULL) || (gDrvAT25Obj.cacheNumPages == 0U))
+    {
+        return false;
+    }
+
+    *stats = gDrvAT25Obj.cacheStats;
+
+    return true;
 }
 
 DRV_AT25_TRANSFER_STATUS DRV_AT25_TransferStatusGet(const DRV_HANDLE handle)
@@ -528,7 +1191,7 @@ DRV_AT25_TRANSFER_STATUS DRV_AT25_TransferStatusGet(const DRV_HANDLE handle)
     }
     else
     {
-        return gDrvAT25Obj.transferStatus;
+        return gDrvAT25Obj.clientStatus;
     }
 }
 
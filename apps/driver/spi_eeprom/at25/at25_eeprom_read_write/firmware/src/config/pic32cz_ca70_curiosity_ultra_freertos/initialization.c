@@ -91,6 +91,11 @@ static const DRV_AT25_PLIB_INTERFACE drvAT25PlibAPI = {
     .callbackRegister = (DRV_AT25_PLIB_CALLBACK_REGISTER)SPI0_CallbackRegister,
 };
 
+/* AT25 Driver RAM page cache */
+static DRV_AT25_CACHE_PAGE drvAT25CachePages[DRV_AT25_CACHE_NUM_PAGES];
+
+static uint8_t drvAT25CacheBuffer[DRV_AT25_CACHE_NUM_PAGES * DRV_AT25_EEPROM_PAGE_SIZE];
+
 /* AT25 Driver Initialization Data */
 static const DRV_AT25_INIT drvAT25InitData =
 {
@@ -113,6 +118,36 @@ static const DRV_AT25_INIT drvAT25InitData =
     .holdPin    = DRV_AT25_HOLD_PIN_IDX,
 
     .writeProtectPin    = DRV_AT25_WP_PIN_IDX,
+
+    /* RAM page cache */
+    .cachePages = drvAT25CachePages,
+
+    .cacheBuffer = drvAT25CacheBuffer,
+
+    .cacheNumPages = DRV_AT25_CACHE_NUM_PAGES,
+
+    /* Modified pages are programmed after this many milliseconds */
+    .cacheFlushTimeout = DRV_AT25_CACHE_FLUSH_TIMEOUT_MS,
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="SYS_TIME Initialization Data">
+
+static const SYS_TIME_PLIB_INTERFACE sysTimePlibAPI = {
+    .timerCallbackSet = (SYS_TIME_PLIB_CALLBACK_REGISTER)TC0_CH0_TimerCallbackRegister,
+    .timerStart = (SYS_TIME_PLIB_START)TC0_CH0_TimerStart,
+    .timerStop = (SYS_TIME_PLIB_STOP)TC0_CH0_TimerStop ,
+    .timerFrequencyGet = (SYS_TIME_PLIB_FREQUENCY_GET)TC0_CH0_TimerFrequencyGet,
+    .timerPeriodSet = (SYS_TIME_PLIB_PERIOD_SET)TC0_CH0_TimerPeriodSet,
+    .timerCompareSet = (SYS_TIME_PLIB_COMPARE_SET)TC0_CH0_TimerCompareSet,
+    .timerCounterGet = (SYS_TIME_PLIB_COUNTER_GET)TC0_CH0_TimerCounterGet,
+};
+
+static const SYS_TIME_INIT sysTimeInitData =
+{
+    .timePlib = &sysTimePlibAPI,
+    .hwTimerIntNum = TC0_CH0_IRQn,
 };
 
 // </editor-fold>
@@ -170,6 +205,15 @@ void SYS_Initialize ( void* data )
     EFC_Initialize();
   
     CLOCK_Initialize();
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+    /* Count the core clock cycles up to the start of the scheduler */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
 	PIO_Initialize();
 
 
@@ -180,6 +224,8 @@ void SYS_Initialize ( void* data )
 
 	SPI0_Initialize();
 
+    TC0_CH0_TimerInitialize(); 
+
 	BSP_Initialize();
 
     /* MISRAC 2012 deviation block start */
@@ -189,6 +235,12 @@ void SYS_Initialize ( void* data )
 
     sysObj.drvAT25 = DRV_AT25_Initialize(DRV_AT25_INDEX, (SYS_MODULE_INIT *)&drvAT25InitData);
 
+    /* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -  
+    H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1*/
+        
+    sysObj.sysTime = SYS_TIME_Initialize(SYS_TIME_INDEX_0, (SYS_MODULE_INIT *)&sysTimeInitData);
+    
+    /* MISRAC 2012 deviation block end */
 
 
 
@@ -67,6 +67,7 @@ void DebugMonitor_Handler (void);
 void xPortPendSVHandler (void);
 void xPortSysTickHandler (void);
 void SPI0_InterruptHandler (void);
+void TC0_CH0_InterruptHandler (void);
 
 
 
@@ -80,6 +80,7 @@ APP_DATA CACHE_ALIGN appData;
 
 static uint32_t erase_index = 0;
 static uint32_t write_index = 0;
+static uint32_t read_index = 0;
 
 // *****************************************************************************
 // *****************************************************************************
@@ -188,6 +189,7 @@ void APP_Tasks ( void )
 
             erase_index = 0;
             write_index = 0;
+            read_index = 0;
             appData.state = APP_STATE_ERASE_FLASH;
 
             break;
@@ -281,12 +283,19 @@ void APP_Tasks ( void )
         {
             appData.isTransferDone = false;
 
-            if (DRV_SST26_Read(appData.handle, (uint32_t *)&appData.readBuffer, BUFFER_SIZE, MEM_ADDRESS) != true)
+            if (DRV_SST26_Read(appData.handle, (uint32_t *)&appData.readBuffer[read_index], READ_BLOCK_SIZE, (MEM_ADDRESS + read_index)) != true)
             {
                 appData.state = APP_STATE_ERROR;
             }
             else
             {
+                /* A read served from the read-ahead buffers is complete on
+                 * return, no event is given for it */
+                if (DRV_SST26_TransferStatusGet(appData.handle) != DRV_SST26_TRANSFER_BUSY)
+                {
+                    appData.isTransferDone = true;
+                }
+
                 appData.state = APP_STATE_READ_WAIT;
             }
 
@@ -301,7 +310,16 @@ void APP_Tasks ( void )
 
                 if(transferStatus == DRV_SST26_TRANSFER_COMPLETED)
                 {
-                    appData.state = APP_STATE_VERIFY_DATA;
+                    read_index += READ_BLOCK_SIZE;
+
+                    if (read_index < BUFFER_SIZE)
+                    {
+                        appData.state = APP_STATE_READ_MEMORY;
+                    }
+                    else
+                    {
+                        appData.state = APP_STATE_VERIFY_DATA;
+                    }
                 }
                 else if (transferStatus == DRV_SST26_TRANSFER_ERROR_UNKNOWN)
                 {
@@ -74,6 +74,9 @@ extern "C" {
 #define BUFFER_SIZE     16384
 #define MEM_ADDRESS     0x0
 
+/* Read back in sector sized requests, the way a file system reads the flash */
+#define READ_BLOCK_SIZE 512
+
 // *****************************************************************************
 /* Application states
 
@@ -93,6 +93,8 @@ extern "C" {
 #define DRV_SST26_PAGE_SIZE             (256U)
 #define DRV_SST26_ERASE_BUFFER_SIZE     (4096U)
 #define DRV_SST26_CHIP_SELECT_PIN       SYS_PORT_PIN_PA11
+#define DRV_SST26_READ_AHEAD_ENABLE     true
+#define DRV_SST26_READ_AHEAD_SIZE       (2048U)
 
 
 
@@ -695,7 +695,10 @@ bool DRV_SST26_ChipErase( const DRV_HANDLE handle );
     </code>
 
   Remarks:
-    None.
+    With the SPI interface and DRV_SST26_READ_AHEAD_ENABLE set to true, a read
+    served whole from the read-ahead buffers is complete when this function
+    returns. DRV_SST26_TransferStatusGet then returns
+    DRV_SST26_TRANSFER_COMPLETED and the event handler is not called for it.
 */
 
 bool DRV_SST26_Read( const DRV_HANDLE handle, void *rx_data, uint32_t rx_data_length, uint32_t address );
@@ -888,6 +891,216 @@ DRV_SST26_TRANSFER_STATUS DRV_SST26_TransferStatusGet( const DRV_HANDLE handle )
 
 bool DRV_SST26_GeometryGet( const DRV_HANDLE handle, DRV_SST26_GEOMETRY *geometry );
 
+// *****************************************************************************
+/* Function:
+    void *DRV_SST26_XipAddressGet( const DRV_HANDLE handle, uint32_t address );
+
+  Summary:
+    Returns the address of the flash contents in the QSPI memory window.
+
+  Description:
+    This function maps the flash in the QSPI memory window in continuous read
+    mode, if it is not mapped yet, and returns the address at which the flash
+    location is read as plain memory, through the data cache.
+
+    The driver unmaps the flash for any other command, program, erase and
+    register accesses, and maps it again when TransferStatusGet reports the
+    completion of the program or erase operation. The flash is not mapped
+    while a program or erase operation is in progress, unless it is
+    suspended.
+
+    This function is only supported when sst26 driver is using QSPI PLIB in
+    memory mode with DRV_SST26_XIP_ENABLE set to true.
+
+  Precondition:
+    DRV_SST26_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle  - A valid open-instance handle, returned from the driver's open
+              routine
+
+    address - Flash memory address
+
+  Returns:
+    Pointer to the flash location in the QSPI memory window.
+
+    NULL if the address is beyond the flash size or execute-in-place is not
+    available.
+
+  Example:
+    <code>
+
+    const uint8_t *table;
+
+    if (DRV_SST26_XipLock(handle) == true)
+    {
+        table = (const uint8_t *)DRV_SST26_XipAddressGet(handle, TABLE_ADDRESS);
+
+        // table[] can be read until DRV_SST26_XipUnlock is called
+
+        DRV_SST26_XipUnlock(handle);
+    }
+
+    </code>
+
+  Remarks:
+    The flash is only guaranteed to stay mapped between DRV_SST26_XipLock and
+    DRV_SST26_XipUnlock.
+*/
+
+void *DRV_SST26_XipAddressGet( const DRV_HANDLE handle, uint32_t address );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SST26_XipLock( const DRV_HANDLE handle );
+
+  Summary:
+    Keeps the flash mapped in the QSPI memory window.
+
+  Description:
+    This function maps the flash in the QSPI memory window, if it is not mapped
+    yet, and keeps it mapped until DRV_SST26_XipUnlock is called. While the
+    window is locked, the program, erase and register functions of the driver
+    return false and TransferStatusGet reports DRV_SST26_TRANSFER_COMPLETED.
+
+    Locks nest, the window is released once every successful call has been
+    matched by a call to DRV_SST26_XipUnlock.
+
+    This function is only supported when sst26 driver is using QSPI PLIB in
+    memory mode with DRV_SST26_XIP_ENABLE set to true.
+
+  Precondition:
+    DRV_SST26_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+  Returns:
+    true if the flash is mapped and locked.
+
+    false if a program or erase operation is in progress or suspended, or if
+    execute-in-place is not available.
+
+  Example:
+    Refer to DRV_SST26_XipAddressGet.
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SST26_XipLock( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    void DRV_SST26_XipUnlock( const DRV_HANDLE handle );
+
+  Summary:
+    Releases a lock taken with DRV_SST26_XipLock.
+
+  Description:
+    This function undoes one successful call to DRV_SST26_XipLock. Once all
+    of them are undone, the driver may unmap the flash again.
+
+  Precondition:
+    DRV_SST26_XipLock must have returned true.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+  Returns:
+    None.
+
+  Example:
+    Refer to DRV_SST26_XipAddressGet.
+
+  Remarks:
+    The flash may be unmapped once the last lock is released, pointers
+    returned by DRV_SST26_XipAddressGet are no longer valid then.
+*/
+
+void DRV_SST26_XipUnlock( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SST26_Suspend( const DRV_HANDLE handle );
+
+  Summary:
+    Suspends the page program or erase operation in progress.
+
+  Description:
+    This function sends the write-suspend command and waits for the flash to
+    enter the suspended state, which takes at most 10 us. While suspended, the
+    flash can be read outside of the page or the block being programmed or
+    erased. DRV_SST26_TransferStatusGet reports the read transfers as usual.
+
+    This function is only supported when sst26 driver is using QSPI PLIB.
+
+  Precondition:
+    DRV_SST26_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+  Returns:
+    true  - The operation is suspended.
+
+    false - No program or erase operation was in progress, the operation
+            completed before it could be suspended, or the command failed.
+
+  Example:
+    <code>
+
+    if (DRV_SST26_Suspend(handle) == true)
+    {
+        DRV_SST26_Read(handle, buffer, BUFFER_SIZE, OTHER_SECTOR_ADDRESS);
+
+        DRV_SST26_Resume(handle);
+    }
+
+    </code>
+
+  Remarks:
+    No other program or erase operation may be started while an operation is
+    suspended.
+*/
+
+bool DRV_SST26_Suspend( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SST26_Resume( const DRV_HANDLE handle );
+
+  Summary:
+    Resumes the suspended page program or erase operation.
+
+  Description:
+    This function sends the write-resume command. The operation continues and
+    DRV_SST26_TransferStatusGet reports it busy until it completes.
+
+    This function is only supported when sst26 driver is using QSPI PLIB.
+
+  Precondition:
+    DRV_SST26_Suspend must have returned true.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+  Returns:
+    true  - The operation is resumed.
+
+    false - No operation is suspended, or the command failed.
+
+  Remarks:
+    The flash needs some time after a resume to make progress. Suspending it
+    again right away, repeatedly, can keep the operation from completing.
+*/
+
+bool DRV_SST26_Resume( const DRV_HANDLE handle );
+
 // *****************************************************************************
 /* Function:
     void DRV_SST26_EventHandlerSet(
@@ -980,6 +1193,9 @@ bool DRV_SST26_GeometryGet( const DRV_HANDLE handle, DRV_SST26_GEOMETRY *geometr
   Remarks:
     If the client does not want to be notified when the queued buffer transfer
     has completed, it does not need to register a callback.
+
+    The event handler is called from the interrupt context of the driver. A
+    read that DRV_SST26_Read completes before returning gives no event.
 */
 /* MISRA C-2012 Rule 8.6 deviated:2 Deviation record ID -  H3_MISRAC_2012_R_8_6_DR_1 */
 
@@ -51,6 +51,10 @@
 
 #include "drv_sst26_spi_interface.h"
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+#include "system/int/sys_int.h"
+#endif
+
 /* Array to hold the commands to be sent  */
 static CACHE_ALIGN uint8_t sst26Command[CACHE_ALIGNED_SIZE_GET(8)];
 
@@ -59,6 +63,12 @@ static CACHE_ALIGN uint8_t sst26Response[CACHE_ALIGNED_SIZE_GET(2)];
 
 static CACHE_ALIGN uint8_t jedecID[CACHE_ALIGNED_SIZE_GET(4)] = { 0 };
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+/* Read-ahead buffers. The bytes clocked in while the command, address and
+ * dummy byte go out land ahead of the window data. */
+static CACHE_ALIGN uint8_t sst26ReadAhead[2][CACHE_ALIGNED_SIZE_GET(DRV_SST26_READ_AHEAD_HEADER_SIZE + DRV_SST26_READ_AHEAD_SIZE)];
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Global objects
@@ -104,47 +114,129 @@ static uint32_t DRV_SST26_GetFlashSize( uint8_t deviceId )
     return 0;
 }
 
-static bool DRV_SST26_ResetFlash(void)
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+
+/* Drops the read-ahead windows before the flash content changes. A fill still
+ * in progress is discarded when it completes. */
+static void lDRV_SST26_ReadAheadFlush(void)
 {
-    dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
+    bool interruptState = SYS_INT_Disable();
 
-    dObj->state             = DRV_SST26_STATE_WAIT_RESET_FLASH_COMPLETE;
+    dObj->readAheadValid[0]     = false;
+    dObj->readAheadValid[1]     = false;
+    dObj->isReadAheadDropped    = dObj->isReadAheadBusy;
 
-    sst26Command[0] = (uint8_t)SST26_CMD_FLASH_RESET_ENABLE;
-    dObj->transferDataObj.pTransmitData = sst26Command;
-
-    dObj->transferDataObj.txSize = 1;
+    SYS_INT_Restore(interruptState);
+}
 
-    (void) DRV_SST26_SPIWriteRead(dObj, &dObj->transferDataObj);
+/* Returns the index of the read-ahead buffer holding address, or 2. */
+static uint32_t lDRV_SST26_ReadAheadFind(uint32_t address)
+{
+    uint32_t i;
 
-    while (dObj->transferStatus == DRV_SST26_TRANSFER_BUSY)
+    for (i = 0U; i < 2U; i++)
     {
-        /* Nothing to do */
+        if ((dObj->readAheadValid[i] == true) &&
+            (address >= dObj->readAheadAddr[i]) &&
+            ((address - dObj->readAheadAddr[i]) < dObj->readAheadSize[i]))
+        {
+            break;
+        }
     }
 
+    return i;
+}
 
-    dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
+/* Starts filling the buffer not used last with size bytes from address.
+ * Command, address and data go in one chip select held transfer. */
+static void lDRV_SST26_ReadAheadFill(uint32_t address, uint32_t size)
+{
+    uint32_t i = (dObj->readAheadLast == 0U) ? 1U : 0U;
 
-    dObj->state             = DRV_SST26_STATE_WAIT_RESET_FLASH_COMPLETE;
+    dObj->readAheadValid[i]     = false;
+    dObj->readAheadAddr[i]      = address;
+    dObj->readAheadSize[i]      = size;
+    dObj->readAheadFill         = i;
+    dObj->isReadAheadDropped    = false;
+    dObj->isReadAheadBusy       = true;
+
+    sst26Command[0] = (uint8_t)SST26_CMD_HIGH_SPEED_READ;
+    sst26Command[1] = (uint8_t)(address >> 16);
+    sst26Command[2] = (uint8_t)(address >> 8);
+    sst26Command[3] = (uint8_t)address;
+    sst26Command[4] = 0xFF;
 
-    sst26Command[0] = (uint8_t)SST26_CMD_FLASH_RESET;
     dObj->transferDataObj.pTransmitData = sst26Command;
-    dObj->transferDataObj.pReceiveData = NULL;
+    dObj->transferDataObj.txSize = DRV_SST26_READ_AHEAD_HEADER_SIZE;
+    dObj->transferDataObj.pReceiveData = sst26ReadAhead[i];
+    dObj->transferDataObj.rxSize = DRV_SST26_READ_AHEAD_HEADER_SIZE + size;
 
-    dObj->transferDataObj.txSize = 1;
-    dObj->transferDataObj.rxSize = 0;
+    dObj->state = DRV_SST26_STATE_WAIT_READ_AHEAD_COMPLETE;
 
     (void) DRV_SST26_SPIWriteRead(dObj, &dObj->transferDataObj);
+}
 
-    while (dObj->transferStatus == DRV_SST26_TRANSFER_BUSY)
+/* Copies what the read-ahead buffers hold of the pending client read, and
+ * fetches the rest when they run out: a whole window when the client reads
+ * sequentially, only the bytes still pending otherwise. Once the read is
+ * complete, the window following it is fetched in the background if the
+ * client reads sequentially. Returns true once the client read is complete. */
+static bool lDRV_SST26_ReadAheadServe(void)
+{
+    uint32_t i = lDRV_SST26_ReadAheadFind(dObj->memoryAddr);
+    uint32_t offset;
+    uint32_t nBytes;
+    uint32_t nextAddr;
+
+    while ((dObj->nPendingBytes > 0U) && (i < 2U))
     {
-        /* Nothing to do */
+        offset = dObj->memoryAddr - dObj->readAheadAddr[i];
+        nBytes = dObj->readAheadSize[i] - offset;
+
+        if (nBytes > dObj->nPendingBytes)
+        {
+            nBytes = dObj->nPendingBytes;
+        }
+
+        (void) memcpy(dObj->bufferAddr, &sst26ReadAhead[i][DRV_SST26_READ_AHEAD_HEADER_SIZE + offset], nBytes);
+
+        dObj->bufferAddr    += nBytes;
+        dObj->memoryAddr    += nBytes;
+        dObj->nPendingBytes -= nBytes;
+        dObj->readAheadLast  = i;
+
+        i = lDRV_SST26_ReadAheadFind(dObj->memoryAddr);
     }
 
+    if (dObj->nPendingBytes > 0U)
+    {
+        if (dObj->isReadSequential == true)
+        {
+            lDRV_SST26_ReadAheadFill(dObj->memoryAddr, DRV_SST26_READ_AHEAD_SIZE);
+        }
+        else
+        {
+            lDRV_SST26_ReadAheadFill(dObj->memoryAddr, dObj->nPendingBytes);
+        }
+    }
+    else
+    {
+        dObj->isReadPending  = false;
+        dObj->transferStatus = DRV_SST26_TRANSFER_COMPLETED;
 
-    return true;
+        nextAddr = dObj->readAheadAddr[dObj->readAheadLast] + dObj->readAheadSize[dObj->readAheadLast];
+
+        if ((dObj->isReadSequential == true) && (lDRV_SST26_ReadAheadFind(nextAddr) == 2U))
+        {
+            lDRV_SST26_ReadAheadFill(nextAddr, DRV_SST26_READ_AHEAD_SIZE);
+        }
+    }
+
+    return (dObj->nPendingBytes == 0U);
 }
 
+#endif
+
 static bool DRV_SST26_WriteEnable(void)
 {
     sst26Command[0] = (uint8_t)SST26_CMD_WRITE_ENABLE;
@@ -232,22 +324,137 @@ static bool DRV_SST26_WriteData( void* txData, uint32_t txDataLength, uint32_t a
     return true;
 }
 
+/* Sends the first transfer of the client command saved in dObj, according to
+ * the state it starts in. */
+static bool lDRV_SST26_CommandStart( void )
+{
+    bool status = true;
+
+    switch(dObj->state)
+    {
+        case DRV_SST26_STATE_READ_DATA:
+        {
+            status = DRV_SST26_WriteCommandAddress((uint8_t)SST26_CMD_HIGH_SPEED_READ, dObj->memoryAddr);
+            break;
+        }
+
+        case DRV_SST26_STATE_WAIT_JEDEC_ID_READ_COMPLETE:
+        {
+            sst26Command[0] = (uint8_t)SST26_CMD_JEDEC_ID_READ;
+
+            dObj->transferDataObj.pTransmitData = sst26Command;
+            dObj->transferDataObj.txSize = 1;
+            dObj->transferDataObj.pReceiveData = dObj->bufferAddr;
+            dObj->transferDataObj.rxSize = 4;
+
+            (void) DRV_SST26_SPIWriteRead(dObj, &dObj->transferDataObj);
+            break;
+        }
+
+        case DRV_SST26_STATE_WAIT_RESET_FLASH_COMPLETE:
+        {
+            sst26Command[0] = dObj->currentCommand;
+
+            dObj->transferDataObj.pTransmitData = sst26Command;
+            dObj->transferDataObj.txSize = 1;
+            dObj->transferDataObj.pReceiveData = NULL;
+            dObj->transferDataObj.rxSize = 0;
+
+            (void) DRV_SST26_SPIWriteRead(dObj, &dObj->transferDataObj);
+            break;
+        }
+
+        default:
+        {
+            /* Page program, erase and unlock start with a Write Enable
+             * request. Further commands will be issued from the interrupt
+             * context. */
+            status = DRV_SST26_WriteEnable();
+            break;
+        }
+    }
+
+    return status;
+}
+
+/* Starts the client command saved in dObj in the given state. While a
+ * background read-ahead fill holds the bus, the command is left to the fill
+ * completion instead of waiting for it, as the client may call from its event
+ * handler, in the interrupt context that completes the fill. */
+static bool lDRV_SST26_CommandSubmit( DRV_SST26_STATE state )
+{
+    bool status = true;
+    bool isDeferred = false;
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    bool interruptState = SYS_INT_Disable();
+
+    if (dObj->isReadAheadBusy == true)
+    {
+        dObj->pendingState      = state;
+        dObj->isCommandPending  = true;
+        isDeferred              = true;
+    }
+
+    SYS_INT_Restore(interruptState);
+#endif
+
+    if (isDeferred == false)
+    {
+        dObj->state = state;
+        status = lDRV_SST26_CommandStart();
+    }
+
+    return status;
+}
+
+static bool DRV_SST26_ResetFlash(void)
+{
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    lDRV_SST26_ReadAheadFlush();
+#endif
+
+    dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
+
+    dObj->currentCommand    = (uint8_t)SST26_CMD_FLASH_RESET_ENABLE;
+
+    (void) lDRV_SST26_CommandSubmit(DRV_SST26_STATE_WAIT_RESET_FLASH_COMPLETE);
+
+    while (dObj->transferStatus == DRV_SST26_TRANSFER_BUSY)
+    {
+        /* Nothing to do */
+    }
+
+
+    dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
+
+    dObj->currentCommand    = (uint8_t)SST26_CMD_FLASH_RESET;
+
+    (void) lDRV_SST26_CommandSubmit(DRV_SST26_STATE_WAIT_RESET_FLASH_COMPLETE);
+
+    while (dObj->transferStatus == DRV_SST26_TRANSFER_BUSY)
+    {
+        /* Nothing to do */
+    }
+
+
+    return true;
+}
+
 static bool DRV_SST26_Erase( uint8_t command, uint32_t address )
 {
     bool status = false;
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    lDRV_SST26_ReadAheadFlush();
+#endif
+
     dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
 
     /* Save the request */
     dObj->currentCommand    = command;
     dObj->memoryAddr        = address;
 
-    dObj->state             = DRV_SST26_STATE_ERASE;
-
-    /* Start the transfer by submitting a Write Enable request. Further commands
-     * will be issued from the interrupt context.
-    */
-    status = DRV_SST26_WriteEnable();
+    status = lDRV_SST26_CommandSubmit(DRV_SST26_STATE_ERASE);
 
     if (status == false)
     {
@@ -405,6 +612,41 @@ void DRV_SST26_Handler( void )
             break;
         }
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+        case DRV_SST26_STATE_WAIT_READ_AHEAD_COMPLETE:
+        {
+            /* De-assert the chip select */
+            SYS_PORT_PinSet(dObj->chipSelectPin);
+
+            dObj->readAheadValid[dObj->readAheadFill] = (dObj->isReadAheadDropped == false);
+            dObj->isReadAheadDropped = false;
+            dObj->isReadAheadBusy = false;
+
+            if (dObj->isCommandPending == true)
+            {
+                /* Start the client command that waited for the bus */
+                dObj->isCommandPending = false;
+                dObj->state = dObj->pendingState;
+
+                if (lDRV_SST26_CommandStart() == false)
+                {
+                    dObj->transferStatus = DRV_SST26_TRANSFER_ERROR_UNKNOWN;
+                }
+                break;
+            }
+
+            if (dObj->isReadPending == false)
+            {
+                /* Background fill, no client transfer to report */
+                return;
+            }
+
+            (void) lDRV_SST26_ReadAheadServe();
+
+            break;
+        }
+#endif
+
         case DRV_SST26_STATE_WAIT_UNLOCK_FLASH_COMPLETE:
         case DRV_SST26_STATE_WAIT_RESET_FLASH_COMPLETE:
         case DRV_SST26_STATE_WAIT_JEDEC_ID_READ_COMPLETE:
@@ -465,13 +707,13 @@ bool DRV_SST26_UnlockFlash( const DRV_HANDLE handle )
             dObj->currentCommand    = (uint8_t)SST26_CMD_UNPROTECT_GLOBAL;
         }
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+        lDRV_SST26_ReadAheadFlush();
+#endif
+
         dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
-        dObj->state             = DRV_SST26_STATE_UNLOCK_FLASH;
 
-        /* Start the transfer by submitting a Write Enable request. Further commands
-         * will be issued from the interrupt context.
-        */
-        status = DRV_SST26_WriteEnable();
+        status = lDRV_SST26_CommandSubmit(DRV_SST26_STATE_UNLOCK_FLASH);
 
         if (status == false)
         {
@@ -490,18 +732,11 @@ bool DRV_SST26_ReadJedecId( const DRV_HANDLE handle, void* jedec_id )
         return false;
     }
 
-
     dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
 
-    dObj->state             = DRV_SST26_STATE_WAIT_JEDEC_ID_READ_COMPLETE;
+    dObj->bufferAddr        = jedec_id;
 
-    sst26Command[0]   = (uint8_t)SST26_CMD_JEDEC_ID_READ;
-
-    dObj->transferDataObj.pTransmitData = sst26Command;
-    dObj->transferDataObj.txSize = 1;
-    dObj->transferDataObj.pReceiveData = jedec_id;
-    dObj->transferDataObj.rxSize = 4;
-    (void) DRV_SST26_SPIWriteRead(dObj, &dObj->transferDataObj);
+    (void) lDRV_SST26_CommandSubmit(DRV_SST26_STATE_WAIT_JEDEC_ID_READ_COMPLETE);
 
     while (dObj->transferStatus == DRV_SST26_TRANSFER_BUSY)
     {
@@ -525,6 +760,9 @@ DRV_SST26_TRANSFER_STATUS DRV_SST26_TransferStatusGet( const DRV_HANDLE handle )
 bool DRV_SST26_Read( const DRV_HANDLE handle, void *rx_data, uint32_t rx_data_length, uint32_t address )
 {
     bool status = false;
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    bool interruptState;
+#endif
 
     if( (handle == DRV_HANDLE_INVALID) ||
         (rx_data == NULL) ||
@@ -541,9 +779,35 @@ bool DRV_SST26_Read( const DRV_HANDLE handle, void *rx_data, uint32_t rx_data_le
     dObj->bufferAddr        = rx_data;
     dObj->memoryAddr        = address;
 
-    dObj->state             = DRV_SST26_STATE_READ_DATA;
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    dObj->isReadSequential  = (address == dObj->readNextAddr);
+    dObj->readNextAddr      = address + rx_data_length;
+
+    if (rx_data_length <= DRV_SST26_READ_AHEAD_SIZE)
+    {
+        /* Serve the read now unless a fill is in progress, in which case
+         * the fill completion serves it. A read served whole from the
+         * buffers is complete on return and gives no event: the handler is
+         * only called from the SPI interrupt, so a client queuing its next
+         * read from it does not nest. */
+        interruptState = SYS_INT_Disable();
+
+        dObj->isReadPending = true;
 
-    status = DRV_SST26_WriteCommandAddress((uint8_t)SST26_CMD_HIGH_SPEED_READ, address);
+        if (dObj->isReadAheadBusy == false)
+        {
+            (void) lDRV_SST26_ReadAheadServe();
+        }
+
+        SYS_INT_Restore(interruptState);
+
+        return true;
+    }
+
+    /* Longer reads go straight to the client buffer */
+#endif
+
+    status = lDRV_SST26_CommandSubmit(DRV_SST26_STATE_READ_DATA);
 
     if ( status == false)
     {
@@ -564,6 +828,10 @@ bool DRV_SST26_PageWrite( const DRV_HANDLE handle, void *tx_data, uint32_t addre
         return status;
     }
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    lDRV_SST26_ReadAheadFlush();
+#endif
+
     dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
 
     /* save the request */
@@ -572,9 +840,7 @@ bool DRV_SST26_PageWrite( const DRV_HANDLE handle, void *tx_data, uint32_t addre
     dObj->bufferAddr        = tx_data;
     dObj->memoryAddr        = address;
 
-    dObj->state             = DRV_SST26_STATE_WRITE_CMD_ADDR;
-
-    status = DRV_SST26_WriteEnable();
+    status = lDRV_SST26_CommandSubmit(DRV_SST26_STATE_WRITE_CMD_ADDR);
 
     if (status == false)
     {
@@ -767,6 +1033,19 @@ SYS_MODULE_OBJ DRV_SST26_Initialize
 
     dObj->transferStatus = DRV_SST26_TRANSFER_COMPLETED;
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    dObj->readAheadValid[0] = false;
+    dObj->readAheadValid[1] = false;
+    dObj->readAheadLast     = 0U;
+    dObj->readAheadFill     = 0U;
+    dObj->isReadAheadBusy   = false;
+    dObj->isReadAheadDropped = false;
+    dObj->isCommandPending  = false;
+    dObj->isReadPending     = false;
+    dObj->isReadSequential  = false;
+    dObj->readNextAddr      = 0U;
+#endif
+
     dObj->status    = SYS_STATUS_READY;
 
     /* Return the driver index */
@@ -50,6 +50,30 @@
 #include <string.h>
 #include "configuration.h"
 #include "driver/sst26/drv_sst26.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Constants
+// *****************************************************************************
+// *****************************************************************************
+
+/* Read-ahead. Reads of up to DRV_SST26_READ_AHEAD_SIZE bytes are served from
+ * two buffers, each filled in a single chip select held transfer. A read that
+ * does not follow the previous one fetches only its own bytes. While a
+ * sequential stream is read, windows of DRV_SST26_READ_AHEAD_SIZE bytes are
+ * fetched and the window following the one in use is fetched in the
+ * background. */
+#ifndef DRV_SST26_READ_AHEAD_ENABLE
+#define DRV_SST26_READ_AHEAD_ENABLE         false
+#endif
+
+#ifndef DRV_SST26_READ_AHEAD_SIZE
+#define DRV_SST26_READ_AHEAD_SIZE           (2048U)
+#endif
+
+/* Command, address and dummy byte of a high speed read, clocked in ahead of
+ * the data of a read-ahead window */
+#define DRV_SST26_READ_AHEAD_HEADER_SIZE    (5U)
 // *****************************************************************************
 // *****************************************************************************
 // Section: Local Data Type Definitions
@@ -131,7 +155,8 @@ typedef enum
     DRV_SST26_STATE_UNLOCK_FLASH,
     DRV_SST26_STATE_WAIT_UNLOCK_FLASH_COMPLETE,
     DRV_SST26_STATE_WAIT_RESET_FLASH_COMPLETE,
-    DRV_SST26_STATE_WAIT_JEDEC_ID_READ_COMPLETE
+    DRV_SST26_STATE_WAIT_JEDEC_ID_READ_COMPLETE,
+    DRV_SST26_STATE_WAIT_READ_AHEAD_COMPLETE
 } DRV_SST26_STATE;
 
 typedef struct
@@ -199,6 +224,46 @@ typedef struct
 
     DRV_SST26_TRANSFER_OBJ          transferDataObj;
 
+#if (DRV_SST26_READ_AHEAD_ENABLE == true)
+    /* Flash address of the window held by each read-ahead buffer */
+    uint32_t readAheadAddr[2];
+
+    /* Number of bytes of the window held by each read-ahead buffer */
+    uint32_t readAheadSize[2];
+
+    /* The read-ahead buffer holds the data of its window */
+    bool readAheadValid[2];
+
+    /* Read-ahead buffer used last, the other one is filled next */
+    uint32_t readAheadLast;
+
+    /* Read-ahead buffer being filled */
+    uint32_t readAheadFill;
+
+    /* A read-ahead buffer is being filled */
+    volatile bool isReadAheadBusy;
+
+    /* The flash content changed while a buffer was being filled, the fill is
+     * discarded when it completes */
+    volatile bool isReadAheadDropped;
+
+    /* A client command waits for the fill to release the bus. The fill
+     * completion starts it in pendingState. */
+    volatile bool isCommandPending;
+
+    /* State the pending client command starts in */
+    DRV_SST26_STATE pendingState;
+
+    /* A client read is served from the read-ahead buffers */
+    volatile bool isReadPending;
+
+    /* The client read in progress starts where the previous one ended */
+    bool isReadSequential;
+
+    /* Flash address following the previous client read */
+    uint32_t readNextAddr;
+#endif
+
 } DRV_SST26_OBJECT;
 
 
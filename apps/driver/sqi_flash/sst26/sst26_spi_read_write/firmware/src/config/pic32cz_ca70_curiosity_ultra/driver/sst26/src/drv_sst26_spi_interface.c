@@ -78,7 +78,8 @@ bool DRV_SST26_SPIWriteRead(
 
     SYS_PORT_PinClear(dObj->chipSelectPin);
 
-    dObj->transferStatus    = DRV_SST26_TRANSFER_BUSY;
+    /* The caller owns transferStatus, a background read-ahead fill leaves
+     * the status of the client transfer untouched. */
     (void) dObj->sst26Plib->writeRead (transferObj->pTransmitData, transferObj->txSize, transferObj->pReceiveData, transferObj->rxSize);
     return isSuccess;
 }
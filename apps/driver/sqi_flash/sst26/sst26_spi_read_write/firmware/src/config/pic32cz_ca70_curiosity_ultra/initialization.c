@@ -143,6 +143,9 @@ void SYS_Initialize ( void* data )
     CLOCK_Initialize();
 	PIO_Initialize();
 
+    /* Skip cache maintenance for the non-cacheable MPU regions */
+    SYS_CACHE_NonCacheableRegionsLoad();
+
 
 
     QSPI_Initialize();
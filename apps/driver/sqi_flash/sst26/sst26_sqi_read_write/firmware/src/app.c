@@ -80,6 +80,7 @@ APP_DATA CACHE_ALIGN appData;
 
 static uint32_t erase_index = 0;
 static uint32_t write_index = 0;
+static bool is_rewritten = false;
 
 // *****************************************************************************
 // *****************************************************************************
@@ -285,7 +286,11 @@ void APP_Tasks ( void )
         {
             if (!memcmp(appData.writeBuffer, appData.readBuffer, BUFFER_SIZE))
             {
+#if (DRV_SST26_XIP_ENABLE == true)
+                appData.state = APP_STATE_XIP_VERIFY_DATA;
+#else
                 appData.state = APP_STATE_SUCCESS;
+#endif
             }
             else
             {
@@ -295,6 +300,44 @@ void APP_Tasks ( void )
             break;
         }
 
+#if (DRV_SST26_XIP_ENABLE == true)
+        case APP_STATE_XIP_VERIFY_DATA:
+        {
+            uint32_t i = 0;
+
+            if (DRV_SST26_XipLock(appData.handle) != true)
+            {
+                /* The flash cannot be mapped yet, try again */
+                break;
+            }
+
+            if (memcmp(appData.writeBuffer, DRV_SST26_XipAddressGet(appData.handle, MEM_ADDRESS), BUFFER_SIZE))
+            {
+                appData.state = APP_STATE_ERROR;
+            }
+            else if (is_rewritten == false)
+            {
+                /* Program the same sectors again, read back through a cache
+                 * holding the first pattern */
+                for (i = 0; i < BUFFER_SIZE; i++)
+                    appData.writeBuffer[i] = (uint8_t)~i;
+
+                is_rewritten = true;
+                erase_index = 0;
+                write_index = 0;
+                appData.state = APP_STATE_ERASE_FLASH;
+            }
+            else
+            {
+                appData.state = APP_STATE_SUCCESS;
+            }
+
+            DRV_SST26_XipUnlock(appData.handle);
+
+            break;
+        }
+#endif
+
         case APP_STATE_SUCCESS:
         {
             DRV_SST26_Close(appData.handle);
@@ -117,6 +117,11 @@ typedef enum
     /* Verify Data Read */
     APP_STATE_VERIFY_DATA,
 
+    /* Verify the data in the execute-in-place window, then program the
+     * sectors again with another pattern. The window is cached by then, so
+     * the second pass checks that reads do not return the old contents. */
+    APP_STATE_XIP_VERIFY_DATA,
+
     /* The app idles */
     APP_STATE_SUCCESS,
 
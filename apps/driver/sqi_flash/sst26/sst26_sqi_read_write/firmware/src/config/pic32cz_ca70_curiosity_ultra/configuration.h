@@ -92,6 +92,8 @@ extern "C" {
 #define DRV_SST26_START_ADDRESS         (0x0U)
 #define DRV_SST26_PAGE_SIZE             (256U)
 #define DRV_SST26_ERASE_BUFFER_SIZE     (4096U)
+#define DRV_SST26_XIP_ENABLE            true
+#define DRV_SST26_XIP_MPU_REGION        (15U)
 
 
 
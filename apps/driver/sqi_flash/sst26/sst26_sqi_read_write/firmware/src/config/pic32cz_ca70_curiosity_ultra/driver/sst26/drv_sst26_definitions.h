@@ -94,6 +94,12 @@ typedef bool (*DRV_SST26_PLIB_MEM_READ)( qspi_memory_xfer_t *qspi_memory_xfer, u
 /* Pointer to write to the specified address of the flash device. */
 typedef bool (*DRV_SST26_PLIB_MEM_WRITE)( qspi_memory_xfer_t *qspi_memory_xfer, uint32_t *tx_data, uint32_t tx_data_length, uint32_t address );
 
+/* Pointer to map the flash device in the QSPI memory window. */
+typedef bool (*DRV_SST26_PLIB_MEM_MAP_ENTER)( qspi_memory_xfer_t *qspi_memory_xfer );
+
+/* Pointer to unmap the flash device from the QSPI memory window. */
+typedef bool (*DRV_SST26_PLIB_MEM_MAP_EXIT)( qspi_memory_xfer_t *qspi_memory_xfer );
+
 typedef struct 
 {
     /* Pointer to write command to QSPI slave device. */
@@ -111,6 +117,14 @@ typedef struct
     /* Pointer to write to the specified address of the flash device. */
     DRV_SST26_PLIB_MEM_WRITE MemoryWrite;
 
+    /* Pointer to map the flash device in the QSPI memory window, used when
+     * DRV_SST26_XIP_ENABLE is true. */
+    DRV_SST26_PLIB_MEM_MAP_ENTER MemoryMapEnter;
+
+    /* Pointer to unmap the flash device from the QSPI memory window, used
+     * when DRV_SST26_XIP_ENABLE is true. */
+    DRV_SST26_PLIB_MEM_MAP_EXIT MemoryMapExit;
+
 } DRV_SST26_PLIB_INTERFACE;
 
 /* SST26 Driver Initialization Data Declaration */
@@ -77,7 +77,9 @@ static const DRV_SST26_PLIB_INTERFACE drvSST26PlibAPI = {
     .RegisterRead   = QSPI_RegisterRead,
     .RegisterWrite  = QSPI_RegisterWrite,
     .MemoryRead     = QSPI_MemoryRead,
-    .MemoryWrite    = QSPI_MemoryWrite
+    .MemoryWrite    = QSPI_MemoryWrite,
+    .MemoryMapEnter = QSPI_MemoryMapEnter,
+    .MemoryMapExit  = QSPI_MemoryMapExit
 };
 
 static const DRV_SST26_INIT drvSST26InitData =
@@ -142,6 +144,9 @@ void SYS_Initialize ( void* data )
     CLOCK_Initialize();
 	PIO_Initialize();
 
+    /* Skip cache maintenance for the non-cacheable MPU regions */
+    SYS_CACHE_NonCacheableRegionsLoad();
+
 
 
     QSPI_Initialize();
@@ -314,32 +314,64 @@ static DRV_USART_BUFFER_OBJ* lDRV_USART_GetTransferObj(
     }
 }
 
+static void lDRV_USART_FreeTransferObjListInit(DRV_USART_OBJ* dObj)
+{
+    uint32_t index;
+
+    /* Chain all the buffer objects of the pool into the free list */
+    dObj->freeObjList = NULL;
+
+    for (index = dObj->bufferObjPoolSize; index > 0U; index--)
+    {
+        dObj->bufferObjPool[index - 1U].inUse = false;
+        dObj->bufferObjPool[index - 1U].next = dObj->freeObjList;
+        dObj->freeObjList = &dObj->bufferObjPool[index - 1U];
+    }
+}
+
+static void lDRV_USART_FreeTransferObjPut(
+    DRV_USART_OBJ* dObj,
+    DRV_USART_BUFFER_OBJ* bufferObj
+)
+{
+    bufferObj->currentState = DRV_USART_BUFFER_IS_FREE;
+    bufferObj->inUse = false;
+
+    /* Return the buffer object to the head of the free list */
+    bufferObj->next = dObj->freeObjList;
+    dObj->freeObjList = bufferObj;
+}
+
 static DRV_USART_BUFFER_OBJ* lDRV_USART_FreeTransferObjGet(DRV_USART_CLIENT_OBJ* clientObj)
 {
     uint32_t index;
     DRV_USART_OBJ* dObj = (DRV_USART_OBJ* )&gDrvUSARTObj[clientObj->drvIndex];
-    DRV_USART_BUFFER_OBJ* pBufferObj = dObj->bufferObjPool;
+    DRV_USART_BUFFER_OBJ* pBufferObj = dObj->freeObjList;
 
-    for (index = 0; index < dObj->bufferObjPoolSize; index++)
+    if (pBufferObj == NULL)
     {
-        if (pBufferObj[index].inUse == false)
-        {
-            pBufferObj[index].inUse = true;
-            pBufferObj[index].next = NULL;
+        /* All the buffer objects are in use */
+        return NULL;
+    }
 
-            /* Generate a unique buffer handle consisting of an incrementing
-             * token counter, driver index and the buffer index.
-             */
-            pBufferObj[index].bufferHandle = (DRV_USART_BUFFER_HANDLE)lDRV_USART_MAKE_HANDLE(
-                dObj->usartTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+    /* Take the buffer object at the head of the free list */
+    dObj->freeObjList = pBufferObj->next;
 
-            /* Update the token for next time */
-            dObj->usartTokenCount = lDRV_USART_UPDATE_TOKEN(dObj->usartTokenCount);
+    pBufferObj->inUse = true;
+    pBufferObj->next = NULL;
 
-            return &pBufferObj[index];
-        }
-    }
-    return NULL;
+    index = (uint32_t)(pBufferObj - dObj->bufferObjPool);
+
+    /* Generate a unique buffer handle consisting of an incrementing
+     * token counter, driver index and the buffer index.
+     */
+    pBufferObj->bufferHandle = (DRV_USART_BUFFER_HANDLE)lDRV_USART_MAKE_HANDLE(
+        dObj->usartTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+
+    /* Update the token for next time */
+    dObj->usartTokenCount = lDRV_USART_UPDATE_TOKEN(dObj->usartTokenCount);
+
+    return pBufferObj;
 }
 
 static bool lDRV_USART_TransferObjAddToList(
@@ -349,17 +381,22 @@ static bool lDRV_USART_TransferObjAddToList(
 )
 {
     DRV_USART_BUFFER_OBJ** pBufferObjList;
+    DRV_USART_BUFFER_OBJ** pBufferObjListTail;
     bool isFirstBufferInList = false;
 
     if (dir == DRV_USART_DIRECTION_TX)
     {
         pBufferObjList = (DRV_USART_BUFFER_OBJ**)&(dObj->transmitObjList);
+        pBufferObjListTail = (DRV_USART_BUFFER_OBJ**)&(dObj->transmitObjListTail);
     }
     else
     {
         pBufferObjList = (DRV_USART_BUFFER_OBJ**)&(dObj->receiveObjList);
+        pBufferObjListTail = (DRV_USART_BUFFER_OBJ**)&(dObj->receiveObjListTail);
     }
 
+    bufferObj->next = NULL;
+
     // Is the buffer object list empty?
     if (*pBufferObjList == NULL)
     {
@@ -368,21 +405,12 @@ static bool lDRV_USART_TransferObjAddToList(
     }
     else
     {
-        // List is not empty. Iterate to the end of the buffer object list
-        while (*pBufferObjList != NULL)
-        {
-            if ((*pBufferObjList)->next == NULL)
-            {
-                (*pBufferObjList)->next = bufferObj;
-                break;
-            }
-            else
-            {
-                pBufferObjList = (DRV_USART_BUFFER_OBJ**)&((*pBufferObjList)->next);
-            }
-        }
+        // List is not empty. Append after the last buffer object
+        (*pBufferObjListTail)->next = bufferObj;
     }
 
+    *pBufferObjListTail = bufferObj;
+
     return isFirstBufferInList;
 }
 
@@ -411,27 +439,35 @@ static void lDRV_USART_RemoveTransferObjFromList(
 )
 {
     DRV_USART_BUFFER_OBJ** pBufferObjList;
+    DRV_USART_BUFFER_OBJ** pBufferObjListTail;
 
     if (dir == DRV_USART_DIRECTION_TX)
     {
         pBufferObjList = (DRV_USART_BUFFER_OBJ**)&(dObj->transmitObjList);
+        pBufferObjListTail = (DRV_USART_BUFFER_OBJ**)&(dObj->transmitObjListTail);
     }
     else
     {
         pBufferObjList = (DRV_USART_BUFFER_OBJ**)&(dObj->receiveObjList);
+        pBufferObjListTail = (DRV_USART_BUFFER_OBJ**)&(dObj->receiveObjListTail);
     }
 
     // Remove the element at the head of the linked list
     if (*pBufferObjList != NULL)
     {
         /* Save the buffer object to be removed. Set the next buffer object as
-         * the new head of the linked list. Reset the removed buffer object. */
+         * the new head of the linked list. Return the removed buffer object
+         * to the free list. */
 
         DRV_USART_BUFFER_OBJ* temp = *pBufferObjList;
         *pBufferObjList = (*pBufferObjList)->next;
-        temp->currentState = DRV_USART_BUFFER_IS_FREE;
-        temp->next = NULL;
-        temp->inUse = false;
+
+        if (*pBufferObjList == NULL)
+        {
+            *pBufferObjListTail = NULL;
+        }
+
+        lDRV_USART_FreeTransferObjPut(dObj, temp);
     }
 }
 
@@ -442,15 +478,19 @@ static void lDRV_USART_RemoveClientTransfersFromList(
 )
 {
     DRV_USART_BUFFER_OBJ** pBufferObjList;
+    DRV_USART_BUFFER_OBJ** pBufferObjListTail;
     DRV_USART_BUFFER_OBJ* delBufferObj = NULL;
+    DRV_USART_BUFFER_OBJ* prevBufferObj = NULL;
 
     if (dir == DRV_USART_DIRECTION_TX)
     {
         pBufferObjList = (DRV_USART_BUFFER_OBJ**)&(dObj->transmitObjList);
+        pBufferObjListTail = (DRV_USART_BUFFER_OBJ**)&(dObj->transmitObjListTail);
     }
     else
     {
         pBufferObjList = (DRV_USART_BUFFER_OBJ**)&(dObj->receiveObjList);
+        pBufferObjListTail = (DRV_USART_BUFFER_OBJ**)&(dObj->receiveObjListTail);
     }
 
     while (*pBufferObjList != NULL)
@@ -463,15 +503,19 @@ static void lDRV_USART_RemoveClientTransfersFromList(
             delBufferObj = *pBufferObjList;
             // Update the current node to point to the deleted node's next node
             *pBufferObjList = (DRV_USART_BUFFER_OBJ*)(*pBufferObjList)->next;
-            // Reset the deleted node
-            delBufferObj->next = NULL;
-            delBufferObj->currentState = DRV_USART_BUFFER_IS_FREE;
+            // The last node was deleted, the previous node is the new tail
+            if (*pBufferObjListTail == delBufferObj)
+            {
+                *pBufferObjListTail = prevBufferObj;
+            }
+            // Return the deleted node to the free list
             delBufferObj->status = DRV_USART_BUFFER_EVENT_COMPLETE;
-            delBufferObj->inUse = false;
+            lDRV_USART_FreeTransferObjPut(dObj, delBufferObj);
         }
         else
         {
             // Move to the next node
+            prevBufferObj = *pBufferObjList;
             pBufferObjList = (DRV_USART_BUFFER_OBJ**)&((*pBufferObjList)->next);
         }
     }
@@ -661,6 +705,46 @@ static void lDRV_USART_BufferQueueTask(
     }
 }
 
+static void* lDRV_USART_ReadContinuousSwitch( DRV_USART_OBJ* dObj )
+{
+    DRV_USART_READ_CONTINUOUS_OBJ* rxObj = &dObj->readContinuous;
+    void* buffer = rxObj->buffer[rxObj->activeIndex];
+
+    /* Hand the other buffer to the PLIB before the client gets the filled one,
+     * so that the receiver is never left without a buffer */
+    rxObj->activeIndex = (rxObj->activeIndex == 0U) ? 1U : 0U;
+    rxObj->idleCount = 0;
+
+    (void) dObj->usartPlib->read_t(rxObj->buffer[rxObj->activeIndex], rxObj->size);
+
+    return buffer;
+}
+
+static void lDRV_USART_ReadContinuousTask( DRV_USART_OBJ* dObj, uint32_t errorMask )
+{
+    DRV_USART_READ_CONTINUOUS_OBJ* rxObj = &dObj->readContinuous;
+    DRV_USART_READ_CONTINUOUS_EVENT event = DRV_USART_READ_CONTINUOUS_EVENT_BUFFER_FULL;
+    size_t nBytes = rxObj->size;
+    void* buffer;
+
+    if (errorMask != (uint32_t) DRV_USART_ERROR_NONE)
+    {
+        event = DRV_USART_READ_CONTINUOUS_EVENT_ERROR;
+        nBytes = dObj->usartPlib->readCountGet();
+    }
+
+    buffer = lDRV_USART_ReadContinuousSwitch(dObj);
+
+    if (rxObj->eventHandler != NULL)
+    {
+        dObj->interruptNestingCount++;
+
+        rxObj->eventHandler(event, buffer, nBytes, rxObj->context);
+
+        dObj->interruptNestingCount--;
+    }
+}
+
 static void lDRV_USART_TX_PLIB_CallbackHandler( uintptr_t context )
 {
     DRV_USART_OBJ* dObj = (DRV_USART_OBJ* )context;
@@ -678,7 +762,11 @@ static void lDRV_USART_RX_PLIB_CallbackHandler( uintptr_t context )
 
     errorMask = dObj->usartPlib->errorGet();
 
-    if(errorMask == (uint32_t) DRV_USART_ERROR_NONE)
+    if (dObj->readContinuous.clientHandle != DRV_HANDLE_INVALID)
+    {
+        lDRV_USART_ReadContinuousTask(dObj, errorMask);
+    }
+    else if(errorMask == (uint32_t) DRV_USART_ERROR_NONE)
     {
         lDRV_USART_BufferQueueTask(dObj, DRV_USART_DIRECTION_RX, DRV_USART_BUFFER_EVENT_COMPLETE, errorMask);
     }
@@ -742,15 +830,20 @@ SYS_MODULE_OBJ DRV_USART_Initialize(
     dObj->bufferObjPoolSize     = usartInit->bufferObjPoolSize;
     dObj->bufferObjPool         = (DRV_USART_BUFFER_OBJ*)usartInit->bufferObjPool;
     dObj->transmitObjList       = (DRV_USART_BUFFER_OBJ*)NULL;
+    dObj->transmitObjListTail   = (DRV_USART_BUFFER_OBJ*)NULL;
     dObj->receiveObjList        = (DRV_USART_BUFFER_OBJ*)NULL;
+    dObj->receiveObjListTail    = (DRV_USART_BUFFER_OBJ*)NULL;
     dObj->interruptNestingCount = 0;
     dObj->interruptSources      = usartInit->interruptSources;
+    dObj->readContinuous.clientHandle = DRV_HANDLE_INVALID;
     dObj->remapDataWidth        = usartInit->remapDataWidth;
     dObj->remapParity           = usartInit->remapParity;
     dObj->remapStopBits         = usartInit->remapStopBits;
     dObj->remapError            = usartInit->remapError;
     dObj->dataWidth             = usartInit->dataWidth;
 
+    lDRV_USART_FreeTransferObjListInit(dObj);
+
     /* Register a callback with either DMA or USART PLIB based on configuration.
      * dObj is used as a context parameter, that will be used to distinguish the
      * events for different driver instances. */
@@ -900,6 +993,13 @@ void DRV_USART_Close( DRV_HANDLE handle )
     lDRV_USART_RemoveClientTransfersFromList(dObj, clientObj, DRV_USART_DIRECTION_TX);
     lDRV_USART_RemoveClientTransfersFromList(dObj, clientObj, DRV_USART_DIRECTION_RX);
 
+    if (dObj->readContinuous.clientHandle == clientObj->clientHandle)
+    {
+        (void) dObj->usartPlib->readAbort();
+
+        dObj->readContinuous.clientHandle = DRV_HANDLE_INVALID;
+    }
+
     lDRV_USART_ResourceUnlock(dObj);
 
     /* Reduce the number of clients */
@@ -1078,6 +1178,13 @@ static void lDRV_USART_BufferAdd(
         return;
     }
 
+    /* Reads are not queued while the receiver is in continuous read mode */
+    if ((dir == DRV_USART_DIRECTION_RX) && (dObj->readContinuous.clientHandle != DRV_HANDLE_INVALID))
+    {
+        lDRV_USART_ResourceUnlock(dObj);
+        return;
+    }
+
     // Get a free buffer object
     bufferObj = lDRV_USART_FreeTransferObjGet(clientObj);
 
@@ -1270,4 +1377,155 @@ bool DRV_USART_ReadAbort(const DRV_HANDLE handle)
     lDRV_USART_ResourceUnlock(dObj);
 
     return true;
-}
\ No newline at end of file
+}
+
+bool DRV_USART_ReadContinuousStart(
+    const DRV_HANDLE handle,
+    void* buffer0,
+    void* buffer1,
+    const size_t size,
+    const DRV_USART_READ_CONTINUOUS_EVENT_HANDLER eventHandler,
+    const uintptr_t context
+)
+{
+    DRV_USART_OBJ* dObj = NULL;
+    DRV_USART_CLIENT_OBJ* clientObj = NULL;
+    DRV_USART_READ_CONTINUOUS_OBJ* rxObj = NULL;
+    bool isSuccess = false;
+
+    if ((buffer0 == NULL) || (buffer1 == NULL) || (size == 0U))
+    {
+        return false;
+    }
+
+    /* Validate the driver handle */
+    clientObj = lDRV_USART_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = (DRV_USART_OBJ* )&gDrvUSARTObj[clientObj->drvIndex];
+    rxObj = &dObj->readContinuous;
+
+    if (lDRV_USART_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
+    /* The receiver must not be in use by a continuous read or by queued reads */
+    if ((rxObj->clientHandle == DRV_HANDLE_INVALID) && (dObj->receiveObjList == NULL))
+    {
+        rxObj->buffer[0]    = buffer0;
+        rxObj->buffer[1]    = buffer1;
+        rxObj->size         = size;
+        rxObj->activeIndex  = 0;
+        rxObj->idleCount    = 0;
+        rxObj->eventHandler = eventHandler;
+        rxObj->context      = context;
+        rxObj->clientHandle = handle;
+
+        isSuccess = dObj->usartPlib->read_t(buffer0, size);
+
+        if (isSuccess == false)
+        {
+            rxObj->clientHandle = DRV_HANDLE_INVALID;
+        }
+    }
+
+    lDRV_USART_ResourceUnlock(dObj);
+
+    return isSuccess;
+}
+
+bool DRV_USART_ReadContinuousStop(const DRV_HANDLE handle)
+{
+    DRV_USART_OBJ* dObj = NULL;
+    DRV_USART_CLIENT_OBJ* clientObj = NULL;
+    bool isSuccess = false;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_USART_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = (DRV_USART_OBJ* )&gDrvUSARTObj[clientObj->drvIndex];
+
+    if (lDRV_USART_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
+    if (dObj->readContinuous.clientHandle == handle)
+    {
+        (void) dObj->usartPlib->readAbort();
+
+        dObj->readContinuous.clientHandle = DRV_HANDLE_INVALID;
+
+        isSuccess = true;
+    }
+
+    lDRV_USART_ResourceUnlock(dObj);
+
+    return isSuccess;
+}
+
+void DRV_USART_ReadContinuousIdleCheck(const DRV_HANDLE handle)
+{
+    DRV_USART_OBJ* dObj = NULL;
+    DRV_USART_CLIENT_OBJ* clientObj = NULL;
+    DRV_USART_READ_CONTINUOUS_OBJ* rxObj = NULL;
+    DRV_USART_READ_CONTINUOUS_EVENT_HANDLER eventHandler = NULL;
+    uintptr_t context = 0U;
+    void* buffer = NULL;
+    size_t nBytes = 0U;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_USART_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return;
+    }
+
+    dObj = (DRV_USART_OBJ* )&gDrvUSARTObj[clientObj->drvIndex];
+    rxObj = &dObj->readContinuous;
+
+    if (lDRV_USART_ResourceLock(dObj) == false)
+    {
+        return;
+    }
+
+    if (rxObj->clientHandle == handle)
+    {
+        nBytes = dObj->usartPlib->readCountGet();
+
+        if ((nBytes != 0U) && (nBytes == rxObj->idleCount))
+        {
+            /* No byte received since the last check. The receive interrupt is
+             * disabled here, so a byte arriving now stays in the receive holding
+             * register and is read into the next buffer. */
+            (void) dObj->usartPlib->readAbort();
+
+            buffer = lDRV_USART_ReadContinuousSwitch(dObj);
+            eventHandler = rxObj->eventHandler;
+            context = rxObj->context;
+        }
+        else
+        {
+            rxObj->idleCount = nBytes;
+        }
+    }
+
+    lDRV_USART_ResourceUnlock(dObj);
+
+    /* Give the callback outside of the lock, the handler may call driver APIs */
+    if ((buffer != NULL) && (eventHandler != NULL))
+    {
+        eventHandler(DRV_USART_READ_CONTINUOUS_EVENT_LINE_IDLE, buffer, nBytes, context);
+    }
+}
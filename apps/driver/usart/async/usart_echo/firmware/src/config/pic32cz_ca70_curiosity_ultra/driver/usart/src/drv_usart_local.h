@@ -166,7 +166,7 @@ typedef struct DRV_USART_BUFFER_OBJ_T
     /* Number of bytes completed */
     volatile size_t                 nCount;
 
-    /* Next buffer pointer */
+    /* Next buffer pointer in the free list or in the transfer list */
     struct DRV_USART_BUFFER_OBJ_T*   next;
 
     /* Current state of the buffer */
@@ -182,6 +182,46 @@ typedef struct DRV_USART_BUFFER_OBJ_T
 
 } DRV_USART_BUFFER_OBJ;
 
+// *****************************************************************************
+/* USART Driver Continuous Read Object
+
+  Summary:
+    Object used to keep track of the continuous (ping-pong) receive.
+
+  Description:
+    The two application buffers are handed to the PLIB alternately. The buffer
+    that is not with the PLIB belongs to the client until it is re-armed on
+    the next buffer switch.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Handle of the client that owns the continuous read. DRV_HANDLE_INVALID
+     * when continuous read is not active */
+    DRV_HANDLE                                  clientHandle;
+
+    /* Ping-pong pair of application receive buffers */
+    void*                                       buffer[2];
+
+    /* Size of each of the receive buffers */
+    size_t                                      size;
+
+    /* Index of the buffer that is currently with the PLIB */
+    uint8_t                                     activeIndex;
+
+    /* Received byte count seen by the previous idle check */
+    size_t                                      idleCount;
+
+    /* Event handler and context of the owning client */
+    DRV_USART_READ_CONTINUOUS_EVENT_HANDLER     eventHandler;
+
+    uintptr_t                                   context;
+
+} DRV_USART_READ_CONTINUOUS_OBJ;
+
 // *****************************************************************************
 /* USART Driver Instance Object
 
@@ -227,12 +267,24 @@ typedef struct
     /* Pointer to the transmit and receive buffer pool */
     DRV_USART_BUFFER_OBJ*                   bufferObjPool;
 
+    /* Linked list of free buffer objects in the buffer pool */
+    DRV_USART_BUFFER_OBJ*                   freeObjList;
+
     /* Linked list of transmit buffer objects */
     DRV_USART_BUFFER_OBJ*                   transmitObjList;
 
+    /* Last buffer object in the transmit list */
+    DRV_USART_BUFFER_OBJ*                   transmitObjListTail;
+
     /* Linked list of receive buffer objects */
     DRV_USART_BUFFER_OBJ*                   receiveObjList;
 
+    /* Last buffer object in the receive list */
+    DRV_USART_BUFFER_OBJ*                   receiveObjListTail;
+
+    /* Continuous (ping-pong) receive state */
+    DRV_USART_READ_CONTINUOUS_OBJ           readContinuous;
+
     /* To identify if we are running from interrupt context or not */
     uint8_t                                 interruptNestingCount;
 
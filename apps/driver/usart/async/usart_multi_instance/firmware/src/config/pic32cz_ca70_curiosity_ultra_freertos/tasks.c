@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP1_Tasks. */
 TaskHandle_t xAPP1_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP1_Tasks task. */
+static StackType_t lAPP1_TasksStack[1024];
+static StaticTask_t lAPP1_TasksTCB;
+#endif
+
 static void lAPP1_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -80,6 +90,12 @@ TaskHandle_t xAPP2_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP2_Tasks task. */
+static StackType_t lAPP2_TasksStack[1024];
+static StaticTask_t lAPP2_TasksTCB;
+#endif
+
 static void lAPP2_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -119,6 +135,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP1_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP1_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP1_Tasks,
+           "APP1_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP1_TasksStack,
+           &lAPP1_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP1_Tasks,
            "APP1_Tasks",
@@ -126,8 +152,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP1_Tasks);
+#endif
 
     /* Create OS Thread for APP2_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP2_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP2_Tasks,
+           "APP2_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP2_TasksStack,
+           &lAPP2_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP2_Tasks,
            "APP2_Tasks",
@@ -135,8 +172,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP2_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
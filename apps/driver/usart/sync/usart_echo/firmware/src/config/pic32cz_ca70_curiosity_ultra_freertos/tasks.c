@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP_USART_ECHO_Tasks. */
 TaskHandle_t xAPP_USART_ECHO_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_USART_ECHO_Tasks task. */
+static StackType_t lAPP_USART_ECHO_TasksStack[1024];
+static StaticTask_t lAPP_USART_ECHO_TasksTCB;
+#endif
+
 static void lAPP_USART_ECHO_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -104,6 +114,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_USART_ECHO_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_USART_ECHO_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_USART_ECHO_Tasks,
+           "APP_USART_ECHO_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_USART_ECHO_TasksStack,
+           &lAPP_USART_ECHO_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_USART_ECHO_Tasks,
            "APP_USART_ECHO_Tasks",
@@ -111,8 +131,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_USART_ECHO_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -260,6 +260,72 @@ typedef struct DRV_USART_INIT_T DRV_USART_INIT;
 
 typedef void (*DRV_USART_BUFFER_EVENT_HANDLER )( DRV_USART_BUFFER_EVENT event, DRV_USART_BUFFER_HANDLE bufferHandle, uintptr_t context );
 
+// *****************************************************************************
+/* USART Driver Continuous Read Events
+
+   Summary
+    Identifies the events raised by the continuous read mode.
+
+   Description
+    This enumeration identifies the events that the driver passes to the
+    continuous read event handler registered with the
+    DRV_USART_ReadContinuousStart function.
+
+   Remarks:
+    Each event hands one of the two ping-pong buffers back to the client. The
+    driver has already switched reception to the other buffer when the event
+    is raised.
+*/
+
+typedef enum
+{
+    /* The buffer is full. This is the half point of the ping-pong pair. */
+    DRV_USART_READ_CONTINUOUS_EVENT_BUFFER_FULL = 0,
+
+    /* The line went idle with a partially filled buffer. */
+    DRV_USART_READ_CONTINUOUS_EVENT_LINE_IDLE = 1,
+
+    /* A receive error occurred. The buffer holds the bytes received before
+     * the error. */
+    DRV_USART_READ_CONTINUOUS_EVENT_ERROR = -1
+
+} DRV_USART_READ_CONTINUOUS_EVENT;
+
+// *****************************************************************************
+/* USART Driver Continuous Read Event Handler Function Pointer
+
+   Summary
+    Pointer to a USART Driver continuous read event handler function
+
+   Description
+    This data type defines the required function signature for the continuous
+    read event handling callback function.
+
+  Parameters:
+    event - Identifies the type of event
+
+    buffer - The ping-pong buffer that is handed back to the client
+
+    nBytes - Number of bytes received in the buffer
+
+    context - Value identifying the context of the application that
+    started the continuous read.
+
+  Returns:
+    None.
+
+  Remarks:
+    The buffer belongs to the client until the driver switches back to it,
+    which happens when the other buffer is filled or the line goes idle.
+    The client must consume or copy the data before that.
+
+    The BUFFER_FULL and ERROR events are raised in the peripheral's interrupt
+    context. The LINE_IDLE event is raised in the context that called
+    DRV_USART_ReadContinuousIdleCheck.
+*/
+
+typedef void (*DRV_USART_READ_CONTINUOUS_EVENT_HANDLER )( DRV_USART_READ_CONTINUOUS_EVENT event, void* buffer, size_t nBytes, uintptr_t context );
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: USART Driver System Interface Routines
@@ -1188,6 +1254,162 @@ bool DRV_USART_ReadQueuePurge( const DRV_HANDLE handle );
 */
 bool DRV_USART_ReadAbort(const DRV_HANDLE handle);
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: USART Driver Continuous Read Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool DRV_USART_ReadContinuousStart
+    (
+        const DRV_HANDLE handle,
+        void* buffer0,
+        void* buffer1,
+        const size_t size,
+        const DRV_USART_READ_CONTINUOUS_EVENT_HANDLER eventHandler,
+        const uintptr_t context
+    )
+
+  Summary:
+    Starts continuous reception into a ping-pong pair of buffers.
+
+  Description:
+    This function starts receiving into buffer0. When a buffer is full the
+    driver hands the other buffer to the PLIB from within the receive
+    interrupt and only then raises the event for the filled buffer. The
+    receiver is therefore never left without a buffer and the client does
+    not need to re-queue a buffer after every event.
+
+  Precondition:
+    DRV_USART_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - Handle of the communication channel as returned by the
+    DRV_USART_Open function.
+
+    buffer0 - First receive buffer
+
+    buffer1 - Second receive buffer
+
+    size - Size of each buffer. It must be the same for both buffers.
+
+    eventHandler - Continuous read event handler
+
+    context - Value passed back to the event handler
+
+  Returns:
+    true - Continuous read was started.
+
+    false - The arguments are invalid, a continuous read is already active
+    on this instance or read requests are queued.
+
+  Example:
+    <code>
+    static uint8_t rxPing[64];
+    static uint8_t rxPong[64];
+
+    void APP_USARTReadEventHandler(DRV_USART_READ_CONTINUOUS_EVENT event,
+        void* buffer, size_t nBytes, uintptr_t context)
+    {
+        if (event != DRV_USART_READ_CONTINUOUS_EVENT_ERROR)
+        {
+            APP_ProcessData(buffer, nBytes);
+        }
+    }
+
+    DRV_USART_ReadContinuousStart(myUSARTHandle, rxPing, rxPong, sizeof(rxPing),
+        APP_USARTReadEventHandler, (uintptr_t)0);
+    </code>
+
+  Remarks:
+    While continuous read is active DRV_USART_ReadBufferAdd fails for all
+    clients of the instance. Write requests are not affected.
+*/
+
+bool DRV_USART_ReadContinuousStart(
+    const DRV_HANDLE handle,
+    void* buffer0,
+    void* buffer1,
+    const size_t size,
+    const DRV_USART_READ_CONTINUOUS_EVENT_HANDLER eventHandler,
+    const uintptr_t context
+);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_USART_ReadContinuousStop(const DRV_HANDLE handle)
+
+  Summary:
+    Stops the continuous read.
+
+  Description:
+    This function aborts the on-going read and releases both buffers. No
+    event is raised for the bytes that are in the active buffer.
+
+  Precondition:
+    DRV_USART_ReadContinuousStart must have been called by this client.
+
+  Parameters:
+    handle - Handle of the communication channel as returned by the
+    DRV_USART_Open function.
+
+  Returns:
+    true - Continuous read was stopped.
+
+    false - The handle is invalid or does not own the continuous read.
+
+  Example:
+    <code>
+    DRV_USART_ReadContinuousStop(myUSARTHandle);
+    </code>
+
+  Remarks:
+    This function is thread safe in a RTOS application.
+    Avoid this function call from within the callback.
+*/
+
+bool DRV_USART_ReadContinuousStop(const DRV_HANDLE handle);
+
+// *****************************************************************************
+/* Function:
+    void DRV_USART_ReadContinuousIdleCheck(const DRV_HANDLE handle)
+
+  Summary:
+    Checks the receive line for idle during a continuous read.
+
+  Description:
+    The PLIBs used by the driver do not report a receiver timeout, so line idle
+    is detected by calling this function periodically. If bytes are pending
+    in the active buffer and no new byte was received since the previous call,
+    the driver switches to the other buffer and raises the LINE_IDLE event
+    with the partially filled buffer.
+
+  Precondition:
+    DRV_USART_ReadContinuousStart must have been called by this client.
+
+  Parameters:
+    handle - Handle of the communication channel as returned by the
+    DRV_USART_Open function.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    // Called every 2 ms from the application task
+    DRV_USART_ReadContinuousIdleCheck(myUSARTHandle);
+    </code>
+
+  Remarks:
+    The interval between calls sets the idle timeout. It should be a few
+    character times at the configured baud rate.
+    This function must not be called from an interrupt context.
+*/
+
+void DRV_USART_ReadContinuousIdleCheck(const DRV_HANDLE handle);
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: USART Driver Synchronous(Blocking Model) Transfer Interface Routines
@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP_USART_USB_CLICK_BOARD_Tasks. */
 TaskHandle_t xAPP_USART_USB_CLICK_BOARD_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_USART_USB_CLICK_BOARD_Tasks task. */
+static StackType_t lAPP_USART_USB_CLICK_BOARD_TasksStack[1024];
+static StaticTask_t lAPP_USART_USB_CLICK_BOARD_TasksTCB;
+#endif
+
 static void lAPP_USART_USB_CLICK_BOARD_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -79,6 +89,12 @@ TaskHandle_t xAPP_USART_USB_DEBUG_PORT_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_USART_USB_DEBUG_PORT_Tasks task. */
+static StackType_t lAPP_USART_USB_DEBUG_PORT_TasksStack[1024];
+static StaticTask_t lAPP_USART_USB_DEBUG_PORT_TasksTCB;
+#endif
+
 static void lAPP_USART_USB_DEBUG_PORT_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -117,6 +133,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_USART_USB_CLICK_BOARD_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_USART_USB_CLICK_BOARD_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_USART_USB_CLICK_BOARD_Tasks,
+           "APP_USART_USB_CLICK_BOARD_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_USART_USB_CLICK_BOARD_TasksStack,
+           &lAPP_USART_USB_CLICK_BOARD_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_USART_USB_CLICK_BOARD_Tasks,
            "APP_USART_USB_CLICK_BOARD_Tasks",
@@ -124,8 +150,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_USART_USB_CLICK_BOARD_Tasks);
+#endif
 
     /* Create OS Thread for APP_USART_USB_DEBUG_PORT_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_USART_USB_DEBUG_PORT_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_USART_USB_DEBUG_PORT_Tasks,
+           "APP_USART_USB_DEBUG_PORT_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_USART_USB_DEBUG_PORT_TasksStack,
+           &lAPP_USART_USB_DEBUG_PORT_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_USART_USB_DEBUG_PORT_Tasks,
            "APP_USART_USB_DEBUG_PORT_Tasks",
@@ -133,8 +170,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_USART_USB_DEBUG_PORT_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -0,0 +1,142 @@
+/*******************************************************************************
+  FreeRTOS Kernel Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    FreeRTOS.h
+
+  Summary:
+    Host replacement of the FreeRTOS kernel header for the heap benchmark.
+
+  Description:
+    The FreeRTOS heap implementations only use the kernel types, a few
+    configuration options and the scheduler suspend routines. This header
+    provides them on the host so that heap_tlsf.c and heap_4.c build
+    unchanged. The configuration options match the FreeRTOSConfig.h of the
+    target applications.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+#define configSUPPORT_DYNAMIC_ALLOCATION             1
+#define configTOTAL_HEAP_SIZE                        ( ( size_t ) 40960 )
+#define configAPPLICATION_ALLOCATED_HEAP             0
+#define configHEAP_CLEAR_MEMORY_ON_FREE              0
+#define configENABLE_HEAP_PROTECTOR                  0
+#define configUSE_MALLOC_FAILED_HOOK                 0
+#define configTLSF_FL_INDEX_MAX                      16
+
+#define configASSERT( x )                            assert( x )
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Port Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+typedef long            BaseType_t;
+typedef unsigned long   UBaseType_t;
+
+/* Pointers are 64 bits wide on the host */
+#define portPOINTER_SIZE_TYPE                        uintptr_t
+#define portBYTE_ALIGNMENT                           8
+#define portBYTE_ALIGNMENT_MASK                      ( 0x0007 )
+#define portMAX_DELAY                                ( ( size_t ) -1 )
+
+#define PRIVILEGED_FUNCTION
+#define PRIVILEGED_DATA
+
+#define mtCOVERAGE_TEST_MARKER()
+#define traceMALLOC( pvAddress, uiSize )
+#define traceFREE( pvAddress, uiSize )
+
+/* The benchmark runs from a single thread */
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Heap Interface
+// *****************************************************************************
+// *****************************************************************************
+
+/* Used to pass information about the heap out of vPortGetHeapStats(). */
+typedef struct xHeapStats
+{
+    size_t xAvailableHeapSpaceInBytes;      /* The total heap size currently available - this is the sum of all the free blocks, not the largest block that can be allocated. */
+    size_t xSizeOfLargestFreeBlockInBytes;  /* The maximum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+    size_t xSizeOfSmallestFreeBlockInBytes; /* The minimum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+    size_t xNumberOfFreeBlocks;             /* The number of free memory blocks within the heap at the time vPortGetHeapStats() is called. */
+    size_t xMinimumEverFreeBytesRemaining;  /* The minimum amount of total free memory (sum of all free blocks) there has been in the heap since the system booted. */
+    size_t xNumberOfSuccessfulAllocations;  /* The number of calls to pvPortMalloc() that have returned a valid memory block. */
+    size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
+} HeapStats_t;
+
+void * pvPortMalloc( size_t xWantedSize );
+void * pvPortCalloc( size_t xNum, size_t xSize );
+void vPortFree( void * pv );
+void vPortInitialiseBlocks( void );
+size_t xPortGetFreeHeapSize( void );
+size_t xPortGetMinimumEverFreeHeapSize( void );
+void vPortGetHeapStats( HeapStats_t * pxHeapStats );
+void vPortHeapResetState( void );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+    }
+#endif
+// DOM-IGNORE-END
+
+#endif // INC_FREERTOS_H
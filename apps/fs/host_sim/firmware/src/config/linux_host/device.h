@@ -0,0 +1,86 @@
+/*******************************************************************************
+  Device Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    device.h
+
+  Summary:
+    Host replacement of the device header.
+
+  Description:
+    This file replaces the device header of the target configurations when
+    the File System stack is built for a Linux host. It provides the CMSIS
+    compiler macros and the cache alignment macros used by the stack, there
+    are no device registers on the host.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DEVICE_H
+#define DEVICE_H
+
+#include <sys/types.h>
+
+/* CMSIS compiler macros */
+#ifndef __INLINE
+    #define __INLINE                        inline
+#endif
+#ifndef __STATIC_INLINE
+    #define __STATIC_INLINE                 static inline
+#endif
+#ifndef __WEAK
+    #define __WEAK                          __attribute__((weak))
+#endif
+#ifndef __ALIGNED
+    #define __ALIGNED(x)                    __attribute__((aligned(x)))
+#endif
+#ifndef __PACKED
+    #define __PACKED                        __attribute__((packed))
+#endif
+
+#define NO_INIT
+#define SECTION(a)
+
+/* Cache maintenance has no effect on the host, the buffers are still aligned
+ * the way the target expects them to be. */
+#define CACHE_LINE_SIZE                     (32u)
+#define CACHE_ALIGN                         __ALIGNED(CACHE_LINE_SIZE)
+#define CACHE_ALIGNED_SIZE_GET(size)        ((size) + ((((size) % (CACHE_LINE_SIZE))!= 0U)? ((CACHE_LINE_SIZE) - ((size) % (CACHE_LINE_SIZE))) : (0U)))
+
+#define DATA_CACHE_IS_ENABLED()             (0U)
+#define INSTRUCTION_CACHE_IS_ENABLED()      (0U)
+#define DCACHE_CLEAN_BY_ADDR(addr,sz)
+#define DCACHE_INVALIDATE_BY_ADDR(addr,sz)
+#define DCACHE_CLEAN_INVALIDATE_BY_ADDR(addr,sz)
+
+#ifndef FORMAT_ATTRIBUTE
+   #define FORMAT_ATTRIBUTE(archetype, string_index, first_to_check)  __attribute__ ((format (archetype, string_index, first_to_check)))
+#endif
+
+#endif //DEVICE_H
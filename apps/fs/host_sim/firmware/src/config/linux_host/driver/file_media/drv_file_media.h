@@ -0,0 +1,510 @@
+/*******************************************************************************
+  File Backed Media Driver Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_file_media.h
+
+  Summary:
+    File backed media driver interface declarations for the host simulation.
+
+  Description:
+    The file backed media driver simulates a block media on a Linux host. The
+    media contents are kept in a memory mapped image file. The driver models
+    the read, write and erase block geometry and the access latency of an SD
+    card, a NOR flash (SST26 through DRV_MEMORY) or the internal flash (EFC
+    through DRV_MEMORY), and registers with the File System Media Manager in
+    the same way as the target media drivers do.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_FILE_MEDIA_H
+#define DRV_FILE_MEDIA_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+#include "driver/driver_common.h"
+#include "system/system_module.h"
+#include "system/system_media.h"
+#include "system/fs/sys_fs_media_manager.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* File Backed Media Profiles
+
+  Summary:
+    Identifies the predefined media models.
+
+  Description:
+    This enumeration identifies the predefined media models returned by
+    DRV_FILE_MEDIA_ModelGet.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* SD card: 512 byte read, write and erase blocks, no erase before write */
+    DRV_FILE_MEDIA_PROFILE_SD = 0,
+
+    /* SST26 NOR flash through DRV_MEMORY: byte reads, 256 byte pages and
+       4 KB erase sectors, every write erases the sectors it touches */
+    DRV_FILE_MEDIA_PROFILE_NOR,
+
+    /* Internal flash through DRV_MEMORY: byte reads, 512 byte pages and
+       8 KB erase blocks, every write erases the blocks it touches */
+    DRV_FILE_MEDIA_PROFILE_EFC,
+
+    DRV_FILE_MEDIA_PROFILE_MAX
+
+} DRV_FILE_MEDIA_PROFILE;
+
+// *****************************************************************************
+/* File Backed Media Model
+
+  Summary:
+    Geometry and latency model of a simulated media.
+
+  Description:
+    This structure describes the block geometry of the simulated media and the
+    latency charged for each request. A request completes once its modelled
+    latency has elapsed on the host monotonic clock.
+
+    Read latency    = readSetupUs + bytes * readNsPerByte / 1000
+    Write latency   = writeSetupUs + writeBlocks * programUs
+                      + bytes * writeNsPerByte / 1000
+                      + erased blocks * eraseUs (eraseOnWrite only)
+    Erase latency   = eraseBlocks * eraseUs
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Read, write and erase block sizes in bytes */
+    uint32_t readBlockSize;
+    uint32_t writeBlockSize;
+    uint32_t eraseBlockSize;
+
+    /* Erase the erase blocks touched by a write before programming them, as
+       DRV_MEMORY_AsyncEraseWrite does */
+    bool eraseOnWrite;
+
+    /* Contents of an erased byte and of a newly created image */
+    uint8_t erasedValue;
+
+    /* Latency model, see above */
+    uint32_t readSetupUs;
+    uint32_t readNsPerByte;
+    uint32_t writeSetupUs;
+    uint32_t programUs;
+    uint32_t writeNsPerByte;
+    uint32_t eraseUs;
+
+} DRV_FILE_MEDIA_MODEL;
+
+// *****************************************************************************
+/* File Backed Media Driver Initialization Data
+
+  Summary:
+    Defines the data required to initialize the file backed media driver.
+
+  Description:
+    This data type defines the data required to initialize the file backed
+    media driver.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Path of the image file. The file is created if it does not exist. */
+    const char* imagePath;
+
+    /* Size of the media in bytes. The image file is resized to this size. A
+       value of 0 uses the size of an existing image file. */
+    uint32_t mediaSize;
+
+    /* Geometry and latency model of the media */
+    DRV_FILE_MEDIA_MODEL model;
+
+    /* Percentage applied to every latency of the model. 100 runs the model
+       in real time, 0 completes every request on the next task call. */
+    uint32_t latencyScale;
+
+    /* Media type reported to the Media Manager, selects the device name
+       (mmcblk, mtd, nvm) of the media */
+    SYS_FS_MEDIA_TYPE mediaType;
+
+} DRV_FILE_MEDIA_INIT;
+
+// *****************************************************************************
+/* File Backed Media Driver Statistics
+
+  Summary:
+    Accumulated activity of the simulated media.
+
+  Description:
+    This structure holds the accumulated activity of the simulated media. The
+    modelled busy time does not depend on the host and can be compared across
+    runs to evaluate changes of the File System stack reproducibly.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t readRequests;
+    uint32_t writeRequests;
+    uint32_t eraseRequests;
+
+    uint64_t bytesRead;
+    uint64_t bytesWritten;
+    uint64_t blocksErased;
+
+    /* Sum of the modelled request latencies in microseconds, independent of
+       latencyScale */
+    uint64_t busyUs;
+
+} DRV_FILE_MEDIA_STATS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    const DRV_FILE_MEDIA_MODEL* DRV_FILE_MEDIA_ModelGet
+    (
+        DRV_FILE_MEDIA_PROFILE profile
+    );
+
+  Summary:
+    Returns a predefined media model.
+
+  Description:
+    This routine returns the geometry and latency model of a predefined media
+    profile. The model can be copied into DRV_FILE_MEDIA_INIT and adjusted.
+
+  Precondition:
+    None.
+
+  Parameters:
+    profile - Media profile.
+
+  Returns:
+    Pointer to the model. NULL if the profile is invalid.
+
+  Remarks:
+    The latencies are representative values of the respective devices.
+*/
+
+const DRV_FILE_MEDIA_MODEL* DRV_FILE_MEDIA_ModelGet
+(
+    DRV_FILE_MEDIA_PROFILE profile
+);
+
+// *****************************************************************************
+/* Function:
+    SYS_MODULE_OBJ DRV_FILE_MEDIA_Initialize
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const SYS_MODULE_INIT * const init
+    );
+
+  Summary:
+    Initializes the file backed media driver.
+
+  Description:
+    This routine maps the image file of the instance and registers the media
+    with the File System Media Manager.
+
+  Precondition:
+    None.
+
+  Parameters:
+    drvIndex - Driver instance, less than DRV_FILE_MEDIA_INSTANCES_NUMBER.
+
+    init     - Pointer to a DRV_FILE_MEDIA_INIT structure.
+
+  Returns:
+    Driver object. SYS_MODULE_OBJ_INVALID if the image could not be mapped or
+    the model is inconsistent.
+
+  Remarks:
+    None.
+*/
+
+SYS_MODULE_OBJ DRV_FILE_MEDIA_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT * const init
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_FILE_MEDIA_Deinitialize
+    (
+        SYS_MODULE_OBJ object
+    );
+
+  Summary:
+    Deinitializes the file backed media driver.
+
+  Description:
+    This routine deregisters the media from the Media Manager, writes the
+    image back to the image file and unmaps it.
+
+  Precondition:
+    DRV_FILE_MEDIA_Initialize must have been called.
+
+  Parameters:
+    object - Driver object returned by DRV_FILE_MEDIA_Initialize.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void DRV_FILE_MEDIA_Deinitialize
+(
+    SYS_MODULE_OBJ object
+);
+
+// *****************************************************************************
+/* Function:
+    SYS_STATUS DRV_FILE_MEDIA_Status
+    (
+        SYS_MODULE_OBJ object
+    );
+
+  Summary:
+    Returns the status of the driver.
+
+  Description:
+    This routine returns SYS_STATUS_READY once the image is mapped.
+
+  Precondition:
+    None.
+
+  Parameters:
+    object - Driver object returned by DRV_FILE_MEDIA_Initialize.
+
+  Returns:
+    SYS_STATUS_READY or SYS_STATUS_UNINITIALIZED.
+
+  Remarks:
+    None.
+*/
+
+SYS_STATUS DRV_FILE_MEDIA_Status
+(
+    SYS_MODULE_OBJ object
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_FILE_MEDIA_Tasks
+    (
+        SYS_MODULE_OBJ object
+    );
+
+  Summary:
+    Completes the pending request once its modelled latency has elapsed.
+
+  Description:
+    This routine transfers the data of the pending request and notifies the
+    client once the latency of the request has elapsed. It is called by the
+    Media Manager transfer task.
+
+  Precondition:
+    DRV_FILE_MEDIA_Initialize must have been called.
+
+  Parameters:
+    object - Driver object returned by DRV_FILE_MEDIA_Initialize.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void DRV_FILE_MEDIA_Tasks
+(
+    SYS_MODULE_OBJ object
+);
+
+// *****************************************************************************
+/* Function:
+    void DRV_FILE_MEDIA_StatsGet
+    (
+        SYS_MODULE_OBJ object,
+        DRV_FILE_MEDIA_STATS* stats
+    );
+
+  Summary:
+    Returns the accumulated activity of the media.
+
+  Description:
+    This routine copies the accumulated activity of the media into stats.
+
+  Precondition:
+    DRV_FILE_MEDIA_Initialize must have been called.
+
+  Parameters:
+    object - Driver object returned by DRV_FILE_MEDIA_Initialize.
+
+    stats  - Storage for the statistics.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void DRV_FILE_MEDIA_StatsGet
+(
+    SYS_MODULE_OBJ object,
+    DRV_FILE_MEDIA_STATS* stats
+);
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Media Manager Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+/* The following routines are called by the Media Manager through the
+   SYS_FS_MEDIA_FUNCTIONS table of the driver. Block numbers and counts are
+   in units of the read, write or erase block of the model. */
+
+DRV_HANDLE DRV_FILE_MEDIA_Open
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const DRV_IO_INTENT ioIntent
+);
+
+void DRV_FILE_MEDIA_Close
+(
+    const DRV_HANDLE handle
+);
+
+bool DRV_FILE_MEDIA_IsAttached
+(
+    const DRV_HANDLE handle
+);
+
+SYS_MEDIA_GEOMETRY* DRV_FILE_MEDIA_GeometryGet
+(
+    const DRV_HANDLE handle
+);
+
+void DRV_FILE_MEDIA_AsyncRead
+(
+    const DRV_HANDLE handle,
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE* commandHandle,
+    void* targetBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+);
+
+void DRV_FILE_MEDIA_AsyncWrite
+(
+    const DRV_HANDLE handle,
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE* commandHandle,
+    void* sourceBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+);
+
+void DRV_FILE_MEDIA_AsyncErase
+(
+    const DRV_HANDLE handle,
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE* commandHandle,
+    uint32_t blockStart,
+    uint32_t nBlock
+);
+
+void DRV_FILE_MEDIA_EventHandlerSet
+(
+    const DRV_HANDLE handle,
+    const void* eventHandler,
+    const uintptr_t context
+);
+
+SYS_MEDIA_COMMAND_STATUS DRV_FILE_MEDIA_CommandStatusGet
+(
+    const DRV_HANDLE handle,
+    const SYS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle
+);
+
+uintptr_t DRV_FILE_MEDIA_AddressGet
+(
+    const DRV_HANDLE handle
+);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif // #ifndef DRV_FILE_MEDIA_H
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,690 @@
+/*******************************************************************************
+  File Backed Media Driver Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_file_media.c
+
+  Summary:
+    File backed media driver implementation for the host simulation.
+
+  Description:
+    This file implements the file backed media driver. The media contents
+    live in a memory mapped image file, requests complete from the driver task
+    once the latency given by the media model has elapsed.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "driver/file_media/src/drv_file_media_local.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global objects
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_FILE_MEDIA_OBJECT gDrvFileMediaObj[DRV_FILE_MEDIA_INSTANCES_NUMBER];
+
+static const DRV_FILE_MEDIA_MODEL gDrvFileMediaModel[DRV_FILE_MEDIA_PROFILE_MAX] =
+{
+    /* SD card on a 4 bit bus at 50 MHz */
+    {
+        .readBlockSize  = 512,
+        .writeBlockSize = 512,
+        .eraseBlockSize = 512,
+        .eraseOnWrite   = false,
+        .erasedValue    = 0x00,
+        .readSetupUs    = 150,
+        .readNsPerByte  = 40,
+        .writeSetupUs   = 500,
+        .programUs      = 0,
+        .writeNsPerByte = 40,
+        .eraseUs        = 250
+    },
+    /* SST26 NOR flash on a quad SPI bus at 66 MHz */
+    {
+        .readBlockSize  = 1,
+        .writeBlockSize = 256,
+        .eraseBlockSize = 4096,
+        .eraseOnWrite   = true,
+        .erasedValue    = 0xFF,
+        .readSetupUs    = 1,
+        .readNsPerByte  = 30,
+        .writeSetupUs   = 1,
+        .programUs      = 1000,
+        .writeNsPerByte = 30,
+        .eraseUs        = 18000
+    },
+    /* Internal flash */
+    {
+        .readBlockSize  = 1,
+        .writeBlockSize = 512,
+        .eraseBlockSize = 8192,
+        .eraseOnWrite   = true,
+        .erasedValue    = 0xFF,
+        .readSetupUs    = 0,
+        .readNsPerByte  = 2,
+        .writeSetupUs   = 1,
+        .programUs      = 1500,
+        .writeNsPerByte = 2,
+        .eraseUs        = 50000
+    }
+};
+
+/* MISRA C-2012 Rule 11.1 deviated:1 Deviation record ID -  H3_MISRAC_2012_R_11_1_DR_1 */
+
+static const SYS_FS_MEDIA_FUNCTIONS gDrvFileMediaFunctions =
+{
+    .mediaStatusGet     = DRV_FILE_MEDIA_IsAttached,
+    .mediaGeometryGet   = DRV_FILE_MEDIA_GeometryGet,
+    .sectorRead         = DRV_FILE_MEDIA_AsyncRead,
+    .sectorWrite        = DRV_FILE_MEDIA_AsyncWrite,
+    .eventHandlerset    = DRV_FILE_MEDIA_EventHandlerSet,
+    .commandStatusGet   = (CommandStatusGetType)DRV_FILE_MEDIA_CommandStatusGet,
+    .Read               = DRV_FILE_MEDIA_AsyncRead,
+    .erase              = DRV_FILE_MEDIA_AsyncErase,
+    .addressGet         = DRV_FILE_MEDIA_AddressGet,
+    .open               = DRV_FILE_MEDIA_Open,
+    .close              = DRV_FILE_MEDIA_Close,
+    .tasks              = DRV_FILE_MEDIA_Tasks
+};
+
+/* MISRAC 2012 deviation block end */
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Backed Media Driver Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint64_t lDRV_FILE_MEDIA_TimeNsGet(void)
+{
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+}
+
+static DRV_FILE_MEDIA_OBJECT* lDRV_FILE_MEDIA_HandleValidate(const DRV_HANDLE handle)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj;
+
+    if (handle >= DRV_FILE_MEDIA_INSTANCES_NUMBER)
+    {
+        return NULL;
+    }
+
+    dObj = &gDrvFileMediaObj[handle];
+
+    if ((dObj->inUse == false) || (dObj->isOpen == false))
+    {
+        return NULL;
+    }
+
+    return dObj;
+}
+
+/* Number of blocks of blockSize touched by the byte range */
+static uint32_t lDRV_FILE_MEDIA_BlocksTouched(uint32_t address, uint32_t nBytes, uint32_t blockSize)
+{
+    if (nBytes == 0U)
+    {
+        return 0;
+    }
+
+    return (((address + nBytes - 1U) / blockSize) - (address / blockSize) + 1U);
+}
+
+/* Modelled latency of a request in nanoseconds */
+static uint64_t lDRV_FILE_MEDIA_LatencyNsGet
+(
+    const DRV_FILE_MEDIA_MODEL* model,
+    DRV_FILE_MEDIA_OPERATION operation,
+    uint32_t address,
+    uint32_t nBytes
+)
+{
+    uint64_t latencyNs = 0;
+
+    switch (operation)
+    {
+        case DRV_FILE_MEDIA_OPERATION_READ:
+        {
+            latencyNs = ((uint64_t)model->readSetupUs * 1000U) + ((uint64_t)nBytes * model->readNsPerByte);
+            break;
+        }
+
+        case DRV_FILE_MEDIA_OPERATION_WRITE:
+        {
+            latencyNs = ((uint64_t)model->writeSetupUs * 1000U) + ((uint64_t)nBytes * model->writeNsPerByte) +
+                        ((uint64_t)lDRV_FILE_MEDIA_BlocksTouched(address, nBytes, model->writeBlockSize) * model->programUs * 1000U);
+
+            if (model->eraseOnWrite == true)
+            {
+                latencyNs += ((uint64_t)lDRV_FILE_MEDIA_BlocksTouched(address, nBytes, model->eraseBlockSize) * model->eraseUs * 1000U);
+            }
+            break;
+        }
+
+        case DRV_FILE_MEDIA_OPERATION_ERASE:
+        default:
+        {
+            latencyNs = ((uint64_t)lDRV_FILE_MEDIA_BlocksTouched(address, nBytes, model->eraseBlockSize) * model->eraseUs * 1000U);
+            break;
+        }
+    }
+
+    return latencyNs;
+}
+
+static void lDRV_FILE_MEDIA_RequestSubmit
+(
+    DRV_FILE_MEDIA_OBJECT* dObj,
+    uint32_t drvIndex,
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE* commandHandle,
+    DRV_FILE_MEDIA_OPERATION operation,
+    uint8_t* buffer,
+    uint32_t address,
+    uint32_t nBytes
+)
+{
+    uint64_t latencyNs;
+
+    if (commandHandle != NULL)
+    {
+        *commandHandle = SYS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+    }
+
+    if ((dObj->pending == true) || (nBytes == 0U) || (address >= dObj->mediaSize) ||
+        (nBytes > (dObj->mediaSize - address)) ||
+        ((buffer == NULL) && (operation != DRV_FILE_MEDIA_OPERATION_ERASE)))
+    {
+        return;
+    }
+
+    latencyNs = lDRV_FILE_MEDIA_LatencyNsGet(&dObj->model, operation, address, nBytes);
+
+    dObj->stats.busyUs += (latencyNs / 1000U);
+
+    dObj->handleToken++;
+
+    if (dObj->handleToken > DRV_FILE_MEDIA_TOKEN_MAX)
+    {
+        dObj->handleToken = 1;
+    }
+
+    dObj->operation     = operation;
+    dObj->buffer        = buffer;
+    dObj->address       = address;
+    dObj->nBytes        = nBytes;
+    dObj->deadlineNs    = lDRV_FILE_MEDIA_TimeNsGet() + ((latencyNs * dObj->latencyScale) / 100U);
+    dObj->commandHandle = DRV_FILE_MEDIA_MAKE_HANDLE(dObj->handleToken, drvIndex);
+    dObj->commandStatus = SYS_MEDIA_COMMAND_IN_PROGRESS;
+    dObj->pending       = true;
+
+    if (commandHandle != NULL)
+    {
+        *commandHandle = dObj->commandHandle;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Backed Media Driver Interface Implementations
+// *****************************************************************************
+// *****************************************************************************
+
+const DRV_FILE_MEDIA_MODEL* DRV_FILE_MEDIA_ModelGet(DRV_FILE_MEDIA_PROFILE profile)
+{
+    if (profile >= DRV_FILE_MEDIA_PROFILE_MAX)
+    {
+        return NULL;
+    }
+
+    return &gDrvFileMediaModel[profile];
+}
+
+SYS_MODULE_OBJ DRV_FILE_MEDIA_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT * const init
+)
+{
+    const DRV_FILE_MEDIA_INIT* fileMediaInit = (const DRV_FILE_MEDIA_INIT *)init;
+    const DRV_FILE_MEDIA_MODEL* model;
+    DRV_FILE_MEDIA_OBJECT* dObj;
+    struct stat imageStat;
+    bool isNewImage;
+    void* image;
+
+    if ((drvIndex >= DRV_FILE_MEDIA_INSTANCES_NUMBER) || (fileMediaInit == NULL) ||
+        (fileMediaInit->imagePath == NULL))
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj  = &gDrvFileMediaObj[drvIndex];
+    model = &fileMediaInit->model;
+
+    if (dObj->inUse == true)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    if ((model->readBlockSize == 0U) || (model->writeBlockSize == 0U) || (model->eraseBlockSize == 0U))
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    (void) memset(dObj, 0, sizeof(DRV_FILE_MEDIA_OBJECT));
+
+    dObj->imageFd = open(fileMediaInit->imagePath, O_RDWR | O_CREAT, 0644);
+
+    if (dObj->imageFd < 0)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    if (fstat(dObj->imageFd, &imageStat) != 0)
+    {
+        (void) close(dObj->imageFd);
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    isNewImage      = (imageStat.st_size == 0);
+    dObj->mediaSize = fileMediaInit->mediaSize;
+
+    if (dObj->mediaSize == 0U)
+    {
+        dObj->mediaSize = (uint32_t)imageStat.st_size;
+    }
+
+    /* The media must hold a whole number of blocks of every kind */
+    if ((dObj->mediaSize == 0U) || ((dObj->mediaSize % model->readBlockSize) != 0U) ||
+        ((dObj->mediaSize % model->writeBlockSize) != 0U) || ((dObj->mediaSize % model->eraseBlockSize) != 0U))
+    {
+        (void) close(dObj->imageFd);
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    if ((off_t)dObj->mediaSize != imageStat.st_size)
+    {
+        if (ftruncate(dObj->imageFd, (off_t)dObj->mediaSize) != 0)
+        {
+            (void) close(dObj->imageFd);
+            return SYS_MODULE_OBJ_INVALID;
+        }
+    }
+
+    image = mmap(NULL, dObj->mediaSize, PROT_READ | PROT_WRITE, MAP_SHARED, dObj->imageFd, 0);
+
+    if (image == MAP_FAILED)
+    {
+        (void) close(dObj->imageFd);
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj->image        = (uint8_t *)image;
+    dObj->model        = *model;
+    dObj->latencyScale = fileMediaInit->latencyScale;
+
+    if (isNewImage == true)
+    {
+        /* A new image starts out erased */
+        (void) memset(dObj->image, model->erasedValue, dObj->mediaSize);
+    }
+
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].blockSize  = model->readBlockSize;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].numBlocks  = dObj->mediaSize / model->readBlockSize;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].blockSize = model->writeBlockSize;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].numBlocks = dObj->mediaSize / model->writeBlockSize;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].blockSize = model->eraseBlockSize;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].numBlocks = dObj->mediaSize / model->eraseBlockSize;
+
+    dObj->mediaGeometryObj.mediaProperty   = (SYS_MEDIA_PROPERTY)((uint32_t)SYS_MEDIA_READ_IS_BLOCKING | (uint32_t)SYS_MEDIA_WRITE_IS_BLOCKING);
+    dObj->mediaGeometryObj.numReadRegions  = 1;
+    dObj->mediaGeometryObj.numWriteRegions = 1;
+    dObj->mediaGeometryObj.numEraseRegions = 1;
+    dObj->mediaGeometryObj.geometryTable   = dObj->mediaGeometryTable;
+
+    dObj->inUse         = true;
+    dObj->status        = SYS_STATUS_READY;
+    dObj->commandHandle = SYS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+
+    /* Register with the Media Manager the same way the target media drivers do */
+    dObj->mediaHandle = SYS_FS_MEDIA_MANAGER_Register((SYS_MODULE_OBJ)drvIndex, (SYS_MODULE_INDEX)drvIndex,
+                                                      &gDrvFileMediaFunctions, fileMediaInit->mediaType);
+
+    return (SYS_MODULE_OBJ)drvIndex;
+}
+
+void DRV_FILE_MEDIA_Deinitialize(SYS_MODULE_OBJ object)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj;
+
+    if (object >= DRV_FILE_MEDIA_INSTANCES_NUMBER)
+    {
+        return;
+    }
+
+    dObj = &gDrvFileMediaObj[object];
+
+    if (dObj->inUse == false)
+    {
+        return;
+    }
+
+    if (dObj->mediaHandle != SYS_FS_MEDIA_HANDLE_INVALID)
+    {
+        SYS_FS_MEDIA_MANAGER_DeRegister(dObj->mediaHandle);
+    }
+
+    (void) msync(dObj->image, dObj->mediaSize, MS_SYNC);
+    (void) munmap(dObj->image, dObj->mediaSize);
+    (void) close(dObj->imageFd);
+
+    dObj->inUse  = false;
+    dObj->isOpen = false;
+    dObj->status = SYS_STATUS_UNINITIALIZED;
+}
+
+SYS_STATUS DRV_FILE_MEDIA_Status(SYS_MODULE_OBJ object)
+{
+    if ((object >= DRV_FILE_MEDIA_INSTANCES_NUMBER) || (gDrvFileMediaObj[object].inUse == false))
+    {
+        return SYS_STATUS_UNINITIALIZED;
+    }
+
+    return gDrvFileMediaObj[object].status;
+}
+
+void DRV_FILE_MEDIA_Tasks(SYS_MODULE_OBJ object)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj;
+
+    if (object >= DRV_FILE_MEDIA_INSTANCES_NUMBER)
+    {
+        return;
+    }
+
+    dObj = &gDrvFileMediaObj[object];
+
+    if ((dObj->pending == false) || (lDRV_FILE_MEDIA_TimeNsGet() < dObj->deadlineNs))
+    {
+        return;
+    }
+
+    switch (dObj->operation)
+    {
+        case DRV_FILE_MEDIA_OPERATION_READ:
+        {
+            (void) memcpy(dObj->buffer, &dObj->image[dObj->address], dObj->nBytes);
+
+            dObj->stats.readRequests++;
+            dObj->stats.bytesRead += dObj->nBytes;
+            break;
+        }
+
+        case DRV_FILE_MEDIA_OPERATION_WRITE:
+        {
+            /* Erase write preserves the rest of the erase blocks, so the
+             * contents end up the same as with a plain write */
+            (void) memcpy(&dObj->image[dObj->address], dObj->buffer, dObj->nBytes);
+
+            dObj->stats.writeRequests++;
+            dObj->stats.bytesWritten += dObj->nBytes;
+
+            if (dObj->model.eraseOnWrite == true)
+            {
+                dObj->stats.blocksErased += lDRV_FILE_MEDIA_BlocksTouched(dObj->address, dObj->nBytes, dObj->model.eraseBlockSize);
+            }
+            break;
+        }
+
+        case DRV_FILE_MEDIA_OPERATION_ERASE:
+        default:
+        {
+            (void) memset(&dObj->image[dObj->address], dObj->model.erasedValue, dObj->nBytes);
+
+            dObj->stats.eraseRequests++;
+            dObj->stats.blocksErased += (dObj->nBytes / dObj->model.eraseBlockSize);
+            break;
+        }
+    }
+
+    dObj->pending       = false;
+    dObj->commandStatus = SYS_MEDIA_COMMAND_COMPLETED;
+
+    if (dObj->eventHandler != NULL)
+    {
+        dObj->eventHandler(SYS_MEDIA_EVENT_BLOCK_COMMAND_COMPLETE, dObj->commandHandle, dObj->context);
+    }
+}
+
+void DRV_FILE_MEDIA_StatsGet(SYS_MODULE_OBJ object, DRV_FILE_MEDIA_STATS* stats)
+{
+    if ((object >= DRV_FILE_MEDIA_INSTANCES_NUMBER) || (stats == NULL))
+    {
+        return;
+    }
+
+    *stats = gDrvFileMediaObj[object].stats;
+}
+
+DRV_HANDLE DRV_FILE_MEDIA_Open
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const DRV_IO_INTENT ioIntent
+)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj;
+
+    (void) ioIntent;
+
+    if (drvIndex >= DRV_FILE_MEDIA_INSTANCES_NUMBER)
+    {
+        return DRV_HANDLE_INVALID;
+    }
+
+    dObj = &gDrvFileMediaObj[drvIndex];
+
+    /* The Media Manager is the only client of the driver */
+    if ((dObj->inUse == false) || (dObj->status != SYS_STATUS_READY) || (dObj->isOpen == true))
+    {
+        return DRV_HANDLE_INVALID;
+    }
+
+    dObj->isOpen       = true;
+    dObj->eventHandler = NULL;
+    dObj->context      = 0;
+
+    return (DRV_HANDLE)drvIndex;
+}
+
+void DRV_FILE_MEDIA_Close(const DRV_HANDLE handle)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj = lDRV_FILE_MEDIA_HandleValidate(handle);
+
+    if (dObj != NULL)
+    {
+        dObj->isOpen  = false;
+        dObj->pending = false;
+    }
+}
+
+bool DRV_FILE_MEDIA_IsAttached(const DRV_HANDLE handle)
+{
+    return (lDRV_FILE_MEDIA_HandleValidate(handle) != NULL);
+}
+
+SYS_MEDIA_GEOMETRY* DRV_FILE_MEDIA_GeometryGet(const DRV_HANDLE handle)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj = lDRV_FILE_MEDIA_HandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        return NULL;
+    }
+
+    return &dObj->mediaGeometryObj;
+}
+
+void DRV_FILE_MEDIA_AsyncRead
+(
+    const DRV_HANDLE handle,
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE* commandHandle,
+    void* targetBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj = lDRV_FILE_MEDIA_HandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        if (commandHandle != NULL)
+        {
+            *commandHandle = SYS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+        }
+        return;
+    }
+
+    lDRV_FILE_MEDIA_RequestSubmit(dObj, (uint32_t)handle, commandHandle, DRV_FILE_MEDIA_OPERATION_READ,
+                                  (uint8_t *)targetBuffer, blockStart * dObj->model.readBlockSize,
+                                  nBlock * dObj->model.readBlockSize);
+}
+
+void DRV_FILE_MEDIA_AsyncWrite
+(
+    const DRV_HANDLE handle,
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE* commandHandle,
+    void* sourceBuffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj = lDRV_FILE_MEDIA_HandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        if (commandHandle != NULL)
+        {
+            *commandHandle = SYS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+        }
+        return;
+    }
+
+    lDRV_FILE_MEDIA_RequestSubmit(dObj, (uint32_t)handle, commandHandle, DRV_FILE_MEDIA_OPERATION_WRITE,
+                                  (uint8_t *)sourceBuffer, blockStart * dObj->model.writeBlockSize,
+                                  nBlock * dObj->model.writeBlockSize);
+}
+
+void DRV_FILE_MEDIA_AsyncErase
+(
+    const DRV_HANDLE handle,
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE* commandHandle,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj = lDRV_FILE_MEDIA_HandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        if (commandHandle != NULL)
+        {
+            *commandHandle = SYS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+        }
+        return;
+    }
+
+    lDRV_FILE_MEDIA_RequestSubmit(dObj, (uint32_t)handle, commandHandle, DRV_FILE_MEDIA_OPERATION_ERASE,
+                                  NULL, blockStart * dObj->model.eraseBlockSize,
+                                  nBlock * dObj->model.eraseBlockSize);
+}
+
+void DRV_FILE_MEDIA_EventHandlerSet
+(
+    const DRV_HANDLE handle,
+    const void* eventHandler,
+    const uintptr_t context
+)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj = lDRV_FILE_MEDIA_HandleValidate(handle);
+
+    if (dObj != NULL)
+    {
+        dObj->eventHandler = (SYS_MEDIA_EVENT_HANDLER)eventHandler;
+        dObj->context      = context;
+    }
+}
+
+SYS_MEDIA_COMMAND_STATUS DRV_FILE_MEDIA_CommandStatusGet
+(
+    const DRV_HANDLE handle,
+    const SYS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle
+)
+{
+    DRV_FILE_MEDIA_OBJECT* dObj = lDRV_FILE_MEDIA_HandleValidate(handle);
+
+    if ((dObj == NULL) || (commandHandle == SYS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID))
+    {
+        return SYS_MEDIA_COMMAND_UNKNOWN;
+    }
+
+    if (commandHandle == dObj->commandHandle)
+    {
+        return dObj->commandStatus;
+    }
+
+    /* An older request, it has been completed */
+    return SYS_MEDIA_COMMAND_COMPLETED;
+}
+
+uintptr_t DRV_FILE_MEDIA_AddressGet(const DRV_HANDLE handle)
+{
+    (void) handle;
+
+    /* The image is only accessed through the driver, the media address space
+     * starts at 0. MPFS uses the address only to compute media offsets. */
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+  File Backed Media Driver Local Data Structures
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_file_media_local.h
+
+  Summary:
+    File backed media driver local declarations and definitions.
+
+  Description:
+    This file contains the file backed media driver's local declarations and
+    definitions.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_FILE_MEDIA_LOCAL_H
+#define DRV_FILE_MEDIA_LOCAL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/file_media/drv_file_media.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Number of entries of the media geometry table (read, write, erase) */
+#define DRV_FILE_MEDIA_GEOMETRY_TABLE_SIZE      (3U)
+
+/* The command handle holds a running token in the upper bits and the driver
+ * instance in the lower 8 bits */
+#define DRV_FILE_MEDIA_TOKEN_MAX                (0xFFFFFFU)
+#define DRV_FILE_MEDIA_MAKE_HANDLE(token, index) ((SYS_MEDIA_BLOCK_COMMAND_HANDLE)(((token) << 8) | (index)))
+
+typedef enum
+{
+    DRV_FILE_MEDIA_OPERATION_READ = 0,
+
+    DRV_FILE_MEDIA_OPERATION_WRITE,
+
+    DRV_FILE_MEDIA_OPERATION_ERASE
+
+} DRV_FILE_MEDIA_OPERATION;
+
+typedef struct
+{
+    /* Flag to indicate the instance is initialized */
+    bool inUse;
+
+    /* Flag to indicate the instance is opened by the Media Manager */
+    bool isOpen;
+
+    SYS_STATUS status;
+
+    /* Image file and its mapping */
+    int imageFd;
+    uint8_t* image;
+    uint32_t mediaSize;
+
+    /* Geometry and latency model */
+    DRV_FILE_MEDIA_MODEL model;
+    uint32_t latencyScale;
+
+    SYS_MEDIA_GEOMETRY mediaGeometryObj;
+    SYS_MEDIA_REGION_GEOMETRY mediaGeometryTable[DRV_FILE_MEDIA_GEOMETRY_TABLE_SIZE];
+
+    /* Handle returned by the Media Manager registration */
+    SYS_FS_MEDIA_HANDLE mediaHandle;
+
+    /* Client event handler */
+    SYS_MEDIA_EVENT_HANDLER eventHandler;
+    uintptr_t context;
+
+    /* The request being processed. The driver processes one request at a
+       time, as the File System issues one request at a time per disk. */
+    bool pending;
+    DRV_FILE_MEDIA_OPERATION operation;
+    uint8_t* buffer;
+    uint32_t address;
+    uint32_t nBytes;
+    uint64_t deadlineNs;
+
+    SYS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle;
+    SYS_MEDIA_COMMAND_STATUS commandStatus;
+    uint32_t handleToken;
+
+    DRV_FILE_MEDIA_STATS stats;
+
+} DRV_FILE_MEDIA_OBJECT;
+
+#endif //#ifndef DRV_FILE_MEDIA_LOCAL_H
@@ -0,0 +1,123 @@
+/*******************************************************************************
+  Interrupt System Service Library Interface Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_int.h
+
+  Summary:
+    Host replacement of the Interrupt System Service.
+
+  Description:
+    The File System stack and the basic OSAL only use the global interrupt
+    enable of the Interrupt System Service to protect critical sections. The
+    host build runs the stack and the simulated media from a single thread,
+    so there are no interrupts to disable.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_INT_H
+#define SYS_INT_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "device.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+/* Interrupt sources are not used on the host */
+typedef int32_t INT_SOURCE;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+__STATIC_INLINE void SYS_INT_Enable( void )
+{
+}
+
+__STATIC_INLINE bool SYS_INT_Disable( void )
+{
+    return true;
+}
+
+__STATIC_INLINE bool SYS_INT_IsEnabled( void )
+{
+    return true;
+}
+
+__STATIC_INLINE void SYS_INT_Restore( bool state )
+{
+    (void) state;
+}
+
+__STATIC_INLINE void SYS_INT_SourceEnable( INT_SOURCE source )
+{
+    (void) source;
+}
+
+__STATIC_INLINE bool SYS_INT_SourceDisable( INT_SOURCE source )
+{
+    (void) source;
+    return true;
+}
+
+__STATIC_INLINE void SYS_INT_SourceRestore( INT_SOURCE source, bool state )
+{
+    (void) source;
+    (void) state;
+}
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+    }
+#endif
+// DOM-IGNORE-END
+
+#endif // SYS_INT_H
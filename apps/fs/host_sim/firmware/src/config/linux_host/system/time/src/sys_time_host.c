@@ -0,0 +1,98 @@
+/*******************************************************************************
+  Timer System Service Host Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_time_host.c
+
+  Summary:
+    Timer System Service counter routines for the host simulation.
+
+  Description:
+    This file implements the counter routines of the Timer System Service on
+    top of the host monotonic clock. The counter runs at 1 GHz, so counts are
+    nanoseconds. Delays, callbacks and software timers are not implemented,
+    the File System stack does not use them.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <time.h>
+#include "configuration.h"
+#include "system/time/sys_time.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Timer System Service Counter Routines
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t SYS_TIME_FrequencyGet ( void )
+{
+    return (uint32_t)SYS_TIME_CPU_CLOCK_FREQUENCY;
+}
+
+uint64_t SYS_TIME_Counter64Get ( void )
+{
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+}
+
+uint32_t SYS_TIME_CounterGet ( void )
+{
+    return (uint32_t)SYS_TIME_Counter64Get();
+}
+
+uint32_t SYS_TIME_CountToUS ( uint32_t count )
+{
+    return (uint32_t)(((uint64_t)count * 1000000ULL) / SYS_TIME_FrequencyGet());
+}
+
+uint32_t SYS_TIME_CountToMS ( uint32_t count )
+{
+    return (uint32_t)(((uint64_t)count * 1000ULL) / SYS_TIME_FrequencyGet());
+}
+
+uint32_t SYS_TIME_USToCount ( uint32_t us )
+{
+    return (uint32_t)(((uint64_t)us * SYS_TIME_FrequencyGet()) / 1000000ULL);
+}
+
+uint32_t SYS_TIME_MSToCount ( uint32_t ms )
+{
+    return (uint32_t)(((uint64_t)ms * SYS_TIME_FrequencyGet()) / 1000ULL);
+}
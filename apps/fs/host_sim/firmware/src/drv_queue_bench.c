@@ -0,0 +1,306 @@
+/*******************************************************************************
+  Driver Queue Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_queue_bench.c
+
+  Summary:
+    This file contains the "main" function of the driver queue benchmark.
+
+  Description:
+    This file contains the "main" function of the driver queue benchmark. It
+    runs the asynchronous USART driver on the host on top of a PLIB that
+    completes nothing by itself, fills the transfer queue to a given depth and
+    then completes the queued transfers by calling the PLIB callback of the
+    driver, like the USART interrupt does. The time taken by the submit and by
+    the completion of a transfer is printed for every queue depth.
+ *******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <stdio.h>
+#include <time.h>
+#include "configuration.h"
+#include "driver/usart/drv_usart.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Transfer objects of the driver, the largest queue depth measured */
+#define QUEUE_BENCH_POOL_SIZE           (128U)
+
+/* Number of times the queue is filled and drained at every depth */
+#define QUEUE_BENCH_ROUNDS              (20000U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_USART_CLIENT_OBJ queueBenchClientObjPool[1];
+
+static DRV_USART_BUFFER_OBJ queueBenchBufferObjPool[QUEUE_BENCH_POOL_SIZE];
+
+static uint8_t queueBenchData[4];
+
+/* Write callback registered by the driver, called to complete a transfer */
+static DRV_USART_PLIB_CALLBACK queueBenchWriteCallback;
+
+static uintptr_t queueBenchWriteContext;
+
+static uint32_t queueBenchCompleted;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: USART PLIB
+// *****************************************************************************
+// *****************************************************************************
+/* The transfers are only completed by QUEUE_BENCH_Complete */
+
+static void QUEUE_BENCH_CallbackRegister(DRV_USART_PLIB_CALLBACK callback, uintptr_t context)
+{
+    queueBenchWriteCallback = callback;
+    queueBenchWriteContext = context;
+}
+
+static void QUEUE_BENCH_ReadCallbackRegister(DRV_USART_PLIB_CALLBACK callback, uintptr_t context)
+{
+    (void)callback;
+    (void)context;
+}
+
+static bool QUEUE_BENCH_Transfer(void *buffer, const size_t size)
+{
+    (void)buffer;
+    (void)size;
+
+    return true;
+}
+
+static bool QUEUE_BENCH_IsBusy(void)
+{
+    return false;
+}
+
+static size_t QUEUE_BENCH_CountGet(void)
+{
+    return sizeof(queueBenchData);
+}
+
+static bool QUEUE_BENCH_Abort(void)
+{
+    return true;
+}
+
+static uint32_t QUEUE_BENCH_ErrorGet(void)
+{
+    return 0U;
+}
+
+static bool QUEUE_BENCH_SerialSetup(DRV_USART_SERIAL_SETUP* setup, uint32_t clkSrc)
+{
+    (void)setup;
+    (void)clkSrc;
+
+    return true;
+}
+
+static const DRV_USART_PLIB_INTERFACE queueBenchPlibAPI =
+{
+    .readCallbackRegister = QUEUE_BENCH_ReadCallbackRegister,
+    .read_t = QUEUE_BENCH_Transfer,
+    .readIsBusy = QUEUE_BENCH_IsBusy,
+    .readCountGet = QUEUE_BENCH_CountGet,
+    .readAbort = QUEUE_BENCH_Abort,
+    .writeCallbackRegister = QUEUE_BENCH_CallbackRegister,
+    .write_t = QUEUE_BENCH_Transfer,
+    .writeIsBusy = QUEUE_BENCH_IsBusy,
+    .writeCountGet = QUEUE_BENCH_CountGet,
+    .errorGet = QUEUE_BENCH_ErrorGet,
+    .serialSetup = QUEUE_BENCH_SerialSetup
+};
+
+static const uint32_t queueBenchRemapDataWidth[] = { 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x0, 0xFFFFFFFFU };
+static const uint32_t queueBenchRemapParity[] = { 0x800, 0x0, 0x200, 0x600, 0x400, 0xFFFFFFFFU };
+static const uint32_t queueBenchRemapStopBits[] = { 0x0, 0xFFFFFFFFU, 0xFFFFFFFFU };
+static const uint32_t queueBenchRemapError[] = { 0x20, 0x80, 0x40 };
+
+static const DRV_USART_INTERRUPT_SOURCES queueBenchInterruptSources =
+{
+    .isSingleIntSrc                        = true,
+    .intSources.usartInterrupt             = 0
+};
+
+static const DRV_USART_INIT queueBenchInitData =
+{
+    .usartPlib = &queueBenchPlibAPI,
+    .numClients = 1U,
+    .clientObjPool = (uintptr_t)&queueBenchClientObjPool[0],
+    .bufferObjPoolSize = QUEUE_BENCH_POOL_SIZE,
+    .bufferObjPool = (uintptr_t)&queueBenchBufferObjPool[0],
+    .interruptSources = &queueBenchInterruptSources,
+    .remapDataWidth = queueBenchRemapDataWidth,
+    .remapParity = queueBenchRemapParity,
+    .remapStopBits = queueBenchRemapStopBits,
+    .remapError = queueBenchRemapError,
+    .dataWidth = DRV_USART_DATA_8_BIT,
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void QUEUE_BENCH_EventHandler(DRV_USART_BUFFER_EVENT event, DRV_USART_BUFFER_HANDLE bufferHandle, uintptr_t context)
+{
+    (void)bufferHandle;
+    (void)context;
+
+    if (event == DRV_USART_BUFFER_EVENT_COMPLETE)
+    {
+        queueBenchCompleted++;
+    }
+}
+
+static uint64_t QUEUE_BENCH_TimeGet(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Main Entry Point
+// *****************************************************************************
+// *****************************************************************************
+
+int main ( void )
+{
+    SYS_MODULE_OBJ object;
+    DRV_HANDLE handle;
+    DRV_USART_BUFFER_HANDLE bufferHandle;
+    uint64_t submitTime;
+    uint64_t completeTime;
+    uint64_t start;
+    uint32_t depth;
+    uint32_t round;
+    uint32_t i;
+
+    object = DRV_USART_Initialize(DRV_USART_INDEX_0, (SYS_MODULE_INIT *)&queueBenchInitData);
+
+    if (object == SYS_MODULE_OBJ_INVALID)
+    {
+        printf("QUEUEBENCH driver initialization failed\n");
+        return EXIT_FAILURE;
+    }
+
+    handle = DRV_USART_Open(DRV_USART_INDEX_0, DRV_IO_INTENT_READWRITE);
+
+    if (handle == DRV_HANDLE_INVALID)
+    {
+        printf("QUEUEBENCH driver open failed\n");
+        return EXIT_FAILURE;
+    }
+
+    DRV_USART_BufferEventHandlerSet(handle, QUEUE_BENCH_EventHandler, 0U);
+
+    printf("QUEUEBENCH depth submit_ns complete_ns\n");
+
+    for (depth = 1U; depth <= QUEUE_BENCH_POOL_SIZE; depth <<= 1U)
+    {
+        submitTime = 0U;
+        completeTime = 0U;
+        queueBenchCompleted = 0U;
+
+        for (round = 0U; round < QUEUE_BENCH_ROUNDS; round++)
+        {
+            /* Queue depth transfers, the first one goes to the PLIB */
+            start = QUEUE_BENCH_TimeGet();
+
+            for (i = 0U; i < depth; i++)
+            {
+                DRV_USART_WriteBufferAdd(handle, queueBenchData, sizeof(queueBenchData), &bufferHandle);
+
+                if (bufferHandle == DRV_USART_BUFFER_HANDLE_INVALID)
+                {
+                    printf("QUEUEBENCH submit failed at depth %u\n", (unsigned int)depth);
+                    return EXIT_FAILURE;
+                }
+            }
+
+            submitTime += QUEUE_BENCH_TimeGet() - start;
+
+            /* Complete them one by one as the transmit interrupt would */
+            start = QUEUE_BENCH_TimeGet();
+
+            for (i = 0U; i < depth; i++)
+            {
+                queueBenchWriteCallback(queueBenchWriteContext);
+            }
+
+            completeTime += QUEUE_BENCH_TimeGet() - start;
+        }
+
+        if (queueBenchCompleted != (depth * QUEUE_BENCH_ROUNDS))
+        {
+            printf("QUEUEBENCH %u of %u transfers completed at depth %u\n", (unsigned int)queueBenchCompleted,
+                (unsigned int)(depth * QUEUE_BENCH_ROUNDS), (unsigned int)depth);
+            return EXIT_FAILURE;
+        }
+
+        printf("QUEUEBENCH %5u %9.1f %11.1f\n", (unsigned int)depth,
+            (double)submitTime / (double)(depth * QUEUE_BENCH_ROUNDS),
+            (double)completeTime / (double)(depth * QUEUE_BENCH_ROUNDS));
+    }
+
+    DRV_USART_Close(handle);
+
+    return EXIT_SUCCESS;
+}
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,452 @@
+/*******************************************************************************
+  Heap Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    heap_bench.c
+
+  Summary:
+    This file contains the "main" function of the FreeRTOS heap benchmark.
+
+  Description:
+    This file contains the "main" function of the FreeRTOS heap benchmark. It
+    is linked with one heap implementation, heap_tlsf.c or heap_4.c, and runs
+    the same random sequence of pvPortMalloc and vPortFree calls on each. For
+    every workload it prints the time taken by the calls and how fragmented
+    the heap got. With -s it checks the heap instead: the blocks must not
+    overlap, must be aligned, and must all merge back into one free block
+    once they are freed. Build it with AddressSanitizer for that run.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "FreeRTOS.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Name of the heap implementation printed with the results */
+#ifndef HEAP_BENCH_NAME
+#define HEAP_BENCH_NAME                 "heap"
+#endif
+
+/* Default number of pvPortMalloc and vPortFree calls per workload */
+#define HEAP_BENCH_OPS                  (1000000U)
+
+/* Largest number of live blocks of a workload */
+#define HEAP_BENCH_SLOTS_MAX            (256U)
+
+/* The fragmentation is sampled every that many calls */
+#define HEAP_BENCH_SAMPLE_PERIOD        (1024U)
+
+typedef struct
+{
+    /* Name printed with the results */
+    const char*     name;
+
+    /* Number of live blocks a random call picks from. Each pick frees the
+     * block if it is allocated, or allocates it. */
+    uint32_t        slots;
+
+} HEAP_BENCH_WORKLOAD;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* steady keeps the heap about a third full, pressure runs it out of memory */
+static const HEAP_BENCH_WORKLOAD heapBenchWorkloads[] =
+{
+    { "steady",     64U },
+    { "pressure",   256U },
+};
+
+static void* heapBenchBlock[HEAP_BENCH_SLOTS_MAX];
+
+static size_t heapBenchSize[HEAP_BENCH_SLOTS_MAX];
+
+static uint8_t heapBenchTag[HEAP_BENCH_SLOTS_MAX];
+
+static uint32_t heapBenchSeed;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t HEAP_BENCH_Random(void)
+{
+    heapBenchSeed ^= heapBenchSeed << 13;
+    heapBenchSeed ^= heapBenchSeed >> 17;
+    heapBenchSeed ^= heapBenchSeed << 5;
+
+    return heapBenchSeed;
+}
+
+/* Mostly small control blocks and messages, some buffers and a few task
+ * stacks sized allocations */
+static size_t HEAP_BENCH_SizeGet(void)
+{
+    uint32_t pick = HEAP_BENCH_Random() % 100U;
+    size_t size;
+
+    if (pick < 75U)
+    {
+        size = 16U + (HEAP_BENCH_Random() % 113U);
+    }
+    else if (pick < 95U)
+    {
+        size = 129U + (HEAP_BENCH_Random() % 896U);
+    }
+    else
+    {
+        size = 1025U + (HEAP_BENCH_Random() % 3072U);
+    }
+
+    return size;
+}
+
+static uint64_t HEAP_BENCH_TimeGet(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+static int HEAP_BENCH_Compare(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Sorts the samples and prints their average, 99th percentile and maximum */
+static void HEAP_BENCH_TimePrint(uint32_t* samples, uint32_t count)
+{
+    uint64_t total = 0U;
+    uint32_t i;
+
+    if (count == 0U)
+    {
+        printf(" %8s %8s %8s", "-", "-", "-");
+        return;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        total += samples[i];
+    }
+
+    qsort(samples, count, sizeof(samples[0]), HEAP_BENCH_Compare);
+
+    printf(" %8.1f %8u %8u", (double)total / (double)count,
+        (unsigned int)samples[(count * 99U) / 100U], (unsigned int)samples[count - 1U]);
+}
+
+/* Share of the free space that is outside the largest free block */
+static double HEAP_BENCH_FragmentationGet(const HeapStats_t* stats)
+{
+    double fragmentation = 0.0;
+
+    if (stats->xAvailableHeapSpaceInBytes != 0U)
+    {
+        fragmentation = 100.0 * (1.0 - ((double)stats->xSizeOfLargestFreeBlockInBytes /
+            (double)stats->xAvailableHeapSpaceInBytes));
+    }
+
+    return fragmentation;
+}
+
+static void HEAP_BENCH_FreeAll(uint32_t slots)
+{
+    uint32_t i;
+
+    for (i = 0U; i < slots; i++)
+    {
+        vPortFree(heapBenchBlock[i]);
+        heapBenchBlock[i] = NULL;
+    }
+}
+
+static bool HEAP_BENCH_Run(const HEAP_BENCH_WORKLOAD* workload, uint32_t ops,
+    uint32_t* mallocTime, uint32_t* freeTime)
+{
+    HeapStats_t stats;
+    uint32_t nMalloc = 0U;
+    uint32_t nFree = 0U;
+    uint32_t nFailed = 0U;
+    uint32_t nFailedFragmented = 0U;
+    uint32_t nSamples = 0U;
+    double fragmentationTotal = 0.0;
+    double fragmentationMax = 0.0;
+    double fragmentation;
+    size_t largestMin = configTOTAL_HEAP_SIZE;
+    uint64_t start;
+    uint32_t op;
+    uint32_t slot;
+    size_t size;
+
+    for (op = 0U; op < ops; op++)
+    {
+        slot = HEAP_BENCH_Random() % workload->slots;
+
+        if (heapBenchBlock[slot] != NULL)
+        {
+            start = HEAP_BENCH_TimeGet();
+            vPortFree(heapBenchBlock[slot]);
+            freeTime[nFree++] = (uint32_t)(HEAP_BENCH_TimeGet() - start);
+
+            heapBenchBlock[slot] = NULL;
+        }
+        else
+        {
+            size = HEAP_BENCH_SizeGet();
+
+            start = HEAP_BENCH_TimeGet();
+            heapBenchBlock[slot] = pvPortMalloc(size);
+            mallocTime[nMalloc++] = (uint32_t)(HEAP_BENCH_TimeGet() - start);
+
+            if (heapBenchBlock[slot] == NULL)
+            {
+                nFailed++;
+
+                /* Enough memory was free, but not in one block */
+                if (xPortGetFreeHeapSize() >= (size + 64U))
+                {
+                    nFailedFragmented++;
+                }
+            }
+        }
+
+        if ((op % HEAP_BENCH_SAMPLE_PERIOD) == 0U)
+        {
+            vPortGetHeapStats(&stats);
+            fragmentation = HEAP_BENCH_FragmentationGet(&stats);
+
+            fragmentationTotal += fragmentation;
+            nSamples++;
+
+            if (fragmentation > fragmentationMax)
+            {
+                fragmentationMax = fragmentation;
+            }
+
+            if (stats.xSizeOfLargestFreeBlockInBytes < largestMin)
+            {
+                largestMin = stats.xSizeOfLargestFreeBlockInBytes;
+            }
+        }
+    }
+
+    printf("HEAPBENCH %-9s %-8s", HEAP_BENCH_NAME, workload->name);
+    HEAP_BENCH_TimePrint(mallocTime, nMalloc);
+    HEAP_BENCH_TimePrint(freeTime, nFree);
+    printf("\n");
+
+    printf("HEAPFRAG  %-9s %-8s %7u %7u %8.1f %8.1f %8u\n", HEAP_BENCH_NAME, workload->name,
+        (unsigned int)nFailed, (unsigned int)nFailedFragmented,
+        fragmentationTotal / (double)nSamples, fragmentationMax, (unsigned int)largestMin);
+
+    HEAP_BENCH_FreeAll(workload->slots);
+
+    return true;
+}
+
+/* Fills every block with its own tag and checks the tag when the block is
+ * freed, so that overlapping blocks or a heap writing into an allocated
+ * block are detected */
+static bool HEAP_BENCH_Stress(const HEAP_BENCH_WORKLOAD* workload, uint32_t ops, size_t freeInitial)
+{
+    HeapStats_t stats;
+    uint8_t* block;
+    uint32_t op;
+    uint32_t slot;
+    size_t i;
+
+    for (op = 0U; op < ops; op++)
+    {
+        slot = HEAP_BENCH_Random() % workload->slots;
+        block = (uint8_t*)heapBenchBlock[slot];
+
+        if (block != NULL)
+        {
+            for (i = 0U; i < heapBenchSize[slot]; i++)
+            {
+                if (block[i] != heapBenchTag[slot])
+                {
+                    printf("HEAPSTRESS %s %s block %p overwritten at offset %u\n", HEAP_BENCH_NAME,
+                        workload->name, (void*)block, (unsigned int)i);
+                    return false;
+                }
+            }
+
+            vPortFree(block);
+            heapBenchBlock[slot] = NULL;
+        }
+        else
+        {
+            heapBenchSize[slot] = HEAP_BENCH_SizeGet();
+            block = (uint8_t*)pvPortMalloc(heapBenchSize[slot]);
+
+            if (block != NULL)
+            {
+                if (((uintptr_t)block & portBYTE_ALIGNMENT_MASK) != 0U)
+                {
+                    printf("HEAPSTRESS %s %s block %p is not aligned\n", HEAP_BENCH_NAME,
+                        workload->name, (void*)block);
+                    return false;
+                }
+
+                heapBenchTag[slot] = (uint8_t)HEAP_BENCH_Random();
+                (void)memset(block, heapBenchTag[slot], heapBenchSize[slot]);
+            }
+
+            heapBenchBlock[slot] = block;
+        }
+    }
+
+    HEAP_BENCH_FreeAll(workload->slots);
+
+    /* Everything must have merged back into the initial free block */
+    vPortGetHeapStats(&stats);
+
+    if ((stats.xAvailableHeapSpaceInBytes != freeInitial) || (stats.xNumberOfFreeBlocks != 1U) ||
+        (stats.xSizeOfLargestFreeBlockInBytes != freeInitial) ||
+        (stats.xNumberOfSuccessfulAllocations != stats.xNumberOfSuccessfulFrees))
+    {
+        printf("HEAPSTRESS %s %s heap not restored: free %u of %u in %u blocks, %u allocations %u frees\n",
+            HEAP_BENCH_NAME, workload->name, (unsigned int)stats.xAvailableHeapSpaceInBytes,
+            (unsigned int)freeInitial, (unsigned int)stats.xNumberOfFreeBlocks,
+            (unsigned int)stats.xNumberOfSuccessfulAllocations, (unsigned int)stats.xNumberOfSuccessfulFrees);
+        return false;
+    }
+
+    printf("HEAPSTRESS %s %s %u calls ok\n", HEAP_BENCH_NAME, workload->name, (unsigned int)ops);
+
+    return true;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Main Entry Point
+// *****************************************************************************
+// *****************************************************************************
+
+int main ( int argc, char* argv[] )
+{
+    uint32_t* mallocTime;
+    uint32_t* freeTime;
+    uint32_t ops = HEAP_BENCH_OPS;
+    bool isStress = false;
+    bool isSuccess = true;
+    size_t freeInitial;
+    uint32_t i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:s")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                ops = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 's':
+                isStress = true;
+                break;
+
+            default:
+                printf("usage: %s [-n calls] [-s]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    mallocTime = malloc(ops * sizeof(uint32_t));
+    freeTime = malloc(ops * sizeof(uint32_t));
+
+    if ((ops == 0U) || (mallocTime == NULL) || (freeTime == NULL))
+    {
+        printf("HEAPBENCH cannot run %u calls\n", (unsigned int)ops);
+        return EXIT_FAILURE;
+    }
+
+    /* The heap is set up by the first call */
+    vPortFree(pvPortMalloc(1U));
+    freeInitial = xPortGetFreeHeapSize();
+
+    if (isStress == false)
+    {
+        printf("HEAPBENCH heap      workload malloc_avg_ns   p99_ns   max_ns free_avg_ns  p99_ns   max_ns\n");
+        printf("HEAPFRAG  heap      workload  failed  no_fit avg_frag max_frag min_largest\n");
+    }
+
+    for (i = 0U; (i < (sizeof(heapBenchWorkloads) / sizeof(heapBenchWorkloads[0]))) && (isSuccess == true); i++)
+    {
+        heapBenchSeed = 0x2545F491U;
+
+        if (isStress == true)
+        {
+            isSuccess = HEAP_BENCH_Stress(&heapBenchWorkloads[i], ops, freeInitial);
+        }
+        else
+        {
+            isSuccess = HEAP_BENCH_Run(&heapBenchWorkloads[i], ops, mallocTime, freeTime);
+        }
+    }
+
+    free(mallocTime);
+    free(freeTime);
+
+    return (isSuccess == true) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,430 @@
+/*******************************************************************************
+  Main Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    main.c
+
+  Summary:
+    This file contains the "main" function of the File System host
+    simulation.
+
+  Description:
+    This file contains the "main" function of the File System host
+    simulation. It attaches a file backed media to the Media Manager, mounts
+    it and runs the block device benchmark on it. The FAT build formats the
+    media when it holds no file system. The MPFS build (HOST_SIM_MPFS) mounts
+    an existing MPFS2 image read only.
+ *******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "configuration.h"
+#include "system/fs/sys_fs.h"
+#include "system/fs/sys_fs_media_manager.h"
+#include "system/fs/sys_fs_bench.h"
+#include "driver/file_media/drv_file_media.h"
+#ifdef HOST_SIM_MPFS
+#include "system/fs/mpfs/mpfs.h"
+#else
+#include "system/fs/sys_fs_fat_interface.h"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define HOST_SIM_MOUNT_NAME             "/mnt/myDrive1"
+
+#ifdef HOST_SIM_MPFS
+#define HOST_SIM_DEVICE_NAME            "/dev/nvma1"
+#define HOST_SIM_FS_TYPE                MPFS2
+#define HOST_SIM_MEDIA_TYPE             SYS_FS_MEDIA_TYPE_NVM
+#define HOST_SIM_DEFAULT_PROFILE        DRV_FILE_MEDIA_PROFILE_EFC
+#define HOST_SIM_DEFAULT_SIZE           (0U)
+#else
+#define HOST_SIM_DEVICE_NAME            "/dev/mmcblka1"
+#define HOST_SIM_FS_TYPE                FAT
+#define HOST_SIM_MEDIA_TYPE             SYS_FS_MEDIA_TYPE_SD_CARD
+#define HOST_SIM_DEFAULT_PROFILE        DRV_FILE_MEDIA_PROFILE_SD
+#define HOST_SIM_DEFAULT_SIZE           (16U * 1024U * 1024U)
+#endif
+
+/* Sectors per request of the benchmark */
+#define HOST_SIM_BENCH_SEQ_SECTORS      (64U)
+#define HOST_SIM_BENCH_RAND_SECTORS     (8U)
+
+/* Number of task calls after which the media is considered missing */
+#define HOST_SIM_ATTACH_RETRIES         (1000000U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File System Initialization Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Referenced by the Media Manager for auto mount, which is disabled */
+const SYS_FS_MEDIA_MOUNT_DATA sysfsMountTable[SYS_FS_VOLUME_NUMBER] =
+{
+    {NULL}
+};
+
+#ifdef HOST_SIM_MPFS
+static const SYS_FS_FUNCTIONS MPFSFunctions =
+{
+    .mount             = MPFS_Mount,
+    .unmount           = MPFS_Unmount,
+    .open              = MPFS_Open,
+    .read_t            = MPFS_Read,
+    .close             = MPFS_Close,
+    .seek              = MPFS_Seek,
+    .fstat             = MPFS_Stat,
+    .tell              = MPFS_GetPosition,
+    .eof               = MPFS_EOF,
+    .size              = MPFS_GetSize,
+    .openDir           = MPFS_DirOpen,
+    .readDir           = MPFS_DirRead,
+    .closeDir          = MPFS_DirClose,
+    .getlabel          = NULL,
+    .currWD            = NULL,
+    .getstrn           = NULL,
+    .write_t           = NULL,
+    .mkdir             = NULL,
+    .chdir             = NULL,
+    .remove_t          = NULL,
+    .setlabel          = NULL,
+    .truncate          = NULL,
+    .chdrive           = NULL,
+    .chmode            = NULL,
+    .chtime            = NULL,
+    .rename_t          = NULL,
+    .sync              = NULL,
+    .putchr            = NULL,
+    .putstrn           = NULL,
+    .formattedprint    = NULL,
+    .testerror         = NULL,
+    .formatDisk        = NULL,
+    .partitionDisk     = NULL,
+    .getCluster        = NULL
+};
+
+static const SYS_FS_REGISTRATION_TABLE sysFSInit [ SYS_FS_MAX_FILE_SYSTEM_TYPE ] =
+{
+    {
+        .nativeFileSystemType = MPFS2,
+        .nativeFileSystemFunctions = &MPFSFunctions
+    }
+};
+#else
+static const SYS_FS_FUNCTIONS FatFsFunctions =
+{
+    .mount             = FATFS_mount,
+    .unmount           = FATFS_unmount,
+    .open              = FATFS_open,
+    .read_t            = FATFS_read,
+    .close             = FATFS_close,
+    .seek              = FATFS_lseek,
+    .fstat             = FATFS_stat,
+    .getlabel          = FATFS_getlabel,
+    .currWD            = FATFS_getcwd,
+    .getstrn           = FATFS_gets,
+    .openDir           = FATFS_opendir,
+    .readDir           = FATFS_readdir,
+    .closeDir          = FATFS_closedir,
+    .chdir             = FATFS_chdir,
+    .chdrive           = FATFS_chdrive,
+    .write_t           = FATFS_write,
+    .tell              = FATFS_tell,
+    .eof               = FATFS_eof,
+    .size              = FATFS_size,
+    .mkdir             = FATFS_mkdir,
+    .remove_t          = FATFS_unlink,
+    .setlabel          = FATFS_setlabel,
+    .truncate          = FATFS_truncate,
+    .chmode            = FATFS_chmod,
+    .chtime            = FATFS_utime,
+    .rename_t          = FATFS_rename,
+    .sync              = FATFS_sync,
+    .putchr            = FATFS_putc,
+    .putstrn           = FATFS_puts,
+    .formattedprint    = FATFS_printf,
+    .testerror         = FATFS_error,
+    .formatDisk        = (FORMAT_DISK)FATFS_mkfs,
+    .partitionDisk     = FATFS_fdisk,
+    .getCluster        = FATFS_getclusters
+};
+
+static const SYS_FS_REGISTRATION_TABLE sysFSInit [ SYS_FS_MAX_FILE_SYSTEM_TYPE ] =
+{
+    {
+        .nativeFileSystemType = FAT,
+        .nativeFileSystemFunctions = &FatFsFunctions
+    }
+};
+
+static uint8_t CACHE_ALIGN work[SYS_FS_FAT_MAX_SS];
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Benchmark Data
+// *****************************************************************************
+// *****************************************************************************
+
+static uint8_t CACHE_ALIGN benchBuffer[HOST_SIM_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE];
+static uint8_t CACHE_ALIGN benchSaveBuffer[HOST_SIM_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void lHOST_SIM_Usage(const char* name)
+{
+    printf("usage: %s [-p sd|nor|efc] [-f image] [-s bytes] [-l percent] [-n]\n"
+           "  -p  media model (default %s)\n"
+           "  -f  image file (default media.img)\n"
+           "  -s  media size in bytes, 0 keeps the size of an existing image\n"
+           "  -l  latency scale in percent, 0 disables the latency model (default 100)\n"
+           "  -n  read only benchmark\n",
+           name, (HOST_SIM_DEFAULT_PROFILE == DRV_FILE_MEDIA_PROFILE_SD) ? "sd" : "efc");
+}
+
+static bool lHOST_SIM_ProfileParse(const char* name, DRV_FILE_MEDIA_PROFILE* profile)
+{
+    static const char* const profileNames[DRV_FILE_MEDIA_PROFILE_MAX] = {"sd", "nor", "efc"};
+    uint32_t i;
+
+    for (i = 0; i < (uint32_t)DRV_FILE_MEDIA_PROFILE_MAX; i++)
+    {
+        if (strcmp(name, profileNames[i]) == 0)
+        {
+            *profile = (DRV_FILE_MEDIA_PROFILE)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Runs the File System tasks until the mount succeeds or fails for a reason
+ * other than the media not being attached yet */
+static SYS_FS_RESULT lHOST_SIM_Mount(void)
+{
+    uint32_t retries = HOST_SIM_ATTACH_RETRIES;
+
+    while (SYS_FS_Mount(HOST_SIM_DEVICE_NAME, HOST_SIM_MOUNT_NAME, HOST_SIM_FS_TYPE, 0, NULL) != SYS_FS_RES_SUCCESS)
+    {
+        if ((SYS_FS_Error() != SYS_FS_ERROR_NOT_READY) || (retries == 0U))
+        {
+            return SYS_FS_RES_FAILURE;
+        }
+
+        retries--;
+
+        SYS_FS_Tasks();
+    }
+
+    return SYS_FS_RES_SUCCESS;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Main Entry Point
+// *****************************************************************************
+// *****************************************************************************
+
+int main ( int argc, char* argv[] )
+{
+    DRV_FILE_MEDIA_INIT fileMediaInit;
+    DRV_FILE_MEDIA_PROFILE profile = HOST_SIM_DEFAULT_PROFILE;
+    DRV_FILE_MEDIA_STATS stats;
+    SYS_FS_BENCH_CONFIG benchConfig;
+    SYS_MODULE_OBJ fileMediaObj;
+    uint32_t numSectors;
+    bool readOnly = false;
+    bool result;
+    int option;
+
+    (void) memset(&fileMediaInit, 0, sizeof(fileMediaInit));
+
+    fileMediaInit.imagePath    = "media.img";
+    fileMediaInit.mediaSize    = HOST_SIM_DEFAULT_SIZE;
+    fileMediaInit.latencyScale = 100;
+    fileMediaInit.mediaType    = HOST_SIM_MEDIA_TYPE;
+
+    while ((option = getopt(argc, argv, "p:f:s:l:nh")) != -1)
+    {
+        switch (option)
+        {
+            case 'p':
+            {
+                if (lHOST_SIM_ProfileParse(optarg, &profile) == false)
+                {
+                    lHOST_SIM_Usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            }
+
+            case 'f':
+                fileMediaInit.imagePath = optarg;
+                break;
+
+            case 's':
+                fileMediaInit.mediaSize = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'l':
+                fileMediaInit.latencyScale = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'n':
+                readOnly = true;
+                break;
+
+            default:
+                lHOST_SIM_Usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    fileMediaInit.model = *DRV_FILE_MEDIA_ModelGet(profile);
+
+    /* The File System must be initialized before the driver registers its
+     * media with the Media Manager */
+    (void) SYS_FS_Initialize((const void *)sysFSInit);
+
+    fileMediaObj = DRV_FILE_MEDIA_Initialize(DRV_FILE_MEDIA_INDEX_0, (const SYS_MODULE_INIT *)&fileMediaInit);
+
+    if (fileMediaObj == SYS_MODULE_OBJ_INVALID)
+    {
+        printf("Could not open the media image %s\n", fileMediaInit.imagePath);
+        return EXIT_FAILURE;
+    }
+
+    if (lHOST_SIM_Mount() != SYS_FS_RES_SUCCESS)
+    {
+        printf("Could not mount %s\n", fileMediaInit.imagePath);
+        DRV_FILE_MEDIA_Deinitialize(fileMediaObj);
+        return EXIT_FAILURE;
+    }
+
+#ifndef HOST_SIM_MPFS
+    /* Check If Mount was successful with no file system on media */
+    if (SYS_FS_Error() == SYS_FS_ERROR_NO_FILESYSTEM)
+    {
+        SYS_FS_FORMAT_PARAM formatOpt;
+
+        printf("Formatting %s\n", fileMediaInit.imagePath);
+
+        (void) memset(&formatOpt, 0, sizeof(formatOpt));
+        formatOpt.fmt     = SYS_FS_FORMAT_FAT;
+        formatOpt.au_size = 0;
+
+        if (SYS_FS_DriveFormat(HOST_SIM_MOUNT_NAME, &formatOpt, (void *)work, SYS_FS_FAT_MAX_SS) != SYS_FS_RES_SUCCESS)
+        {
+            printf("Could not format %s\n", fileMediaInit.imagePath);
+            DRV_FILE_MEDIA_Deinitialize(fileMediaObj);
+            return EXIT_FAILURE;
+        }
+    }
+#endif
+
+    (void) memset(&benchConfig, 0, sizeof(benchConfig));
+
+    benchConfig.diskNum      = 0;
+    benchConfig.startSector  = 0;
+    benchConfig.numSectors   = 0;
+    benchConfig.seqSectors   = HOST_SIM_BENCH_SEQ_SECTORS;
+    benchConfig.seqRequests  = 256;
+    benchConfig.randSectors  = HOST_SIM_BENCH_RAND_SECTORS;
+    benchConfig.randRequests = 1000;
+    benchConfig.seed         = 0x5EED1234U;
+    benchConfig.buffer       = benchBuffer;
+    benchConfig.saveBuffer   = benchSaveBuffer;
+
+    /* Small media such as an MPFS2 image may hold less than one request */
+    numSectors = SYS_FS_BENCH_SectorCountGet(benchConfig.diskNum);
+
+    if (benchConfig.seqSectors > numSectors)
+    {
+        benchConfig.seqSectors = numSectors;
+    }
+
+    if (benchConfig.randSectors > numSectors)
+    {
+        benchConfig.randSectors = numSectors;
+    }
+
+#ifdef HOST_SIM_MPFS
+    /* MPFS2 is read only */
+    (void) readOnly;
+#else
+    benchConfig.writeEnable  = !readOnly;
+    benchConfig.preserveData = true;
+    benchConfig.fileDir      = (readOnly == true) ? NULL : HOST_SIM_MOUNT_NAME;
+    benchConfig.numFiles     = 32;
+    benchConfig.fileSize     = 512;
+#endif
+
+    result = SYS_FS_BENCH_Run(&benchConfig, NULL);
+
+    DRV_FILE_MEDIA_StatsGet(fileMediaObj, &stats);
+
+    printf("FILEMEDIA reads=%u writes=%u erases=%u bytes_read=%llu bytes_written=%llu blocks_erased=%llu busy_us=%llu\n",
+           (unsigned int)stats.readRequests, (unsigned int)stats.writeRequests, (unsigned int)stats.eraseRequests,
+           (unsigned long long)stats.bytesRead, (unsigned long long)stats.bytesWritten,
+           (unsigned long long)stats.blocksErased, (unsigned long long)stats.busyUs);
+
+    (void) SYS_FS_Unmount(HOST_SIM_MOUNT_NAME);
+
+    DRV_FILE_MEDIA_Deinitialize(fileMediaObj);
+
+    return (result == true) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+/*******************************************************************************
+ End of File
+*/
@@ -52,8 +52,10 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <stdio.h>
 #include <string.h>
 #include "app.h"
+#include "system/fs/sys_fs_bench.h"
 
 /* This application showcases the File operations with NVM as the media. To
  * begin with the file system image contains a file called "FILE.TXT" with
@@ -92,6 +94,17 @@
 #define WRITE_DATA_SIZE         13
 #define ORIG_DATA_SIZE          4
 
+/* Run the block device benchmark on the NVM once the demo has
+ * completed. The write tests restore the overwritten sectors, the file system
+ * is left intact unless power is lost while the benchmark runs. */
+#define APP_FS_BENCH_ENABLE         true
+
+/* Sectors per request of the benchmark. The first half of the benchmark
+ * buffer holds the request data, the second half the sectors saved for
+ * restore. */
+#define APP_FS_BENCH_SEQ_SECTORS    (8U)
+#define APP_FS_BENCH_RAND_SECTORS   (1U)
+
 /* This is the string that will written to the file */
 const uint8_t writeData[WRITE_DATA_SIZE] = "Hello World";
 
@@ -116,6 +129,30 @@ const uint8_t originalData[ORIG_DATA_SIZE] = "Data";
 
 APP_DATA appData;
 
+static uint8_t CACHE_ALIGN fsBenchBuffer[2U * APP_FS_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE];
+
+/* Results of the last benchmark run, also printed when the run completes */
+static SYS_FS_BENCH_RESULT fsBenchResults[SYS_FS_BENCH_TEST_MAX];
+
+static const SYS_FS_BENCH_CONFIG fsBenchConfig =
+{
+    .diskNum        = 0,
+    .startSector    = 0,
+    .numSectors     = 0,
+    .seqSectors     = APP_FS_BENCH_SEQ_SECTORS,
+    .seqRequests    = 32,
+    .randSectors    = APP_FS_BENCH_RAND_SECTORS,
+    .randRequests   = 128,
+    .seed           = 0x5EED1234U,
+    .writeEnable    = true,
+    .preserveData   = true,
+    .buffer         = &fsBenchBuffer[0],
+    .saveBuffer     = &fsBenchBuffer[APP_FS_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE],
+    .fileDir        = APP_MOUNT_NAME,
+    .numFiles       = 8,
+    .fileSize       = 512
+};
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -389,8 +426,8 @@ void APP_Tasks ( void )
                 }
                 else
                 {
-                    /* The test was successful. Lets idle. */
-                    appData.state = APP_IDLE;
+                    /* The test was successful. Run the benchmark. */
+                    appData.state = APP_FS_BENCH;
                 }
 
                 SYS_FS_FileClose(appData.fileHandle);
@@ -398,6 +435,22 @@ void APP_Tasks ( void )
             break;
         }
 
+        case APP_FS_BENCH:
+        {
+            appData.state = APP_IDLE;
+
+            if (APP_FS_BENCH_ENABLE)
+            {
+                printf("\n\n\r Running block device benchmark\n\r");
+
+                if (SYS_FS_BENCH_Run(&fsBenchConfig, fsBenchResults) == false)
+                {
+                    appData.state = APP_ERROR;
+                }
+            }
+            break;
+        }
+
         case APP_IDLE:
         {
             /* The application comes here when the demo has completed
@@ -128,6 +128,9 @@ typedef enum
     /* The app reads and verifies the write */
     APP_READ_VERIFY_FILE,
 
+    /* The app runs the block device benchmark */
+    APP_FS_BENCH,
+
     /* The app closes the file and idles */
     APP_IDLE,
 
@@ -101,6 +101,12 @@ extern "C" {
 #define SYS_FS_FAT_MAX_SS                 SYS_FS_MEDIA_MAX_BLOCK_SIZE
 #define SYS_FS_FAT_ALIGNED_BUFFER_LEN     512
 
+/* File System Block Device Benchmark Configuration */
+#define SYS_FS_BENCH_HISTOGRAM_BINS       (20U)
+#define SYS_FS_BENCH_USE_CYCLE_COUNTER    true
+#define SYS_FS_BENCH_CPU_CLOCK_FREQUENCY  (300000000U)
+#define SYS_FS_BENCH_PRINT(fmt, ...)      printf(fmt, ##__VA_ARGS__)
+
 
 
 
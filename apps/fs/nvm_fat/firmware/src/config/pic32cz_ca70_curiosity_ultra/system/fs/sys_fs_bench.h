@@ -0,0 +1,463 @@
+/*************************************************************************
+File System Service Block Device Benchmark Interface Declarations and Types
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_fs_bench.h
+
+  Summary:
+    File System block device benchmark interface declarations and types.
+
+  Description:
+    This file contains function and type declarations of a media agnostic
+    benchmark which measures the sequential and random read/write IOPS,
+    request latency and small file create/delete rates of any media
+    registered with the File System Media Manager.
+  *************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_FS_BENCH_H_
+#define SYS_FS_BENCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+#include "system/fs/sys_fs.h"
+#include "system/fs/sys_fs_media_manager.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Build Parameters
+// *****************************************************************************
+// *****************************************************************************
+
+/* Size of a sector as seen by the benchmark and the Media Manager */
+#define SYS_FS_BENCH_SECTOR_SIZE            (512U)
+
+/* Number of latency histogram bins. Bin 0 counts the requests that completed
+ * in less than 2 microseconds, bin n counts the requests that completed in
+ * [2^n, 2^(n+1)) microseconds and the last bin counts everything slower. */
+#ifndef SYS_FS_BENCH_HISTOGRAM_BINS
+    #define SYS_FS_BENCH_HISTOGRAM_BINS     (20U)
+#endif
+
+/* Maximum length of the path of a file created by the small file test */
+#ifndef SYS_FS_BENCH_PATH_LEN
+    #define SYS_FS_BENCH_PATH_LEN           (64U)
+#endif
+
+/* Time source of the benchmark. By default the requests are timed with the
+ * Timer System Service. Configurations without SYS_TIME set this to true to
+ * time them with the DWT cycle counter of the Cortex-M core instead, which
+ * runs at SYS_FS_BENCH_CPU_CLOCK_FREQUENCY. */
+#ifndef SYS_FS_BENCH_USE_CYCLE_COUNTER
+    #define SYS_FS_BENCH_USE_CYCLE_COUNTER  false
+#endif
+
+/* Core clock frequency in Hz, used only with SYS_FS_BENCH_USE_CYCLE_COUNTER */
+#ifndef SYS_FS_BENCH_CPU_CLOCK_FREQUENCY
+    #define SYS_FS_BENCH_CPU_CLOCK_FREQUENCY    (300000000U)
+#endif
+
+/* Output of the benchmark results. Defaults to the system console, can be
+ * redirected (for example to printf) from configuration.h. */
+#ifndef SYS_FS_BENCH_PRINT
+    #include "system/debug/sys_debug.h"
+    #define SYS_FS_BENCH_PRINT(fmt, ...)    SYS_CONSOLE_PRINT(fmt, ##__VA_ARGS__)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* SYS FS Benchmark Tests
+
+  Summary:
+    Identifies the tests run by the benchmark.
+
+  Description:
+    This enumeration identifies the tests run by the benchmark. The name of
+    each test in the benchmark output is given in the comment.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* "seq_read": sequential multi-sector reads */
+    SYS_FS_BENCH_TEST_SEQ_READ = 0,
+
+    /* "seq_write": sequential multi-sector writes */
+    SYS_FS_BENCH_TEST_SEQ_WRITE,
+
+    /* "rand_read": reads at random request aligned offsets */
+    SYS_FS_BENCH_TEST_RAND_READ,
+
+    /* "rand_write": writes at random request aligned offsets */
+    SYS_FS_BENCH_TEST_RAND_WRITE,
+
+    /* "file_create": open, write and close of small files */
+    SYS_FS_BENCH_TEST_FILE_CREATE,
+
+    /* "file_delete": removal of the files created by file_create */
+    SYS_FS_BENCH_TEST_FILE_DELETE,
+
+    SYS_FS_BENCH_TEST_MAX
+
+} SYS_FS_BENCH_TEST;
+
+// *****************************************************************************
+/* SYS FS Benchmark Test Status
+
+  Summary:
+    Result status of a benchmark test.
+
+  Description:
+    This enumeration identifies the status of a benchmark test.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* Test was not run because it is disabled by the configuration */
+    SYS_FS_BENCH_STATUS_SKIPPED = 0,
+
+    /* Test ran to completion */
+    SYS_FS_BENCH_STATUS_OK,
+
+    /* Test was aborted by a failed request */
+    SYS_FS_BENCH_STATUS_ERROR
+
+} SYS_FS_BENCH_STATUS;
+
+// *****************************************************************************
+/* SYS FS Benchmark Configuration
+
+  Summary:
+    Parameters of a benchmark run.
+
+  Description:
+    This structure holds the parameters of a benchmark run. The block tests
+    are restricted to the sector region [startSector, startSector + numSectors)
+    of the disk.
+
+  Remarks:
+    The write tests overwrite the sectors of the region. Unless preserveData is
+    set, a file system on the region is corrupted by the write tests.
+*/
+
+typedef struct
+{
+    /* Media Manager disk number of the media under test */
+    uint16_t diskNum;
+
+    /* First sector of the test region */
+    uint32_t startSector;
+
+    /* Number of sectors of the test region. 0 extends the region up to the
+     * end of the media. */
+    uint32_t numSectors;
+
+    /* Sectors per request and number of requests of the sequential tests */
+    uint32_t seqSectors;
+    uint32_t seqRequests;
+
+    /* Sectors per request and number of requests of the random tests */
+    uint32_t randSectors;
+    uint32_t randRequests;
+
+    /* Seed of the random offset generator. Identical seeds produce identical
+     * random access patterns. */
+    uint32_t seed;
+
+    /* Run the sequential and random write tests */
+    bool writeEnable;
+
+    /* Save the sectors overwritten by each write request and restore them
+     * after the request. The save and restore are not part of the measured
+     * latency. Requires saveBuffer. */
+    bool preserveData;
+
+    /* Cache aligned buffer of at least max(seqSectors, randSectors) sectors.
+     * Also holds the data written to each file by the small file test. */
+    uint8_t* buffer;
+
+    /* Cache aligned buffer of the same size as buffer. Used only when
+     * preserveData is set. */
+    uint8_t* saveBuffer;
+
+    /* Directory of a mounted volume in which the small file test creates its
+     * files. NULL skips the small file test. */
+    const char* fileDir;
+
+    /* Number of files and bytes written to each file by the small file test.
+     * fileSize must not exceed the size of buffer. */
+    uint32_t numFiles;
+    uint32_t fileSize;
+
+} SYS_FS_BENCH_CONFIG;
+
+// *****************************************************************************
+/* SYS FS Benchmark Result
+
+  Summary:
+    Measurements of a benchmark test.
+
+  Description:
+    This structure holds the measurements of a benchmark test. The elapsed
+    time is the sum of the latencies of the measured requests. Times are kept
+    in counts of the time source (SYS_TIME or the cycle counter, see
+    SYS_FS_BENCH_USE_CYCLE_COUNTER) and only converted to microseconds by
+    SYS_FS_BENCH_ResultPrint, so that requests shorter than a microsecond are
+    still accounted for.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    SYS_FS_BENCH_TEST test;
+
+    SYS_FS_BENCH_STATUS status;
+
+    /* Number of completed requests */
+    uint32_t requests;
+
+    /* Number of bytes transferred by the completed requests */
+    uint64_t bytes;
+
+    /* Sum of the request latencies in counts of the time source */
+    uint64_t elapsedCount;
+
+    /* Minimum and maximum request latency in counts of the time source */
+    uint64_t latencyMinCount;
+    uint64_t latencyMaxCount;
+
+    /* Request latency histogram, see SYS_FS_BENCH_HISTOGRAM_BINS */
+    uint32_t histogram[SYS_FS_BENCH_HISTOGRAM_BINS];
+
+} SYS_FS_BENCH_RESULT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+//*****************************************************************************
+/* Function:
+    uint32_t SYS_FS_BENCH_SectorCountGet
+    (
+        uint16_t diskNum
+    );
+
+  Summary:
+    Returns the number of sectors of a disk.
+
+  Description:
+    This function returns the size of the media attached to the disk in
+    sectors of SYS_FS_BENCH_SECTOR_SIZE bytes.
+
+  Precondition:
+    The media must be attached to the Media Manager.
+
+  Parameters:
+    diskNum - Media Manager disk number.
+
+  Returns:
+    Number of sectors of the disk. 0 if no media is attached.
+
+  Remarks:
+    None.
+*/
+
+uint32_t SYS_FS_BENCH_SectorCountGet
+(
+    uint16_t diskNum
+);
+
+//*****************************************************************************
+/* Function:
+    SYS_FS_BENCH_STATUS SYS_FS_BENCH_TestRun
+    (
+        const SYS_FS_BENCH_CONFIG* config,
+        SYS_FS_BENCH_TEST test,
+        SYS_FS_BENCH_RESULT* result
+    );
+
+  Summary:
+    Runs a single benchmark test.
+
+  Description:
+    This function runs a benchmark test to completion and stores its
+    measurements in result. Each request is submitted through the Media
+    Manager and waited upon by running the media transfer task, the same way
+    the FAT disk I/O layer waits for its requests.
+
+  Precondition:
+    The media must be attached to the Media Manager. No other client may
+    access the disk while the test runs.
+
+  Parameters:
+    config - Benchmark parameters.
+
+    test - Test to be run.
+
+    result - Storage for the measurements.
+
+  Returns:
+    Status of the test. Also stored in result.
+
+  Example:
+    <code>
+    SYS_FS_BENCH_RESULT result;
+
+    if (SYS_FS_BENCH_TestRun(&config, SYS_FS_BENCH_TEST_RAND_READ, &result) == SYS_FS_BENCH_STATUS_OK)
+    {
+        SYS_FS_BENCH_ResultPrint(&config, &result);
+    }
+    </code>
+
+  Remarks:
+    SYS_FS_BENCH_TEST_FILE_DELETE removes the files created by a previous
+    run of SYS_FS_BENCH_TEST_FILE_CREATE.
+*/
+
+SYS_FS_BENCH_STATUS SYS_FS_BENCH_TestRun
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    SYS_FS_BENCH_TEST test,
+    SYS_FS_BENCH_RESULT* result
+);
+
+//*****************************************************************************
+/* Function:
+    bool SYS_FS_BENCH_Run
+    (
+        const SYS_FS_BENCH_CONFIG* config,
+        SYS_FS_BENCH_RESULT* results
+    );
+
+  Summary:
+    Runs and reports all the benchmark tests.
+
+  Description:
+    This function runs every test enabled by the configuration in the order
+    of SYS_FS_BENCH_TEST and prints the result of each test.
+
+  Precondition:
+    See SYS_FS_BENCH_TestRun.
+
+  Parameters:
+    config - Benchmark parameters.
+
+    results - Array of SYS_FS_BENCH_TEST_MAX results, indexed by test. May be
+              NULL if the caller only needs the printed report.
+
+  Returns:
+    true - No test failed.
+
+    false - At least one test failed.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_FS_BENCH_Run
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    SYS_FS_BENCH_RESULT* results
+);
+
+//*****************************************************************************
+/* Function:
+    void SYS_FS_BENCH_ResultPrint
+    (
+        const SYS_FS_BENCH_CONFIG* config,
+        const SYS_FS_BENCH_RESULT* result
+    );
+
+  Summary:
+    Prints a benchmark result.
+
+  Description:
+    This function prints a result through SYS_FS_BENCH_PRINT as two lines of
+    space separated key=value pairs:
+
+    <code>
+    FSBENCH test=rand_read disk=0 status=ok req=1000 sectors=8 bytes=4096000 us=812345 iops=1231 kbps=4923 lat_min_us=701 lat_avg_us=812 lat_max_us=2210
+    FSBENCH_HIST test=rand_read bins=20 h=0,0,0,0,0,0,0,0,0,996,4,0,0,0,0,0,0,0,0,0
+    </code>
+
+    sectors is the number of sectors per request of the block tests and 0 for
+    the file tests.
+
+  Precondition:
+    None.
+
+  Parameters:
+    config - Benchmark parameters of the run.
+
+    result - Result to be printed.
+
+  Returns:
+    None.
+
+  Remarks:
+    Skipped tests print only the FSBENCH line, with status=skipped.
+*/
+
+void SYS_FS_BENCH_ResultPrint
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    const SYS_FS_BENCH_RESULT* result
+);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif /* SYS_FS_BENCH_H_ */
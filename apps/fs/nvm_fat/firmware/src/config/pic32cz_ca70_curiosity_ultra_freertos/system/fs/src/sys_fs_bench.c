@@ -0,0 +1,605 @@
+/*******************************************************************************
+  File System Block Device Benchmark Implementation.
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_fs_bench.c
+
+  Summary:
+    This file contains implementation of the SYS FS block device benchmark.
+
+  Description:
+    This file contains implementation of the SYS FS block device benchmark.
+    The benchmark only depends on the Media Manager, the SYS FS file API and
+    SYS_TIME (or the DWT cycle counter), so that it can be built for the
+    target as well as for a host against a simulated media driver.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+#include <stdio.h>
+#include <string.h>
+#include "system/fs/sys_fs_bench.h"
+#if (SYS_FS_BENCH_USE_CYCLE_COUNTER == true)
+#include "device.h"
+#else
+#include "system/time/sys_time.h"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Names of the tests in the benchmark output */
+static const char* const gSysFsBenchTestName[SYS_FS_BENCH_TEST_MAX] =
+{
+    "seq_read",
+    "seq_write",
+    "rand_read",
+    "rand_write",
+    "file_create",
+    "file_delete"
+};
+
+static const char* const gSysFsBenchStatusName[] =
+{
+    "skipped",
+    "ok",
+    "error"
+};
+
+#if (SYS_FS_BENCH_USE_CYCLE_COUNTER == true)
+/* 64 bit extension of the 32 bit cycle counter */
+static uint64_t gSysFsBenchCycles;
+static uint32_t gSysFsBenchCyclesLast;
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (SYS_FS_BENCH_USE_CYCLE_COUNTER == true)
+static void lSYS_FS_BENCH_CounterStart(void)
+{
+    /* Enable the trace unit, unlock the DWT and start the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    gSysFsBenchCyclesLast = DWT->CYCCNT;
+}
+
+/* The counter is read at least once per request, so it is extended to 64
+ * bits as long as no request takes more than 2^32 cycles (14 s at 300 MHz) */
+static uint64_t lSYS_FS_BENCH_CounterGet(void)
+{
+    uint32_t cycles = DWT->CYCCNT;
+
+    gSysFsBenchCycles += (uint64_t)(cycles - gSysFsBenchCyclesLast);
+    gSysFsBenchCyclesLast = cycles;
+
+    return gSysFsBenchCycles;
+}
+
+static uint64_t lSYS_FS_BENCH_FrequencyGet(void)
+{
+    return (uint64_t)SYS_FS_BENCH_CPU_CLOCK_FREQUENCY;
+}
+#else
+static void lSYS_FS_BENCH_CounterStart(void)
+{
+    /* SYS_TIME is running already */
+}
+
+static uint64_t lSYS_FS_BENCH_CounterGet(void)
+{
+    return SYS_TIME_Counter64Get();
+}
+
+static uint64_t lSYS_FS_BENCH_FrequencyGet(void)
+{
+    return (uint64_t)SYS_TIME_FrequencyGet();
+}
+#endif
+
+/* Converts counts of the time source to microseconds. The whole seconds are
+ * converted apart so that long runs do not overflow the multiplication. */
+static uint64_t lSYS_FS_BENCH_CountToUs(uint64_t count)
+{
+    uint64_t frequency = lSYS_FS_BENCH_FrequencyGet();
+
+    if (frequency == 0U)
+    {
+        return 0U;
+    }
+
+    return (((count / frequency) * 1000000ULL) + (((count % frequency) * 1000000ULL) / frequency));
+}
+
+/* Returns value * scale / count, saturated to 32 bits. 0 if count is 0. */
+static uint32_t lSYS_FS_BENCH_Rate(uint64_t value, uint64_t scale, uint64_t count)
+{
+    uint64_t rate;
+
+    if (count == 0U)
+    {
+        return 0U;
+    }
+
+    /* Scales are clock frequencies, value * scale fits in 64 bits for
+     * any value below 2^32, larger values are divided first */
+    if (value < 0x100000000ULL)
+    {
+        rate = (value * scale) / count;
+    }
+    else
+    {
+        rate = (value / count) * scale;
+    }
+
+    return (rate > UINT32_MAX) ? UINT32_MAX : (uint32_t)rate;
+}
+
+/* xorshift32 generator. Keeps the random access pattern reproducible for a
+ * given seed, independent of the C library. */
+static uint32_t lSYS_FS_BENCH_Random(uint32_t* state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+
+    *state = x;
+
+    return x;
+}
+
+static void lSYS_FS_BENCH_ResultReset(SYS_FS_BENCH_RESULT* result, SYS_FS_BENCH_TEST test)
+{
+    (void) memset(result, 0, sizeof(SYS_FS_BENCH_RESULT));
+
+    result->test         = test;
+    result->status       = SYS_FS_BENCH_STATUS_SKIPPED;
+    result->latencyMinCount = UINT64_MAX;
+}
+
+/* Adds a request to the result. The latency is kept in counts, it is
+ * only converted to microseconds for the histogram bin. Summing microseconds
+ * would drop every request that completes in less than one. */
+static void lSYS_FS_BENCH_LatencyAdd(SYS_FS_BENCH_RESULT* result, uint64_t startCount, uint32_t nBytes)
+{
+    uint64_t latencyCount = lSYS_FS_BENCH_CounterGet() - startCount;
+    uint64_t latencyUs = lSYS_FS_BENCH_CountToUs(latencyCount);
+    uint32_t bin = 0;
+
+    while (((latencyUs >> (bin + 1U)) != 0U) && (bin < (SYS_FS_BENCH_HISTOGRAM_BINS - 1U)))
+    {
+        bin++;
+    }
+
+    result->histogram[bin]++;
+    result->requests++;
+    result->bytes        += nBytes;
+    result->elapsedCount += latencyCount;
+
+    if (latencyCount < result->latencyMinCount)
+    {
+        result->latencyMinCount = latencyCount;
+    }
+
+    if (latencyCount > result->latencyMaxCount)
+    {
+        result->latencyMaxCount = latencyCount;
+    }
+}
+
+/* Waits for a Media Manager request by running the media transfer task, the
+ * same way disk_checkCommandStatus() in diskio.c does. The status is polled
+ * instead of using a transfer handler as the handler is owned by diskio.c. */
+static bool lSYS_FS_BENCH_Wait(uint16_t diskNum, SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle)
+{
+    SYS_FS_MEDIA_COMMAND_STATUS status;
+
+    if (commandHandle == SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+    do
+    {
+        SYS_FS_MEDIA_MANAGER_TransferTask((uint8_t)diskNum);
+
+        status = SYS_FS_MEDIA_MANAGER_CommandStatusGet(diskNum, commandHandle);
+
+    } while ((status == SYS_FS_MEDIA_COMMAND_QUEUED) || (status == SYS_FS_MEDIA_COMMAND_IN_PROGRESS));
+
+    return (status == SYS_FS_MEDIA_COMMAND_COMPLETED);
+}
+
+static bool lSYS_FS_BENCH_SectorRead(uint16_t diskNum, uint8_t* buffer, uint32_t sector, uint32_t numSectors)
+{
+    return lSYS_FS_BENCH_Wait(diskNum, SYS_FS_MEDIA_MANAGER_SectorRead(diskNum, buffer, sector, numSectors));
+}
+
+static bool lSYS_FS_BENCH_SectorWrite(uint16_t diskNum, uint8_t* buffer, uint32_t sector, uint32_t numSectors)
+{
+    return lSYS_FS_BENCH_Wait(diskNum, SYS_FS_MEDIA_MANAGER_SectorWrite(diskNum, sector, buffer, numSectors));
+}
+
+/* Submits one measured block request. For writes with preserveData set the
+ * overwritten sectors are saved before and restored after the measurement. */
+static bool lSYS_FS_BENCH_BlockRequest
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    bool isWrite,
+    uint32_t sector,
+    uint32_t numSectors,
+    SYS_FS_BENCH_RESULT* result
+)
+{
+    uint64_t startCount;
+    bool status;
+
+    if (isWrite == false)
+    {
+        startCount = lSYS_FS_BENCH_CounterGet();
+
+        status = lSYS_FS_BENCH_SectorRead(config->diskNum, config->buffer, sector, numSectors);
+    }
+    else
+    {
+        if (config->preserveData == true)
+        {
+            if (lSYS_FS_BENCH_SectorRead(config->diskNum, config->saveBuffer, sector, numSectors) == false)
+            {
+                return false;
+            }
+        }
+
+        startCount = lSYS_FS_BENCH_CounterGet();
+
+        status = lSYS_FS_BENCH_SectorWrite(config->diskNum, config->buffer, sector, numSectors);
+    }
+
+    if (status == true)
+    {
+        lSYS_FS_BENCH_LatencyAdd(result, startCount, numSectors * SYS_FS_BENCH_SECTOR_SIZE);
+    }
+
+    if ((isWrite == true) && (config->preserveData == true))
+    {
+        /* Restore the sectors even if the write failed part way */
+        if (lSYS_FS_BENCH_SectorWrite(config->diskNum, config->saveBuffer, sector, numSectors) == false)
+        {
+            status = false;
+        }
+    }
+
+    return status;
+}
+
+static SYS_FS_BENCH_STATUS lSYS_FS_BENCH_BlockTest
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    SYS_FS_BENCH_TEST test,
+    SYS_FS_BENCH_RESULT* result
+)
+{
+    bool isWrite = ((test == SYS_FS_BENCH_TEST_SEQ_WRITE) || (test == SYS_FS_BENCH_TEST_RAND_WRITE));
+    bool isRandom = ((test == SYS_FS_BENCH_TEST_RAND_READ) || (test == SYS_FS_BENCH_TEST_RAND_WRITE));
+    uint32_t diskSectors = SYS_FS_BENCH_SectorCountGet(config->diskNum);
+    uint32_t regionSectors = config->numSectors;
+    uint32_t numSectors;
+    uint32_t numRequests;
+    uint32_t sector;
+    uint32_t seed;
+    uint32_t i;
+
+    if (isRandom == true)
+    {
+        numSectors  = config->randSectors;
+        numRequests = config->randRequests;
+    }
+    else
+    {
+        numSectors  = config->seqSectors;
+        numRequests = config->seqRequests;
+    }
+
+    if ((numRequests == 0U) || ((isWrite == true) && (config->writeEnable == false)))
+    {
+        return SYS_FS_BENCH_STATUS_SKIPPED;
+    }
+
+    if ((numSectors == 0U) || (config->buffer == NULL) || (config->startSector >= diskSectors) ||
+        ((isWrite == true) && (config->preserveData == true) && (config->saveBuffer == NULL)))
+    {
+        return SYS_FS_BENCH_STATUS_ERROR;
+    }
+
+    if ((regionSectors == 0U) || (regionSectors > (diskSectors - config->startSector)))
+    {
+        regionSectors = diskSectors - config->startSector;
+    }
+
+    if (regionSectors < numSectors)
+    {
+        return SYS_FS_BENCH_STATUS_ERROR;
+    }
+
+    /* Zero would lock the generator */
+    seed   = (config->seed != 0U) ? config->seed : 1U;
+    sector = config->startSector;
+
+    for (i = 0; i < numRequests; i++)
+    {
+        if (isRandom == true)
+        {
+            sector = config->startSector +
+                     ((lSYS_FS_BENCH_Random(&seed) % (regionSectors / numSectors)) * numSectors);
+        }
+        else if ((sector + numSectors) > (config->startSector + regionSectors))
+        {
+            /* Wrap around to the start of the region */
+            sector = config->startSector;
+        }
+        else
+        {
+            /* Continue with the next request */
+        }
+
+        if (lSYS_FS_BENCH_BlockRequest(config, isWrite, sector, numSectors, result) == false)
+        {
+            return SYS_FS_BENCH_STATUS_ERROR;
+        }
+
+        sector += numSectors;
+    }
+
+    return SYS_FS_BENCH_STATUS_OK;
+}
+
+static SYS_FS_BENCH_STATUS lSYS_FS_BENCH_FileTest
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    SYS_FS_BENCH_TEST test,
+    SYS_FS_BENCH_RESULT* result
+)
+{
+    char path[SYS_FS_BENCH_PATH_LEN];
+    SYS_FS_HANDLE fileHandle;
+    uint64_t startCount;
+    bool status;
+    int pathLen;
+    uint32_t i;
+
+    if ((config->fileDir == NULL) || (config->numFiles == 0U))
+    {
+        return SYS_FS_BENCH_STATUS_SKIPPED;
+    }
+
+    if ((config->fileSize != 0U) && (config->buffer == NULL))
+    {
+        return SYS_FS_BENCH_STATUS_ERROR;
+    }
+
+    for (i = 0; i < config->numFiles; i++)
+    {
+        pathLen = snprintf(path, sizeof(path), "%s/fsb%05lu.bin", config->fileDir, (unsigned long)i);
+
+        if ((pathLen < 0) || ((uint32_t)pathLen >= sizeof(path)))
+        {
+            return SYS_FS_BENCH_STATUS_ERROR;
+        }
+
+        startCount = lSYS_FS_BENCH_CounterGet();
+
+        if (test == SYS_FS_BENCH_TEST_FILE_CREATE)
+        {
+            fileHandle = SYS_FS_FileOpen(path, SYS_FS_FILE_OPEN_WRITE);
+
+            if (fileHandle == SYS_FS_HANDLE_INVALID)
+            {
+                return SYS_FS_BENCH_STATUS_ERROR;
+            }
+
+            status = true;
+
+            if (config->fileSize != 0U)
+            {
+                status = (SYS_FS_FileWrite(fileHandle, config->buffer, config->fileSize) == config->fileSize);
+            }
+
+            if (SYS_FS_FileClose(fileHandle) != SYS_FS_RES_SUCCESS)
+            {
+                status = false;
+            }
+        }
+        else
+        {
+            status = (SYS_FS_FileDirectoryRemove(path) == SYS_FS_RES_SUCCESS);
+        }
+
+        if (status == false)
+        {
+            return SYS_FS_BENCH_STATUS_ERROR;
+        }
+
+        lSYS_FS_BENCH_LatencyAdd(result, startCount,
+                (test == SYS_FS_BENCH_TEST_FILE_CREATE) ? config->fileSize : 0U);
+    }
+
+    return SYS_FS_BENCH_STATUS_OK;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t SYS_FS_BENCH_SectorCountGet(uint16_t diskNum)
+{
+    SYS_FS_MEDIA_GEOMETRY* geometry = SYS_FS_MEDIA_MANAGER_GetMediaGeometry(diskNum);
+    uint64_t mediaSize;
+
+    if ((geometry == NULL) || (geometry->geometryTable == NULL))
+    {
+        return 0;
+    }
+
+    /* Entry 0 of the geometry table describes the read region */
+    mediaSize = (uint64_t)geometry->geometryTable[0].blockSize * geometry->geometryTable[0].numBlocks;
+
+    return (uint32_t)(mediaSize / SYS_FS_BENCH_SECTOR_SIZE);
+}
+
+SYS_FS_BENCH_STATUS SYS_FS_BENCH_TestRun
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    SYS_FS_BENCH_TEST test,
+    SYS_FS_BENCH_RESULT* result
+)
+{
+    if ((config == NULL) || (result == NULL) || (test >= SYS_FS_BENCH_TEST_MAX))
+    {
+        return SYS_FS_BENCH_STATUS_ERROR;
+    }
+
+    lSYS_FS_BENCH_ResultReset(result, test);
+
+    lSYS_FS_BENCH_CounterStart();
+
+    if ((test == SYS_FS_BENCH_TEST_FILE_CREATE) || (test == SYS_FS_BENCH_TEST_FILE_DELETE))
+    {
+        result->status = lSYS_FS_BENCH_FileTest(config, test, result);
+    }
+    else
+    {
+        result->status = lSYS_FS_BENCH_BlockTest(config, test, result);
+    }
+
+    return result->status;
+}
+
+bool SYS_FS_BENCH_Run
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    SYS_FS_BENCH_RESULT* results
+)
+{
+    SYS_FS_BENCH_RESULT localResult;
+    SYS_FS_BENCH_RESULT* result;
+    bool status = true;
+    uint32_t test;
+
+    for (test = 0; test < (uint32_t)SYS_FS_BENCH_TEST_MAX; test++)
+    {
+        result = (results != NULL) ? &results[test] : &localResult;
+
+        if (SYS_FS_BENCH_TestRun(config, (SYS_FS_BENCH_TEST)test, result) == SYS_FS_BENCH_STATUS_ERROR)
+        {
+            status = false;
+        }
+
+        SYS_FS_BENCH_ResultPrint(config, result);
+    }
+
+    return status;
+}
+
+void SYS_FS_BENCH_ResultPrint
+(
+    const SYS_FS_BENCH_CONFIG* config,
+    const SYS_FS_BENCH_RESULT* result
+)
+{
+    uint64_t frequency = lSYS_FS_BENCH_FrequencyGet();
+    uint32_t numSectors = 0;
+    uint32_t iops;
+    uint32_t kbps;
+    uint32_t latencyAvgUs;
+    uint64_t latencyMinCount = 0;
+    uint32_t i;
+
+    if ((config == NULL) || (result == NULL) || (result->test >= SYS_FS_BENCH_TEST_MAX))
+    {
+        return;
+    }
+
+    if ((result->test == SYS_FS_BENCH_TEST_SEQ_READ) || (result->test == SYS_FS_BENCH_TEST_SEQ_WRITE))
+    {
+        numSectors = config->seqSectors;
+    }
+    else if ((result->test == SYS_FS_BENCH_TEST_RAND_READ) || (result->test == SYS_FS_BENCH_TEST_RAND_WRITE))
+    {
+        numSectors = config->randSectors;
+    }
+    else
+    {
+        /* File tests are not sector based */
+    }
+
+    /* Rates are computed from the raw counts, every division is guarded */
+    iops = lSYS_FS_BENCH_Rate(result->requests, frequency, result->elapsedCount);
+    kbps = lSYS_FS_BENCH_Rate(result->bytes / 1024U, frequency, result->elapsedCount);
+    latencyAvgUs = lSYS_FS_BENCH_Rate(lSYS_FS_BENCH_CountToUs(result->elapsedCount), 1U, result->requests);
+
+    if (result->requests != 0U)
+    {
+        latencyMinCount = result->latencyMinCount;
+    }
+
+    SYS_FS_BENCH_PRINT("FSBENCH test=%s disk=%u status=%s req=%lu sectors=%lu bytes=%lu us=%lu iops=%lu kbps=%lu"
+                       " lat_min_us=%lu lat_avg_us=%lu lat_max_us=%lu\r\n",
+                       gSysFsBenchTestName[result->test], (unsigned int)config->diskNum,
+                       gSysFsBenchStatusName[result->status], (unsigned long)result->requests,
+                       (unsigned long)numSectors, (unsigned long)result->bytes,
+                       (unsigned long)lSYS_FS_BENCH_CountToUs(result->elapsedCount), (unsigned long)iops,
+                       (unsigned long)kbps, (unsigned long)lSYS_FS_BENCH_CountToUs(latencyMinCount),
+                       (unsigned long)latencyAvgUs, (unsigned long)lSYS_FS_BENCH_CountToUs(result->latencyMaxCount));
+
+    if (result->status == SYS_FS_BENCH_STATUS_SKIPPED)
+    {
+        return;
+    }
+
+    SYS_FS_BENCH_PRINT("FSBENCH_HIST test=%s bins=%lu h=%lu", gSysFsBenchTestName[result->test],
+                       (unsigned long)SYS_FS_BENCH_HISTOGRAM_BINS, (unsigned long)result->histogram[0]);
+
+    for (i = 1; i < SYS_FS_BENCH_HISTOGRAM_BINS; i++)
+    {
+        SYS_FS_BENCH_PRINT(",%lu", (unsigned long)result->histogram[i]);
+    }
+
+    SYS_FS_BENCH_PRINT("\r\n");
+}
@@ -61,6 +61,16 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the SYS_FS_Tasks task. */
+static StackType_t lSYS_FS_TasksStack[SYS_FS_STACK_SIZE];
+static StaticTask_t lSYS_FS_TasksTCB;
+#endif
+
 static void lSYS_FS_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -77,6 +87,12 @@ TaskHandle_t xAPP_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_Tasks task. */
+static StackType_t lAPP_TasksStack[1024];
+static StaticTask_t lAPP_TasksTCB;
+#endif
+
 static void lAPP_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -106,6 +122,16 @@ void SYS_Tasks ( void )
 {
     /* Maintain system services */
     
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void) xTaskCreateStatic( lSYS_FS_Tasks,
+        "SYS_FS_TASKS",
+        SYS_FS_STACK_SIZE,
+        (void*)NULL,
+        SYS_FS_PRIORITY ,
+        lSYS_FS_TasksStack,
+        &lSYS_FS_TasksTCB
+    );
+#else
     (void) xTaskCreate( lSYS_FS_Tasks,
         "SYS_FS_TASKS",
         SYS_FS_STACK_SIZE,
@@ -113,6 +139,7 @@ void SYS_Tasks ( void )
         SYS_FS_PRIORITY ,
         (TaskHandle_t*)NULL
     );
+#endif
 
 
 
@@ -126,6 +153,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_Tasks,
+           "APP_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_TasksStack,
+           &lAPP_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_Tasks,
            "APP_Tasks",
@@ -133,8 +170,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
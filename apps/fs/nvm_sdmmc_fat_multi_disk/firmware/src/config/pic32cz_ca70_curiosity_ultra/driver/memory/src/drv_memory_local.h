@@ -80,6 +80,12 @@
 #define DRV_MEMORY_TOKEN_MAX                            (DRV_MEMORY_TOKEN_MASK >> 16)
 #define DRV_MEMORY_MAKE_HANDLE(token, instance, index)  (((token) << 16) | ((instance) << 8) | (index))
 
+/* Number of times a single page program or sector erase can be suspended to
+ * serve queued reads. Bounds the delay reads add to the operation. */
+#ifndef DRV_MEMORY_SUSPEND_COUNT_MAX
+#define DRV_MEMORY_SUSPEND_COUNT_MAX                    (8U)
+#endif
+
 /* MEMORY Driver operations. */
 typedef enum
 {
@@ -164,6 +170,9 @@ typedef enum
     /* Perform the required transfer */
     DRV_MEMORY_TRANSFER,
 
+    /* Serve queued reads while the program or erase in progress is suspended */
+    DRV_MEMORY_SUSPENDED,
+
     /* Idle state of the driver. */
     DRV_MEMORY_IDLE,
 
@@ -331,6 +340,15 @@ typedef struct
     /* Pointer to the current buffer object */
     DRV_MEMORY_BUFFER_OBJECT *currentBufObj;
 
+    /* Queued read served while the current operation is suspended */
+    DRV_MEMORY_BUFFER_OBJECT *readBufObj;
+
+    /* Read state of the current operation while it is suspended */
+    DRV_MEMORY_READ_STATE suspendedReadState;
+
+    /* Number of times the current page program or sector erase was suspended */
+    uint32_t suspendCount;
+
     /* Memory pool for Client Objects */
     DRV_MEMORY_CLIENT_OBJECT *clientObjPool;
 
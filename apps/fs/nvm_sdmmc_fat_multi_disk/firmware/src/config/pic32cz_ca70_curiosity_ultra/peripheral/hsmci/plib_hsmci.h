@@ -95,6 +95,10 @@ void HSMCI_DmaSetup
     HSMCI_DATA_TRANSFER_DIR operation
 );
 
+void HSMCI_DmaBurstSet ( HSMCI_DMA_BURST burst );
+
+HSMCI_DMA_BURST HSMCI_DmaBurstGet ( void );
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -53,8 +53,144 @@
 #include "semphr.h"
 #include "task.h"
 
+#include "configuration.h"
 #include "osal/osal_freertos.h"
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data
+// *****************************************************************************
+// *****************************************************************************
+/* With configSUPPORT_STATIC_ALLOCATION set, semaphores and mutexes take their
+   control block from a pool sized at build time instead of the FreeRTOS heap.
+   OSAL_STATIC_SEMAPHORE_COUNT should cover all the OSAL semaphores and mutexes
+   that exist at the same time. Once the pool is exhausted, OSAL_SEM_Create and
+   OSAL_MUTEX_Create fall back to the FreeRTOS heap when
+   configSUPPORT_DYNAMIC_ALLOCATION is set, and fail otherwise.
+*/
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+
+#ifndef OSAL_STATIC_SEMAPHORE_COUNT
+#define OSAL_STATIC_SEMAPHORE_COUNT    (16U)
+#endif
+
+static StaticSemaphore_t lOSAL_SemaphorePool[OSAL_STATIC_SEMAPHORE_COUNT];
+static bool lOSAL_SemaphoreInUse[OSAL_STATIC_SEMAPHORE_COUNT];
+
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+
+static StaticSemaphore_t* lOSAL_SemaphoreStorageGet(void)
+{
+    StaticSemaphore_t* storage = NULL;
+    uint32_t i;
+
+    taskENTER_CRITICAL();
+
+    for (i = 0U; i < OSAL_STATIC_SEMAPHORE_COUNT; i++)
+    {
+        if (lOSAL_SemaphoreInUse[i] == false)
+        {
+            lOSAL_SemaphoreInUse[i] = true;
+            storage = &lOSAL_SemaphorePool[i];
+            break;
+        }
+    }
+
+    taskEXIT_CRITICAL();
+
+    return storage;
+}
+
+static void lOSAL_SemaphoreStorageRelease(SemaphoreHandle_t handle)
+{
+    uintptr_t address = (uintptr_t)handle;
+    uintptr_t poolStart = (uintptr_t)&lOSAL_SemaphorePool[0];
+
+    /* A statically created semaphore handle is the address of its storage */
+    if ((address >= poolStart) && (address < (poolStart + sizeof(lOSAL_SemaphorePool))))
+    {
+        taskENTER_CRITICAL();
+
+        lOSAL_SemaphoreInUse[(address - poolStart) / sizeof(StaticSemaphore_t)] = false;
+
+        taskEXIT_CRITICAL();
+    }
+}
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+#define lOSAL_SemaphoreCreateDynamic(create)                    (create)
+#else
+#define lOSAL_SemaphoreCreateDynamic(create)                    NULL
+#endif
+
+static SemaphoreHandle_t lOSAL_SemaphoreCreateBinary(void)
+{
+    StaticSemaphore_t* storage = lOSAL_SemaphoreStorageGet();
+    SemaphoreHandle_t handle;
+
+    if (storage != NULL)
+    {
+        handle = xSemaphoreCreateBinaryStatic(storage);
+    }
+    else
+    {
+        handle = lOSAL_SemaphoreCreateDynamic(xSemaphoreCreateBinary());
+    }
+
+    return handle;
+}
+
+static SemaphoreHandle_t lOSAL_SemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount)
+{
+    StaticSemaphore_t* storage = lOSAL_SemaphoreStorageGet();
+    SemaphoreHandle_t handle;
+
+    if (storage != NULL)
+    {
+        handle = xSemaphoreCreateCountingStatic(maxCount, initialCount, storage);
+    }
+    else
+    {
+        handle = lOSAL_SemaphoreCreateDynamic(xSemaphoreCreateCounting(maxCount, initialCount));
+    }
+
+    return handle;
+}
+
+static SemaphoreHandle_t lOSAL_SemaphoreCreateMutex(void)
+{
+    StaticSemaphore_t* storage = lOSAL_SemaphoreStorageGet();
+    SemaphoreHandle_t handle;
+
+    if (storage != NULL)
+    {
+        handle = xSemaphoreCreateMutexStatic(storage);
+    }
+    else
+    {
+        handle = lOSAL_SemaphoreCreateDynamic(xSemaphoreCreateMutex());
+    }
+
+    return handle;
+}
+
+#else
+
+#define lOSAL_SemaphoreStorageRelease(handle)
+#define lOSAL_SemaphoreCreateBinary()                           xSemaphoreCreateBinary()
+#define lOSAL_SemaphoreCreateCounting(maxCount, initialCount)   xSemaphoreCreateCounting((maxCount), (initialCount))
+#define lOSAL_SemaphoreCreateMutex()                            xSemaphoreCreateMutex()
+
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: OSAL Routines
@@ -245,7 +381,7 @@ OSAL_RESULT OSAL_SEM_Create(OSAL_SEM_HANDLE_TYPE* semID, OSAL_SEM_TYPE type, OSA
          * Binary semaphore must be created in a state such that the first call to
          * 'take' the semaphore would pass.
          */
-        *(SemaphoreHandle_t*)semID = xSemaphoreCreateBinary();
+        *(SemaphoreHandle_t*)semID = lOSAL_SemaphoreCreateBinary();
 
         if ((*(SemaphoreHandle_t*)semID != NULL) && (initialCount == 1U))
         {
@@ -266,7 +402,7 @@ OSAL_RESULT OSAL_SEM_Create(OSAL_SEM_HANDLE_TYPE* semID, OSAL_SEM_TYPE type, OSA
     break;
 
     case OSAL_SEM_TYPE_COUNTING:
-      *(SemaphoreHandle_t*)semID = xSemaphoreCreateCounting((UBaseType_t)maxCount, (UBaseType_t)initialCount);
+      *(SemaphoreHandle_t*)semID = lOSAL_SemaphoreCreateCounting((UBaseType_t)maxCount, (UBaseType_t)initialCount);
     break;
 
     default:
@@ -312,6 +448,7 @@ OSAL_RESULT OSAL_SEM_Create(OSAL_SEM_HANDLE_TYPE* semID, OSAL_SEM_TYPE type, OSA
 OSAL_RESULT OSAL_SEM_Delete(OSAL_SEM_HANDLE_TYPE* semID)
 {
   vSemaphoreDelete(*(SemaphoreHandle_t*)semID);
+  lOSAL_SemaphoreStorageRelease(*(SemaphoreHandle_t*)semID);
   *(SemaphoreHandle_t*)semID = NULL;
 
   return (OSAL_RESULT)OSAL_RESULT_SUCCESS;
@@ -605,7 +742,7 @@ OSAL_RESULT OSAL_MUTEX_Create(OSAL_MUTEX_HANDLE_TYPE* mutexID)
         return (OSAL_RESULT)OSAL_RESULT_FAIL;
     }
 
-    *(SemaphoreHandle_t*)mutexID = xSemaphoreCreateMutex();
+    *(SemaphoreHandle_t*)mutexID = lOSAL_SemaphoreCreateMutex();
     
     if (*(SemaphoreHandle_t*)mutexID == NULL)
     {
@@ -651,6 +788,7 @@ OSAL_RESULT OSAL_MUTEX_Delete(OSAL_MUTEX_HANDLE_TYPE* mutexID)
     }
     
     vSemaphoreDelete(*(SemaphoreHandle_t*)mutexID);
+    lOSAL_SemaphoreStorageRelease(*(SemaphoreHandle_t*)mutexID);
     *(SemaphoreHandle_t*)mutexID = NULL;
 
     return (OSAL_RESULT)OSAL_RESULT_SUCCESS;
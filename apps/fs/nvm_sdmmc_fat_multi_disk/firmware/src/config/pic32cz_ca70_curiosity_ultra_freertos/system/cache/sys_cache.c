@@ -45,10 +45,262 @@
 // Section: Included Files
 // *****************************************************************************
 // *****************************************************************************
+#include "configuration.h"
 #include "device.h"
 #include "device_cache.h"
 #include "system/cache/sys_cache.h"
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Size above which merged ranges are cleaned with a whole Data Cache
+ * operation. Walking the Data Cache by set/way costs about as much as
+ * walking the same number of bytes by address. */
+#ifndef SYS_CACHE_DCACHE_RANGES_THRESHOLD
+    #define SYS_CACHE_DCACHE_RANGES_THRESHOLD   (16384U)
+#endif
+
+/* Number of non-cacheable regions held */
+#ifndef SYS_CACHE_NONCACHEABLE_REGIONS_MAX
+    #define SYS_CACHE_NONCACHEABLE_REGIONS_MAX  (4U)
+#endif
+
+#define SYS_CACHE_LINE_MASK                     ((uintptr_t)CACHE_LINE_SIZE - 1U)
+
+typedef enum
+{
+    SYS_CACHE_DCACHE_CLEAN = 0,
+
+    SYS_CACHE_DCACHE_INVALIDATE,
+
+    SYS_CACHE_DCACHE_CLEAN_INVALIDATE
+
+} SYS_CACHE_DCACHE_OPERATION;
+
+typedef struct
+{
+    uintptr_t start;
+
+    /* First address after the region */
+    uintptr_t end;
+
+    /* Loaded from the MPU by SYS_CACHE_NonCacheableRegionsLoad, rather than
+     * added by SYS_CACHE_NonCacheableRegionAdd */
+    bool isLoaded;
+
+} SYS_CACHE_REGION;
+
+static SYS_CACHE_REGION gSysCacheNonCacheableRegion[SYS_CACHE_NONCACHEABLE_REGIONS_MAX];
+
+static volatile uint32_t gSysCacheNonCacheableRegionCount = 0U;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static bool lSYS_CACHE_IsNonCacheable(uintptr_t start, uintptr_t end)
+{
+    uint32_t count = gSysCacheNonCacheableRegionCount;
+    uint32_t i;
+    bool isNonCacheable = false;
+
+    for (i = 0U; i < count; i++)
+    {
+        if ((start >= gSysCacheNonCacheableRegion[i].start) && (end <= gSysCacheNonCacheableRegion[i].end))
+        {
+            isNonCacheable = true;
+            break;
+        }
+    }
+
+    return isNonCacheable;
+}
+
+static bool lSYS_CACHE_IsMaintained(void *addr, int32_t size)
+{
+    return (size > 0) && (lSYS_CACHE_IsNonCacheable((uintptr_t)addr, (uintptr_t)addr + (uint32_t)size) == false);
+}
+
+/* Widens the ranges to whole cache lines, sorts them by address and merges
+ * the overlapping and adjacent ones. Empty and non-cacheable ranges are
+ * dropped. Returns the number of merged ranges, at the start of the array. */
+static uint32_t lSYS_CACHE_RangesCoalesce(SYS_CACHE_RANGE *ranges, uint32_t nRanges, uint32_t *totalSize)
+{
+    SYS_CACHE_RANGE range;
+    uintptr_t start;
+    uintptr_t end;
+    uintptr_t lastEnd;
+    uint32_t count = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    /* Insertion sort, the batches are short */
+    for (i = 0U; i < nRanges; i++)
+    {
+        start = (uintptr_t)ranges[i].addr & ~SYS_CACHE_LINE_MASK;
+        end = ((uintptr_t)ranges[i].addr + ranges[i].size + SYS_CACHE_LINE_MASK) & ~SYS_CACHE_LINE_MASK;
+
+        range.addr = (void *)start;
+        range.size = (ranges[i].size == 0U) ? 0U : (uint32_t)(end - start);
+
+        j = i;
+        while ((j > 0U) && ((uintptr_t)ranges[j - 1U].addr > start))
+        {
+            ranges[j] = ranges[j - 1U];
+            j--;
+        }
+        ranges[j] = range;
+    }
+
+    *totalSize = 0U;
+
+    for (i = 0U; i < nRanges; i++)
+    {
+        start = (uintptr_t)ranges[i].addr;
+        end = start + ranges[i].size;
+
+        if ((start == end) || (lSYS_CACHE_IsNonCacheable(start, end) == true))
+        {
+            continue;
+        }
+
+        lastEnd = (count == 0U) ? 0U : ((uintptr_t)ranges[count - 1U].addr + ranges[count - 1U].size);
+
+        if ((count != 0U) && (start <= lastEnd))
+        {
+            if (end > lastEnd)
+            {
+                ranges[count - 1U].size += (uint32_t)(end - lastEnd);
+                *totalSize += (uint32_t)(end - lastEnd);
+            }
+        }
+        else
+        {
+            ranges[count] = ranges[i];
+            *totalSize += ranges[count].size;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+static void lSYS_CACHE_RangesMaintain(SYS_CACHE_RANGE *ranges, uint32_t nRanges, SYS_CACHE_DCACHE_OPERATION operation)
+{
+    uint32_t totalSize = 0U;
+    uint32_t count;
+    uint32_t i;
+
+    if ((DATA_CACHE_IS_ENABLED() != 0U) && (ranges != NULL)) // If Data Cache is enabled
+    {
+        count = lSYS_CACHE_RangesCoalesce(ranges, nRanges, &totalSize);
+
+        if ((operation != SYS_CACHE_DCACHE_INVALIDATE) && (totalSize > SYS_CACHE_DCACHE_RANGES_THRESHOLD))
+        {
+            if (operation == SYS_CACHE_DCACHE_CLEAN)
+            {
+                DCACHE_CLEAN();
+            }
+            else
+            {
+                DCACHE_CLEAN_INVALIDATE();
+            }
+        }
+        else
+        {
+            for (i = 0U; i < count; i++)
+            {
+                if (operation == SYS_CACHE_DCACHE_CLEAN)
+                {
+                    DCACHE_CLEAN_BY_ADDR(ranges[i].addr, (int32_t)ranges[i].size);
+                }
+                else if (operation == SYS_CACHE_DCACHE_INVALIDATE)
+                {
+                    DCACHE_INVALIDATE_BY_ADDR(ranges[i].addr, (int32_t)ranges[i].size);
+                }
+                else
+                {
+                    DCACHE_CLEAN_INVALIDATE_BY_ADDR(ranges[i].addr, (int32_t)ranges[i].size);
+                }
+            }
+        }
+    }
+}
+
+/* Strongly-ordered and device memory, and normal memory with a
+ * non-cacheable inner policy, are not cached */
+static bool lSYS_CACHE_MPUAttributesNonCacheable(uint32_t rasr)
+{
+    uint32_t tex = (rasr & MPU_RASR_TEX_Msk) >> MPU_RASR_TEX_Pos;
+    bool isNonCacheable;
+
+    if ((tex & 0x4U) != 0U)
+    {
+        /* Normal memory, C and B hold the inner cache policy */
+        isNonCacheable = ((rasr & (MPU_RASR_C_Msk | MPU_RASR_B_Msk)) == 0U);
+    }
+    else
+    {
+        isNonCacheable = ((rasr & MPU_RASR_C_Msk) == 0U);
+    }
+
+    return isNonCacheable;
+}
+
+static bool lSYS_CACHE_RegionAdd(uintptr_t start, uintptr_t end, bool isLoaded)
+{
+    uint32_t count = gSysCacheNonCacheableRegionCount;
+    bool isAdded = false;
+
+    if (count < SYS_CACHE_NONCACHEABLE_REGIONS_MAX)
+    {
+        gSysCacheNonCacheableRegion[count].start = start;
+        gSysCacheNonCacheableRegion[count].end = end;
+        gSysCacheNonCacheableRegion[count].isLoaded = isLoaded;
+
+        /* Publish the region after it is filled in */
+        gSysCacheNonCacheableRegionCount = count + 1U;
+        isAdded = true;
+    }
+
+    return isAdded;
+}
+
+static void lSYS_CACHE_RegionRemove(uint32_t index)
+{
+    uint32_t count = gSysCacheNonCacheableRegionCount;
+
+    /* Move the last region into the slot before the table is shortened, a
+     * concurrent lookup then sees every other region */
+    gSysCacheNonCacheableRegion[index] = gSysCacheNonCacheableRegion[count - 1U];
+    gSysCacheNonCacheableRegionCount = count - 1U;
+}
+
+/* First address after an MPU region, saturated at the top of the address
+ * space */
+static uintptr_t lSYS_CACHE_MPURegionEnd(uintptr_t start, uint32_t rasr)
+{
+    uint32_t sizeField = (rasr & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos;
+    uintptr_t end = UINTPTR_MAX;
+
+    if (sizeField < 31U)
+    {
+        end = start + ((uintptr_t)1U << (sizeField + 1U));
+
+        if (end == 0U)
+        {
+            end = UINTPTR_MAX;
+        }
+    }
+
+    return end;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: System Cache Interface Functions
@@ -129,7 +381,7 @@ void SYS_CACHE_CleanDCache (void)
 
 void SYS_CACHE_InvalidateDCache_by_Addr (void *addr, int32_t size)
 {
-    if (DATA_CACHE_IS_ENABLED() != 0U) // If Data Cache is enabled
+    if ((DATA_CACHE_IS_ENABLED() != 0U) && (lSYS_CACHE_IsMaintained(addr, size) == true)) // If Data Cache is enabled
     {
         DCACHE_INVALIDATE_BY_ADDR(addr, size);
     }
@@ -137,7 +389,7 @@ void SYS_CACHE_InvalidateDCache_by_Addr (void *addr, int32_t size)
 
 void SYS_CACHE_CleanDCache_by_Addr (void *addr, int32_t size)
 {
-    if (DATA_CACHE_IS_ENABLED() != 0U) // If Data Cache is enabled
+    if ((DATA_CACHE_IS_ENABLED() != 0U) && (lSYS_CACHE_IsMaintained(addr, size) == true)) // If Data Cache is enabled
     {
         DCACHE_CLEAN_BY_ADDR(addr, size);
     }
@@ -155,10 +407,117 @@ void SYS_CACHE_CleanInvalidateDCache (void)
 
 void SYS_CACHE_CleanInvalidateDCache_by_Addr (void *addr, int32_t size)
 {
-    if (DATA_CACHE_IS_ENABLED() != 0U) // If Data Cache is enabled
+    if ((DATA_CACHE_IS_ENABLED() != 0U) && (lSYS_CACHE_IsMaintained(addr, size) == true)) // If Data Cache is enabled
     {
         DCACHE_CLEAN_INVALIDATE_BY_ADDR(addr, size);
     }
 }
 
+void SYS_CACHE_CleanDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges)
+{
+    lSYS_CACHE_RangesMaintain(ranges, nRanges, SYS_CACHE_DCACHE_CLEAN);
+}
+
+void SYS_CACHE_InvalidateDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges)
+{
+    lSYS_CACHE_RangesMaintain(ranges, nRanges, SYS_CACHE_DCACHE_INVALIDATE);
+}
+
+void SYS_CACHE_CleanInvalidateDCache_by_Ranges (SYS_CACHE_RANGE *ranges, uint32_t nRanges)
+{
+    lSYS_CACHE_RangesMaintain(ranges, nRanges, SYS_CACHE_DCACHE_CLEAN_INVALIDATE);
+}
+
+void SYS_CACHE_NonCacheableRegionsLoad (void)
+{
+    uint32_t nRegions = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+    uint32_t region;
+    uint32_t higher;
+    uint32_t rasr;
+    uintptr_t start;
+    uintptr_t end;
+    uintptr_t higherStart;
+    uintptr_t higherEnd;
+    bool isOverlapped;
+
+    /* Drop what the previous load found, the MPU may have been reprogrammed
+     * since. The regions added explicitly are kept. */
+    region = 0U;
+    while (region < gSysCacheNonCacheableRegionCount)
+    {
+        if (gSysCacheNonCacheableRegion[region].isLoaded == true)
+        {
+            lSYS_CACHE_RegionRemove(region);
+        }
+        else
+        {
+            region++;
+        }
+    }
+
+    if ((MPU->CTRL & MPU_CTRL_ENABLE_Msk) != 0U)
+    {
+        for (region = 0U; region < nRegions; region++)
+        {
+            MPU->RNR = region;
+            rasr = MPU->RASR;
+            start = MPU->RBAR & MPU_RBAR_ADDR_Msk;
+
+            if (((rasr & MPU_RASR_ENABLE_Msk) == 0U) || ((rasr & MPU_RASR_SRD_Msk) != 0U) ||
+                (lSYS_CACHE_MPUAttributesNonCacheable(rasr) == false))
+            {
+                continue;
+            }
+
+            end = lSYS_CACHE_MPURegionEnd(start, rasr);
+
+            /* A higher numbered region takes precedence where they overlap */
+            isOverlapped = false;
+            for (higher = region + 1U; higher < nRegions; higher++)
+            {
+                MPU->RNR = higher;
+                rasr = MPU->RASR;
+                higherStart = MPU->RBAR & MPU_RBAR_ADDR_Msk;
+                higherEnd = lSYS_CACHE_MPURegionEnd(higherStart, rasr);
+
+                if (((rasr & MPU_RASR_ENABLE_Msk) != 0U) && (higherStart < end) && (start < higherEnd))
+                {
+                    isOverlapped = true;
+                    break;
+                }
+            }
+
+            if (isOverlapped == false)
+            {
+                (void) lSYS_CACHE_RegionAdd(start, end, true);
+            }
+        }
+    }
+}
+
+bool SYS_CACHE_NonCacheableRegionAdd (void *addr, uint32_t size)
+{
+    return lSYS_CACHE_RegionAdd((uintptr_t)addr, (uintptr_t)addr + size, false);
+}
+
+bool SYS_CACHE_NonCacheableRegionRemove (void *addr, uint32_t size)
+{
+    uint32_t count = gSysCacheNonCacheableRegionCount;
+    uint32_t i;
+    bool isRemoved = false;
+
+    for (i = 0U; i < count; i++)
+    {
+        if ((gSysCacheNonCacheableRegion[i].start == (uintptr_t)addr) &&
+            (gSysCacheNonCacheableRegion[i].end == ((uintptr_t)addr + size)))
+        {
+            lSYS_CACHE_RegionRemove(i);
+            isRemoved = true;
+            break;
+        }
+    }
+
+    return isRemoved;
+}
+
 /* MISRAC 2012 deviation block end */
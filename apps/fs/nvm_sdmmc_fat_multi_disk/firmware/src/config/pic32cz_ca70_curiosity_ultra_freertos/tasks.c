@@ -60,6 +60,16 @@
 // Section: RTOS "Tasks" Routine
 // *****************************************************************************
 // *****************************************************************************
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_MEMORY_0_Tasks task. */
+static StackType_t lDRV_MEMORY_0_TasksStack[DRV_MEMORY_STACK_SIZE_IDX0];
+static StaticTask_t lDRV_MEMORY_0_TasksTCB;
+#endif
+
 static void lDRV_MEMORY_0_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -70,6 +80,12 @@ static void lDRV_MEMORY_0_Tasks(  void *pvParameters  )
 }
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the SYS_FS_Tasks task. */
+static StackType_t lSYS_FS_TasksStack[SYS_FS_STACK_SIZE];
+static StaticTask_t lSYS_FS_TasksTCB;
+#endif
+
 static void lSYS_FS_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -80,6 +96,12 @@ static void lSYS_FS_Tasks(  void *pvParameters  )
 }
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_SDMMC0_Tasks task. */
+static StackType_t lDRV_SDMMC0_TasksStack[DRV_SDMMC_STACK_SIZE_IDX0];
+static StaticTask_t lDRV_SDMMC0_TasksTCB;
+#endif
+
 static void lDRV_SDMMC0_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -95,6 +117,12 @@ TaskHandle_t xAPP_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_Tasks task. */
+static StackType_t lAPP_TasksStack[1024];
+static StaticTask_t lAPP_TasksTCB;
+#endif
+
 static void lAPP_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -124,6 +152,16 @@ void SYS_Tasks ( void )
 {
     /* Maintain system services */
     
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void) xTaskCreateStatic( lSYS_FS_Tasks,
+        "SYS_FS_TASKS",
+        SYS_FS_STACK_SIZE,
+        (void*)NULL,
+        SYS_FS_PRIORITY ,
+        lSYS_FS_TasksStack,
+        &lSYS_FS_TasksTCB
+    );
+#else
     (void) xTaskCreate( lSYS_FS_Tasks,
         "SYS_FS_TASKS",
         SYS_FS_STACK_SIZE,
@@ -131,7 +169,18 @@ void SYS_Tasks ( void )
         SYS_FS_PRIORITY ,
         (TaskHandle_t*)NULL
     );
+#endif
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void) xTaskCreateStatic( lDRV_SDMMC0_Tasks,
+        "DRV_SDMMC0_Tasks",
+        DRV_SDMMC_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_SDMMC_PRIORITY_IDX0 ,
+        lDRV_SDMMC0_TasksStack,
+        &lDRV_SDMMC0_TasksTCB
+    );
+#else
     (void) xTaskCreate( lDRV_SDMMC0_Tasks,
         "DRV_SDMMC0_Tasks",
         DRV_SDMMC_STACK_SIZE_IDX0,
@@ -139,12 +188,23 @@ void SYS_Tasks ( void )
         DRV_SDMMC_PRIORITY_IDX0 ,
         (TaskHandle_t*)NULL
     );
+#endif
 
 
 
 
 
     /* Maintain Device Drivers */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        (void)xTaskCreateStatic( lDRV_MEMORY_0_Tasks,
+        "DRV_MEM_0_TASKS",
+        DRV_MEMORY_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_MEMORY_PRIORITY_IDX0 ,
+        lDRV_MEMORY_0_TasksStack,
+        &lDRV_MEMORY_0_TasksTCB
+    );
+#else
         (void)xTaskCreate( lDRV_MEMORY_0_Tasks,
         "DRV_MEM_0_TASKS",
         DRV_MEMORY_STACK_SIZE_IDX0,
@@ -152,6 +212,7 @@ void SYS_Tasks ( void )
         DRV_MEMORY_PRIORITY_IDX0 ,
         (TaskHandle_t*)NULL
     );
+#endif
 
 
 
@@ -161,6 +222,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_Tasks,
+           "APP_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_TasksStack,
+           &lAPP_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_Tasks,
            "APP_Tasks",
@@ -168,8 +239,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -58,6 +58,7 @@
 #include "bsp/bsp.h"
 #include "driver/sst26/drv_sst26.h"
 #include "system/time/sys_time.h"
+#include "system/profile/sys_profile.h"
 #include "driver/memory/drv_memory_efc.h"
 #include "peripheral/qspi/plib_qspi.h"
 #include "system/fs/sys_fs.h"
@@ -222,6 +223,18 @@ typedef struct
 
 extern SYSTEM_OBJECTS sysObj;
 
+#ifndef SYS_BOOT_TIME_ENABLE
+#define SYS_BOOT_TIME_ENABLE    false
+#endif
+
+#if (SYS_BOOT_TIME_ENABLE == true)
+/* Core clock cycles from the end of CLOCK_Initialize in SYS_Initialize to the
+   call of vTaskStartScheduler in SYS_Tasks, counted by the DWT cycle counter.
+   Divide by configCPU_CLOCK_HZ for the boot time in seconds. The C startup
+   code that runs before main is not included. */
+extern uint32_t SYS_BootCycles;
+#endif
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -496,6 +496,84 @@ bool QSPI_MemoryWrite( qspi_memory_xfer_t *qspi_memory_xfer, uint32_t *tx_data,
     return writeStatus;
 }
 
+bool QSPI_MemoryMapEnter( qspi_memory_xfer_t *qspi_memory_xfer )
+{
+    volatile uint32_t dummy = 0;
+
+    /* Dummy Read to clear QSPI_SR.INSTRE and QSPI_SR.CSR */
+    (void) QSPI_REGS->QSPI_SR;
+
+    /* Leave the read frame open. Every CPU or DMA read of the QSPI memory
+     * window from now on fetches the serial memory at the accessed offset,
+     * until QSPI_MemoryMapExit() is called. */
+    if (qspi_setup_transfer(qspi_memory_xfer, QSPI_MEM_READ, 0) == false)
+    {
+        return false;
+    }
+
+    /* Start the frame now, so that the instruction and the option code are
+     * sent and the serial memory is in continuous read mode on exit */
+    dummy = *(volatile uint32_t *)QSPIMEM_ADDR;
+    (void)dummy;
+
+    return true;
+}
+
+bool QSPI_MemoryMapExit( qspi_memory_xfer_t *qspi_memory_xfer )
+{
+    uint32_t mask = 0;
+    volatile uint32_t dummy = 0;
+
+    __DSB();
+    __ISB();
+
+    QSPI_EndTransfer();
+
+    while((QSPI_REGS->QSPI_SR& QSPI_SR_INSTRE_Msk) == 0U)
+    {
+        /* Poll Status register to know status if instruction has end */
+    }
+
+    if (qspi_memory_xfer->continuous_read_en)
+    {
+        /* The serial memory still waits for an address without instruction.
+         * Send one read without instruction and with the option code that
+         * takes the memory out of its continuous read mode. */
+        QSPI_REGS->QSPI_IAR = QSPI_IAR_ADDR(0U);
+
+        QSPI_REGS->QSPI_ICR = QSPI_ICR_OPT((uint32_t)qspi_memory_xfer->option);
+
+        mask |= (uint32_t)qspi_memory_xfer->width;
+        mask |= (uint32_t)qspi_memory_xfer->addr_len;
+        mask |= (uint32_t)qspi_memory_xfer->option_len;
+        mask |= QSPI_IFR_OPTEN_Msk;
+        mask |= QSPI_IFR_NBDUM((uint32_t)qspi_memory_xfer->dummy_cycles);
+        mask |= QSPI_IFR_ADDREN_Msk | QSPI_IFR_DATAEN_Msk;
+        mask |= QSPI_IFR_TFRTYP(QSPI_IFR_TFRTYP_TRSFR_READ_MEMORY_Val);
+
+        QSPI_REGS->QSPI_IFR = mask;
+
+        /* To synchronize APB and AHB accesses */
+        dummy = QSPI_REGS->QSPI_IFR;
+
+        dummy = *(volatile uint32_t *)QSPIMEM_ADDR;
+
+        (void) QSPI_REGS->QSPI_SR;
+        __DSB();
+        __ISB();
+
+        QSPI_EndTransfer();
+
+        while((QSPI_REGS->QSPI_SR& QSPI_SR_INSTRE_Msk) == 0U)
+        {
+            /* Poll Status register to know status if instruction has end */
+        }
+    }
+
+    (void)dummy;
+    return true;
+}
+
 /*******************************************************************************
  End of File
 */
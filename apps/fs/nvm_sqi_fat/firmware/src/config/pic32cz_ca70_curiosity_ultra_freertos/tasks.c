@@ -61,6 +61,16 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the SYS_FS_Tasks task. */
+static StackType_t lSYS_FS_TasksStack[SYS_FS_STACK_SIZE];
+static StaticTask_t lSYS_FS_TasksTCB;
+#endif
+
 static void lSYS_FS_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -77,6 +87,12 @@ TaskHandle_t xAPP_SST26_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_SST26_Tasks task. */
+static StackType_t lAPP_SST26_TasksStack[1024];
+static StaticTask_t lAPP_SST26_TasksTCB;
+#endif
+
 static void lAPP_SST26_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -91,6 +107,12 @@ TaskHandle_t xAPP_NVM_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_NVM_Tasks task. */
+static StackType_t lAPP_NVM_TasksStack[1024];
+static StaticTask_t lAPP_NVM_TasksTCB;
+#endif
+
 static void lAPP_NVM_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -105,6 +127,12 @@ TaskHandle_t xAPP_MONITOR_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_MONITOR_Tasks task. */
+static StackType_t lAPP_MONITOR_TasksStack[128];
+static StaticTask_t lAPP_MONITOR_TasksTCB;
+#endif
+
 static void lAPP_MONITOR_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -134,6 +162,16 @@ void SYS_Tasks ( void )
 {
     /* Maintain system services */
     
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void) xTaskCreateStatic( lSYS_FS_Tasks,
+        "SYS_FS_TASKS",
+        SYS_FS_STACK_SIZE,
+        (void*)NULL,
+        SYS_FS_PRIORITY ,
+        lSYS_FS_TasksStack,
+        &lSYS_FS_TasksTCB
+    );
+#else
     (void) xTaskCreate( lSYS_FS_Tasks,
         "SYS_FS_TASKS",
         SYS_FS_STACK_SIZE,
@@ -141,6 +179,7 @@ void SYS_Tasks ( void )
         SYS_FS_PRIORITY ,
         (TaskHandle_t*)NULL
     );
+#endif
 
 
 
@@ -155,6 +194,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_SST26_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_SST26_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_SST26_Tasks,
+           "APP_SST26_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lAPP_SST26_TasksStack,
+           &lAPP_SST26_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_SST26_Tasks,
            "APP_SST26_Tasks",
@@ -162,8 +211,19 @@ void SYS_Tasks ( void )
            NULL,
            2U ,
            &xAPP_SST26_Tasks);
+#endif
 
     /* Create OS Thread for APP_NVM_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_NVM_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_NVM_Tasks,
+           "APP_NVM_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lAPP_NVM_TasksStack,
+           &lAPP_NVM_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_NVM_Tasks,
            "APP_NVM_Tasks",
@@ -171,8 +231,19 @@ void SYS_Tasks ( void )
            NULL,
            2U ,
            &xAPP_NVM_Tasks);
+#endif
 
     /* Create OS Thread for APP_MONITOR_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_MONITOR_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_MONITOR_Tasks,
+           "APP_MONITOR_Tasks",
+           128,
+           NULL,
+           1U ,
+           lAPP_MONITOR_TasksStack,
+           &lAPP_MONITOR_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_MONITOR_Tasks,
            "APP_MONITOR_Tasks",
@@ -180,8 +251,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_MONITOR_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
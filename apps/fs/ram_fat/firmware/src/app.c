@@ -52,7 +52,9 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <stdio.h>
 #include "app.h"
+#include "system/fs/sys_fs_bench.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -70,6 +72,17 @@
 
 #define APP_FILE_NAME               "newfile.txt"
 
+/* Run the block device benchmark on the RAM disk once the demo has
+ * completed. The write tests restore the overwritten sectors, the file system
+ * is left intact unless power is lost while the benchmark runs. */
+#define APP_FS_BENCH_ENABLE         true
+
+/* Sectors per request of the benchmark. The first half of the benchmark
+ * buffer holds the request data, the second half the sectors saved for
+ * restore. */
+#define APP_FS_BENCH_SEQ_SECTORS    (8U)
+#define APP_FS_BENCH_RAND_SECTORS   (1U)
+
 #define KEEP                        __attribute__((keep, address(DRV_MEMORY_DEVICE_START_ADDRESS)))
 
 // *****************************************************************************
@@ -94,6 +107,30 @@ static uint8_t CACHE_ALIGN work[SYS_FS_FAT_MAX_SS];
 
 SYS_FS_FORMAT_PARAM formatOpt;
 
+static uint8_t CACHE_ALIGN fsBenchBuffer[2U * APP_FS_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE];
+
+/* Results of the last benchmark run, also printed when the run completes */
+static SYS_FS_BENCH_RESULT fsBenchResults[SYS_FS_BENCH_TEST_MAX];
+
+static const SYS_FS_BENCH_CONFIG fsBenchConfig =
+{
+    .diskNum        = 0,
+    .startSector    = 0,
+    .numSectors     = 0,
+    .seqSectors     = APP_FS_BENCH_SEQ_SECTORS,
+    .seqRequests    = 64,
+    .randSectors    = APP_FS_BENCH_RAND_SECTORS,
+    .randRequests   = 256,
+    .seed           = 0x5EED1234U,
+    .writeEnable    = true,
+    .preserveData   = true,
+    .buffer         = &fsBenchBuffer[0],
+    .saveBuffer     = &fsBenchBuffer[APP_FS_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE],
+    .fileDir        = APP_MOUNT_NAME,
+    .numFiles       = 8,
+    .fileSize       = 512
+};
+
 /* Create an array for reserving region in RAM for Fat File system */
 char CACHE_ALIGN RAM_FAT_MEDIA[DRV_MEMORY_DEVICE_MEDIA_SIZE_BYTES] KEEP;
 
@@ -435,7 +472,23 @@ void APP_Tasks ( void )
             }
             else
             {
-                appData.state = APP_UNMOUNT_DISK;
+                appData.state = APP_FS_BENCH;
+            }
+            break;
+        }
+
+        case APP_FS_BENCH:
+        {
+            appData.state = APP_UNMOUNT_DISK;
+
+            if (APP_FS_BENCH_ENABLE)
+            {
+                printf("\n\n\r Running block device benchmark\n\r");
+
+                if (SYS_FS_BENCH_Run(&fsBenchConfig, fsBenchResults) == false)
+                {
+                    appData.state = APP_ERROR;
+                }
             }
             break;
         }
@@ -6898,7 +6898,7 @@ int f_printf (
 	va_list argList		/* Optional arguments... */
 )
 {
-	va_list arp = argList;
+	va_list arp;
 	putbuff pb;
 	UINT i, j, w, f, r;
 	int prec;
@@ -6913,6 +6913,7 @@ int f_printf (
 	char d, str[SZ_NUM_BUF];
 
 
+	va_copy(arp, argList);
 	putc_init(&pb, fp);
 
 	for (;;) {
@@ -7043,6 +7044,7 @@ int f_printf (
 		}
 	}
 
+	va_end(arp);
 	return putc_flush(&pb);
 }
 
@@ -61,6 +61,16 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the SYS_FS_Tasks task. */
+static StackType_t lSYS_FS_TasksStack[SYS_FS_STACK_SIZE];
+static StaticTask_t lSYS_FS_TasksTCB;
+#endif
+
 static void lSYS_FS_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -71,6 +81,12 @@ static void lSYS_FS_Tasks(  void *pvParameters  )
 }
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the DRV_SDMMC0_Tasks task. */
+static StackType_t lDRV_SDMMC0_TasksStack[DRV_SDMMC_STACK_SIZE_IDX0];
+static StaticTask_t lDRV_SDMMC0_TasksTCB;
+#endif
+
 static void lDRV_SDMMC0_Tasks(  void *pvParameters  )
 {
     while(true)
@@ -86,6 +102,12 @@ TaskHandle_t xAPP_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_Tasks task. */
+static StackType_t lAPP_TasksStack[1024];
+static StaticTask_t lAPP_TasksTCB;
+#endif
+
 static void lAPP_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -115,6 +137,16 @@ void SYS_Tasks ( void )
 {
     /* Maintain system services */
     
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void) xTaskCreateStatic( lSYS_FS_Tasks,
+        "SYS_FS_TASKS",
+        SYS_FS_STACK_SIZE,
+        (void*)NULL,
+        SYS_FS_PRIORITY ,
+        lSYS_FS_TasksStack,
+        &lSYS_FS_TasksTCB
+    );
+#else
     (void) xTaskCreate( lSYS_FS_Tasks,
         "SYS_FS_TASKS",
         SYS_FS_STACK_SIZE,
@@ -122,7 +154,18 @@ void SYS_Tasks ( void )
         SYS_FS_PRIORITY ,
         (TaskHandle_t*)NULL
     );
+#endif
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    (void) xTaskCreateStatic( lDRV_SDMMC0_Tasks,
+        "DRV_SDMMC0_Tasks",
+        DRV_SDMMC_STACK_SIZE_IDX0,
+        (void*)NULL,
+        DRV_SDMMC_PRIORITY_IDX0 ,
+        lDRV_SDMMC0_TasksStack,
+        &lDRV_SDMMC0_TasksTCB
+    );
+#else
     (void) xTaskCreate( lDRV_SDMMC0_Tasks,
         "DRV_SDMMC0_Tasks",
         DRV_SDMMC_STACK_SIZE_IDX0,
@@ -130,6 +173,7 @@ void SYS_Tasks ( void )
         DRV_SDMMC_PRIORITY_IDX0 ,
         (TaskHandle_t*)NULL
     );
+#endif
 
 
 
@@ -144,6 +188,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_Tasks,
+           "APP_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_TasksStack,
+           &lAPP_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_Tasks,
            "APP_Tasks",
@@ -151,8 +205,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
@@ -0,0 +1,662 @@
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ * A Two-Level Segregated Fit (TLSF) implementation of pvPortMalloc() and
+ * vPortFree(). Both run in constant time regardless of the number of blocks
+ * in the heap, so they can be used by long running applications that create
+ * and delete tasks, queues and buffers.
+ *
+ * Free blocks are kept in segregated lists. The first level splits the sizes
+ * into power of two classes, the second level splits each class into
+ * heapSL_INDEX_COUNT linear ranges. Two bitmaps record which lists are not
+ * empty, so the smallest list that satisfies a request is found with two bit
+ * scans. A freed block is merged at once with its free physical neighbours.
+ *
+ * The heap keeps the counters read by vPortGetHeapStats() and the TLSF
+ * specific telemetry declared in heap_tlsf.h.
+ *
+ * See heap_1.c, heap_2.c, heap_4.c and the memory management pages of
+ * https://www.FreeRTOS.org for the other implementations.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "heap_tlsf.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#if ( portBYTE_ALIGNMENT != 8 )
+    #error heap_tlsf.c requires portBYTE_ALIGNMENT to be 8
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Number of second level lists per size class, as a power of two. */
+#define heapSL_INDEX_COUNT_LOG2    ( 4U )
+#define heapSL_INDEX_COUNT         ( 1U << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than this are all in the first class, split linearly. */
+#define heapSMALL_BLOCK_SIZE       ( ( size_t ) 1U << heapTLSF_FL_INDEX_SHIFT )
+
+/* The block size field holds the size of the block, header included. The
+ * sizes are multiples of portBYTE_ALIGNMENT, which leaves bit 0 to mark the
+ * free blocks. */
+#define heapBLOCK_FREE_BIT         ( ( size_t ) 1U )
+
+/* Only the physical neighbour pointer and the size are kept in an allocated
+ * block. The free list pointers overlay the application data. */
+#define heapBLOCK_HEADER_SIZE      ( offsetof( BlockLink_t, pxNextFreeBlock ) )
+#define heapMINIMUM_BLOCK_SIZE     ( sizeof( BlockLink_t ) )
+
+/* Blocks must stay below the first size class that has no free list. */
+#define heapMAXIMUM_BLOCK_SIZE     ( ( ( size_t ) 1U << configTLSF_FL_INDEX_MAX ) - portBYTE_ALIGNMENT )
+
+#define heapSIZE_MAX               ( ~( ( size_t ) 0 ) )
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )    ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Header of a block. The blocks tile the heap, each one starting where the
+ * previous one ends. */
+typedef struct A_TLSF_BLOCK_LINK
+{
+    struct A_TLSF_BLOCK_LINK * pxPrevPhysBlock; /*<< The block just below this one in memory, NULL for the first block. */
+    size_t xBlockSize;                          /*<< The size of the block, header included, and heapBLOCK_FREE_BIT. */
+    struct A_TLSF_BLOCK_LINK * pxNextFreeBlock; /*<< The next block in the same free list, free blocks only. */
+    struct A_TLSF_BLOCK_LINK * pxPrevFreeBlock; /*<< The previous block in the same free list, free blocks only. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Carves the first free block and the end marker out of ucHeap.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Free list housekeeping.
+ */
+static void prvInsertFreeBlock( BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+static void prvRemoveFreeBlock( BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* Heads of the free lists, and the bitmaps of the lists that are not empty. */
+PRIVILEGED_DATA static BlockLink_t * pxFreeLists[ heapTLSF_CLASS_COUNT ][ heapSL_INDEX_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFlBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSlBitmap[ heapTLSF_CLASS_COUNT ];
+
+/* Usable size of the heap, 0 until the heap is initialised. */
+PRIVILEGED_DATA static size_t xHeapSize = ( size_t ) 0U;
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
+
+/* Per size class counters. */
+PRIVILEGED_DATA static HeapClassStats_t xClassStats[ heapTLSF_CLASS_COUNT ];
+
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFls( size_t xValue )
+{
+    /* Index of the most significant bit set, xValue must not be 0. */
+    return ( UBaseType_t ) ( 31U - ( UBaseType_t ) __builtin_clz( ( uint32_t ) xValue ) );
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFfs( uint32_t ulValue )
+{
+    /* Index of the least significant bit set, ulValue must not be 0. */
+    return ( UBaseType_t ) __builtin_ctz( ulValue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xSize,
+                              UBaseType_t * puxFl,
+                              UBaseType_t * puxSl )
+{
+    UBaseType_t uxFl;
+
+    if( xSize < heapSMALL_BLOCK_SIZE )
+    {
+        *puxFl = 0U;
+        *puxSl = ( UBaseType_t ) ( xSize / ( heapSMALL_BLOCK_SIZE / heapSL_INDEX_COUNT ) );
+    }
+    else
+    {
+        uxFl = prvFls( xSize );
+        *puxSl = ( UBaseType_t ) ( ( xSize >> ( uxFl - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT );
+        *puxFl = uxFl - ( heapTLSF_FL_INDEX_SHIFT - 1U );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingSearch( size_t xSize,
+                              UBaseType_t * puxFl,
+                              UBaseType_t * puxSl )
+{
+    /* Round the size up to the next list boundary, so that any block of the
+     * list found is large enough. */
+    if( xSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xSize += ( ( size_t ) 1U << ( prvFls( xSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1U;
+    }
+
+    prvMappingInsert( xSize, puxFl, puxSl );
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvSearchSuitableBlock( UBaseType_t * puxFl,
+                                             UBaseType_t * puxSl )
+{
+    UBaseType_t uxFl = *puxFl;
+    uint32_t ulSlMap;
+    uint32_t ulFlMap;
+
+    if( uxFl >= ( UBaseType_t ) heapTLSF_CLASS_COUNT )
+    {
+        return NULL;
+    }
+
+    /* First look for a list of the same class with large enough blocks, then
+     * for the smallest non empty list of a larger class. */
+    ulSlMap = ulSlBitmap[ uxFl ] & ( ~( uint32_t ) 0U << *puxSl );
+
+    if( ulSlMap == 0U )
+    {
+        ulFlMap = ulFlBitmap & ( ~( uint32_t ) 0U << ( uxFl + 1U ) );
+
+        if( ulFlMap == 0U )
+        {
+            return NULL;
+        }
+
+        uxFl = prvFfs( ulFlMap );
+        ulSlMap = ulSlBitmap[ uxFl ];
+    }
+
+    *puxFl = uxFl;
+    *puxSl = prvFfs( ulSlMap );
+
+    return pxFreeLists[ *puxFl ][ *puxSl ];
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvNextPhysBlock( const BlockLink_t * pxBlock )
+{
+    return ( BlockLink_t * ) ( ( ( uint8_t * ) pxBlock ) + ( pxBlock->xBlockSize & ~heapBLOCK_FREE_BIT ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockLink_t * pxBlock )
+{
+    UBaseType_t uxFl;
+    UBaseType_t uxSl;
+    BlockLink_t * pxHead;
+
+    prvMappingInsert( pxBlock->xBlockSize & ~heapBLOCK_FREE_BIT, &uxFl, &uxSl );
+
+    pxHead = pxFreeLists[ uxFl ][ uxSl ];
+
+    pxBlock->pxNextFreeBlock = pxHead;
+    pxBlock->pxPrevFreeBlock = NULL;
+
+    if( pxHead != NULL )
+    {
+        pxHead->pxPrevFreeBlock = pxBlock;
+    }
+
+    pxFreeLists[ uxFl ][ uxSl ] = pxBlock;
+    ulFlBitmap |= ( 1UL << uxFl );
+    ulSlBitmap[ uxFl ] |= ( 1UL << uxSl );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockLink_t * pxBlock )
+{
+    UBaseType_t uxFl;
+    UBaseType_t uxSl;
+
+    prvMappingInsert( pxBlock->xBlockSize & ~heapBLOCK_FREE_BIT, &uxFl, &uxSl );
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+    }
+
+    if( pxBlock->pxPrevFreeBlock != NULL )
+    {
+        pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was the head of its list. */
+        pxFreeLists[ uxFl ][ uxSl ] = pxBlock->pxNextFreeBlock;
+
+        if( pxBlock->pxNextFreeBlock == NULL )
+        {
+            ulSlBitmap[ uxFl ] &= ~( 1UL << uxSl );
+
+            if( ulSlBitmap[ uxFl ] == 0U )
+            {
+                ulFlBitmap &= ~( 1UL << uxFl );
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock = NULL;
+    BlockLink_t * pxRemainder;
+    size_t xBlockSize = 0;
+    size_t xFoundSize;
+    UBaseType_t uxFl;
+    UBaseType_t uxSl;
+    UBaseType_t uxClass;
+    void * pvReturn = NULL;
+
+    vTaskSuspendAll();
+    {
+        if( xHeapSize == ( size_t ) 0U )
+        {
+            prvHeapInit();
+        }
+
+        if( ( xWantedSize > 0U ) && ( xWantedSize <= ( heapMAXIMUM_BLOCK_SIZE - heapBLOCK_HEADER_SIZE ) ) )
+        {
+            /* Add the header and round up to the alignment. */
+            xBlockSize = ( xWantedSize + heapBLOCK_HEADER_SIZE + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+            if( xBlockSize < heapMINIMUM_BLOCK_SIZE )
+            {
+                xBlockSize = heapMINIMUM_BLOCK_SIZE;
+            }
+
+            prvMappingSearch( xBlockSize, &uxFl, &uxSl );
+            pxBlock = prvSearchSuitableBlock( &uxFl, &uxSl );
+
+            if( pxBlock != NULL )
+            {
+                prvRemoveFreeBlock( pxBlock );
+
+                xFoundSize = pxBlock->xBlockSize & ~heapBLOCK_FREE_BIT;
+
+                if( ( xFoundSize - xBlockSize ) >= heapMINIMUM_BLOCK_SIZE )
+                {
+                    /* Return the end of the block to the free lists. */
+                    pxRemainder = ( BlockLink_t * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize );
+                    pxRemainder->pxPrevPhysBlock = pxBlock;
+                    pxRemainder->xBlockSize = ( xFoundSize - xBlockSize ) | heapBLOCK_FREE_BIT;
+                    prvNextPhysBlock( pxRemainder )->pxPrevPhysBlock = pxRemainder;
+                    prvInsertFreeBlock( pxRemainder );
+                }
+                else
+                {
+                    /* Too small to be split, hand out the whole block. */
+                    xBlockSize = xFoundSize;
+                }
+
+                pxBlock->xBlockSize = xBlockSize;
+
+                xFreeBytesRemaining -= xBlockSize;
+
+                if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+
+                prvMappingInsert( xBlockSize, &uxClass, &uxSl );
+                xClassStats[ uxClass ].xNumberOfSuccessfulAllocations++;
+                xNumberOfSuccessfulAllocations++;
+
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapBLOCK_HEADER_SIZE );
+            }
+            else
+            {
+                prvMappingInsert( xBlockSize, &uxClass, &uxSl );
+                xClassStats[ uxClass ].xNumberOfFailedAllocations++;
+            }
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pvReturn ) & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxNeighbour;
+    size_t xBlockSize;
+    UBaseType_t uxClass;
+    UBaseType_t uxSl;
+
+    if( pv != NULL )
+    {
+        pxBlock = ( BlockLink_t * ) ( ( ( uint8_t * ) pv ) - heapBLOCK_HEADER_SIZE );
+
+        /* Check the block is actually allocated. */
+        configASSERT( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0U );
+        configASSERT( pxBlock->xBlockSize >= heapMINIMUM_BLOCK_SIZE );
+
+        vTaskSuspendAll();
+        {
+            xBlockSize = pxBlock->xBlockSize;
+
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( pv, 0, xBlockSize - heapBLOCK_HEADER_SIZE );
+            }
+            #endif
+
+            xFreeBytesRemaining += xBlockSize;
+            prvMappingInsert( xBlockSize, &uxClass, &uxSl );
+            xClassStats[ uxClass ].xNumberOfSuccessfulFrees++;
+            xNumberOfSuccessfulFrees++;
+            traceFREE( pv, xBlockSize );
+
+            /* Merge with the following block if it is free. */
+            pxNeighbour = prvNextPhysBlock( pxBlock );
+
+            if( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0U )
+            {
+                prvRemoveFreeBlock( pxNeighbour );
+                xBlockSize += pxNeighbour->xBlockSize & ~heapBLOCK_FREE_BIT;
+            }
+
+            /* Merge with the preceding block if it is free. */
+            pxNeighbour = pxBlock->pxPrevPhysBlock;
+
+            if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0U ) )
+            {
+                prvRemoveFreeBlock( pxNeighbour );
+                xBlockSize += pxNeighbour->xBlockSize & ~heapBLOCK_FREE_BIT;
+                pxBlock = pxNeighbour;
+            }
+
+            pxBlock->xBlockSize = xBlockSize | heapBLOCK_FREE_BIT;
+            prvNextPhysBlock( pxBlock )->pxPrevPhysBlock = pxBlock;
+            prvInsertFreeBlock( pxBlock );
+        }
+        ( void ) xTaskResumeAll();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxFirstFreeBlock;
+    BlockLink_t * pxEndMarker;
+    portPOINTER_SIZE_TYPE uxAddress;
+    size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    uxAddress = ( portPOINTER_SIZE_TYPE ) ucHeap;
+
+    if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        uxAddress += ( portBYTE_ALIGNMENT - 1 );
+        uxAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+        xTotalHeapSize -= ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) ucHeap );
+    }
+
+    xTotalHeapSize &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+    /* The whole heap but the end marker is one free block. The end marker is
+     * an allocated block header that stops the merging at the end of the
+     * heap. */
+    pxFirstFreeBlock = ( BlockLink_t * ) uxAddress;
+    xHeapSize = xTotalHeapSize - heapBLOCK_HEADER_SIZE;
+
+    configASSERT( xHeapSize <= heapMAXIMUM_BLOCK_SIZE );
+
+    pxEndMarker = ( BlockLink_t * ) ( uxAddress + xHeapSize );
+    pxEndMarker->pxPrevPhysBlock = pxFirstFreeBlock;
+    pxEndMarker->xBlockSize = 0U;
+
+    pxFirstFreeBlock->pxPrevPhysBlock = NULL;
+    pxFirstFreeBlock->xBlockSize = xHeapSize | heapBLOCK_FREE_BIT;
+    prvInsertFreeBlock( pxFirstFreeBlock );
+
+    xFreeBytesRemaining = xHeapSize;
+    xMinimumEverFreeBytesRemaining = xHeapSize;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvLargestFreeBlockGet( void )
+{
+    UBaseType_t uxFl;
+    UBaseType_t uxSl;
+    BlockLink_t * pxBlock;
+    size_t xSize = 0U;
+
+    /* The largest block is in the highest non empty list. */
+    if( ulFlBitmap != 0U )
+    {
+        uxFl = prvFls( ulFlBitmap );
+        uxSl = prvFls( ulSlBitmap[ uxFl ] );
+
+        for( pxBlock = pxFreeLists[ uxFl ][ uxSl ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+        {
+            if( ( pxBlock->xBlockSize & ~heapBLOCK_FREE_BIT ) > xSize )
+            {
+                xSize = pxBlock->xBlockSize & ~heapBLOCK_FREE_BIT;
+            }
+        }
+    }
+
+    return xSize;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    UBaseType_t uxFl;
+    UBaseType_t uxSl;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    size_t xSize;
+
+    vTaskSuspendAll();
+    {
+        for( uxFl = 0U; uxFl < ( UBaseType_t ) heapTLSF_CLASS_COUNT; uxFl++ )
+        {
+            for( uxSl = 0U; uxSl < heapSL_INDEX_COUNT; uxSl++ )
+            {
+                for( pxBlock = pxFreeLists[ uxFl ][ uxSl ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+                {
+                    xSize = pxBlock->xBlockSize & ~heapBLOCK_FREE_BIT;
+                    xBlocks++;
+
+                    if( xSize > xMaxSize )
+                    {
+                        xMaxSize = xSize;
+                    }
+
+                    if( xSize < xMinSize )
+                    {
+                        xMinSize = xSize;
+                    }
+                }
+            }
+        }
+
+        pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+        pxHeapStats->xSizeOfSmallestFreeBlockInBytes = ( xBlocks > 0U ) ? xMinSize : 0U;
+        pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetHeapHighWaterMark( void )
+{
+    size_t xHighWaterMark;
+
+    vTaskSuspendAll();
+    {
+        xHighWaterMark = xHeapSize - xMinimumEverFreeBytesRemaining;
+    }
+    ( void ) xTaskResumeAll();
+
+    return xHighWaterMark;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortGetHeapFragmentation( void )
+{
+    UBaseType_t uxFragmentation = 0U;
+    size_t xLargest;
+
+    vTaskSuspendAll();
+    {
+        xLargest = prvLargestFreeBlockGet();
+
+        if( xFreeBytesRemaining > 0U )
+        {
+            uxFragmentation = ( UBaseType_t ) ( 100U - ( ( xLargest * 100U ) / xFreeBytesRemaining ) );
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    return uxFragmentation;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapClassStats( HeapClassStats_t * pxClassStats )
+{
+    UBaseType_t uxClass;
+
+    vTaskSuspendAll();
+    {
+        for( uxClass = 0U; uxClass < ( UBaseType_t ) heapTLSF_CLASS_COUNT; uxClass++ )
+        {
+            pxClassStats[ uxClass ] = xClassStats[ uxClass ];
+            pxClassStats[ uxClass ].xMaximumBlockSizeInBytes = ( ( size_t ) 1U << ( uxClass + heapTLSF_FL_INDEX_SHIFT ) ) - 1U;
+        }
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Reset the state in this file. This state is normally initialized at start up.
+ * This function must be called by the application before restarting the
+ * scheduler.
+ */
+void vPortHeapResetState( void )
+{
+    ( void ) memset( pxFreeLists, 0, sizeof( pxFreeLists ) );
+    ( void ) memset( ulSlBitmap, 0, sizeof( ulSlBitmap ) );
+    ( void ) memset( xClassStats, 0, sizeof( xClassStats ) );
+    ulFlBitmap = 0U;
+
+    xHeapSize = ( size_t ) 0U;
+    xFreeBytesRemaining = ( size_t ) 0U;
+    xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+    xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+    xNumberOfSuccessfulFrees = ( size_t ) 0U;
+}
+/*-----------------------------------------------------------*/
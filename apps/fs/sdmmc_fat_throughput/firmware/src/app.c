@@ -53,6 +53,10 @@
 // *****************************************************************************
 #include <string.h>
 #include "system/time/sys_time.h"
+#include "peripheral/hsmci/plib_hsmci.h"
+#include "system/fs/sys_fs_bench.h"
+#include "system/perf/sys_perf.h"
+#include "peripheral/uart/plib_uart1.h"
 #include "app.h"
 #include "user.h"
 
@@ -74,6 +78,30 @@
 
 #define BUFFER_SIZE         (65536UL)
 
+/* Repeat the aligned buffer throughput measurement for each HSMCI DMA burst
+ * setting once the demo has completed. Set to false to skip the sweep. */
+#define APP_BURST_SWEEP_ENABLE      true
+
+#define APP_BURST_SWEEP_COUNT       (sizeof(burstSweepSettings) / sizeof(burstSweepSettings[0]))
+
+/* Run the block device benchmark on the SD card once the demo has completed.
+ * The write tests restore the overwritten sectors, the file system on the
+ * card is left intact unless power is lost while the benchmark runs. */
+#define APP_FS_BENCH_ENABLE         true
+
+/* Sectors per request of the benchmark. The first half of the data buffer
+ * holds the request data, the second half the sectors saved for restore. */
+#define APP_FS_BENCH_SEQ_SECTORS    (64U)
+#define APP_FS_BENCH_RAND_SECTORS   (8U)
+
+/* Memory profile of the build, printed with the results so that runs of the
+ * TCM and the default build profiles can be compared */
+#if defined(TCM_ENABLE)
+#define APP_MEMORY_PROFILE          "ITCM/DTCM"
+#else
+#define APP_MEMORY_PROFILE          "Flash/SRAM"
+#endif
+
 // *****************************************************************************
 /* Application Data
 
@@ -96,6 +124,49 @@ static uint8_t CACHE_ALIGN dataBuffer[BUFFER_SIZE + 1];
 
 uint8_t *dataPtr = NULL;
 
+/* HSMCI DMA burst settings measured by the burst sweep */
+static const HSMCI_DMA_BURST burstSweepSettings[] =
+{
+    HSMCI_DMA_BURST_1,
+    HSMCI_DMA_BURST_4,
+    HSMCI_DMA_BURST_8,
+    HSMCI_DMA_BURST_16,
+    HSMCI_DMA_BURST_AUTO
+};
+
+static const char* const burstSweepNames[] =
+{
+    "1 word",
+    "4 words",
+    "8 words",
+    "16 words",
+    "Auto"
+};
+
+/* Write and read throughput in Megabytes/s of each burst setting */
+static float burstSweepWriteThroughput[APP_BURST_SWEEP_COUNT];
+static float burstSweepReadThroughput[APP_BURST_SWEEP_COUNT];
+
+/* Block device benchmark parameters */
+static const SYS_FS_BENCH_CONFIG fsBenchConfig =
+{
+    .diskNum        = 0,
+    .startSector    = 0,
+    .numSectors     = 0,
+    .seqSectors     = APP_FS_BENCH_SEQ_SECTORS,
+    .seqRequests    = 256,
+    .randSectors    = APP_FS_BENCH_RAND_SECTORS,
+    .randRequests   = 1000,
+    .seed           = 0x5EED1234U,
+    .writeEnable    = true,
+    .preserveData   = true,
+    .buffer         = &dataBuffer[0],
+    .saveBuffer     = &dataBuffer[APP_FS_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE],
+    .fileDir        = SDCARD_MOUNT_NAME,
+    .numFiles       = 32,
+    .fileSize       = 512
+};
+
 static const char messageBuffer[] =
 "\n\r-------------------------------------------------------------------"
 "\n\r\t         SD-Card Throughput Demo Application \t\t"
@@ -130,6 +201,11 @@ static void APP_SysFSEventHandler(SYS_FS_EVENT event,void* eventData,uintptr_t c
                 appData.useUnAlignedBuffer = false;
                 appData.rwCounter = 0;
 
+                /* Abort the burst sweep and restore the automatic burst selection */
+                appData.burstSweep = false;
+                appData.burstIndex = 0;
+                HSMCI_DmaBurstSet(HSMCI_DMA_BURST_AUTO);
+
                 appData.state = APP_MOUNT_WAIT;
 
                 LED_OFF();
@@ -187,6 +263,7 @@ void APP_Initialize ( void )
     }
 
     printf("%s", messageBuffer);
+    printf("\r Hot ISRs and driver state in %s\n\r", APP_MEMORY_PROFILE);
 }
 
 /******************************************************************************
@@ -201,6 +278,7 @@ void APP_Tasks ( void )
 {
     uint64_t diffCount = 0;
     size_t rwBytes = -1;
+    uint32_t i;
 
     /* Check the application's current state. */
     switch ( appData.state )
@@ -244,7 +322,14 @@ void APP_Tasks ( void )
             {
                 appData.state = APP_WRITE_TO_FILE;
 
-                if (appData.useUnAlignedBuffer == true)
+                if (appData.burstSweep == true)
+                {
+                    printf("\n\n\r Using Aligned Buffer, DMA burst of %s\n\r",
+                                burstSweepNames[appData.burstIndex]);
+
+                    dataPtr = (uint8_t *)&dataBuffer[0];
+                }
+                else if (appData.useUnAlignedBuffer == true)
                 {
                     printf("\n\n\r Using Un-Aligned Buffer\n\r");
 
@@ -380,10 +465,28 @@ void APP_Tasks ( void )
 
             SYS_FS_FileClose(appData.fileHandle);
 
-            /* Go to idle once throughput calculation is complete */
-            if (appData.useUnAlignedBuffer == true)
+            if (appData.burstSweep == true)
             {
-                appData.state = APP_IDLE;
+                burstSweepWriteThroughput[appData.burstIndex] = appData.writeThroughput;
+                burstSweepReadThroughput[appData.burstIndex] = appData.readThroughput;
+
+                appData.burstIndex++;
+                appData.state = APP_BURST_SWEEP_NEXT;
+            }
+            else if (appData.useUnAlignedBuffer == true)
+            {
+                if (APP_BURST_SWEEP_ENABLE)
+                {
+                    printf("\n\n\r Sweeping HSMCI DMA burst settings\n\r");
+
+                    appData.burstSweep = true;
+                    appData.burstIndex = 0;
+                    appData.state = APP_BURST_SWEEP_NEXT;
+                }
+                else
+                {
+                    appData.state = APP_FS_BENCH;
+                }
             }
             else
             {
@@ -395,10 +498,82 @@ void APP_Tasks ( void )
             break;
         }
 
+        case APP_BURST_SWEEP_NEXT:
+        {
+            if (appData.burstIndex < APP_BURST_SWEEP_COUNT)
+            {
+                HSMCI_DmaBurstSet(burstSweepSettings[appData.burstIndex]);
+
+                appData.state = APP_OPEN_FILE;
+            }
+            else
+            {
+                /* Sweep complete. Restore the automatic burst selection */
+                HSMCI_DmaBurstSet(HSMCI_DMA_BURST_AUTO);
+
+                printf("\n\n\r\t DMA Burst \t Write (MB/s) \t Read (MB/s)\r\n");
+
+                for (i = 0; i < APP_BURST_SWEEP_COUNT; i++)
+                {
+                    printf("\r\t %-8s \t %0.3f \t\t %0.3f\r\n", burstSweepNames[i],
+                                burstSweepWriteThroughput[i], burstSweepReadThroughput[i]);
+                }
+
+                appData.burstSweep = false;
+                appData.state = APP_FS_BENCH;
+            }
+            break;
+        }
+
+        case APP_FS_BENCH:
+        {
+            /* Go to idle once throughput calculation is complete */
+            appData.state = APP_IDLE;
+
+            if (APP_FS_BENCH_ENABLE)
+            {
+                printf("\n\n\r Running block device benchmark\n\r");
+
+                if (SYS_FS_BENCH_Run(&fsBenchConfig, NULL) == false)
+                {
+                    appData.state = APP_ERROR;
+                }
+            }
+
+#if (SYS_PERF_ENABLE == true)
+            /* Report the probes of the throughput and benchmark runs */
+            printf("\n\n\r Cycle count probes (p: print, r: clear)\n\r");
+            SYS_PERF_Dump();
+#endif
+            break;
+        }
+
         case APP_IDLE:
         {
             /* The application comes here when the demo has completed successfully.*/
             LED_ON();
+
+#if (SYS_PERF_ENABLE == true)
+            /* Console commands of the cycle count probes */
+            if (UART1_ReceiverIsReady() == true)
+            {
+                switch (UART1_ReadByte())
+                {
+                    case 'p':
+                        SYS_PERF_Dump();
+                        break;
+
+                    case 'r':
+                        SYS_PERF_Reset();
+                        printf("\r\n Cycle count probes cleared\r\n");
+                        break;
+
+                    default:
+                        printf("\r\n p: print the cycle count probes, r: clear them\r\n");
+                        break;
+                }
+            }
+#endif
             break;
         }
 
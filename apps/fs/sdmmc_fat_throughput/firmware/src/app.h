@@ -104,6 +104,12 @@ typedef enum
 
     APP_CLOSE_FILE,
 
+    /* Selects the next HSMCI DMA burst setting of the burst sweep */
+    APP_BURST_SWEEP_NEXT,
+
+    /* Runs the block device benchmark */
+    APP_FS_BENCH,
+
     APP_IDLE,
 
     APP_ERROR
@@ -141,6 +147,12 @@ typedef struct
     /* Flag to indicate usage of unaligned buffer */
     bool useUnAlignedBuffer;
 
+    /* Flag to indicate the HSMCI DMA burst sweep is in progress */
+    bool burstSweep;
+
+    /* Index of the burst setting being measured by the burst sweep */
+    uint32_t burstIndex;
+
     /* read-write counter */
     uint32_t rwCounter;
 
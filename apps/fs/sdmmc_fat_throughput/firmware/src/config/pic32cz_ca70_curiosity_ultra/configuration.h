@@ -111,6 +111,15 @@ extern "C" {
 #define SYS_FS_FAT_MAX_SS                 SYS_FS_MEDIA_MAX_BLOCK_SIZE
 #define SYS_FS_FAT_ALIGNED_BUFFER_LEN     512
 
+/* File System Block Device Benchmark Configuration */
+#define SYS_FS_BENCH_HISTOGRAM_BINS       (20U)
+#define SYS_FS_BENCH_PRINT(fmt, ...)      printf(fmt, ##__VA_ARGS__)
+
+/* Cycle Count Profiling Configuration */
+#define SYS_PERF_ENABLE                   false
+#define SYS_PERF_CPU_CLOCK_FREQUENCY      (300000000U)
+#define SYS_PERF_PRINT(fmt, ...)          printf(fmt, ##__VA_ARGS__)
+
 
 
 
@@ -70,6 +70,7 @@
 #include "system/cache/sys_cache.h"
 #include "osal/osal.h"
 #include "system/debug/sys_debug.h"
+#include "system/perf/sys_perf.h"
 #include "app.h"
 
 
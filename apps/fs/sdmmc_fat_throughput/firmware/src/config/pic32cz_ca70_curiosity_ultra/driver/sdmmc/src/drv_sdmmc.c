@@ -55,6 +55,7 @@
 #include "system/cache/sys_cache.h"
 #include <string.h>
 #include "driver/sdmmc/src/drv_sdmmc_file_system.h"
+#include "system/perf/sys_perf.h"
 
 static DRV_SDMMC_OBJ gDrvSDMMCObj[DRV_SDMMC_INSTANCES_NUMBER];
 
@@ -120,32 +121,64 @@ static DRV_SDMMC_CLIENT_OBJ* lDRV_SDMMC_DriverHandleValidate(DRV_HANDLE handle)
     return(clientObj);
 }
 
-static DRV_SDMMC_BUFFER_OBJ* lDRV_SDMMC_FreeBufferObjectGet(DRV_SDMMC_CLIENT_OBJ* clientObj)
+static void lDRV_SDMMC_FreeBufferObjectListInit(DRV_SDMMC_OBJ* dObj)
 {
     uint32_t index;
-    DRV_SDMMC_OBJ* dObj = (DRV_SDMMC_OBJ* )&gDrvSDMMCObj[clientObj->drvIndex];
     DRV_SDMMC_BUFFER_OBJ* pBufferObj = (DRV_SDMMC_BUFFER_OBJ*)dObj->bufferObjPool;
 
-    for (index = 0; index < dObj->bufferObjPoolSize; index++)
+    /* Chain all the buffer objects of the pool into the free list */
+    dObj->freeObjList = NULL;
+
+    for (index = dObj->bufferObjPoolSize; index > 0U; index--)
     {
-        if (pBufferObj[index].inUse == false)
-        {
-            pBufferObj[index].inUse = true;
-            pBufferObj[index].next = NULL;
+        pBufferObj[index - 1U].inUse = false;
+        pBufferObj[index - 1U].next = dObj->freeObjList;
+        dObj->freeObjList = &pBufferObj[index - 1U];
+    }
+}
 
-            /* Generate a unique buffer handle consisting of an incrementing
-             * token counter, driver index and the buffer index.
-             */
-            pBufferObj[index].commandHandle = (DRV_SDMMC_COMMAND_HANDLE)lDRV_SDMMC_MAKE_HANDLE(
-                dObj->sdmmcTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+static void lDRV_SDMMC_FreeBufferObjectPut(
+    DRV_SDMMC_OBJ* dObj,
+    DRV_SDMMC_BUFFER_OBJ* bufferObj
+)
+{
+    bufferObj->inUse = false;
 
-            /* Update the token for next time */
-            dObj->sdmmcTokenCount = lDRV_SDMMC_UPDATE_TOKEN(dObj->sdmmcTokenCount);
+    /* Return the buffer object to the head of the free list */
+    bufferObj->next = dObj->freeObjList;
+    dObj->freeObjList = bufferObj;
+}
 
-            return &pBufferObj[index];
-        }
+static DRV_SDMMC_BUFFER_OBJ* lDRV_SDMMC_FreeBufferObjectGet(DRV_SDMMC_CLIENT_OBJ* clientObj)
+{
+    uint32_t index;
+    DRV_SDMMC_OBJ* dObj = (DRV_SDMMC_OBJ* )&gDrvSDMMCObj[clientObj->drvIndex];
+    DRV_SDMMC_BUFFER_OBJ* pBufferObj = dObj->freeObjList;
+
+    if (pBufferObj == NULL)
+    {
+        /* All the buffer objects are in use */
+        return NULL;
     }
-    return NULL;
+
+    /* Take the buffer object at the head of the free list */
+    dObj->freeObjList = pBufferObj->next;
+
+    pBufferObj->inUse = true;
+    pBufferObj->next = NULL;
+
+    index = (uint32_t)(pBufferObj - (DRV_SDMMC_BUFFER_OBJ*)dObj->bufferObjPool);
+
+    /* Generate a unique buffer handle consisting of an incrementing
+     * token counter, driver index and the buffer index.
+     */
+    pBufferObj->commandHandle = (DRV_SDMMC_COMMAND_HANDLE)lDRV_SDMMC_MAKE_HANDLE(
+        dObj->sdmmcTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+
+    /* Update the token for next time */
+    dObj->sdmmcTokenCount = lDRV_SDMMC_UPDATE_TOKEN(dObj->sdmmcTokenCount);
+
+    return pBufferObj;
 }
 /* MISRA C-2012 Rule 11.3 deviated:12 Deviation record ID -  H3_MISRAC_2012_R_11_3_DR_1 */
 
@@ -159,6 +192,8 @@ static bool lDRV_SDMMC_BufferObjectAddToList(
 
     pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&(dObj->bufferObjList);
 
+    bufferObj->next = NULL;
+
     // Is the buffer object list empty?
     if (*pBufferObjList == NULL)
     {
@@ -167,22 +202,12 @@ static bool lDRV_SDMMC_BufferObjectAddToList(
     }
     else
     {
-        // List is not empty. Iterate to the end of the buffer object list.
-        while (*pBufferObjList != NULL)
-        {
-            if ((*pBufferObjList)->next == NULL)
-            {
-                // End of the list reached, add the buffer here.
-                (*pBufferObjList)->next = bufferObj;
-                break;
-            }
-            else
-            {
-                pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&((*pBufferObjList)->next);
-            }
-        }
+        // List is not empty. Add the buffer after the last buffer object.
+        dObj->bufferObjListTail->next = bufferObj;
     }
 
+    dObj->bufferObjListTail = bufferObj;
+
     return isFirstBufferInList;
 }
 
@@ -198,6 +223,47 @@ static DRV_SDMMC_BUFFER_OBJ* lDRV_SDMMC_BufferListGet(
     return pBufferObj;
 }
 
+#if (SYS_PERF_ENABLE == true)
+/* Profiling probe charged with a task call made in the given state */
+static SYS_PERF_PROBE lDRV_SDMMC_PerfProbeGet(
+    DRV_SDMMC_TASK_STATES taskState
+)
+{
+    SYS_PERF_PROBE probe;
+
+    switch (taskState)
+    {
+        case DRV_SDMMC_TASK_PROCESS_QUEUE:
+            probe = SYS_PERF_PROBE_SDMMC_QUEUE;
+            break;
+
+        case DRV_SDMMC_TASK_SELECT_CARD:
+        case DRV_SDMMC_TASK_SETUP_XFER:
+        case DRV_SDMMC_TASK_XFER_COMMAND:
+            probe = SYS_PERF_PROBE_SDMMC_SETUP;
+            break;
+
+        case DRV_SDMMC_TASK_WAIT_DATA_XFER_COMPLETE:
+            probe = SYS_PERF_PROBE_SDMMC_XFER;
+            break;
+
+        case DRV_SDMMC_TASK_XFER_STATUS:
+        case DRV_SDMMC_TASK_SEND_STOP_TRANS_CMD:
+        case DRV_SDMMC_TASK_CHECK_CARD_STATUS:
+        case DRV_SDMMC_TASK_DESELECT_CARD:
+        case DRV_SDMMC_TASK_TRANSFER_COMPLETE:
+            probe = SYS_PERF_PROBE_SDMMC_STATUS;
+            break;
+
+        default:
+            probe = SYS_PERF_PROBE_SDMMC_OTHER;
+            break;
+    }
+
+    return probe;
+}
+#endif
+
 static void lDRV_SDMMC_RemoveBufferObjFromList(
     DRV_SDMMC_OBJ* dObj
 )
@@ -210,12 +276,18 @@ static void lDRV_SDMMC_RemoveBufferObjFromList(
     if (*pBufferObjList != NULL)
     {
         /* Save the buffer object to be removed. Set the next buffer object as
-         * the new head of the linked list. Reset the removed buffer object. */
+         * the new head of the linked list. Return the removed buffer object to
+         * the free list. */
 
         DRV_SDMMC_BUFFER_OBJ* temp = *pBufferObjList;
         *pBufferObjList = (*pBufferObjList)->next;
-        temp->next = NULL;
-        temp->inUse = false;
+
+        if (*pBufferObjList == NULL)
+        {
+            dObj->bufferObjListTail = NULL;
+        }
+
+        lDRV_SDMMC_FreeBufferObjectPut(dObj, temp);
     }
 }
 
@@ -226,6 +298,7 @@ static void lDRV_SDMMC_RemoveClientBuffersFromList(
 {
     DRV_SDMMC_BUFFER_OBJ** pBufferObjList;
     DRV_SDMMC_BUFFER_OBJ* delBufferObj = NULL;
+    DRV_SDMMC_BUFFER_OBJ* prevBufferObj = NULL;
 
     pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&(dObj->bufferObjList);
 
@@ -248,14 +321,20 @@ static void lDRV_SDMMC_RemoveClientBuffersFromList(
                 clientObj->eventHandler((SYS_MEDIA_BLOCK_EVENT)DRV_SDMMC_EVENT_COMMAND_ERROR, delBufferObj->commandHandle, clientObj->context);
             }
 
-            // Reset the deleted node
+            // The last node was deleted, the previous node is the new tail
+            if (dObj->bufferObjListTail == delBufferObj)
+            {
+                dObj->bufferObjListTail = prevBufferObj;
+            }
+
+            // Return the deleted node to the free list
             delBufferObj->status = DRV_SDMMC_COMMAND_COMPLETED;
-            delBufferObj->next = NULL;
-            delBufferObj->inUse = false;
+            lDRV_SDMMC_FreeBufferObjectPut(dObj, delBufferObj);
         }
         else
         {
             // Move to the next node
+            prevBufferObj = *pBufferObjList;
             pBufferObjList = (DRV_SDMMC_BUFFER_OBJ**)&((*pBufferObjList)->next);
         }
     }
@@ -288,10 +367,11 @@ static void lDRV_SDMMC_RemoveBufferObjects (
             clientObj->eventHandler((SYS_MEDIA_BLOCK_EVENT)DRV_SDMMC_EVENT_COMMAND_ERROR, delBufferObj->commandHandle, clientObj->context);
         }
 
-        // Reset the deleted node
-        delBufferObj->next = NULL;
-        delBufferObj->inUse = false;
+        // Return the deleted node to the free list
+        lDRV_SDMMC_FreeBufferObjectPut(dObj, delBufferObj);
     }
+
+    dObj->bufferObjListTail = NULL;
 }
 
 static void lDRV_SDMMC_UpdateGeometry( DRV_SDMMC_OBJ* dObj )
@@ -314,7 +394,7 @@ static void lDRV_SDMMC_UpdateGeometry( DRV_SDMMC_OBJ* dObj )
 }
 
 
-static void lDRV_SDMMC_PlibCallbackHandler(
+static void TCM_CODE lDRV_SDMMC_PlibCallbackHandler(
     DRV_SDMMC_XFER_STATUS xferStatus,
     uintptr_t contextHandle
 )
@@ -3019,10 +3099,13 @@ SYS_MODULE_OBJ DRV_SDMMC_Initialize (
     dObj->mediaState                        = SYS_MEDIA_DETACHED;
     dObj->clockState                        = DRV_SDMMC_CLOCK_SET_DIVIDER;
     dObj->bufferObjList                     = 0U;
+    dObj->bufferObjListTail                 = NULL;
     dObj->isExclusive                       = false;
     dObj->isCmdTimerExpired                 = false;
     dObj->sleepWhenIdle                     = sdmmcInit->sleepWhenIdle;
 
+    lDRV_SDMMC_FreeBufferObjectListInit(dObj);
+
     /* Register a callback with the underlying SDMMC PLIB */
     dObj->sdmmcPlib->sdhostCallbackRegister(lDRV_SDMMC_PlibCallbackHandler, (uintptr_t)dObj);
 
@@ -3766,7 +3849,7 @@ bool DRV_SDMMC_IsWriteProtected (
     return isWriteProtected;
 }
 
-void DRV_SDMMC_Tasks( SYS_MODULE_OBJ object )
+void TCM_CODE DRV_SDMMC_Tasks( SYS_MODULE_OBJ object )
 {
     DRV_SDMMC_OBJ* dObj = NULL;
     DRV_SDMMC_CLIENT_OBJ* clientObj = NULL;
@@ -3782,6 +3865,8 @@ void DRV_SDMMC_Tasks( SYS_MODULE_OBJ object )
         SYS_ASSERT(false, "SDMMC Driver: OSAL_MUTEX_Lock failed");
     }
 
+    SYS_PERF_PROBE_BEGIN(perfCtx, lDRV_SDMMC_PerfProbeGet(dObj->taskState));
+
     currentBufObj = lDRV_SDMMC_BufferListGet(dObj);
 
     switch (dObj->taskState)
@@ -4466,6 +4551,8 @@ void DRV_SDMMC_Tasks( SYS_MODULE_OBJ object )
             break;
     }
 
+    SYS_PERF_PROBE_END(perfCtx);
+
     if (OSAL_MUTEX_Unlock(&dObj->mutex) != OSAL_RESULT_SUCCESS)
     {
         SYS_ASSERT(false, "SDMMC Driver: OSAL_MUTEX_Unlock failed");
@@ -53,7 +53,11 @@
 // Section: Configuration Bits
 // ****************************************************************************
 // ****************************************************************************
+#if defined(TCM_ENABLE)
+#pragma config TCM_CONFIGURATION = 2
+#else
 #pragma config TCM_CONFIGURATION = 0
+#endif
 #pragma config SECURITY_BIT = CLEAR
 #pragma config BOOT_MODE = SET
 
@@ -73,10 +77,10 @@
 // <editor-fold defaultstate="collapsed" desc="DRV_SDMMC Instance 0 Initialization Data">
 
 /* SDMMC Client Objects Pool */
-static DRV_SDMMC_CLIENT_OBJ drvSDMMC0ClientObjPool[DRV_SDMMC_IDX0_CLIENTS_NUMBER];
+static DRV_SDMMC_CLIENT_OBJ TCM_DATA drvSDMMC0ClientObjPool[DRV_SDMMC_IDX0_CLIENTS_NUMBER];
 
 /* SDMMC Transfer Objects Pool */
-static DRV_SDMMC_BUFFER_OBJ drvSDMMC0BufferObjPool[DRV_SDMMC_IDX0_QUEUE_SIZE];
+static DRV_SDMMC_BUFFER_OBJ TCM_DATA drvSDMMC0BufferObjPool[DRV_SDMMC_IDX0_QUEUE_SIZE];
 
 static const DRV_SDMMC_PLIB_API drvSDMMC0PlibAPI = {
     .sdhostCallbackRegister = (DRV_SDMMC_PLIB_CALLBACK_REGISTER)HSMCI_CallbackRegister,
@@ -282,6 +286,11 @@ void SYS_Initialize ( void* data )
     CLOCK_Initialize();
 	PIO_Initialize();
 
+#if (SYS_PERF_ENABLE == true)
+    /* Start the cycle counter before any instrumented module runs */
+    SYS_PERF_Initialize();
+#endif
+
     XDMAC_Initialize();
 
 
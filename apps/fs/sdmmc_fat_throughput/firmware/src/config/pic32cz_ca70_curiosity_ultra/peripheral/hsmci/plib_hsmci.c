@@ -42,6 +42,7 @@
 #include "plib_hsmci.h"
 #include "peripheral/xdmac/plib_xdmac.h"
 #include "interrupts.h"
+#include "system/perf/sys_perf.h"
 
 #define HSMCI_DMA_CHANNEL      0U
 
@@ -51,7 +52,7 @@
 // *****************************************************************************
 // *****************************************************************************
 static const uint8_t* hsmciFifoBaseAddress = (uint8_t*)(HSMCI_BASE_ADDRESS + HSMCI_FIFO_REG_OFST);
-static volatile HSMCI_OBJECT hsmciObj;
+static volatile HSMCI_OBJECT TCM_DATA hsmciObj;
 
 static void HSMCI_VariablesInit ( void )
 {
@@ -59,10 +60,45 @@ static void HSMCI_VariablesInit ( void )
     hsmciObj.isCmdInProgress = false;
     hsmciObj.isDataInProgress = false;
     hsmciObj.callback = NULL;
+    hsmciObj.dmaBurst = HSMCI_DMA_BURST_AUTO;
 }
 
-void __attribute__((used)) HSMCI_InterruptHandler(void)
+/* Returns the chunk/burst size in words to use for a transfer of numWords
+   words to/from the given buffer. The size must divide the transfer so that
+   the last HSMCI chunk request is complete, and in auto mode the buffer must
+   be aligned to the burst so that no memory burst crosses a 1 KB boundary. */
+static uint32_t HSMCI_DmaBurstSelect ( const uint8_t* buffer, uint32_t numWords )
 {
+    uint32_t burst = (uint32_t)hsmciObj.dmaBurst;
+    uint32_t address = (uint32_t)(uintptr_t)buffer;
+
+    if (burst == (uint32_t)HSMCI_DMA_BURST_AUTO)
+    {
+        burst = (uint32_t)HSMCI_DMA_BURST_16;
+
+        while ((burst > 1U) && ((address & ((burst * 4U) - 1U)) != 0U))
+        {
+            burst >>= 1U;
+        }
+    }
+
+    while ((burst > 1U) && ((numWords & (burst - 1U)) != 0U))
+    {
+        burst >>= 1U;
+    }
+
+    /* There is no memory burst of two beats */
+    if (burst == 2U)
+    {
+        burst = 1U;
+    }
+
+    return burst;
+}
+
+void __attribute__((used)) TCM_CODE HSMCI_InterruptHandler(void)
+{
+    SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_HSMCI_ISR);
     uint32_t intMask = 0U;
     uint32_t intFlags = 0U;
     HSMCI_XFER_STATUS xferStatus = (HSMCI_XFER_STATUS) 0;
@@ -72,6 +108,7 @@ void __attribute__((used)) HSMCI_InterruptHandler(void)
 
     if ((intMask & intFlags) == 0U)
     {
+        SYS_PERF_PROBE_END(perfCtx);
         return;
     }
 
@@ -145,6 +182,8 @@ void __attribute__((used)) HSMCI_InterruptHandler(void)
         uintptr_t context = hsmciObj.context;
         hsmciObj.callback(xferStatus, context);
     }
+
+    SYS_PERF_PROBE_END(perfCtx);
 }
 
 uint16_t HSMCI_CommandErrorGet(void)
@@ -210,7 +249,37 @@ void HSMCI_DmaSetup (
     HSMCI_DATA_TRANSFER_DIR operation
 )
 {
-    HSMCI_REGS->HSMCI_DMA = HSMCI_DMA_DMAEN_Msk;
+    uint32_t numWords = numBytes/4U;
+    uint32_t burstSettings = 0U;
+    uint32_t chunkSize = HSMCI_DMA_CHKSIZE_1;
+
+    switch (HSMCI_DmaBurstSelect(buffer, numWords))
+    {
+        case 16U:
+            chunkSize = HSMCI_DMA_CHKSIZE_16;
+            burstSettings = XDMAC_CC_MBSIZE_SIXTEEN | XDMAC_CC_CSIZE_CHK_16;
+            break;
+
+        case 8U:
+            chunkSize = HSMCI_DMA_CHKSIZE_8;
+            burstSettings = XDMAC_CC_MBSIZE_EIGHT | XDMAC_CC_CSIZE_CHK_8;
+            break;
+
+        case 4U:
+            chunkSize = HSMCI_DMA_CHKSIZE_4;
+            burstSettings = XDMAC_CC_MBSIZE_FOUR | XDMAC_CC_CSIZE_CHK_4;
+            break;
+
+        default:
+            chunkSize = HSMCI_DMA_CHKSIZE_1;
+            burstSettings = XDMAC_CC_MBSIZE_SINGLE | XDMAC_CC_CSIZE_CHK_1;
+            break;
+    }
+
+    /* The HSMCI raises a DMA request once a full chunk is available in (read)
+     * or can be accepted by (write) its FIFO, so its chunk size must match the
+     * XDMAC chunk size */
+    HSMCI_REGS->HSMCI_DMA = HSMCI_DMA_DMAEN_Msk | chunkSize;
 
     XDMAC_ChannelDisable((XDMAC_CHANNEL) HSMCI_DMA_CHANNEL);
 
@@ -218,9 +287,8 @@ void HSMCI_DmaSetup (
     {
         (void) XDMAC_ChannelSettingsSet((XDMAC_CHANNEL) HSMCI_DMA_CHANNEL,
                             XDMAC_CC_TYPE_PER_TRAN
-                            | XDMAC_CC_MBSIZE_SINGLE
+                            | burstSettings
                             | XDMAC_CC_DSYNC_PER2MEM
-                            | XDMAC_CC_CSIZE_CHK_1
                             | XDMAC_CC_DWIDTH_WORD
                             | XDMAC_CC_SIF_AHB_IF1
                             | XDMAC_CC_DIF_AHB_IF0
@@ -233,16 +301,15 @@ void HSMCI_DmaSetup (
             (XDMAC_CHANNEL) HSMCI_DMA_CHANNEL,
             hsmciFifoBaseAddress,
             buffer,
-            (numBytes/4U)
+            numWords
         );
     }
     else
     {
        (void) XDMAC_ChannelSettingsSet((XDMAC_CHANNEL) HSMCI_DMA_CHANNEL,
                     XDMAC_CC_TYPE_PER_TRAN
-                    | XDMAC_CC_MBSIZE_SINGLE
+                    | burstSettings
                     | XDMAC_CC_DSYNC_MEM2PER
-                    | XDMAC_CC_CSIZE_CHK_1
                     | XDMAC_CC_DWIDTH_WORD
                     | XDMAC_CC_SIF_AHB_IF0
                     | XDMAC_CC_DIF_AHB_IF1
@@ -255,11 +322,21 @@ void HSMCI_DmaSetup (
             (XDMAC_CHANNEL) HSMCI_DMA_CHANNEL,
             buffer,
             hsmciFifoBaseAddress,
-            (numBytes/4U)
+            numWords
         );
    }
 }
 
+void HSMCI_DmaBurstSet ( HSMCI_DMA_BURST burst )
+{
+    hsmciObj.dmaBurst = burst;
+}
+
+HSMCI_DMA_BURST HSMCI_DmaBurstGet ( void )
+{
+    return hsmciObj.dmaBurst;
+}
+
 void HSMCI_BlockSizeSet ( uint16_t blockSize )
 {
     uint32_t xblocksize = blockSize;
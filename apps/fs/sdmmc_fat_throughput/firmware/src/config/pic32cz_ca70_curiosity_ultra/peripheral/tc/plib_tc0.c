@@ -54,6 +54,7 @@
 #include "device.h"
 #include "plib_tc0.h"
 #include "interrupts.h"
+#include "system/perf/sys_perf.h"
 
  
  
@@ -62,7 +63,7 @@
 
 
 /* Callback object for channel 0 */
-static volatile TC_TIMER_CALLBACK_OBJECT TC0_CH0_CallbackObj;
+static volatile TC_TIMER_CALLBACK_OBJECT TCM_DATA TC0_CH0_CallbackObj;
 
 /* Initialize channel in timer mode */
 void TC0_CH0_TimerInitialize (void)
@@ -130,10 +131,22 @@ void TC0_CH0_TimerCallbackRegister(TC_TIMER_CALLBACK callback, uintptr_t context
 }
 
 /* Interrupt handler for Channel 0 */
-void __attribute__((used)) TC0_CH0_InterruptHandler(void)
+void __attribute__((used)) TCM_CODE TC0_CH0_InterruptHandler(void)
 {
+#if (SYS_PERF_ENABLE == true)
+    /* Timer counts since the compare match, read first to measure the interrupt entry */
+    uint16_t latency = (uint16_t)(TC0_REGS->TC_CHANNEL[0].TC_CV - TC0_REGS->TC_CHANNEL[0].TC_RA);
+#endif
     TC_TIMER_STATUS timer_status = (TC_TIMER_STATUS)(TC0_REGS->TC_CHANNEL[0].TC_SR & TC_TIMER_STATUS_MSK);
 
+#if (SYS_PERF_ENABLE == true)
+    if ((timer_status & TC_TIMER_COMPARE_MATCH) != 0U)
+    {
+        SYS_PERF_SAMPLE_ADD(SYS_PERF_PROBE_TIME_IRQ_LATENCY,
+            (uint32_t)latency * (SYS_PERF_CPU_CLOCK_FREQUENCY / TC0_CH0_TimerFrequencyGet()));
+    }
+#endif
+
     /* Additional temporary variable used to prevent MISRA violations (Rule 13.x) */
     uintptr_t context = TC0_CH0_CallbackObj.context;
 
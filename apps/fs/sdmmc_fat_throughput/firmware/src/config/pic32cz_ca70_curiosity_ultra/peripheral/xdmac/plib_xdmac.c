@@ -41,6 +41,7 @@
 #include "device.h"
 #include "plib_xdmac.h"
 #include "interrupts.h"
+#include "system/perf/sys_perf.h"
 
 /* Macro for limiting XDMAC objects to highest channel enabled */
 #define XDMAC_ACTIVE_CHANNELS_MAX (1U)
@@ -54,15 +55,16 @@ typedef struct
     bool busyStatus;
 } XDMAC_CH_OBJECT ;
 
-static volatile XDMAC_CH_OBJECT xdmacChannelObj[XDMAC_ACTIVE_CHANNELS_MAX];
+static volatile XDMAC_CH_OBJECT TCM_DATA xdmacChannelObj[XDMAC_ACTIVE_CHANNELS_MAX];
 
 // *****************************************************************************
 // *****************************************************************************
 // Section: XDMAC Implementation
 // *****************************************************************************
 // *****************************************************************************
-void __attribute__((used)) XDMAC_InterruptHandler( void )
+void __attribute__((used)) TCM_CODE XDMAC_InterruptHandler( void )
 {
+    SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_XDMAC_ISR);
     uint32_t chanIntStatus;
     uint32_t channel;
 
@@ -109,6 +111,8 @@ void __attribute__((used)) XDMAC_InterruptHandler( void )
 
         }
     }
+
+    SYS_PERF_PROBE_END(perfCtx);
 }
 
 void XDMAC_Initialize( void )
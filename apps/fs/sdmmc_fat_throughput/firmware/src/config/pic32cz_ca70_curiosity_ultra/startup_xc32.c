@@ -76,6 +76,17 @@ extern int main(void);
 
 
 
+/* Enable TCM memory */
+__STATIC_INLINE void __attribute__((optimize("-O1"))) TCM_Enable(void)
+{
+    __DSB();
+    __ISB();
+    SCB->ITCMCR = (SCB_ITCMCR_EN_Msk | SCB_ITCMCR_RMW_Msk | SCB_ITCMCR_RETEN_Msk);
+    SCB->DTCMCR = (SCB_DTCMCR_EN_Msk | SCB_DTCMCR_RMW_Msk | SCB_DTCMCR_RETEN_Msk);
+    __DSB();
+    __ISB();
+}
+
 /* Disable TCM memory */
 __STATIC_INLINE void __attribute__((optimize("-O1"))) TCM_Disable(void)
 {
@@ -201,10 +212,15 @@ void __attribute__((optimize("-O1"), section(".text.Reset_Handler"), long_call,
     FPU_Enable();
 #endif
 
-    TCM_Configure(0U);
+    TCM_Configure(TCM_SIZE_CONFIG);
 
+#if defined(TCM_ENABLE)
+    /* Enable TCM  */
+    TCM_Enable();
+#else
     /* Disable TCM  */
     TCM_Disable();
+#endif
 
     /* Initialize data after TCM is enabled.
      * Data initialization from the XC32 .dinit template */
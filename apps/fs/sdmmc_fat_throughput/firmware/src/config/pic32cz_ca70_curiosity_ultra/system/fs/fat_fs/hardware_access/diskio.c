@@ -10,6 +10,7 @@
 #include <string.h>
 #include "diskio.h"        /* FatFs lower layer API */
 #include "system/fs/sys_fs_media_manager.h"
+#include "system/perf/sys_perf.h"
 
 
 #define CACHE_ALIGN_CHECK  (CACHE_LINE_SIZE - 1)
@@ -147,6 +148,7 @@ DRESULT disk_read
     uint32_t count   /* Number of sectors to read (1..128) */
 )
 {
+    SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_DISK_READ);
     DRESULT result = RES_ERROR;
 
     uint32_t i = 0;
@@ -208,6 +210,8 @@ DRESULT disk_read
         result = disk_read_aligned(pdrv, buff, sector, count);
     }
 
+    SYS_PERF_PROBE_END(perfCtx);
+
     return result;
 }
 
@@ -224,6 +228,7 @@ DRESULT disk_write
     uint32_t count       /* Number of sectors to write (1..128) */
 )
 {
+    SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_DISK_WRITE);
     DRESULT result = RES_ERROR;
 
     uint32_t bytesToTransfer    = 0;
@@ -295,6 +300,8 @@ DRESULT disk_write
         result = disk_checkCommandStatus(pdrv);
     }
 
+    SYS_PERF_PROBE_END(perfCtx);
+
     return result;
 }
 #endif
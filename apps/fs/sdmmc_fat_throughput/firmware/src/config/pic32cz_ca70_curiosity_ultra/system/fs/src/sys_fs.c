@@ -44,6 +44,7 @@
 
 #include "system/fs/src/sys_fs_local.h"
 #include "system/fs/sys_fs_media_manager.h"
+#include "system/perf/sys_perf.h"
 
 // *****************************************************************************
 /* Registration table for each native file system
@@ -1111,6 +1112,8 @@ size_t SYS_FS_FileRead
     }
     else
     {
+        SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_FS_FILE_READ);
+
         fileStatus = fileObj->mountPoint->fsFunctions->read_t(
                 fileObj->nativeFSFileObj,
                 buffer,
@@ -1120,6 +1123,8 @@ size_t SYS_FS_FileRead
         /* Release the acquired mutex. */
         (void) OSAL_MUTEX_Unlock(&(fileObj->mountPoint->mutexDiskVolume));
 
+        SYS_PERF_PROBE_END(perfCtx);
+
         if (fileStatus != 0)
         {
             /* There was an error with the read operation. Update the error value.
@@ -2461,6 +2466,8 @@ size_t SYS_FS_FileWrite
     }
     else
     {
+        SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_FS_FILE_WRITE);
+
         fileStatus = fileObj->mountPoint->fsFunctions->write_t(
                 fileObj->nativeFSFileObj,
                 buffer,
@@ -2470,6 +2477,8 @@ size_t SYS_FS_FileWrite
         /* Release the acquired mutex. */
         (void) OSAL_MUTEX_Unlock(&(fileObj->mountPoint->mutexDiskVolume));
 
+        SYS_PERF_PROBE_END(perfCtx);
+
         if (fileStatus != 0)
         {
             /* There was an error while writing to the file. Update the error
@@ -42,6 +42,7 @@
 #include "system/fs/src/sys_fs_media_manager_local.h"
 #include "system/fs/src/sys_fs_local.h"
 #include "system/fs/fat_fs/file_system/ff.h"
+#include "system/perf/sys_perf.h"
 
 static const char *gSYSFSVolumeName [] = {
     "nvm",
@@ -998,6 +999,8 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorWrite
         return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
     }
 
+    SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_MEDIA_SECTOR_WRITE);
+
     mediaWriteBlockSize = mediaObj->mediaGeometry->geometryTable[1].blockSize;
 
     if (mediaWriteBlockSize > 512U)
@@ -1020,6 +1023,7 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorWrite
     {
         mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
         mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), dataBuffer, sector, numSectors);
+        SYS_PERF_PROBE_END(perfCtx);
         return (mediaObj->commandHandle);
     }
     else
@@ -1067,6 +1071,7 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorWrite
                     gSYSFSMediaManagerObj.muteEventNotification = false;
 
                     /* Media read operation failed. */
+                    SYS_PERF_PROBE_END(perfCtx);
                     return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
                 }
 
@@ -1106,6 +1111,7 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorWrite
                 gSYSFSMediaManagerObj.muteEventNotification = false;
 
                 /* Media write operation failed. */
+                SYS_PERF_PROBE_END(perfCtx);
                 return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
             }
 
@@ -1123,6 +1129,8 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorWrite
     mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
     mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), data, memoryBlock, 1);
 
+    SYS_PERF_PROBE_END(perfCtx);
+
     return (mediaObj->commandHandle);
 }
 
@@ -0,0 +1,205 @@
+/*******************************************************************************
+  Cycle Count Profiling Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_perf.c
+
+  Summary:
+    Cycle count profiling implementation.
+
+  Description:
+    This file implements the initialization and the report of the cycle count
+    profiling probes. The probes themselves are inline, see sys_perf.h.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "system/perf/sys_perf.h"
+
+#if (SYS_PERF_ENABLE == true)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+SYS_PERF_PROBE_DATA TCM_DATA gSysPerfProbeData[SYS_PERF_PROBE_MAX];
+
+static const char* const gSysPerfProbeNames[SYS_PERF_PROBE_MAX] =
+{
+    "sdmmc_queue",
+    "sdmmc_setup",
+    "sdmmc_xfer",
+    "sdmmc_status",
+    "sdmmc_other",
+    "fs_read",
+    "fs_write",
+    "disk_read",
+    "disk_write",
+    "mm_sector_write",
+    "xdmac_isr",
+    "hsmci_isr",
+    "time_cb",
+    "time_irq_lat"
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Largest number of cycles counted by a histogram bin */
+static uint32_t lSYS_PERF_BinUpperGet(uint32_t bin)
+{
+    uint32_t shift;
+
+    if (bin < 4U)
+    {
+        return bin;
+    }
+
+    shift = (bin >> 2) - 1U;
+
+    return (((4U + (bin & 3U) + 1U) << shift) - 1U);
+}
+
+static uint32_t lSYS_PERF_CyclesToNs(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000000ULL) / (uint64_t)SYS_PERF_CPU_CLOCK_FREQUENCY);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+void SYS_PERF_Initialize ( void )
+{
+    /* Enable the trace unit, unlock the DWT and start the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    SYS_PERF_Reset();
+}
+
+void SYS_PERF_Reset ( void )
+{
+    uint32_t i;
+
+    (void) memset(gSysPerfProbeData, 0, sizeof(gSysPerfProbeData));
+
+    for (i = 0; i < (uint32_t)SYS_PERF_PROBE_MAX; i++)
+    {
+        gSysPerfProbeData[i].min = UINT32_MAX;
+    }
+}
+
+uint32_t SYS_PERF_PercentileGet ( SYS_PERF_PROBE probe, uint32_t percent )
+{
+    const SYS_PERF_PROBE_DATA* data;
+    uint32_t target;
+    uint32_t total = 0;
+    uint32_t bin;
+
+    if ((probe >= SYS_PERF_PROBE_MAX) || (percent == 0U) || (percent > 100U))
+    {
+        return 0;
+    }
+
+    data = &gSysPerfProbeData[probe];
+
+    if (data->count == 0U)
+    {
+        return 0;
+    }
+
+    /* Rank of the sample holding the percentile, rounded up */
+    target = (uint32_t)((((uint64_t)data->count * percent) + 99U) / 100U);
+
+    for (bin = 0; bin < SYS_PERF_HISTOGRAM_BINS; bin++)
+    {
+        total += data->histogram[bin];
+
+        if (total >= target)
+        {
+            break;
+        }
+    }
+
+    if (bin >= SYS_PERF_HISTOGRAM_BINS)
+    {
+        return data->max;
+    }
+
+    bin = lSYS_PERF_BinUpperGet(bin);
+
+    return (bin < data->max) ? bin : data->max;
+}
+
+void SYS_PERF_Dump ( void )
+{
+    const SYS_PERF_PROBE_DATA* data;
+    uint32_t avg;
+    uint32_t p99;
+    uint32_t i;
+
+    for (i = 0; i < (uint32_t)SYS_PERF_PROBE_MAX; i++)
+    {
+        data = &gSysPerfProbeData[i];
+
+        if (data->count == 0U)
+        {
+            continue;
+        }
+
+        avg = (uint32_t)(data->sum / data->count);
+        p99 = SYS_PERF_PercentileGet((SYS_PERF_PROBE)i, 99);
+
+        SYS_PERF_PRINT("PERF probe=%s n=%lu min=%lu avg=%lu p99=%lu max=%lu cyc avg_ns=%lu p99_ns=%lu max_ns=%lu\r\n",
+                        gSysPerfProbeNames[i], (unsigned long)data->count,
+                        (unsigned long)data->min, (unsigned long)avg,
+                        (unsigned long)p99, (unsigned long)data->max,
+                        (unsigned long)lSYS_PERF_CyclesToNs(avg), (unsigned long)lSYS_PERF_CyclesToNs(p99),
+                        (unsigned long)lSYS_PERF_CyclesToNs(data->max));
+    }
+}
+
+#endif // (SYS_PERF_ENABLE == true)
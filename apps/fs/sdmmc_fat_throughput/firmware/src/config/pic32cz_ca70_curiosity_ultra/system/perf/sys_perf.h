@@ -0,0 +1,405 @@
+/*************************************************************************
+Cycle Count Profiling Service Interface Declarations and Types
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_perf.h
+
+  Summary:
+    Cycle count profiling interface declarations and types.
+
+  Description:
+    This file contains function, type and macro declarations of an opt-in
+    profiling layer which measures the execution time of hot paths with the
+    DWT cycle counter and accumulates the samples in per probe histograms.
+  *************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_PERF_H_
+#define SYS_PERF_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+#include "device.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Build Parameters
+// *****************************************************************************
+// *****************************************************************************
+
+/* Enables the probes. When false the probes, the sample storage and the
+ * interface routines compile to nothing. */
+#ifndef SYS_PERF_ENABLE
+    #define SYS_PERF_ENABLE                 false
+#endif
+
+/* Output of the probe report. Defaults to the system console, can be
+ * redirected (for example to printf) from configuration.h. */
+#if (SYS_PERF_ENABLE == true) && !defined(SYS_PERF_PRINT)
+    #include "system/debug/sys_debug.h"
+    #define SYS_PERF_PRINT(fmt, ...)        SYS_CONSOLE_PRINT(fmt, ##__VA_ARGS__)
+#endif
+
+/* Number of histogram bins. Samples below 4 cycles have a bin each, every
+ * further power of two range of cycles is split into 4 bins, so that a bin
+ * is at most 25% wide. 124 bins cover the full 32-bit cycle range. */
+#define SYS_PERF_HISTOGRAM_BINS             (124U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* SYS PERF Probes
+
+  Summary:
+    Identifies the instrumented hot paths.
+
+  Description:
+    This enumeration identifies the instrumented hot paths. The name of each
+    probe in the report is given in the comment.
+
+  Remarks:
+    Each probe must be updated from a single execution context (one task or
+    one interrupt), which is what makes the sample storage lock free. The
+    time of a probe includes the time spent in interrupts which preempted it.
+*/
+
+typedef enum
+{
+    /* "sdmmc_queue": DRV_SDMMC_Tasks in the queue processing state */
+    SYS_PERF_PROBE_SDMMC_QUEUE = 0,
+
+    /* "sdmmc_setup": DRV_SDMMC_Tasks selecting the card and issuing the
+     * transfer command */
+    SYS_PERF_PROBE_SDMMC_SETUP,
+
+    /* "sdmmc_xfer": DRV_SDMMC_Tasks waiting for the data transfer */
+    SYS_PERF_PROBE_SDMMC_XFER,
+
+    /* "sdmmc_status": DRV_SDMMC_Tasks completing the transfer */
+    SYS_PERF_PROBE_SDMMC_STATUS,
+
+    /* "sdmmc_other": DRV_SDMMC_Tasks in the attach, initialization,
+     * detach and error states */
+    SYS_PERF_PROBE_SDMMC_OTHER,
+
+    /* "fs_read": SYS_FS_FileRead */
+    SYS_PERF_PROBE_FS_FILE_READ,
+
+    /* "fs_write": SYS_FS_FileWrite */
+    SYS_PERF_PROBE_FS_FILE_WRITE,
+
+    /* "disk_read": FAT FS disk_read */
+    SYS_PERF_PROBE_DISK_READ,
+
+    /* "disk_write": FAT FS disk_write */
+    SYS_PERF_PROBE_DISK_WRITE,
+
+    /* "mm_sector_write": SYS_FS_MEDIA_MANAGER_SectorWrite */
+    SYS_PERF_PROBE_MEDIA_SECTOR_WRITE,
+
+    /* "xdmac_isr": XDMAC_InterruptHandler */
+    SYS_PERF_PROBE_XDMAC_ISR,
+
+    /* "hsmci_isr": HSMCI_InterruptHandler */
+    SYS_PERF_PROBE_HSMCI_ISR,
+
+    /* "time_cb": SYS_TIME_PLIBCallback */
+    SYS_PERF_PROBE_TIME_CALLBACK,
+
+    /* "time_irq_lat": interrupt latency of the SYS_TIME compare match, from
+     * the match to the entry of TC0_CH0_InterruptHandler */
+    SYS_PERF_PROBE_TIME_IRQ_LATENCY,
+
+    SYS_PERF_PROBE_MAX
+
+} SYS_PERF_PROBE;
+
+// *****************************************************************************
+/* SYS PERF Probe Data
+
+  Summary:
+    Samples accumulated by a probe.
+
+  Description:
+    This structure holds the samples accumulated by a probe, in CPU cycles.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t count;
+
+    uint32_t min;
+
+    uint32_t max;
+
+    uint64_t sum;
+
+    uint32_t histogram[SYS_PERF_HISTOGRAM_BINS];
+
+} SYS_PERF_PROBE_DATA;
+
+// *****************************************************************************
+/* SYS PERF Probe Context
+
+  Summary:
+    Holds a probe measurement in progress.
+
+  Remarks:
+    Declared by SYS_PERF_PROBE_BEGIN.
+*/
+
+typedef struct
+{
+    SYS_PERF_PROBE probe;
+
+    uint32_t start;
+
+} SYS_PERF_CONTEXT;
+
+#if (SYS_PERF_ENABLE == true)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Probe Macros and Inline Routines
+// *****************************************************************************
+// *****************************************************************************
+
+/* Sample storage, indexed by SYS_PERF_PROBE */
+extern SYS_PERF_PROBE_DATA gSysPerfProbeData[SYS_PERF_PROBE_MAX];
+
+// *****************************************************************************
+/* Function:
+    void SYS_PERF_SampleAdd
+    (
+        SYS_PERF_PROBE probe,
+        uint32_t cycles
+    );
+
+  Summary:
+    Adds a sample to a probe.
+
+  Description:
+    This function adds a sample to the statistics and the histogram of a
+    probe. It is normally called through SYS_PERF_PROBE_END.
+
+  Remarks:
+    None.
+*/
+
+__STATIC_INLINE void SYS_PERF_SampleAdd(SYS_PERF_PROBE probe, uint32_t cycles)
+{
+    SYS_PERF_PROBE_DATA* data = &gSysPerfProbeData[probe];
+    uint32_t msb = 31U - (uint32_t)__CLZ(cycles | 1U);
+    uint32_t bin = cycles;
+
+    if (cycles >= 4U)
+    {
+        bin = ((msb - 1U) << 2) + ((cycles >> (msb - 2U)) & 3U);
+    }
+
+    data->count++;
+    data->sum += cycles;
+
+    if (cycles < data->min)
+    {
+        data->min = cycles;
+    }
+
+    if (cycles > data->max)
+    {
+        data->max = cycles;
+    }
+
+    data->histogram[bin]++;
+}
+
+/* Starts a measurement of probe. ctx names the local measurement context, the
+ * macro must be placed where a declaration is allowed. */
+#define SYS_PERF_PROBE_BEGIN(ctx, probeId)  SYS_PERF_CONTEXT ctx = { (probeId), DWT->CYCCNT }
+
+/* Ends the measurement started by SYS_PERF_PROBE_BEGIN and records it */
+#define SYS_PERF_PROBE_END(ctx)             SYS_PERF_SampleAdd((ctx).probe, DWT->CYCCNT - (ctx).start)
+
+/* Records a sample measured by other means, in CPU cycles */
+#define SYS_PERF_SAMPLE_ADD(probeId, cycles) SYS_PERF_SampleAdd((probeId), (cycles))
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+//*****************************************************************************
+/* Function:
+    void SYS_PERF_Initialize ( void );
+
+  Summary:
+    Starts the DWT cycle counter and clears the samples of every probe.
+
+  Description:
+    This function enables the trace unit, unlocks and starts the DWT cycle
+    counter and clears the samples of every probe.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    Called from SYS_Initialize, before any instrumented module runs.
+*/
+
+void SYS_PERF_Initialize ( void );
+
+//*****************************************************************************
+/* Function:
+    void SYS_PERF_Reset ( void );
+
+  Summary:
+    Clears the samples of every probe.
+
+  Description:
+    This function clears the samples of every probe.
+
+  Precondition:
+    SYS_PERF_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    A sample recorded by an interrupt while the probes are being cleared may
+    be partially cleared.
+*/
+
+void SYS_PERF_Reset ( void );
+
+//*****************************************************************************
+/* Function:
+    uint32_t SYS_PERF_PercentileGet
+    (
+        SYS_PERF_PROBE probe,
+        uint32_t percent
+    );
+
+  Summary:
+    Returns a percentile of the samples of a probe.
+
+  Description:
+    This function returns the upper bound, in cycles, of the histogram bin
+    holding the given percentile of the samples of a probe, limited to the
+    largest sample.
+
+  Precondition:
+    SYS_PERF_Initialize must have been called.
+
+  Parameters:
+    probe - Probe.
+
+    percent - Percentile, 1 to 100.
+
+  Returns:
+    Percentile in cycles. 0 if the probe has no samples.
+
+  Remarks:
+    The result is at most 25% above the exact percentile.
+*/
+
+uint32_t SYS_PERF_PercentileGet ( SYS_PERF_PROBE probe, uint32_t percent );
+
+//*****************************************************************************
+/* Function:
+    void SYS_PERF_Dump ( void );
+
+  Summary:
+    Prints the statistics of every probe.
+
+  Description:
+    This function prints one line per probe with samples, through
+    SYS_PERF_PRINT:
+
+    <code>
+    PERF probe=disk_read n=2048 min=1830 avg=2215 p99=4095 max=5120 cyc avg_ns=7383 p99_ns=13650 max_ns=17066
+    </code>
+
+  Precondition:
+    SYS_PERF_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    The samples are read while the probes keep running, so the line of a
+    probe updated during the report may mix samples of two states.
+*/
+
+void SYS_PERF_Dump ( void );
+
+#else
+
+#define SYS_PERF_PROBE_BEGIN(ctx, probeId)
+#define SYS_PERF_PROBE_END(ctx)
+#define SYS_PERF_SAMPLE_ADD(probeId, cycles)
+
+#endif // (SYS_PERF_ENABLE == true)
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif /* SYS_PERF_H_ */
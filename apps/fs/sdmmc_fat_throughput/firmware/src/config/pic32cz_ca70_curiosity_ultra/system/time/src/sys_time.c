@@ -50,6 +50,7 @@
 #include "system/time/sys_time.h"
 #include "configuration.h"
 #include "sys_time_local.h"
+#include "system/perf/sys_perf.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -57,9 +58,9 @@
 // *****************************************************************************
 // *****************************************************************************
 
-static SYS_TIME_COUNTER_OBJ gSystemCounterObj;
+static SYS_TIME_COUNTER_OBJ TCM_DATA gSystemCounterObj;
 
-static SYS_TIME_TIMER_OBJ timers[SYS_TIME_MAX_TIMERS];
+static SYS_TIME_TIMER_OBJ TCM_DATA timers[SYS_TIME_MAX_TIMERS];
 
 /* This a global token counter used to generate unique timer handles */
 static uint16_t gSysTimeTokenCount = 1;
@@ -153,7 +154,7 @@ static SYS_TIME_TIMER_OBJ* SYS_TIME_GetTimerObject(SYS_TIME_HANDLE handle)
     return NULL;
 }
 
-static void SYS_TIME_HwTimerCompareUpdate(void)
+static void TCM_CODE SYS_TIME_HwTimerCompareUpdate(void)
 {
     uint64_t nextHwCounterValue = 0;
     uint64_t currHwCounterValue;
@@ -517,8 +518,9 @@ static void SYS_TIME_UpdateTime(uint32_t elapsedCounts)
     }
 }
 
-static void SYS_TIME_PLIBCallback(uint32_t status, uintptr_t context)
+static void TCM_CODE SYS_TIME_PLIBCallback(uint32_t status, uintptr_t context)
 {
+    SYS_PERF_PROBE_BEGIN(perfCtx, SYS_PERF_PROBE_TIME_CALLBACK);
     SYS_TIME_COUNTER_OBJ* counterObj = (SYS_TIME_COUNTER_OBJ *)&gSystemCounterObj;
     SYS_TIME_TIMER_OBJ* tmrActive = counterObj->tmrActive;
     uint32_t elapsedCount = 0;
@@ -542,6 +544,8 @@ static void SYS_TIME_PLIBCallback(uint32_t status, uintptr_t context)
     interruptState = SYS_INT_Disable();
     SYS_TIME_HwTimerCompareUpdate();
     SYS_INT_Restore(interruptState);
+
+    SYS_PERF_PROBE_END(perfCtx);
 }
 
 static SYS_TIME_HANDLE SYS_TIME_TimerObjectCreate(
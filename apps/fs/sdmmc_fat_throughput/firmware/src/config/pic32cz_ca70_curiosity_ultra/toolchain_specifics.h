@@ -48,6 +48,22 @@ extern "C" {
 
 #define CACHE_ALIGNED_SIZE_GET(size)     ((size) + ((((size) % (CACHE_LINE_SIZE))!= 0U)? ((CACHE_LINE_SIZE) - ((size) % (CACHE_LINE_SIZE))) : (0U)))
 
+/* Tightly coupled memory. The TCM build profile defines TCM_ENABLE and links
+ * with -mitcm=65536 -mdtcm=65536; TCM_CODE then places a function in ITCM
+ * and TCM_DATA a variable in DTCM. TCM_SIZE_CONFIG is the matching GPNVM
+ * TCM configuration (0: none, 1: 32 KB, 2: 64 KB, 3: 128 KB each).
+ * DTCM is not cached, XDMAC reaches it only through the AHBS port, so DMA
+ * buffers stay in SRAM. */
+#if defined(TCM_ENABLE)
+#define TCM_SIZE_CONFIG    (2U)
+#define TCM_CODE           __attribute__((tcm))
+#define TCM_DATA           __attribute__((tcm))
+#else
+#define TCM_SIZE_CONFIG    (0U)
+#define TCM_CODE
+#define TCM_DATA
+#endif
+
 #ifndef FORMAT_ATTRIBUTE
    #define FORMAT_ATTRIBUTE(archetype, string_index, first_to_check)  __attribute__ ((format (archetype, string_index, first_to_check)))
 #endif
@@ -52,9 +52,15 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <stdio.h>
 #include "app.h"
 #include "bsp/bsp.h"
 #include "user.h"
+#include "system/time/sys_time.h"
+#include "system/fs/sys_fs_bench.h"
+#if defined(SYS_DMA_POOL_SIZE)
+#include "system/dma/sys_dma_pool.h"
+#endif
 // *****************************************************************************
 // *****************************************************************************
 // Section: Global Data Definitions
@@ -68,6 +74,32 @@
 
 #define APP_DATA_LEN         512
 
+/* SDSPI driver benchmark: APP_BENCH_TRANSFERS single sector reads of
+ * APP_BENCH_SECTOR, each written back unchanged, through a second client of
+ * the SDSPI driver. Every sector transfer is made of several small SPI DMA
+ * transfers (command, response, token and data) on the driver buffers. With
+ * a DMA pool the run is done with the pool mapped non-cacheable and then
+ * cacheable, so that the cost of the cache maintenance is reported. */
+#define APP_BENCH_SECTOR          (0U)
+#define APP_BENCH_TRANSFERS       (64U)
+
+#if defined(SYS_DMA_POOL_SIZE) && (SYS_DMA_POOL_NON_CACHEABLE == true)
+#define APP_BENCH_MODES           (2U)
+#else
+#define APP_BENCH_MODES           (1U)
+#endif
+
+/* Run the block device benchmark on the SD card once the demo has
+ * completed. The write tests restore the overwritten sectors, the file system
+ * is left intact unless power is lost while the benchmark runs. */
+#define APP_FS_BENCH_ENABLE         true
+
+/* Sectors per request of the benchmark. The first half of the benchmark
+ * buffer holds the request data, the second half the sectors saved for
+ * restore. */
+#define APP_FS_BENCH_SEQ_SECTORS    (16U)
+#define APP_FS_BENCH_RAND_SECTORS   (1U)
+
 // *****************************************************************************
 /* Application Data
 
@@ -87,6 +119,30 @@ APP_DATA appData;
 
 static uint8_t BUFFER_ATTRIBUTES readWriteBuffer[APP_DATA_LEN];
 
+static uint8_t BUFFER_ATTRIBUTES fsBenchBuffer[2U * APP_FS_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE];
+
+/* Results of the last benchmark run, also printed when the run completes */
+static SYS_FS_BENCH_RESULT fsBenchResults[SYS_FS_BENCH_TEST_MAX];
+
+static const SYS_FS_BENCH_CONFIG fsBenchConfig =
+{
+    .diskNum        = 0,
+    .startSector    = 0,
+    .numSectors     = 0,
+    .seqSectors     = APP_FS_BENCH_SEQ_SECTORS,
+    .seqRequests    = 64,
+    .randSectors    = APP_FS_BENCH_RAND_SECTORS,
+    .randRequests   = 256,
+    .seed           = 0x5EED1234U,
+    .writeEnable    = true,
+    .preserveData   = true,
+    .buffer         = &fsBenchBuffer[0],
+    .saveBuffer     = &fsBenchBuffer[APP_FS_BENCH_SEQ_SECTORS * SYS_FS_BENCH_SECTOR_SIZE],
+    .fileDir        = SDCARD_MOUNT_NAME,
+    .numFiles       = 16,
+    .fileSize       = 512
+};
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Callback Functions
@@ -103,8 +159,43 @@ static uint8_t BUFFER_ATTRIBUTES readWriteBuffer[APP_DATA_LEN];
 // *****************************************************************************
 
 
-/* TODO:  Add any necessary local functions.
-*/
+/* Average time of one transfer, in nanoseconds */
+static uint32_t APP_BenchmarkAverageNs(uint64_t count)
+{
+    uint64_t frequency = (uint64_t)SYS_TIME_FrequencyGet();
+
+    if (frequency == 0U)
+    {
+        return 0U;
+    }
+
+    return (uint32_t)(((count / APP_BENCH_TRANSFERS) * 1000000000ULL) / frequency);
+}
+
+/* Returns true once the sector transfer of the benchmark has completed, its
+ * time is then added to elapsed. A failed transfer ends the benchmark. */
+static bool APP_BenchmarkTransferDone(uint64_t* elapsed)
+{
+    DRV_SDSPI_COMMAND_STATUS status = DRV_SDSPI_CommandStatusGet(appData.benchHandle, appData.benchCommandHandle);
+    bool isDone = false;
+
+    if (status == DRV_SDSPI_COMMAND_COMPLETED)
+    {
+        *elapsed += SYS_TIME_Counter64Get() - appData.benchStartCount;
+        isDone = true;
+    }
+    else if (status == DRV_SDSPI_COMMAND_ERROR_UNKNOWN)
+    {
+        DRV_SDSPI_Close(appData.benchHandle);
+        appData.state = APP_ERROR;
+    }
+    else
+    {
+        /* Queued or in progress */
+    }
+
+    return isDone;
+}
 
 
 // *****************************************************************************
@@ -283,9 +374,128 @@ void APP_Tasks ( void )
             SYS_FS_FileClose(appData.fileHandle);
             SYS_FS_FileClose(appData.fileHandle1);
 
-            /* The test was successful. Lets idle. */
+            /* The test was successful. Run the benchmark. */
+            appData.state = APP_BENCHMARK_OPEN;
+            break;
+
+        case APP_BENCHMARK_OPEN:
+            appData.benchHandle = DRV_SDSPI_Open(DRV_SDSPI_INDEX_0, DRV_IO_INTENT_READWRITE);
+
+            if (appData.benchHandle == DRV_HANDLE_INVALID)
+            {
+                appData.state = APP_ERROR;
+            }
+            else
+            {
+                appData.benchMode = 0U;
+                appData.state = APP_BENCHMARK_MODE;
+            }
+            break;
+
+        case APP_BENCHMARK_MODE:
+            /* The first run is done with the pool non-cacheable, the second
+             * one with the pool cacheable. No transfer is in progress here, so
+             * the mapping can be changed. */
+#if (APP_BENCH_MODES > 1U)
+            (void) SYS_DMA_POOL_NonCacheableSet(appData.benchMode == 0U);
+#endif
+#if defined(SYS_DMA_POOL_SIZE)
+            appData.benchNonCacheable = SYS_DMA_POOL_IsNonCacheable();
+#else
+            appData.benchNonCacheable = false;
+#endif
+            appData.benchReadCount = 0U;
+            appData.benchWriteCount = 0U;
+            appData.benchTransfers = 0U;
+            appData.state = APP_BENCHMARK_READ;
+            break;
+
+        case APP_BENCHMARK_READ:
+            appData.benchStartCount = SYS_TIME_Counter64Get();
+
+            SDCARD_SECTOR_READ(appData.benchHandle, &appData.benchCommandHandle, readWriteBuffer, APP_BENCH_SECTOR, 1U);
+
+            if (appData.benchCommandHandle == DRV_SDSPI_COMMAND_HANDLE_INVALID)
+            {
+                DRV_SDSPI_Close(appData.benchHandle);
+                appData.state = APP_ERROR;
+            }
+            else
+            {
+                appData.state = APP_BENCHMARK_READ_WAIT;
+            }
+            break;
+
+        case APP_BENCHMARK_READ_WAIT:
+            if (APP_BenchmarkTransferDone(&appData.benchReadCount) == true)
+            {
+                appData.state = APP_BENCHMARK_WRITE;
+            }
+            break;
+
+        case APP_BENCHMARK_WRITE:
+            /* Write back the sector just read, the card content is unchanged */
+            appData.benchStartCount = SYS_TIME_Counter64Get();
+
+            SDCARD_SECTOR_WRITE(appData.benchHandle, &appData.benchCommandHandle, readWriteBuffer, APP_BENCH_SECTOR, 1U);
+
+            if (appData.benchCommandHandle == DRV_SDSPI_COMMAND_HANDLE_INVALID)
+            {
+                DRV_SDSPI_Close(appData.benchHandle);
+                appData.state = APP_ERROR;
+            }
+            else
+            {
+                appData.state = APP_BENCHMARK_WRITE_WAIT;
+            }
+            break;
+
+        case APP_BENCHMARK_WRITE_WAIT:
+            if (APP_BenchmarkTransferDone(&appData.benchWriteCount) == true)
+            {
+                appData.benchTransfers++;
+                appData.state = (appData.benchTransfers < APP_BENCH_TRANSFERS) ? APP_BENCHMARK_READ : APP_BENCHMARK_REPORT;
+            }
+            break;
+
+        case APP_BENCHMARK_REPORT:
+            printf("\n\rSDSPIBENCH pool=%s transfers=%u read_ns=%lu write_ns=%lu",
+                appData.benchNonCacheable ? "noncacheable" : "cacheable", (unsigned int)APP_BENCH_TRANSFERS,
+                (unsigned long)APP_BenchmarkAverageNs(appData.benchReadCount),
+                (unsigned long)APP_BenchmarkAverageNs(appData.benchWriteCount));
+
+            appData.benchMode++;
+
+            if (appData.benchMode < APP_BENCH_MODES)
+            {
+                appData.state = APP_BENCHMARK_MODE;
+            }
+            else
+            {
+#if (APP_BENCH_MODES > 1U)
+                /* Back to the configured mapping */
+                (void) SYS_DMA_POOL_NonCacheableSet(true);
+#endif
+                DRV_SDSPI_Close(appData.benchHandle);
+                appData.state = APP_FS_BENCH;
+            }
+            break;
+
+        case APP_FS_BENCH:
+        {
             appData.state = APP_IDLE;
+
+            if (APP_FS_BENCH_ENABLE)
+            {
+                printf("\n\n\r Running block device benchmark\n\r");
+
+                if (SYS_FS_BENCH_Run(&fsBenchConfig, fsBenchResults) == false)
+                {
+                    appData.state = APP_ERROR;
+                }
+            }
             break;
+        }
 
         case APP_IDLE:
             /* The application comes here when the demo has completed
@@ -58,6 +58,7 @@
 #include <stdlib.h>
 #include "configuration.h"
 #include "system/fs/sys_fs.h"
+#include "driver/sdspi/drv_sdspi.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -116,6 +117,30 @@ typedef enum
     /* The app closes the file*/
     APP_CLOSE_FILE,
 
+    /* The app opens a client of the SDSPI driver for the benchmark */
+    APP_BENCHMARK_OPEN,
+
+    /* The app maps the DMA pool for the next benchmark run */
+    APP_BENCHMARK_MODE,
+
+    /* The app starts a timed sector read */
+    APP_BENCHMARK_READ,
+
+    /* The app waits for the sector read to complete */
+    APP_BENCHMARK_READ_WAIT,
+
+    /* The app starts a timed write of the sector read */
+    APP_BENCHMARK_WRITE,
+
+    /* The app waits for the sector write to complete */
+    APP_BENCHMARK_WRITE_WAIT,
+
+    /* The app prints the averages of the benchmark run */
+    APP_BENCHMARK_REPORT,
+
+    /* The app runs the block device benchmark */
+    APP_FS_BENCH,
+
     /* The app closes the file and idles */
     APP_IDLE,
 
@@ -150,6 +175,26 @@ typedef struct
     APP_STATES                  state;           
 
     int32_t                     nBytesRead;
+
+    /* SDSPI driver client and command of the benchmark */
+    DRV_HANDLE                  benchHandle;
+    DRV_SDSPI_COMMAND_HANDLE    benchCommandHandle;
+
+    /* SYS_TIME counter value at the start of the current transfer */
+    uint64_t                    benchStartCount;
+
+    /* Total time of the sector reads and writes of the run, in SYS_TIME counts */
+    uint64_t                    benchReadCount;
+    uint64_t                    benchWriteCount;
+
+    /* Sector read and write pairs done in the run */
+    uint32_t                    benchTransfers;
+
+    /* Benchmark run, 0 with the DMA pool in its configured mapping */
+    uint32_t                    benchMode;
+
+    /* true while the DMA pool is mapped non-cacheable */
+    bool                        benchNonCacheable;
 } APP_DATA;
 
 
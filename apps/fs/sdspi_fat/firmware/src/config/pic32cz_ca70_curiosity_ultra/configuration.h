@@ -101,6 +101,10 @@ extern "C" {
 #define SYS_FS_FAT_MAX_SS                 SYS_FS_MEDIA_MAX_BLOCK_SIZE
 #define SYS_FS_FAT_ALIGNED_BUFFER_LEN     512
 
+/* File System Block Device Benchmark Configuration */
+#define SYS_FS_BENCH_HISTOGRAM_BINS       (20U)
+#define SYS_FS_BENCH_PRINT(fmt, ...)      printf(fmt, ##__VA_ARGS__)
+
 
 
 
@@ -115,6 +119,12 @@ extern "C" {
 #define SYS_TIME_CPU_CLOCK_FREQUENCY                (300000000)
 #define SYS_TIME_COMPARE_UPDATE_EXECUTION_CYCLES    (900)
 
+/* DMA Pool System Service Configuration Options */
+#define SYS_DMA_POOL_SIZE                           (2048U)
+#define SYS_DMA_POOL_BLOCK_SIZE                     (32U)
+#define SYS_DMA_POOL_NON_CACHEABLE                  true
+#define SYS_DMA_POOL_MPU_REGION                     (15U)
+
 
 
 // *****************************************************************************
@@ -124,10 +134,10 @@ extern "C" {
 // *****************************************************************************
 /* SDSPI Driver Instance 0 Configuration Options */
 #define DRV_SDSPI_INDEX_0                       0
-#define DRV_SDSPI_CLIENTS_NUMBER_IDX0           1
+#define DRV_SDSPI_CLIENTS_NUMBER_IDX0           2
 #define DRV_SDSPI_QUEUE_SIZE_IDX0               4
 #define DRV_SDSPI_CHIP_SELECT_PIN_IDX0          SYS_PORT_PIN_PD25
-#define DRV_SDSPI_SPEED_HZ_IDX0                 5000000
+#define DRV_SDSPI_SPEED_HZ_IDX0                 25000000
 #define DRV_SDSPI_POLLING_INTERVAL_MS_IDX0      1000
 
 #define DRV_SDSPI_DMA_MODE
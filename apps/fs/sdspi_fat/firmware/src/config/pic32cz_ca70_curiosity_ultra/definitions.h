@@ -60,6 +60,7 @@
 #include "peripheral/xdmac/plib_xdmac.h"
 #include "peripheral/spi/spi_master/plib_spi0_master.h"
 #include "peripheral/efc/plib_efc.h"
+#include "peripheral/mpu/plib_mpu.h"
 #include "bsp/bsp.h"
 #include "peripheral/tc/plib_tc0.h"
 #include "driver/sdspi/drv_sdspi.h"
@@ -67,6 +68,7 @@
 #include "system/ports/sys_ports.h"
 #include "system/cache/sys_cache.h"
 #include "system/dma/sys_dma.h"
+#include "system/dma/sys_dma_pool.h"
 #include "osal/osal.h"
 #include "system/debug/sys_debug.h"
 #include "system/time/sys_time.h"
@@ -242,7 +242,9 @@ typedef struct
 
     uint32_t                        blockStartAddress;
 
-    /* Speed at which SD card communication should happen */
+    /* Maximum speed at which SD card communication should happen. The driver
+       runs at the lower of this and the TRAN_SPEED of the card's CSD, and
+       lowers the speed on data CRC errors. */
     uint32_t                        sdcardSpeedHz;
 
     uint32_t                        pollingIntervalMs;
@@ -47,6 +47,7 @@
 // *****************************************************************************
 #include <string.h>
 #include "system/cache/sys_cache.h"
+#include "system/dma/sys_dma_pool.h"
 #include "drv_sdspi_plib_interface.h"
 
 #include "drv_sdspi_local.h"
@@ -59,14 +60,13 @@
 // Section: File Scope Variables
 // *****************************************************************************
 // *****************************************************************************
-static CACHE_ALIGN uint8_t gDrvSDSPICmdResponseBuffer [DRV_SDSPI_INSTANCES_NUMBER][CACHE_ALIGNED_SIZE_GET(16)] ;
-static CACHE_ALIGN uint8_t gDrvSDSPIClkPulseData [DRV_SDSPI_INSTANCES_NUMBER][CACHE_ALIGNED_SIZE_GET(10)];
-static CACHE_ALIGN uint8_t gDrvSDSPICsdData [DRV_SDSPI_INSTANCES_NUMBER][CACHE_ALIGNED_SIZE_GET(20)];
-static CACHE_ALIGN uint8_t gDrvSDSPICidData [DRV_SDSPI_INSTANCES_NUMBER][CACHE_ALIGNED_SIZE_GET(20)];
-static CACHE_ALIGN uint8_t gDrvSDSPITempCidData [DRV_SDSPI_INSTANCES_NUMBER][CACHE_ALIGNED_SIZE_GET(20)];
-
-/* Dummy data transmitted by TX DMA, common to all driver instances. */
-static CACHE_ALIGN uint8_t  txCommonDummyData[CACHE_ALIGNED_SIZE_GET(4)];
+/* The command response, clock pulse, CSD, CID, block and dummy transmit
+ * buffers are DMA targets. They are allocated from the DMA pool, which is
+ * mapped non-cacheable when SYS_DMA_POOL_NON_CACHEABLE is true. */
+#define DRV_SDSPI_CMD_RESP_BUFFER_SIZE      (16U)
+#define DRV_SDSPI_CSD_BUFFER_SIZE           (20U)
+#define DRV_SDSPI_CID_BUFFER_SIZE           (20U)
+#define DRV_SDSPI_TX_DUMMY_BUFFER_SIZE      (4U)
 
 static DRV_SDSPI_OBJ gDrvSDSPIObj[DRV_SDSPI_INSTANCES_NUMBER];
 
@@ -83,32 +83,70 @@ static DRV_SDSPI_OBJ gDrvSDSPIObj[DRV_SDSPI_INSTANCES_NUMBER];
 
   Remarks:
     The actual response for the command 'CMD_SD_SEND_OP_COND'is R3, but it has
-    same number of bytes as R7. So R7 is used in the table.
+    same number of bytes as R7. So R7 is used in the table. The CRC7 of each
+    command packet is computed when the packet is framed.
 */
 
 static const DRV_SDSPI_CMD_OBJ gDrvSDSPICmdTable[] =
 {
-    /* Command                             CRC     response    response length*/
-    {CMD_VALUE_GO_IDLE_STATE,              0x95,   RESPONSE_R1,         1 },
-    {CMD_VALUE_SEND_OP_COND,               0xF9,   RESPONSE_R1,         1 },
-    {CMD_VALUE_SEND_IF_COND,               0x87,   RESPONSE_R7,         5 },
-    {CMD_VALUE_SEND_CSD,                   0xAF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_SEND_CID,                   0x1B,   RESPONSE_R1,         1 },
-    {CMD_VALUE_STOP_TRANSMISSION,          0xC3,   RESPONSE_R1,         1 },
-    {CMD_VALUE_SEND_STATUS,                0xAF,   RESPONSE_R2,         2 },
-    {CMD_VALUE_SET_BLOCKLEN,               0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_READ_SINGLE_BLOCK,          0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_READ_MULTI_BLOCK,           0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_WRITE_SINGLE_BLOCK,         0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_WRITE_MULTI_BLOCK,          0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_TAG_SECTOR_START,           0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_TAG_SECTOR_END,             0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_ERASE,                      0xDF,   RESPONSE_R1b,        1 },
-    {CMD_VALUE_APP_CMD,                    0x73,   RESPONSE_R1,         1 },
-    {CMD_VALUE_READ_OCR,                   0x25,   RESPONSE_R7,         5 },
-    {CMD_VALUE_CRC_ON_OFF,                 0x25,   RESPONSE_R1,         1 },
-    {CMD_VALUE_SD_SEND_OP_COND,            0xFF,   RESPONSE_R1,         1 },
-    {CMD_VALUE_SET_WR_BLK_ERASE_COUNT,     0xFF,   RESPONSE_R1,         1 }
+    /* Command                             response    response length*/
+    {CMD_VALUE_GO_IDLE_STATE,              RESPONSE_R1,         1 },
+    {CMD_VALUE_SEND_OP_COND,               RESPONSE_R1,         1 },
+    {CMD_VALUE_SEND_IF_COND,               RESPONSE_R7,         5 },
+    {CMD_VALUE_SEND_CSD,                   RESPONSE_R1,         1 },
+    {CMD_VALUE_SEND_CID,                   RESPONSE_R1,         1 },
+    {CMD_VALUE_STOP_TRANSMISSION,          RESPONSE_R1,         1 },
+    {CMD_VALUE_SEND_STATUS,                RESPONSE_R2,         2 },
+    {CMD_VALUE_SET_BLOCKLEN,               RESPONSE_R1,         1 },
+    {CMD_VALUE_READ_SINGLE_BLOCK,          RESPONSE_R1,         1 },
+    {CMD_VALUE_READ_MULTI_BLOCK,           RESPONSE_R1,         1 },
+    {CMD_VALUE_WRITE_SINGLE_BLOCK,         RESPONSE_R1,         1 },
+    {CMD_VALUE_WRITE_MULTI_BLOCK,          RESPONSE_R1,         1 },
+    {CMD_VALUE_TAG_SECTOR_START,           RESPONSE_R1,         1 },
+    {CMD_VALUE_TAG_SECTOR_END,             RESPONSE_R1,         1 },
+    {CMD_VALUE_ERASE,                      RESPONSE_R1b,        1 },
+    {CMD_VALUE_APP_CMD,                    RESPONSE_R1,         1 },
+    {CMD_VALUE_READ_OCR,                   RESPONSE_R7,         5 },
+    {CMD_VALUE_CRC_ON_OFF,                 RESPONSE_R1,         1 },
+    {CMD_VALUE_SD_SEND_OP_COND,            RESPONSE_R1,         1 },
+    {CMD_VALUE_SET_WR_BLK_ERASE_COUNT,     RESPONSE_R1,         1 }
+};
+
+/* CRC16-CCITT (polynomial 0x1021) lookup table used for data block CRCs */
+static const uint16_t gDrvSDSPICrc16Table[256] =
+{
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+    0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+    0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+    0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+    0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+    0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+    0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+    0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+    0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+    0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+    0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+    0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+    0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+    0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+    0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+    0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+    0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+    0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+    0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+    0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+    0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+    0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+    0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+    0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+    0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+    0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+    0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+    0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
 };
 
 // *****************************************************************************
@@ -179,6 +217,39 @@ static DRV_SDSPI_CLIENT_OBJ* lDRV_SDSPI_DriverHandleValidate( DRV_HANDLE handle
     return(clientObj);
 }
 
+static void lDRV_SDSPI_BuffersFree( DRV_SDSPI_OBJ *dObj )
+{
+    SYS_DMA_POOL_Free(dObj->pCmdResp);
+    SYS_DMA_POOL_Free(dObj->pClkPulseData);
+    SYS_DMA_POOL_Free(dObj->pCsdData);
+    SYS_DMA_POOL_Free(dObj->pCidData);
+    SYS_DMA_POOL_Free(dObj->pTempCidData);
+    SYS_DMA_POOL_Free(dObj->pBlockBuffer);
+    SYS_DMA_POOL_Free(dObj->txDummyData);
+}
+
+static bool lDRV_SDSPI_BuffersAllocate( DRV_SDSPI_OBJ *dObj )
+{
+    dObj->pCmdResp              = SYS_DMA_POOL_Allocate(DRV_SDSPI_CMD_RESP_BUFFER_SIZE);
+    dObj->pClkPulseData         = SYS_DMA_POOL_Allocate(MEDIA_INIT_ARRAY_SIZE);
+    dObj->pCsdData              = SYS_DMA_POOL_Allocate(DRV_SDSPI_CSD_BUFFER_SIZE);
+    dObj->pCidData              = SYS_DMA_POOL_Allocate(DRV_SDSPI_CID_BUFFER_SIZE);
+    dObj->pTempCidData          = SYS_DMA_POOL_Allocate(DRV_SDSPI_CID_BUFFER_SIZE);
+    dObj->pBlockBuffer          = SYS_DMA_POOL_Allocate(DRV_SDSPI_BLOCK_BUFFER_SIZE);
+    dObj->txDummyData           = SYS_DMA_POOL_Allocate(DRV_SDSPI_TX_DUMMY_BUFFER_SIZE);
+
+    if ((dObj->pCmdResp == NULL) || (dObj->pClkPulseData == NULL) ||
+        (dObj->pCsdData == NULL) || (dObj->pCidData == NULL) ||
+        (dObj->pTempCidData == NULL) || (dObj->pBlockBuffer == NULL) ||
+        (dObj->txDummyData == NULL))
+    {
+        lDRV_SDSPI_BuffersFree(dObj);
+        return false;
+    }
+
+    return true;
+}
+
 static void lDRV_SDSPI_UpdateGeometry( DRV_SDSPI_OBJ *dObj )
 {
     uint8_t i = 0;
@@ -200,6 +271,102 @@ static void lDRV_SDSPI_UpdateGeometry( DRV_SDSPI_OBJ *dObj )
     dObj->mediaGeometryObj.geometryTable = (SYS_MEDIA_REGION_GEOMETRY *)&dObj->mediaGeometryTable;
 }
 
+/* CRC7 (polynomial 0x09) of a command packet, returned in the format of the
+   last packet byte: CRC in bits 7:1 and the end bit set */
+static uint8_t lDRV_SDSPI_CRC7( const uint8_t* data, uint32_t nBytes )
+{
+    uint32_t i;
+    uint32_t bit;
+    uint8_t crc = 0;
+    uint8_t dataByte;
+
+    for (i = 0; i < nBytes; i++)
+    {
+        dataByte = data[i];
+
+        for (bit = 0; bit < 8U; bit++)
+        {
+            crc <<= 1;
+            if (((dataByte ^ crc) & 0x80U) != 0U)
+            {
+                crc ^= 0x09U;
+            }
+            dataByte <<= 1;
+        }
+    }
+
+    return (uint8_t)((crc << 1) | CMD_R1_END_BIT_SET);
+}
+
+/* CRC16-CCITT of a data block, as sent by the card behind the block */
+static uint16_t lDRV_SDSPI_CRC16( const uint8_t* data, uint32_t nBytes )
+{
+    uint32_t i;
+    uint16_t crc = 0;
+
+    for (i = 0; i < nBytes; i++)
+    {
+        crc = (uint16_t)(crc << 8) ^ gDrvSDSPICrc16Table[((uint32_t)crc >> 8) ^ data[i]];
+    }
+
+    return crc;
+}
+
+/* Returns the index of the first byte that is not 0xFF, or nBytes if the card
+   kept its data line released for the whole window */
+static uint32_t lDRV_SDSPI_TokenScan( const uint8_t* data, uint32_t nBytes )
+{
+    uint32_t i = 0;
+
+    while ((i < nBytes) && (data[i] == 0xFFU))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/* Moves a multi block request on to its next block */
+static void lDRV_SDSPI_NextBlock( DRV_SDSPI_OBJ* dObj, DRV_SDSPI_BUFFER_OBJ* bufferObj )
+{
+    bufferObj->buffer += DRV_SDSPI_MEDIA_BLOCK_SIZE;
+
+    /* Standard capacity cards are byte addressed */
+    if (dObj->sdCardType == DRV_SDSPI_MODE_NORMAL)
+    {
+        bufferObj->blockStart += DRV_SDSPI_MEDIA_BLOCK_SIZE;
+    }
+    else
+    {
+        bufferObj->blockStart++;
+    }
+}
+
+/* Called on a data CRC error. Lowers the SPI clock by one step and returns
+   true if the request should be restarted from the failed block. */
+static bool lDRV_SDSPI_CRCErrorRetry( DRV_SDSPI_OBJ* dObj )
+{
+    bool retry = false;
+
+    dObj->crcErrorCount++;
+
+    if (dObj->crcRetriesLeft > 0U)
+    {
+        dObj->crcRetriesLeft--;
+
+        dObj->sdcardCurrentSpeedHz >>= 1;
+        if (dObj->sdcardCurrentSpeedHz < DRV_SDSPI_SPI_INITIAL_SPEED)
+        {
+            dObj->sdcardCurrentSpeedHz = DRV_SDSPI_SPI_INITIAL_SPEED;
+        }
+
+        retry = DRV_SDSPI_SPISpeedSetup(dObj, dObj->sdcardCurrentSpeedHz);
+        dObj->crcRetry = retry;
+    }
+
+    return retry;
+}
+
 static void lDRV_SDSPI_CheckWriteProtectStatus
 (
     DRV_SDSPI_OBJ *dObj
@@ -217,32 +384,64 @@ static void lDRV_SDSPI_CheckWriteProtectStatus
 #endif
 }
 
-static DRV_SDSPI_BUFFER_OBJ* lDRV_SDSPI_FreeBufferObjectGet(DRV_SDSPI_CLIENT_OBJ* clientObj)
+static void lDRV_SDSPI_FreeBufferObjectListInit(DRV_SDSPI_OBJ* dObj)
 {
     uint32_t index;
-    DRV_SDSPI_OBJ* dObj = (DRV_SDSPI_OBJ* )&gDrvSDSPIObj[clientObj->drvIndex];
     DRV_SDSPI_BUFFER_OBJ* pBufferObj = (DRV_SDSPI_BUFFER_OBJ*)dObj->bufferObjPool;
 
-    for (index = 0; index < dObj->bufferObjPoolSize; index++)
+    /* Chain all the buffer objects of the pool into the free list */
+    dObj->freeObjList = NULL;
+
+    for (index = dObj->bufferObjPoolSize; index > 0U; index--)
     {
-        if (pBufferObj[index].inUse == false)
-        {
-            pBufferObj[index].inUse = true;
-            pBufferObj[index].next = NULL;
+        pBufferObj[index - 1U].inUse = false;
+        pBufferObj[index - 1U].next = dObj->freeObjList;
+        dObj->freeObjList = &pBufferObj[index - 1U];
+    }
+}
 
-            /* Generate a unique buffer handle consisting of an incrementing
-             * token counter, driver index and the buffer index.
-             */
-            pBufferObj[index].commandHandle = (DRV_SDSPI_COMMAND_HANDLE)lDRV_SDSPI_MAKE_HANDLE(
-                dObj->sdspiTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+static void lDRV_SDSPI_FreeBufferObjectPut(
+    DRV_SDSPI_OBJ* dObj,
+    DRV_SDSPI_BUFFER_OBJ* bufferObj
+)
+{
+    bufferObj->inUse = false;
 
-            /* Update the token for next time */
-            dObj->sdspiTokenCount = lDRV_SDSPI_UPDATE_TOKEN(dObj->sdspiTokenCount);
+    /* Return the buffer object to the head of the free list */
+    bufferObj->next = dObj->freeObjList;
+    dObj->freeObjList = bufferObj;
+}
 
-            return &pBufferObj[index];
-        }
+static DRV_SDSPI_BUFFER_OBJ* lDRV_SDSPI_FreeBufferObjectGet(DRV_SDSPI_CLIENT_OBJ* clientObj)
+{
+    uint32_t index;
+    DRV_SDSPI_OBJ* dObj = (DRV_SDSPI_OBJ* )&gDrvSDSPIObj[clientObj->drvIndex];
+    DRV_SDSPI_BUFFER_OBJ* pBufferObj = dObj->freeObjList;
+
+    if (pBufferObj == NULL)
+    {
+        /* All the buffer objects are in use */
+        return NULL;
     }
-    return NULL;
+
+    /* Take the buffer object at the head of the free list */
+    dObj->freeObjList = pBufferObj->next;
+
+    pBufferObj->inUse = true;
+    pBufferObj->next = NULL;
+
+    index = (uint32_t)(pBufferObj - (DRV_SDSPI_BUFFER_OBJ*)dObj->bufferObjPool);
+
+    /* Generate a unique buffer handle consisting of an incrementing
+     * token counter, driver index and the buffer index.
+     */
+    pBufferObj->commandHandle = (DRV_SDSPI_COMMAND_HANDLE)lDRV_SDSPI_MAKE_HANDLE(
+        dObj->sdspiTokenCount, (uint8_t)clientObj->drvIndex, (uint8_t)index);
+
+    /* Update the token for next time */
+    dObj->sdspiTokenCount = lDRV_SDSPI_UPDATE_TOKEN(dObj->sdspiTokenCount);
+
+    return pBufferObj;
 }
 
 static bool lDRV_SDSPI_BufferObjectAddToList(
@@ -255,6 +454,8 @@ static bool lDRV_SDSPI_BufferObjectAddToList(
 
     pBufferObjList = (DRV_SDSPI_BUFFER_OBJ**)&(dObj->bufferObjList);
 
+    bufferObj->next = NULL;
+
     // Is the buffer object list empty?
     if (*pBufferObjList == NULL)
     {
@@ -263,22 +464,12 @@ static bool lDRV_SDSPI_BufferObjectAddToList(
     }
     else
     {
-        // List is not empty. Iterate to the end of the buffer object list.
-        while (*pBufferObjList != NULL)
-        {
-            if ((*pBufferObjList)->next == NULL)
-            {
-                // End of the list reached, add the buffer here.
-                (*pBufferObjList)->next = bufferObj;
-                break;
-            }
-            else
-            {
-                pBufferObjList = (DRV_SDSPI_BUFFER_OBJ**)&((*pBufferObjList)->next);
-            }
-        }
+        // List is not empty. Add the buffer after the last buffer object.
+        dObj->bufferObjListTail->next = bufferObj;
     }
 
+    dObj->bufferObjListTail = bufferObj;
+
     return isFirstBufferInList;
 }
 
@@ -306,12 +497,18 @@ static void lDRV_SDSPI_RemoveBufferObjFromList(
     if (*pBufferObjList != NULL)
     {
         /* Save the buffer object to be removed. Set the next buffer object as
-         * the new head of the linked list. Reset the removed buffer object. */
+         * the new head of the linked list. Return the removed buffer object to
+         * the free list. */
 
         DRV_SDSPI_BUFFER_OBJ* temp = *pBufferObjList;
         *pBufferObjList = (*pBufferObjList)->next;
-        temp->next = NULL;
-        temp->inUse = false;
+
+        if (*pBufferObjList == NULL)
+        {
+            dObj->bufferObjListTail = NULL;
+        }
+
+        lDRV_SDSPI_FreeBufferObjectPut(dObj, temp);
     }
 }
 
@@ -322,6 +519,7 @@ static void lDRV_SDSPI_RemoveClientBuffersFromList(
 {
     DRV_SDSPI_BUFFER_OBJ** pBufferObjList;
     DRV_SDSPI_BUFFER_OBJ* delBufferObj = NULL;
+    DRV_SDSPI_BUFFER_OBJ* prevBufferObj = NULL;
 
     pBufferObjList = (DRV_SDSPI_BUFFER_OBJ**)&(dObj->bufferObjList);
 
@@ -344,14 +542,20 @@ static void lDRV_SDSPI_RemoveClientBuffersFromList(
                 clientObj->eventHandler((SYS_MEDIA_BLOCK_EVENT)DRV_SDSPI_EVENT_COMMAND_ERROR, delBufferObj->commandHandle, clientObj->context);
             }
 
-            // Reset the deleted node
+            // The last node was deleted, the previous node is the new tail
+            if (dObj->bufferObjListTail == delBufferObj)
+            {
+                dObj->bufferObjListTail = prevBufferObj;
+            }
+
+            // Return the deleted node to the free list
             delBufferObj->status = DRV_SDSPI_COMMAND_COMPLETED;
-            delBufferObj->next = NULL;
-            delBufferObj->inUse = false;
+            lDRV_SDSPI_FreeBufferObjectPut(dObj, delBufferObj);
         }
         else
         {
             // Move to the next node
+            prevBufferObj = *pBufferObjList;
             pBufferObjList = (DRV_SDSPI_BUFFER_OBJ**)&((*pBufferObjList)->next);
         }
     }
@@ -384,10 +588,11 @@ static void lDRV_SDSPI_RemoveBufferObjects (
             clientObj->eventHandler((SYS_MEDIA_BLOCK_EVENT)DRV_SDSPI_EVENT_COMMAND_ERROR, delBufferObj->commandHandle, clientObj->context);
         }
 
-        // Reset the deleted node
-        delBufferObj->next = NULL;
-        delBufferObj->inUse = false;
+        // Return the deleted node to the free list
+        lDRV_SDSPI_FreeBufferObjectPut(dObj, delBufferObj);
     }
+
+    dObj->bufferObjListTail = NULL;
 }
 
 static uint32_t lDRV_SDSPI_ProcessCSD(uint8_t* csdPtr)
@@ -466,6 +671,40 @@ static uint32_t lDRV_SDSPI_ProcessCSD(uint8_t* csdPtr)
     return discCapacity;
 }
 
+/* Returns the maximum clock of the card in Hz, decoded from the TRAN_SPEED
+   field (bits 103:96) of its CSD. The field is at the same place in CSD
+   versions 1 and 2. Returns 0 for a reserved encoding. */
+static uint32_t lDRV_SDSPI_CSDMaxSpeedGet(const uint8_t* csdPtr)
+{
+    /* Rate unit / 10, so that it can be multiplied by the time value x 10 */
+    static const uint32_t rateUnit[4] = { 10000U, 100000U, 1000000U, 10000000U };
+    /* Time value x 10 */
+    static const uint8_t timeValue[16] = { 0U, 10U, 12U, 13U, 15U, 20U, 25U, 30U, 35U, 40U, 45U, 50U, 55U, 60U, 70U, 80U };
+    uint8_t tranSpeed;
+    uint32_t maxSpeedHz = 0;
+
+    if (csdPtr[0] == DRV_SDSPI_DATA_START_TOKEN)
+    {
+        /* Same workaround as in lDRV_SDSPI_ProcessCSD */
+        csdPtr++;
+    }
+
+    tranSpeed = csdPtr[3];
+
+    if ((tranSpeed & 0x80U) == 0U)
+    {
+        maxSpeedHz = rateUnit[tranSpeed & 0x03U] * timeValue[(tranSpeed >> 3) & 0x0FU];
+
+        if ((tranSpeed & 0x04U) != 0U)
+        {
+            /* Reserved rate unit */
+            maxSpeedHz = 0;
+        }
+    }
+
+    return maxSpeedHz;
+}
+
 static void lDRV_SDSPI_CommandSend
 (
     SYS_MODULE_OBJ object,
@@ -491,7 +730,7 @@ static void lDRV_SDSPI_CommandSend
             dObj->pCmdResp[2] = endianArray[2];
             dObj->pCmdResp[3] = endianArray[1];
             dObj->pCmdResp[4] = endianArray[0];
-            dObj->pCmdResp[5] = gDrvSDSPICmdTable[command].crc;
+            dObj->pCmdResp[5] = lDRV_SDSPI_CRC7(dObj->pCmdResp, 5);
             /* Dummy data. Only used in case of DRV_SDCARD_STOP_TRANSMISSION */
             dObj->pCmdResp[6] = 0xFF;
 
@@ -1000,7 +1239,7 @@ static DRV_SDSPI_ATTACH lDRV_SDSPI_MediaCommandDetect
                with a standard response token, followed by a data block of 16 bytes
                suffixed with a 16-bit CRC.
              */
-            if (DRV_SDSPI_SPIRead(dObj, &gDrvSDSPITempCidData[object], DRV_SDSPI_CID_READ_SIZE) == true)
+            if (DRV_SDSPI_SPIRead(dObj, dObj->pTempCidData, DRV_SDSPI_CID_READ_SIZE) == true)
             {
                 dObj->cmdDetectState = DRV_SDSPI_CMD_DETECT_CHK_FOR_DETACH_PRCS_CID_DAT;
             }
@@ -1020,7 +1259,7 @@ static DRV_SDSPI_ATTACH lDRV_SDSPI_MediaCommandDetect
             if (dObj->spiTransferStatus == DRV_SDSPI_SPI_TRANSFER_STATUS_COMPLETE)
             {
                 dObj->sdState = TASK_STATE_IDLE;
-                if (memcmp(dObj->pCidData, &gDrvSDSPITempCidData[object], DRV_SDSPI_CID_READ_SIZE - 1) == 0)
+                if (memcmp(dObj->pCidData, dObj->pTempCidData, DRV_SDSPI_CID_READ_SIZE - 1) == 0)
                 {
                     dObj->cmdDetectState = DRV_SDSPI_CMD_DETECT_CHK_FOR_DETCH;
                 }
@@ -1057,6 +1296,7 @@ static void lDRV_SDSPI_MediaInitialize ( SYS_MODULE_OBJ object )
 {
     /* Get the driver object */
     DRV_SDSPI_OBJ *dObj = ( DRV_SDSPI_OBJ* )&gDrvSDSPIObj[object];
+    uint32_t maxSpeedHz;
 
     /* Check what state we are in, to decide what to do */
     switch (dObj->mediaInitState)
@@ -1065,6 +1305,7 @@ static void lDRV_SDSPI_MediaInitialize ( SYS_MODULE_OBJ object )
 
             dObj->discCapacity = 0;
             dObj->sdCardType = DRV_SDSPI_MODE_NORMAL;
+            dObj->crcEnabled = false;
 
             /* Keep the chip select high(not selected) to send clock pulses  */
             SYS_PORT_PinSet(dObj->chipSelectPin);
@@ -1153,9 +1394,6 @@ static void lDRV_SDSPI_MediaInitialize ( SYS_MODULE_OBJ object )
              */
             lDRV_SDSPI_CommandSend(object, DRV_SDSPI_SEND_IF_COND, 0x1AA);
 
-            /* Note: CRC value in the table is set for value "0x1AA", it should
-               be changed if a different value is passed. */
-
             /* Change from this state only on completion of command execution */
             if (dObj->cmdState == DRV_SDSPI_CMD_EXEC_IS_COMPLETE)
             {
@@ -1339,7 +1577,15 @@ static void lDRV_SDSPI_MediaInitialize ( SYS_MODULE_OBJ object )
                20Mbps SPI speeds. SD cards would typically operate at up to 25Mbps
                or higher SPI speeds.
              */
-            (void) DRV_SDSPI_SPISpeedSetup(dObj, dObj->sdcardSpeedHz);
+            dObj->sdcardCurrentSpeedHz = dObj->sdcardSpeedHz;
+
+            if (dObj->sdcardCurrentSpeedHz > DRV_SDSPI_SPI_DEFAULT_SPEED)
+            {
+                /* The speed of the card is only known once its CSD is read */
+                dObj->sdcardCurrentSpeedHz = DRV_SDSPI_SPI_DEFAULT_SPEED;
+            }
+
+            (void) DRV_SDSPI_SPISpeedSetup(dObj, dObj->sdcardCurrentSpeedHz);
 
             /* Do a dummy read to ensure that the receiver buffer is cleared */
             (void) DRV_SDSPI_SPIRead(dObj, dObj->pCmdResp, 10);
@@ -1414,6 +1660,16 @@ static void lDRV_SDSPI_MediaInitialize ( SYS_MODULE_OBJ object )
             if (dObj->spiTransferStatus == DRV_SDSPI_SPI_TRANSFER_STATUS_COMPLETE)
             {
                 dObj->discCapacity = lDRV_SDSPI_ProcessCSD(dObj->pCsdData);
+
+                /* Run at the highest clock supported by both the card and
+                 * the SPI instance */
+                maxSpeedHz = lDRV_SDSPI_CSDMaxSpeedGet(dObj->pCsdData);
+                if (maxSpeedHz != 0U)
+                {
+                    dObj->sdcardCurrentSpeedHz = (maxSpeedHz < dObj->sdcardSpeedHz) ? maxSpeedHz : dObj->sdcardSpeedHz;
+                    (void) DRV_SDSPI_SPISpeedSetup(dObj, dObj->sdcardCurrentSpeedHz);
+                }
+
                 dObj->mediaInitState = DRV_SDSPI_INIT_READ_CID;
             }
             else if (dObj->spiTransferStatus == DRV_SDSPI_SPI_TRANSFER_STATUS_ERROR)
@@ -1476,7 +1732,7 @@ static void lDRV_SDSPI_MediaInitialize ( SYS_MODULE_OBJ object )
 
             if (dObj->spiTransferStatus == DRV_SDSPI_SPI_TRANSFER_STATUS_COMPLETE)
             {
-                dObj->mediaInitState = DRV_SDSPI_INIT_TURN_OFF_CRC;
+                dObj->mediaInitState = DRV_SDSPI_INIT_TURN_ON_CRC;
             }
             else if (dObj->spiTransferStatus == DRV_SDSPI_SPI_TRANSFER_STATUS_ERROR)
             {
@@ -1488,18 +1744,20 @@ static void lDRV_SDSPI_MediaInitialize ( SYS_MODULE_OBJ object )
             }
             break;
 
-        case DRV_SDSPI_INIT_TURN_OFF_CRC:
+        case DRV_SDSPI_INIT_TURN_ON_CRC:
 
-            /* Turn off CRC7 if we can, might be an invalid cmd on some
-               cards (CMD59). */
-            /* Note: POR default for the media is normally with CRC checking
-               off in SPI mode anyway, so this is typically redundant.
+            /* Turn on CRC7 checking of commands and CRC16 checking of data
+               blocks (CMD59). POR default for the media is with CRC checking
+               off in SPI mode. It might be an invalid cmd on some cards, in
+               which case the driver keeps working without CRC checks.
              */
-            lDRV_SDSPI_CommandSend (object, DRV_SDSPI_CRC_ON_OFF, 0x00);
+            lDRV_SDSPI_CommandSend (object, DRV_SDSPI_CRC_ON_OFF, 0x01);
 
             /* Change from this state only on completion of command execution */
             if (dObj->cmdState == DRV_SDSPI_CMD_EXEC_IS_COMPLETE)
             {
+                dObj->crcEnabled = (dObj->cmdResponse.response1.byte == 0x00U);
+                dObj->crcErrorCount = 0;
                 dObj->mediaInitState = DRV_SDSPI_INIT_SET_BLOCKLEN;
             }
             else if (dObj->cmdState == DRV_SDSPI_CMD_EXEC_ERROR)
@@ -1667,6 +1925,9 @@ static void lDRV_SDSPI_BufferIOTasks
     DRV_SDSPI_CLIENT_OBJ*       clientObj;
     DRV_SDSPI_BUFFER_OBJ*       currentBufObj;
     DRV_SDSPI_EVENT             evtStatus = DRV_SDSPI_EVENT_COMMAND_COMPLETE;
+    uint32_t                    rdLength;
+    uint8_t*                    pData;
+    uint16_t                    blockCrc;
 
     /* Get the driver object */
     dObj = (DRV_SDSPI_OBJ*)&gDrvSDSPIObj[object];
@@ -1712,6 +1973,9 @@ static void lDRV_SDSPI_BufferIOTasks
 
             currentBufObj->status = DRV_SDSPI_COMMAND_IN_PROGRESS;
 
+            dObj->crcRetry = false;
+            dObj->crcRetriesLeft = DRV_SDSPI_CRC_ERROR_RETRIES;
+
             if (dObj->sdCardType == DRV_SDSPI_MODE_NORMAL)
             {
                 currentBufObj->blockStart <<= 9;
@@ -1794,7 +2058,7 @@ static void lDRV_SDSPI_BufferIOTasks
 
         case DRV_SDSPI_TASK_RD_SRT_TKN:
 
-            if (DRV_SDSPI_SPIRead(dObj, dObj->pCmdResp, 1) == true)
+            if (DRV_SDSPI_SPIRead(dObj, dObj->pBlockBuffer, DRV_SDSPI_TOKEN_SCAN_SIZE) == true)
             {
                 dObj->nextTaskState = DRV_SDSPI_TASK_RD_SRT_TKN_STATUS;
                 dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
@@ -1812,13 +2076,28 @@ static void lDRV_SDSPI_BufferIOTasks
                to the media, and we need to keep polling the media until it sends
                us the data start token byte. This could typically take a
                couple of milliseconds, up to a maximum of 100ms.
+               The token window at the start of the block buffer is either
+               freshly read or was read ahead with the previous block.
                */
-            if (dObj->pCmdResp[0] == DRV_SDSPI_DATA_START_TOKEN)
+            dObj->blockDataOffset = lDRV_SDSPI_TokenScan(dObj->pBlockBuffer, DRV_SDSPI_TOKEN_SCAN_SIZE);
+
+            if (dObj->blockDataOffset < DRV_SDSPI_TOKEN_SCAN_SIZE)
             {
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_DATA;
-                /* Received the start token. Stop the timer */
+                /* Received the start token or an error token. Stop the timer */
                 (void) DRV_SDSPI_TimerStop(dObj);
                 dObj->timerFlag = false;
+
+                if (dObj->pBlockBuffer[dObj->blockDataOffset] == DRV_SDSPI_DATA_START_TOKEN)
+                {
+                    /* Data starts right after the token */
+                    dObj->blockDataOffset++;
+                    dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_DATA;
+                }
+                else
+                {
+                    /* Data error token, the card will not send the block */
+                    dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_WRITE_ABORT;
+                }
             }
             else
             {
@@ -1850,22 +2129,18 @@ static void lDRV_SDSPI_BufferIOTasks
 
         case DRV_SDSPI_TASK_READ_DATA:
 
-            if (DRV_SDSPI_SPIRead(dObj, currentBufObj->buffer, DRV_SDSPI_MEDIA_BLOCK_SIZE) == true)
-            {
-                dObj->nextTaskState = DRV_SDSPI_TASK_READ_CRC_BYTES;
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
-            }
-            else
+            /* The bytes of the window after the token are the beginning of
+             * the block. Read the rest of the block and the 2 CRC bytes
+             * right behind the window, and for multi block reads also the
+             * token window of the next block. */
+            rdLength = (dObj->blockDataOffset + DRV_SDSPI_MEDIA_BLOCK_SIZE + 2U) - DRV_SDSPI_TOKEN_SCAN_SIZE;
+
+            if ((currentBufObj->command == (uint8_t)DRV_SDSPI_READ_MULTI_BLOCK) && (currentBufObj->nBlocks > 1U))
             {
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_WRITE_ABORT;
+                rdLength += DRV_SDSPI_TOKEN_SCAN_SIZE;
             }
-            break;
 
-        case DRV_SDSPI_TASK_READ_CRC_BYTES:
-
-            /* Read 2 bytes of CRC data. In SPI mode of operation the CRC
-             * data is ignored. */
-            if (DRV_SDSPI_SPIRead(dObj, dObj->pCmdResp, 2) == true)
+            if (DRV_SDSPI_SPIRead(dObj, &dObj->pBlockBuffer[DRV_SDSPI_TOKEN_SCAN_SIZE], rdLength) == true)
             {
                 dObj->nextTaskState = DRV_SDSPI_TASK_READ_COMPLETE_CHECK;
                 dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
@@ -1878,6 +2153,33 @@ static void lDRV_SDSPI_BufferIOTasks
 
         case DRV_SDSPI_TASK_READ_COMPLETE_CHECK:
 
+            pData = &dObj->pBlockBuffer[dObj->blockDataOffset];
+
+            if (dObj->crcEnabled == true)
+            {
+                blockCrc = ((uint16_t)pData[DRV_SDSPI_MEDIA_BLOCK_SIZE] << 8) | pData[DRV_SDSPI_MEDIA_BLOCK_SIZE + 1U];
+
+                if (lDRV_SDSPI_CRC16(pData, DRV_SDSPI_MEDIA_BLOCK_SIZE) != blockCrc)
+                {
+                    if (lDRV_SDSPI_CRCErrorRetry(dObj) == false)
+                    {
+                        dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_WRITE_ABORT;
+                    }
+                    else if (currentBufObj->command == (uint8_t)DRV_SDSPI_READ_MULTI_BLOCK)
+                    {
+                        /* Stop the transfer and restart it from this block */
+                        dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_STOP_TRANSMISSION;
+                    }
+                    else
+                    {
+                        dObj->taskBufferIOState = DRV_SDSPI_TASK_SEND_DUMMY_CLOCK_PULSES;
+                    }
+                    break;
+                }
+            }
+
+            (void) memcpy(currentBufObj->buffer, pData, DRV_SDSPI_MEDIA_BLOCK_SIZE);
+
             if (currentBufObj->command == (uint8_t)DRV_SDSPI_READ_MULTI_BLOCK)
             {
                 currentBufObj->nBlocks--;
@@ -1887,8 +2189,19 @@ static void lDRV_SDSPI_BufferIOTasks
                 }
                 else
                 {
-                    currentBufObj->buffer += DRV_SDSPI_MEDIA_BLOCK_SIZE;
-                    dObj->taskBufferIOState = DRV_SDSPI_TASK_RD_SRT_TKN;
+                    lDRV_SDSPI_NextBlock(dObj, currentBufObj);
+
+                    /* Move the read ahead window of the next block to the
+                     * start of the buffer and scan it. Clean it so that it
+                     * survives the cache invalidation of the next read. */
+                    (void) memmove(dObj->pBlockBuffer,
+                        &dObj->pBlockBuffer[dObj->blockDataOffset + DRV_SDSPI_MEDIA_BLOCK_SIZE + 2U],
+                        DRV_SDSPI_TOKEN_SCAN_SIZE);
+
+                    SYS_CACHE_CleanDCache_by_Addr(dObj->pBlockBuffer, (int32_t)DRV_SDSPI_TOKEN_SCAN_SIZE);
+
+                    dObj->timerFlag = false;
+                    dObj->taskBufferIOState = DRV_SDSPI_TASK_RD_SRT_TKN_STATUS;
                 }
             }
             else
@@ -1902,7 +2215,17 @@ static void lDRV_SDSPI_BufferIOTasks
             /* Send 8 clock pulses */
             if (DRV_SDSPI_SPIRead(dObj, dObj->pCmdResp, 1) == true)
             {
-                dObj->nextTaskState = DRV_SDSPI_TASK_PROCESS_NEXT;
+                if (dObj->crcRetry == true)
+                {
+                    /* Re-issue the command for the remaining blocks */
+                    dObj->crcRetry = false;
+                    dObj->nextTaskState = (currentBufObj->opType == DRV_SDSPI_OPERATION_TYPE_READ) ?
+                        DRV_SDSPI_TASK_PROCESS_READ : DRV_SDSPI_TASK_PROCESS_WRITE;
+                }
+                else
+                {
+                    dObj->nextTaskState = DRV_SDSPI_TASK_PROCESS_NEXT;
+                }
                 dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
             }
             else
@@ -1959,43 +2282,28 @@ static void lDRV_SDSPI_BufferIOTasks
 
             if (currentBufObj->command == (uint8_t)DRV_SDSPI_WRITE_MULTI_BLOCK)
             {
-                dObj->pCmdResp[0] = DRV_SDSPI_DATA_START_MULTI_BLOCK_TOKEN;
-            }
-            else
-            {
-                dObj->pCmdResp[0] = DRV_SDSPI_DATA_START_TOKEN;
-            }
-
-            if (DRV_SDSPI_SPIWrite(dObj, dObj->pCmdResp, 1) == true)
-            {
-                dObj->nextTaskState = DRV_SDSPI_TASK_WRITE_DATA;
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
+                dObj->pBlockBuffer[0] = DRV_SDSPI_DATA_START_MULTI_BLOCK_TOKEN;
             }
             else
             {
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_WRITE_ABORT;
+                dObj->pBlockBuffer[0] = DRV_SDSPI_DATA_START_TOKEN;
             }
-            break;
-
 
-        case DRV_SDSPI_TASK_WRITE_DATA:
+            /* Send the start token, the data block and its 16-bit CRC in
+             * one transfer. The CRC is a dummy one unless CRC checking is
+             * enabled. */
+            (void) memcpy(&dObj->pBlockBuffer[1], currentBufObj->buffer, DRV_SDSPI_MEDIA_BLOCK_SIZE);
 
-            if (DRV_SDSPI_SPIWrite(dObj, currentBufObj->buffer, 512) == true)
-            {
-                dObj->nextTaskState = DRV_SDSPI_TASK_WRITE_CRC_BYTES;
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
-            }
-            else
+            blockCrc = 0xFFFFU;
+            if (dObj->crcEnabled == true)
             {
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_WRITE_ABORT;
+                blockCrc = lDRV_SDSPI_CRC16(&dObj->pBlockBuffer[1], DRV_SDSPI_MEDIA_BLOCK_SIZE);
             }
-            break;
-
 
-        case DRV_SDSPI_TASK_WRITE_CRC_BYTES:
+            dObj->pBlockBuffer[DRV_SDSPI_MEDIA_BLOCK_SIZE + 1U] = (uint8_t)(blockCrc >> 8);
+            dObj->pBlockBuffer[DRV_SDSPI_MEDIA_BLOCK_SIZE + 2U] = (uint8_t)blockCrc;
 
-            /* Send 16-bit dummy CRC for the data block that was just sent. */
-            if (DRV_SDSPI_SPIWrite(dObj, dObj->pClkPulseData, 2) == true)
+            if (DRV_SDSPI_SPIWrite(dObj, dObj->pBlockBuffer, DRV_SDSPI_MEDIA_BLOCK_SIZE + 3U) == true)
             {
                 dObj->nextTaskState = DRV_SDSPI_TASK_WRITE_READ_RESP_TOKEN;
                 dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
@@ -2023,15 +2331,29 @@ static void lDRV_SDSPI_BufferIOTasks
 
             /* Read response token byte from media, mask out top three
              * don't care bits, and check if there was an error */
-            if ((dObj->pCmdResp[0] & DRV_SDSPI_WRITE_RESPONSE_TOKEN_MASK) != DRV_SDSPI_DATA_ACCEPTED)
+            if ((dObj->pCmdResp[0] & DRV_SDSPI_WRITE_RESPONSE_TOKEN_MASK) == DRV_SDSPI_DATA_ACCEPTED)
             {
-                /* Something went wrong. */
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_WRITE_ABORT;
+                dObj->taskBufferIOState = DRV_SDSPI_TASK_WR_CHK_BSY;
+                dObj->timerFlag = false;
+            }
+            else if (((dObj->pCmdResp[0] & DRV_SDSPI_WRITE_RESPONSE_TOKEN_MASK) == DRV_SDSPI_DATA_CRC_ERROR) &&
+                    (lDRV_SDSPI_CRCErrorRetry(dObj) == true))
+            {
+                /* The card rejected the block. Stop the transfer and restart
+                 * it from this block. */
+                if (currentBufObj->command == (uint8_t)DRV_SDSPI_WRITE_MULTI_BLOCK)
+                {
+                    dObj->taskBufferIOState = DRV_SDSPI_TASK_WRITE_STOP_TRAN_TOKEN;
+                }
+                else
+                {
+                    dObj->taskBufferIOState = DRV_SDSPI_TASK_SEND_DUMMY_CLOCK_PULSES;
+                }
             }
             else
             {
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_WR_CHK_BSY;
-                dObj->timerFlag = false;
+                /* Something went wrong. */
+                dObj->taskBufferIOState = DRV_SDSPI_TASK_READ_WRITE_ABORT;
             }
             break;
 
@@ -2039,8 +2361,10 @@ static void lDRV_SDSPI_BufferIOTasks
 
             /* The media will now send busy token (0x00) bytes until it is
              * internally ready again (after the block is successfully
-             * written and the card is ready to accept a new block). */
-            if (DRV_SDSPI_SPIRead(dObj, dObj->pCmdResp, 1) == true)
+             * written and the card is ready to accept a new block).
+             * Read a window of bytes per transfer, the card is ready once
+             * the last byte of the window is no longer busy. */
+            if (DRV_SDSPI_SPIRead(dObj, dObj->pBlockBuffer, DRV_SDSPI_TOKEN_SCAN_SIZE) == true)
             {
                 dObj->nextTaskState = DRV_SDSPI_TASK_WR_CHK_BSY_STAT;
                 dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
@@ -2053,7 +2377,7 @@ static void lDRV_SDSPI_BufferIOTasks
 
         case DRV_SDSPI_TASK_WR_CHK_BSY_STAT:
 
-            if (dObj->pCmdResp[0] == 0x00U)
+            if (dObj->pBlockBuffer[DRV_SDSPI_TOKEN_SCAN_SIZE - 1U] == 0x00U)
             {
                 /* The media is still busy writing data. Kick start a timer
                  * with 250ms as the timeout value. If the card is still
@@ -2105,7 +2429,7 @@ static void lDRV_SDSPI_BufferIOTasks
                 }
                 else
                 {
-                    currentBufObj->buffer += DRV_SDSPI_MEDIA_BLOCK_SIZE;
+                    lDRV_SDSPI_NextBlock(dObj, currentBufObj);
                     dObj->taskBufferIOState = DRV_SDSPI_TASK_WRITE_START_TOKEN;
                 }
             }
@@ -2148,8 +2472,10 @@ static void lDRV_SDSPI_BufferIOTasks
 
             /* The media will now send busy token (0x00) bytes until it is
              * internally ready again (after the block is successfully
-             * written and the card is ready to accept a new block). */
-            if (DRV_SDSPI_SPIRead(dObj, dObj->pCmdResp, 1) == true)
+             * written and the card is ready to accept a new block).
+             * Read a window of bytes per transfer, the card is ready once
+             * the last byte of the window is no longer busy. */
+            if (DRV_SDSPI_SPIRead(dObj, dObj->pBlockBuffer, DRV_SDSPI_TOKEN_SCAN_SIZE) == true)
             {
                 dObj->nextTaskState = DRV_SDSPI_TASK_WR_STP_TRAN_BSY_STAT;
                 dObj->taskBufferIOState = DRV_SDSPI_TASK_SPI_STATUS;
@@ -2162,7 +2488,7 @@ static void lDRV_SDSPI_BufferIOTasks
 
         case DRV_SDSPI_TASK_WR_STP_TRAN_BSY_STAT:
 
-            if (dObj->pCmdResp[0] == 0x00U)
+            if (dObj->pBlockBuffer[DRV_SDSPI_TOKEN_SCAN_SIZE - 1U] == 0x00U)
             {
                 /* Kick start a timer with 250ms as the timeout value. If
                  * the card is still busy at the end of the timeout then
@@ -2194,7 +2520,17 @@ static void lDRV_SDSPI_BufferIOTasks
                 /* The card is out of the busy state. Stop the timer */
                 (void) DRV_SDSPI_TimerStop(dObj);
                 dObj->timerFlag = false;
-                dObj->taskBufferIOState = DRV_SDSPI_TASK_PROCESS_NEXT;
+
+                if (dObj->crcRetry == true)
+                {
+                    /* Re-issue the command for the remaining blocks */
+                    dObj->crcRetry = false;
+                    dObj->taskBufferIOState = DRV_SDSPI_TASK_PROCESS_WRITE;
+                }
+                else
+                {
+                    dObj->taskBufferIOState = DRV_SDSPI_TASK_PROCESS_NEXT;
+                }
             }
             break;
 
@@ -2302,13 +2638,19 @@ SYS_MODULE_OBJ DRV_SDSPI_Initialize
     dObj->bufferObjPoolSize     = sdSPIInit->bufferObjPoolSize;
     dObj->clientObjPool         = sdSPIInit->clientObjPool;
     dObj->bufferObjList         = 0U;
+    dObj->bufferObjListTail     = NULL;
 
     dObj->writeProtectPin       = sdSPIInit->writeProtectPin;
     dObj->chipSelectPin         = sdSPIInit->chipSelectPin;
     dObj->sdcardSpeedHz         = sdSPIInit->sdcardSpeedHz;
+    dObj->sdcardCurrentSpeedHz  = DRV_SDSPI_SPI_INITIAL_SPEED;
+    dObj->crcEnabled            = false;
+    dObj->crcErrorCount         = 0;
     dObj->pollingIntervalMs     = sdSPIInit->pollingIntervalMs;
     dObj->sdspiTokenCount       = 1;
 
+    lDRV_SDSPI_FreeBufferObjectListInit(dObj);
+
     /* Reset the SDSPI attach/detach variables */
     dObj->isAttached            = DRV_SDSPI_IS_DETACHED;
     dObj->isAttachedLastStatus  = DRV_SDSPI_IS_DETACHED;
@@ -2321,10 +2663,10 @@ SYS_MODULE_OBJ DRV_SDSPI_Initialize
     dObj->spiTransferStatus     = DRV_SDSPI_SPI_TRANSFER_STATUS_COMPLETE;
 
     /* Set up the pointers */
-    dObj->pCmdResp              = &gDrvSDSPICmdResponseBuffer[drvIndex][0];
-    dObj->pCsdData              = &gDrvSDSPICsdData[drvIndex][0];
-    dObj->pCidData              = &gDrvSDSPICidData[drvIndex][0];
-    dObj->pClkPulseData         = &gDrvSDSPIClkPulseData[drvIndex][0];
+    if (lDRV_SDSPI_BuffersAllocate(dObj) == false)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
 
     for (i = 0; i < MEDIA_INIT_ARRAY_SIZE; i++)
     {
@@ -2336,19 +2678,16 @@ SYS_MODULE_OBJ DRV_SDSPI_Initialize
 
 
 
-    /* Each driver instance points to the common dummy data array. */
-    dObj->txDummyData            = txCommonDummyData;
-
-    for (i = 0; i < sizeof(txCommonDummyData); i++)
+    for (i = 0; i < DRV_SDSPI_TX_DUMMY_BUFFER_SIZE; i++)
     {
-        txCommonDummyData[i] = 0xFF;
+        dObj->txDummyData[i] = 0xFF;
     }
     if (dObj->txDMAChannel != SYS_DMA_CHANNEL_NONE)
     {
-        /* Ensure txCommonDummyData (0xFF) is pushed to the main memory for the DMA.
+        /* Ensure txDummyData (0xFF) is pushed to the main memory for the DMA.
          * This operation is needed only once as CPU is not going to modify
-         * txCommonDummyData */
-        SYS_CACHE_CleanDCache_by_Addr (txCommonDummyData, (int32_t)sizeof(txCommonDummyData));
+         * txDummyData */
+        SYS_CACHE_CleanDCache_by_Addr (dObj->txDummyData, (int32_t)DRV_SDSPI_TX_DUMMY_BUFFER_SIZE);
     }
 
     /* Register call-backs with the DMA System Service */
@@ -121,6 +121,40 @@
 
 #define DRV_SDSPI_SPI_INITIAL_SPEED                        400000
 
+// *****************************************************************************
+/* Default speed of the SPI communication.
+
+  Summary:
+    SPI speed used once the card is initialized, until its CSD is read.
+
+  Description:
+    Every MMC and SD card supports this clock in SPI mode. Once the CSD has
+    been read the driver switches to the lower of the card's TRAN_SPEED and
+    the configured maximum speed of the instance.
+
+  Remarks:
+    None.
+*/
+
+#define DRV_SDSPI_SPI_DEFAULT_SPEED                        20000000U
+
+// *****************************************************************************
+/* Number of retries of a block transfer after a CRC error.
+
+  Summary:
+    Number of times a request is retried after a data CRC error.
+
+  Description:
+    On a data CRC error the driver lowers the SPI clock by one step (half the
+    current speed, not below the initial speed) and restarts the transfer from
+    the failed block. The request fails once this many retries have failed.
+
+  Remarks:
+    None.
+*/
+
+#define DRV_SDSPI_CRC_ERROR_RETRIES                        (3U)
+
 
 // *****************************************************************************
 /* Count for 8 clock pulses
@@ -202,6 +236,43 @@
 
 #define DRV_SDSPI_MEDIA_BLOCK_SIZE                                         512
 
+// *****************************************************************************
+/* SD card token scan size.
+
+  Summary:
+    Number of bytes clocked in per SPI transfer while polling the card.
+
+  Description:
+    While waiting for a data start token or for the end of the busy state the
+    driver reads this many bytes per SPI transfer and scans them, instead of
+    doing one transfer per byte. During multi-block reads the same number of
+    bytes is read ahead after the CRC of a block, so that the start token of
+    the next block is usually found without another SPI transfer.
+
+  Remarks:
+    Any data bytes that follow the start token inside the scanned window are
+    kept and used as the beginning of the block.
+*/
+
+#define DRV_SDSPI_TOKEN_SCAN_SIZE                                          (16U)
+
+// *****************************************************************************
+/* SD card block buffer size.
+
+  Summary:
+    Size of the driver's block transfer buffer.
+
+  Description:
+    Holds the token scan window, a data block with its 2 byte CRC and the read
+    ahead window of the next block. Writes use it to send the start token, the
+    data block and the CRC in a single SPI transfer.
+
+  Remarks:
+    None.
+*/
+
+#define DRV_SDSPI_BLOCK_BUFFER_SIZE                                        ((2U * DRV_SDSPI_TOKEN_SCAN_SIZE) + DRV_SDSPI_MEDIA_BLOCK_SIZE + 2U)
+
 
 // *****************************************************************************
 /* SD card transmit bit.
@@ -337,6 +408,21 @@
 
 #define DRV_SDSPI_DATA_ACCEPTED                        (0x05U)
 
+// *****************************************************************************
+/* SD card data rejected due to CRC error token
+
+  Summary:
+    This macro represents an SD card data rejected due to CRC error token.
+
+  Description:
+    This macro represents an SD card data rejected due to CRC error token.
+
+  Remarks:
+    None.
+*/
+
+#define DRV_SDSPI_DATA_CRC_ERROR                       (0x0BU)
+
 
 // *****************************************************************************
 /* SD card R1 response end bit
@@ -488,18 +574,16 @@ typedef enum
     /* Wait for the SPI transaction to complete. */
     DRV_SDSPI_TASK_SPI_STATUS,
 
-    /* Read the start token from the SD card. */
+    /* Read a window of bytes to scan for the start token. */
     DRV_SDSPI_TASK_RD_SRT_TKN,
 
-    /* Check if the token received is correct */
+    /* Scan the window for the start token */
     DRV_SDSPI_TASK_RD_SRT_TKN_STATUS,
 
-    /* Read 512 bytes of data from the SD card. */
+    /* Read the rest of the data block, the 2 bytes of CRC and the token
+       window of the next block in one transfer. */
     DRV_SDSPI_TASK_READ_DATA,
 
-    /* Read 2 bytes of crc data from the sd card. */
-    DRV_SDSPI_TASK_READ_CRC_BYTES,
-
     /* Check if read operation is complete. */
     DRV_SDSPI_TASK_READ_COMPLETE_CHECK,
 
@@ -509,15 +593,10 @@ typedef enum
     /* Send 8 clock pulses */
     DRV_SDSPI_TASK_SEND_DUMMY_CLOCK_PULSES,
 
-    /* Send write start token to the SD card. */
+    /* Send the write start token, 512 bytes of data and 2 bytes of CRC to
+       the SD card. */
     DRV_SDSPI_TASK_WRITE_START_TOKEN,
 
-    /* Write 512 bytes of data to the SD card. */
-    DRV_SDSPI_TASK_WRITE_DATA,
-
-    /* Write 2 bytes of CRC data for the write block. */
-    DRV_SDSPI_TASK_WRITE_CRC_BYTES,
-
     /* Wait for the response token from the card. */
     DRV_SDSPI_TASK_WRITE_READ_RESP_TOKEN,
 
@@ -861,8 +940,8 @@ typedef enum
     /* Process the CID register data */
     DRV_SDSPI_INIT_PROCESS_CID,
 
-    /* Issue command to turn off the CRC */
-    DRV_SDSPI_INIT_TURN_OFF_CRC,
+    /* Issue command to turn on the CRC */
+    DRV_SDSPI_INIT_TURN_ON_CRC,
 
     /* Set the block length of the card */
     DRV_SDSPI_INIT_SET_BLOCKLEN,
@@ -880,9 +959,6 @@ typedef struct
     /* Command code */
     DRV_SDSPI_COMMAND_VALUE      commandCode;
 
-    /* CRC value for that command */
-    uint8_t                     crc;
-
     /* Response type */
     DRV_SDSPI_RESPONSES         responseType;
 
@@ -1376,7 +1452,7 @@ typedef struct DRV_SDSPI_BUFFER_OBJ
     /* Operation type - read/write */
     DRV_SDSPI_OPERATION_TYPE                        opType;
 
-    /* Pointer to the next buffer in the queue */
+    /* Pointer to the next buffer in the queue or in the free list */
     struct DRV_SDSPI_BUFFER_OBJ*                    next;
 
 }DRV_SDSPI_BUFFER_OBJ;
@@ -1439,15 +1515,40 @@ typedef struct
     /* Pointer to the buffer used to send dummy clock pulses on the SPI bus */
     uint8_t*                                        pClkPulseData;
 
+    /* Pointer to the buffer used for data block transfers and token scans */
+    uint8_t*                                        pBlockBuffer;
+
+    /* Offset of the current data block in the block buffer */
+    uint32_t                                        blockDataOffset;
+
     /* Pointer to the CSD data of the SD Card */
     uint8_t*                                        pCsdData;
 
     /* Pointer to the CID data of the SD Card */
     uint8_t*                                        pCidData;
 
-    /* Speed at which SD card communication should happen */
+    /* Pointer to the CID data read back to detect a card change */
+    uint8_t*                                        pTempCidData;
+
+    /* Maximum speed at which SD card communication should happen */
     uint32_t                                        sdcardSpeedHz;
 
+    /* Current speed of the SD card communication, negotiated from the CSD
+       and lowered on CRC errors */
+    uint32_t                                        sdcardCurrentSpeedHz;
+
+    /* Flag to indicate the card accepted the command to turn on CRC checking */
+    bool                                            crcEnabled;
+
+    /* Flag to indicate the current request is restarted after a CRC error */
+    bool                                            crcRetry;
+
+    /* Number of retries left for the current request */
+    uint8_t                                         crcRetriesLeft;
+
+    /* Number of data CRC errors seen since the card was attached */
+    uint32_t                                        crcErrorCount;
+
     uint32_t                                        pollingIntervalMs;
 
     /* Number of sectors in the SD card */
@@ -1477,6 +1578,12 @@ typedef struct
     /* Linked list of buffer objects */
     uintptr_t                                       bufferObjList;
 
+    /* Last buffer object in the buffer object list */
+    DRV_SDSPI_BUFFER_OBJ*                           bufferObjListTail;
+
+    /* Linked list of free buffer objects in the buffer pool */
+    DRV_SDSPI_BUFFER_OBJ*                           freeObjList;
+
 
     /* PLIB API list that will be used by the driver to access the hardware */
     const DRV_SDSPI_PLIB_INTERFACE*                 spiPlib;
@@ -1499,7 +1606,7 @@ typedef struct
     /* This is the SPI receive register address. Used for DMA operation. */
     void*                                           rxAddress;
 
-    /* Pointer to the common transmit dummy data array */
+    /* Pointer to the transmit dummy data array */
     uint8_t*                                        txDummyData;
 
     /* Dummy data is read into this variable by RX DMA */
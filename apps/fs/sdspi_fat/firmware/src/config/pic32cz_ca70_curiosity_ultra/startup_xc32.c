@@ -28,6 +28,7 @@
 #include <stddef.h>
 #include "device.h"
 #include "interrupts.h"
+#include "peripheral/mpu/plib_mpu.h"
 
 /*
  *  The MPLAB X Simulator does not yet support simulation of programming the
@@ -220,6 +221,9 @@ void __attribute__((optimize("-O1"), section(".text.Reset_Handler"), long_call,
     /* Initialize the C library */
     __libc_init_array();
 
+    /* Initialize MPU */
+    MPU_Initialize();
+
     /* Enable ICache (CMSIS-Core API) */
     SCB_EnableICache();
 
@@ -0,0 +1,242 @@
+/*******************************************************************************
+  DMA Pool System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_dma_pool.c
+
+  Summary:
+    DMA buffer pool system service implementation.
+
+  Description:
+    The pool is split into SYS_DMA_POOL_BLOCK_SIZE blocks. A buffer is a run
+    of contiguous blocks; the first block of a run records its length and the
+    following blocks are marked as continuation blocks.
+
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "configuration.h"
+#include "device.h"
+#include "system/dma/sys_dma_pool.h"
+#include "system/int/sys_int.h"
+#include "system/cache/sys_cache.h"
+#include "peripheral/mpu/plib_mpu.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_DMA_POOL_BLOCKS             (SYS_DMA_POOL_SIZE / SYS_DMA_POOL_BLOCK_SIZE)
+#define SYS_DMA_POOL_BLOCK_FREE         (0x00U)
+#define SYS_DMA_POOL_BLOCK_CONTINUED    (0xFFU)
+
+/* An MPU region is a power of two in size, at least 32 bytes, and aligned to
+ * its size. */
+#if ((SYS_DMA_POOL_SIZE < 32U) || ((SYS_DMA_POOL_SIZE & (SYS_DMA_POOL_SIZE - 1U)) != 0U))
+#error "SYS_DMA_POOL_SIZE must be a power of two of at least 32 bytes"
+#endif
+
+#if ((SYS_DMA_POOL_BLOCK_SIZE % CACHE_LINE_SIZE) != 0U)
+#error "SYS_DMA_POOL_BLOCK_SIZE must be a multiple of the cache line size"
+#endif
+
+#if (SYS_DMA_POOL_BLOCKS >= SYS_DMA_POOL_BLOCK_CONTINUED)
+#error "SYS_DMA_POOL_SIZE / SYS_DMA_POOL_BLOCK_SIZE must be less than 255"
+#endif
+
+static uint8_t __ALIGNED(SYS_DMA_POOL_SIZE) gSysDmaPool[SYS_DMA_POOL_SIZE];
+
+/* Per block state: SYS_DMA_POOL_BLOCK_FREE, SYS_DMA_POOL_BLOCK_CONTINUED or,
+ * for the first block of an allocation, the number of blocks in it. */
+static uint8_t gSysDmaPoolBlocks[SYS_DMA_POOL_BLOCKS];
+
+static bool gSysDmaPoolNonCacheable = false;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA Pool System Service Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+void SYS_DMA_POOL_Initialize( void )
+{
+    uint32_t i;
+
+    for (i = 0U; i < SYS_DMA_POOL_BLOCKS; i++)
+    {
+        gSysDmaPoolBlocks[i] = SYS_DMA_POOL_BLOCK_FREE;
+    }
+
+#if (SYS_DMA_POOL_NON_CACHEABLE == true)
+    (void) SYS_DMA_POOL_NonCacheableSet(true);
+#endif
+}
+
+bool SYS_DMA_POOL_NonCacheableSet( bool nonCacheable )
+{
+#if (SYS_DMA_POOL_NON_CACHEABLE == true)
+    if ((nonCacheable == true) && (gSysDmaPoolNonCacheable == false))
+    {
+        /* Region size is 2^(sizeField + 1) bytes */
+        MPU_RegionConfigure(SYS_DMA_POOL_MPU_REGION, (uint32_t)gSysDmaPool,
+                            (30U - (uint32_t)__CLZ(SYS_DMA_POOL_SIZE)),
+                            MPU_ATTR_NORMAL | MPU_ATTR_SHAREABLE | MPU_ATTR_EXECUTE_NEVER |
+                            MPU_RASR_AP(MPU_RASR_AP_READWRITE_Val));
+
+        /* Lines allocated while the pool was still cacheable would otherwise be
+         * evicted over DMA data later on. Maintenance by address works whatever
+         * the MPU attributes, so it is done after the remap and before the pool is
+         * registered as non-cacheable. */
+        SYS_CACHE_CleanInvalidateDCache_by_Addr(gSysDmaPool, (int32_t)SYS_DMA_POOL_SIZE);
+
+        gSysDmaPoolNonCacheable = SYS_CACHE_NonCacheableRegionAdd(gSysDmaPool, SYS_DMA_POOL_SIZE);
+    }
+    else if ((nonCacheable == false) && (gSysDmaPoolNonCacheable == true))
+    {
+        /* Maintenance is done again on pool buffers before the pool becomes
+         * cacheable. No line of the pool was allocated while it was
+         * non-cacheable, so there is nothing to clean. */
+        (void) SYS_CACHE_NonCacheableRegionRemove(gSysDmaPool, SYS_DMA_POOL_SIZE);
+
+        MPU_RegionDisable(SYS_DMA_POOL_MPU_REGION);
+
+        gSysDmaPoolNonCacheable = false;
+    }
+    else
+    {
+        /* Already mapped as requested */
+    }
+#endif
+
+    return (gSysDmaPoolNonCacheable == nonCacheable);
+}
+
+void* SYS_DMA_POOL_Allocate( size_t size )
+{
+    uint32_t nBlocks;
+    uint32_t first = 0U;
+    uint32_t run = 0U;
+    uint32_t i;
+    void* buffer = NULL;
+    bool interruptState;
+
+    if ((size == 0U) || (size > SYS_DMA_POOL_SIZE))
+    {
+        return NULL;
+    }
+
+    nBlocks = ((uint32_t)size + SYS_DMA_POOL_BLOCK_SIZE - 1U) / SYS_DMA_POOL_BLOCK_SIZE;
+
+    interruptState = SYS_INT_Disable();
+
+    /* First fit: look for nBlocks free blocks in a row */
+    for (i = 0U; i < SYS_DMA_POOL_BLOCKS; i++)
+    {
+        if (gSysDmaPoolBlocks[i] != SYS_DMA_POOL_BLOCK_FREE)
+        {
+            run = 0U;
+            continue;
+        }
+
+        if (run == 0U)
+        {
+            first = i;
+        }
+
+        run++;
+
+        if (run == nBlocks)
+        {
+            gSysDmaPoolBlocks[first] = (uint8_t)nBlocks;
+
+            for (i = first + 1U; i < (first + nBlocks); i++)
+            {
+                gSysDmaPoolBlocks[i] = SYS_DMA_POOL_BLOCK_CONTINUED;
+            }
+
+            buffer = &gSysDmaPool[first * SYS_DMA_POOL_BLOCK_SIZE];
+            break;
+        }
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    return buffer;
+}
+
+void SYS_DMA_POOL_Free( void* buffer )
+{
+    uintptr_t offset;
+    uint32_t first;
+    uint32_t nBlocks;
+    uint32_t i;
+    bool interruptState;
+
+    if ((buffer == NULL) || ((uintptr_t)buffer < (uintptr_t)gSysDmaPool))
+    {
+        return;
+    }
+
+    offset = (uintptr_t)buffer - (uintptr_t)gSysDmaPool;
+
+    if ((offset >= SYS_DMA_POOL_SIZE) || ((offset % SYS_DMA_POOL_BLOCK_SIZE) != 0U))
+    {
+        return;
+    }
+
+    first = (uint32_t)offset / SYS_DMA_POOL_BLOCK_SIZE;
+
+    interruptState = SYS_INT_Disable();
+
+    nBlocks = gSysDmaPoolBlocks[first];
+
+    /* Ignore blocks that do not start an allocation */
+    if ((nBlocks != SYS_DMA_POOL_BLOCK_FREE) && (nBlocks != SYS_DMA_POOL_BLOCK_CONTINUED))
+    {
+        for (i = first; i < (first + nBlocks); i++)
+        {
+            gSysDmaPoolBlocks[i] = SYS_DMA_POOL_BLOCK_FREE;
+        }
+    }
+
+    SYS_INT_Restore(interruptState);
+}
+
+bool SYS_DMA_POOL_IsNonCacheable( void )
+{
+    return gSysDmaPoolNonCacheable;
+}
@@ -0,0 +1,255 @@
+/*******************************************************************************
+  DMA Pool System Service Library Interface Header File
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    sys_dma_pool.h
+
+  Summary
+    DMA buffer pool system service library interface.
+
+  Description
+    This file defines the interface to the DMA buffer pool. The pool is a
+    statically allocated block of SRAM that drivers carve their DMA buffers
+    from. When SYS_DMA_POOL_NON_CACHEABLE is true the pool is mapped
+    non-cacheable by an MPU region, so buffers allocated from it need no Data
+    Cache maintenance around DMA transfers.
+
+  Remarks:
+    None.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef SYS_DMA_POOL_H    // Guards against multiple inclusion
+#define SYS_DMA_POOL_H
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA Pool System Service Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_POOL_Initialize( void )
+
+  Summary:
+    Initializes the DMA buffer pool.
+
+  Description:
+    Marks the whole pool free. When SYS_DMA_POOL_NON_CACHEABLE is true, the
+    pool is mapped Normal, non-cacheable, execute-never by MPU region
+    SYS_DMA_POOL_MPU_REGION, any lines it still holds in the Data Cache are
+    cleaned and invalidated, and the pool is registered with
+    SYS_CACHE_NonCacheableRegionAdd so that the cache maintenance done by the
+    drivers on pool buffers is skipped.
+
+  Precondition:
+    The MPU and the Data Cache are initialized.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_POOL_Initialize();
+    </code>
+
+  Remarks:
+    Call from SYS_Initialize, before the drivers that allocate from the pool.
+*/
+void SYS_DMA_POOL_Initialize( void );
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_POOL_NonCacheableSet( bool nonCacheable )
+
+  Summary:
+    Maps the DMA buffer pool non-cacheable or cacheable.
+
+  Description:
+    With nonCacheable true, the pool is mapped as SYS_DMA_POOL_Initialize
+    does. With nonCacheable false, the pool is removed from the non-cacheable
+    region table and MPU region SYS_DMA_POOL_MPU_REGION is disabled, so the
+    pool goes back to the default, cacheable memory map and the drivers
+    maintain the cache on pool buffers again.
+
+  Precondition:
+    SYS_DMA_POOL_Initialize has been called.
+
+  Parameters:
+    nonCacheable - true to map the pool non-cacheable, false for cacheable
+
+  Returns:
+    true  - the pool is mapped as requested
+    false - the pool could not be mapped non-cacheable, either because
+            SYS_DMA_POOL_NON_CACHEABLE is false or because the non-cacheable
+            region table is full
+
+  Example:
+    <code>
+    if (SYS_DMA_POOL_NonCacheableSet(false) == true)
+    {
+        // Time the transfers with the cache maintained on pool buffers
+    }
+    </code>
+
+  Remarks:
+    Meant for comparing both mappings at run time. No DMA transfer may be in
+    progress on a pool buffer while the mapping is changed.
+*/
+bool SYS_DMA_POOL_NonCacheableSet( bool nonCacheable );
+
+//******************************************************************************
+/* Function:
+    void* SYS_DMA_POOL_Allocate( size_t size )
+
+  Summary:
+    Allocates a buffer from the DMA buffer pool.
+
+  Description:
+    Allocates a buffer of at least size bytes. The buffer starts on a cache
+    line boundary and is rounded up to whole SYS_DMA_POOL_BLOCK_SIZE blocks,
+    so it never shares a cache line with another buffer.
+
+  Precondition:
+    SYS_DMA_POOL_Initialize has been called.
+
+  Parameters:
+    size - size of the buffer (in number of bytes)
+
+  Returns:
+    Pointer to the buffer, or NULL if size is zero or the pool has no run of
+    free blocks large enough.
+
+  Example:
+    <code>
+    uint8_t* dmaBuffer = SYS_DMA_POOL_Allocate(512U);
+    </code>
+
+  Remarks:
+    Interrupt safe. The pool is meant for buffers that live as long as the
+    driver, a first fit search is used and no attempt is made to limit
+    fragmentation.
+*/
+void* SYS_DMA_POOL_Allocate( size_t size );
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_POOL_Free( void* buffer )
+
+  Summary:
+    Returns a buffer to the DMA buffer pool.
+
+  Description:
+    Frees a buffer obtained from SYS_DMA_POOL_Allocate. NULL and pointers
+    outside the pool are ignored.
+
+  Precondition:
+    SYS_DMA_POOL_Initialize has been called.
+
+  Parameters:
+    buffer - buffer returned by SYS_DMA_POOL_Allocate
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_POOL_Free(dmaBuffer);
+    </code>
+
+  Remarks:
+    Interrupt safe.
+*/
+void SYS_DMA_POOL_Free( void* buffer );
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_POOL_IsNonCacheable( void )
+
+  Summary:
+    Returns whether the pool is mapped non-cacheable.
+
+  Description:
+    Returns true while the pool is mapped non-cacheable through the MPU, by
+    SYS_DMA_POOL_Initialize or SYS_DMA_POOL_NonCacheableSet.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    true  - buffers from the pool bypass the Data Cache
+    false - buffers from the pool are cacheable
+
+  Example:
+    <code>
+    SYS_CONSOLE_PRINT("DMA pool: %s\r\n", SYS_DMA_POOL_IsNonCacheable() ? "non-cacheable" : "cacheable");
+    </code>
+
+  Remarks:
+    None.
+*/
+bool SYS_DMA_POOL_IsNonCacheable( void );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_DMA_POOL_H
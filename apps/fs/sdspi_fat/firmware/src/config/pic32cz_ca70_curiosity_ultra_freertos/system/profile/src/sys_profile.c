@@ -0,0 +1,344 @@
+/*******************************************************************************
+  RTOS Profiling Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_profile.c
+
+  Summary:
+    RTOS profiling implementation.
+
+  Description:
+    This file implements the FreeRTOS run time statistics clock, the trace
+    ring, the scheduling latency statistics and the reports of the RTOS
+    profiling service.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "system/profile/sys_profile.h"
+
+#if (SYS_PROFILE_ENABLE == true)
+
+#include "definitions.h"
+
+#if !defined(SYS_PROFILE_PRINT)
+    #define SYS_PROFILE_PRINT(fmt, ...)     SYS_CONSOLE_PRINT(fmt, ##__VA_ARGS__)
+#endif
+
+#if ((SYS_PROFILE_TRACE_SIZE & (SYS_PROFILE_TRACE_SIZE - 1U)) != 0U)
+    #error "SYS_PROFILE_TRACE_SIZE must be a power of two"
+#endif
+
+#if (SYS_PROFILE_TRACE_PRINT_COUNT > SYS_PROFILE_TRACE_SIZE)
+    #error "SYS_PROFILE_TRACE_PRINT_COUNT must not exceed SYS_PROFILE_TRACE_SIZE"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    /* SYS_TIME count at which the task was made ready */
+    uint32_t readyAt;
+
+    /* The task is ready and has not been switched in since */
+    bool readyPending;
+
+    /* Largest scheduling latency since the previous report, in counts */
+    uint32_t latencyMax;
+
+    /* Run time of the task at the previous report */
+    uint64_t runTimeLast;
+
+} SYS_PROFILE_TASK_DATA;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_PROFILE_TRACE_ENTRY gSysProfileTrace[SYS_PROFILE_TRACE_SIZE];
+
+/* Number of events recorded since the scheduler start, the next event goes
+ * to gSysProfileTrace[gSysProfileTraceCount % SYS_PROFILE_TRACE_SIZE] */
+static volatile uint32_t gSysProfileTraceCount;
+
+static SYS_PROFILE_TASK_DATA gSysProfileTaskData[SYS_PROFILE_MAX_TASKS];
+
+/* Task number last switched in */
+static uint32_t gSysProfileCurrentTask;
+
+/* SYS_TIME count at the scheduler start */
+static uint64_t gSysProfileStartCount;
+
+/* Total run time at the previous report */
+static uint64_t gSysProfileRunTimeLast;
+
+/* Task states collected by SYS_PROFILE_ReportPrint */
+static TaskStatus_t gSysProfileTaskStatus[SYS_PROFILE_MAX_TASKS];
+
+static const char* const gSysProfileEventNames[] =
+{
+    "ready",
+    "switch",
+    "isr"
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void lSYS_PROFILE_TraceAdd(SYS_PROFILE_EVENT event, uint32_t id, uint32_t timestamp)
+{
+    SYS_PROFILE_TRACE_ENTRY* entry;
+    bool interruptState;
+
+    /* FromISR routines run with interrupts enabled, so a nested handler may
+     * record an event at the same time */
+    interruptState = SYS_INT_Disable();
+
+    entry = &gSysProfileTrace[gSysProfileTraceCount & (SYS_PROFILE_TRACE_SIZE - 1U)];
+    entry->timestamp = timestamp;
+    entry->event = (uint16_t)event;
+    entry->id = (uint16_t)id;
+    gSysProfileTraceCount++;
+
+    SYS_INT_Restore(interruptState);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Kernel Hook Routines
+// *****************************************************************************
+// *****************************************************************************
+
+void SYS_PROFILE_SchedulerStart ( void )
+{
+    uint32_t i;
+
+    /* The tasks created before the scheduler start have not waited for it */
+    for (i = 0U; i < SYS_PROFILE_MAX_TASKS; i++)
+    {
+        gSysProfileTaskData[i].readyPending = false;
+        gSysProfileTaskData[i].latencyMax = 0U;
+        gSysProfileTaskData[i].runTimeLast = 0U;
+    }
+
+    gSysProfileTraceCount = 0U;
+    gSysProfileCurrentTask = 0U;
+    gSysProfileRunTimeLast = 0U;
+    gSysProfileStartCount = SYS_TIME_Counter64Get();
+}
+
+uint64_t SYS_PROFILE_RunTimeCounterGet ( void )
+{
+    return (SYS_TIME_Counter64Get() - gSysProfileStartCount);
+}
+
+void SYS_PROFILE_TaskReady ( uint32_t taskNumber )
+{
+    uint32_t now = (uint32_t)SYS_TIME_Counter64Get();
+
+    if ((taskNumber < SYS_PROFILE_MAX_TASKS) && (gSysProfileTaskData[taskNumber].readyPending == false))
+    {
+        gSysProfileTaskData[taskNumber].readyAt = now;
+        gSysProfileTaskData[taskNumber].readyPending = true;
+    }
+
+    lSYS_PROFILE_TraceAdd(SYS_PROFILE_EVENT_TASK_READY, taskNumber, now);
+}
+
+void SYS_PROFILE_TaskSwitchedIn ( uint32_t taskNumber )
+{
+    SYS_PROFILE_TASK_DATA* taskData;
+    uint32_t now;
+    uint32_t latency;
+
+    /* vTaskSwitchContext runs on every PendSV, including when the running
+     * task keeps the CPU */
+    if (taskNumber == gSysProfileCurrentTask)
+    {
+        return;
+    }
+
+    now = (uint32_t)SYS_TIME_Counter64Get();
+    gSysProfileCurrentTask = taskNumber;
+
+    if (taskNumber < SYS_PROFILE_MAX_TASKS)
+    {
+        taskData = &gSysProfileTaskData[taskNumber];
+
+        if (taskData->readyPending == true)
+        {
+            taskData->readyPending = false;
+            latency = now - taskData->readyAt;
+
+            if (latency > taskData->latencyMax)
+            {
+                taskData->latencyMax = latency;
+            }
+        }
+    }
+
+    lSYS_PROFILE_TraceAdd(SYS_PROFILE_EVENT_TASK_SWITCH, taskNumber, now);
+}
+
+void SYS_PROFILE_IsrEnter ( void )
+{
+    lSYS_PROFILE_TraceAdd(SYS_PROFILE_EVENT_ISR, __get_IPSR(), (uint32_t)SYS_TIME_Counter64Get());
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+void SYS_PROFILE_ReportPrint ( void )
+{
+    configRUN_TIME_COUNTER_TYPE runTimeTotal = 0U;
+    uint64_t window;
+    uint64_t runTime;
+    uint32_t permille;
+    uint32_t latencyMax;
+    uint32_t taskNumber;
+    UBaseType_t taskCount;
+    UBaseType_t i;
+    bool interruptState;
+
+    taskCount = uxTaskGetSystemState(gSysProfileTaskStatus, SYS_PROFILE_MAX_TASKS, &runTimeTotal);
+
+    if (taskCount == 0U)
+    {
+        /* More tasks than SYS_PROFILE_MAX_TASKS */
+        SYS_PROFILE_PRINT("PROF more than %lu tasks\r\n", (unsigned long)SYS_PROFILE_MAX_TASKS);
+        return;
+    }
+
+    window = runTimeTotal - gSysProfileRunTimeLast;
+    gSysProfileRunTimeLast = runTimeTotal;
+
+    for (i = 0U; i < taskCount; i++)
+    {
+        taskNumber = (uint32_t)gSysProfileTaskStatus[i].xTaskNumber;
+        runTime = gSysProfileTaskStatus[i].ulRunTimeCounter;
+        latencyMax = 0U;
+
+        if (taskNumber < SYS_PROFILE_MAX_TASKS)
+        {
+            interruptState = SYS_INT_Disable();
+            latencyMax = gSysProfileTaskData[taskNumber].latencyMax;
+            gSysProfileTaskData[taskNumber].latencyMax = 0U;
+            SYS_INT_Restore(interruptState);
+
+            runTime -= gSysProfileTaskData[taskNumber].runTimeLast;
+            gSysProfileTaskData[taskNumber].runTimeLast = gSysProfileTaskStatus[i].ulRunTimeCounter;
+        }
+
+        permille = (window != 0U) ? (uint32_t)((runTime * 1000U) / window) : 0U;
+
+        SYS_PROFILE_PRINT("PROF id=%lu task=%s cpu=%lu.%lu%% lat_max_us=%lu stack_free=%lu\r\n",
+                          (unsigned long)taskNumber, gSysProfileTaskStatus[i].pcTaskName,
+                          (unsigned long)(permille / 10U), (unsigned long)(permille % 10U),
+                          (unsigned long)SYS_TIME_CountToUS(latencyMax),
+                          (unsigned long)(gSysProfileTaskStatus[i].usStackHighWaterMark * sizeof(StackType_t)));
+    }
+
+    SYS_PROFILE_PRINT("PROF window_ms=%lu\r\n", (unsigned long)((window * 1000U) / SYS_TIME_FrequencyGet()));
+}
+
+void SYS_PROFILE_TracePrint ( void )
+{
+    SYS_PROFILE_TRACE_ENTRY entry;
+    uint32_t count = gSysProfileTraceCount;
+    uint32_t first;
+    uint32_t previous = 0U;
+    uint32_t index;
+    bool interruptState;
+
+    first = (count > SYS_PROFILE_TRACE_PRINT_COUNT) ? (count - SYS_PROFILE_TRACE_PRINT_COUNT) : 0U;
+
+    for (index = first; index < count; index++)
+    {
+        interruptState = SYS_INT_Disable();
+
+        /* Skip the events overwritten since the report started */
+        if ((gSysProfileTraceCount - index) > SYS_PROFILE_TRACE_SIZE)
+        {
+            SYS_INT_Restore(interruptState);
+            continue;
+        }
+
+        entry = gSysProfileTrace[index & (SYS_PROFILE_TRACE_SIZE - 1U)];
+
+        SYS_INT_Restore(interruptState);
+
+        SYS_PROFILE_PRINT("TRACE dt_us=%lu ev=%s id=%u\r\n",
+                          (unsigned long)((index != first) ? SYS_TIME_CountToUS(entry.timestamp - previous) : 0U),
+                          gSysProfileEventNames[entry.event], (unsigned int)entry.id);
+
+        previous = entry.timestamp;
+    }
+}
+
+bool SYS_PROFILE_CommandProcess ( uint8_t key )
+{
+    bool handled = true;
+
+    switch (key)
+    {
+        case (uint8_t)'p':
+            SYS_PROFILE_ReportPrint();
+            break;
+
+        case (uint8_t)'t':
+            SYS_PROFILE_TracePrint();
+            break;
+
+        default:
+            handled = false;
+            break;
+    }
+
+    return handled;
+}
+
+#endif // (SYS_PROFILE_ENABLE == true)
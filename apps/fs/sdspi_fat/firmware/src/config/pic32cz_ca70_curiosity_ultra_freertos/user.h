@@ -64,6 +64,8 @@ extern "C" {
 #define SWITCH_GET()            SW1_Get()
 #define SWITCH_STATUS_PRESSED   SW1_STATE_PRESSED   
 #define BUFFER_ATTRIBUTES       CACHE_ALIGN
+#define SDCARD_SECTOR_READ      DRV_SDSPI_Read
+#define SDCARD_SECTOR_WRITE     DRV_SDSPI_Write
 
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
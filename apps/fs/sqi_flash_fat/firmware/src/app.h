@@ -132,6 +132,9 @@ typedef enum
     /* The app closes the file. */
     APP_CLOSE_FILE,
 
+    /* The app runs the block device benchmark */
+    APP_FS_BENCH,
+
     /* The app unmounts the disk. */
     APP_UNMOUNT_DISK,
 
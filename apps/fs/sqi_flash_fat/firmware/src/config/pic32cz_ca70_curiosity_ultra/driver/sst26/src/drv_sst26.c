@@ -48,6 +48,10 @@
 // *****************************************************************************
 
 #include "driver/sst26/src/drv_sst26_local.h"
+#if (DRV_SST26_XIP_ENABLE == true)
+#include "peripheral/mpu/plib_mpu_local.h"
+#include "system/cache/sys_cache.h"
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -134,10 +138,188 @@ static bool DRV_SST26_EnableQuadIO(void)
     return status;
 }
 
+#if (DRV_SST26_XIP_ENABLE == true)
+/* Data cache size of the Cortex-M7, above which the whole cache is cleaned and
+ * invalidated rather than walked by address */
+#define DRV_SST26_XIP_DCACHE_SIZE   (16384U)
+
+static void lDRV_SST26_XipTransferSetup( uint8_t mode )
+{
+    (void) memset((void *)&qspi_memory_xfer, 0, sizeof(qspi_memory_xfer_t));
+
+    /* High speed read, the mode byte takes the first two of its six dummy
+     * cycles */
+    qspi_memory_xfer.instruction = (uint8_t)SST26_CMD_HIGH_SPEED_READ;
+    qspi_memory_xfer.width = QUAD_CMD;
+    qspi_memory_xfer.addr_len = ADDRL_24_BIT;
+    qspi_memory_xfer.option_en = true;
+    qspi_memory_xfer.option_len = OPTL_8_BIT;
+    qspi_memory_xfer.option = mode;
+    qspi_memory_xfer.dummy_cycles = 4;
+    qspi_memory_xfer.continuous_read_en = true;
+}
+
+static void lDRV_SST26_XipRegionSet( bool enable )
+{
+    __DMB();
+
+    if (enable == true)
+    {
+        /* Normal write-through read-only memory over the flash. The size
+         * field is log2(size) - 1, the flash size being a power of two. */
+        MPU->RBAR = MPU_REGION(DRV_SST26_XIP_MPU_REGION, QSPIMEM_ADDR);
+        MPU->RASR = MPU_REGION_SIZE(30U - (uint32_t)__CLZ(dObj->xipSize)) | MPU_RASR_AP(MPU_RASR_AP_READONLY_Val) |
+                    MPU_ATTR_NORMAL_WT | MPU_ATTR_ENABLE;
+    }
+    else
+    {
+        MPU->RBAR = MPU_RBAR_REGION(DRV_SST26_XIP_MPU_REGION) | MPU_RBAR_VALID_Msk;
+        MPU->RASR &= ~MPU_ATTR_ENABLE;
+    }
+
+    __DSB();
+    __ISB();
+
+    /* The window is cacheable only while the region is enabled, the cache
+     * maintenance of the system service has to follow */
+    SYS_CACHE_NonCacheableRegionsLoad();
+}
+
+/* Records a program or erase operation and its range. The flash is not mapped
+ * again until TransferStatusGet has seen the operation complete, and the
+ * cache lines of the range are invalidated at that point. */
+static void lDRV_SST26_XipDirty( uint32_t address, uint32_t size )
+{
+    uint32_t end = address + size;
+
+    dObj->isXipOpPending = true;
+
+    if (dObj->xipDirtyEnd <= dObj->xipDirtyStart)
+    {
+        dObj->xipDirtyStart = address;
+        dObj->xipDirtyEnd   = end;
+    }
+    else
+    {
+        if (address < dObj->xipDirtyStart)
+        {
+            dObj->xipDirtyStart = address;
+        }
+
+        if (end > dObj->xipDirtyEnd)
+        {
+            dObj->xipDirtyEnd = end;
+        }
+    }
+}
+
+/* Called by TransferStatusGet once the flash reports the recorded program or
+ * erase operation complete. Drops the cache lines of its range, which may
+ * hold the previous contents. The window is not mapped at this point, so the
+ * cache service sees it as non-cacheable and would skip the invalidation by
+ * address: the core function is called directly. */
+static void lDRV_SST26_XipOperationComplete( void )
+{
+    uint32_t start;
+
+    if (dObj->xipDirtyEnd > dObj->xipDirtyStart)
+    {
+        start = dObj->xipDirtyStart & ~(CACHE_LINE_SIZE - 1U);
+
+        if ((dObj->xipDirtyEnd - start) > DRV_SST26_XIP_DCACHE_SIZE)
+        {
+            SYS_CACHE_CleanInvalidateDCache();
+        }
+        else if (DATA_CACHE_IS_ENABLED() != 0U)
+        {
+            DCACHE_INVALIDATE_BY_ADDR((uint32_t *)(QSPIMEM_ADDR + start), (int32_t)(dObj->xipDirtyEnd - start));
+        }
+        else
+        {
+            /* Nothing cached */
+        }
+
+        /* Code may have been fetched from the window as well */
+        SYS_CACHE_InvalidateICache();
+    }
+
+    dObj->xipDirtyStart  = 0;
+    dObj->xipDirtyEnd    = 0;
+    dObj->isXipOpPending = false;
+}
+
+/* Maps the flash in the QSPI memory window. Returns false when execute-in-
+ * place is not available, or while a program or erase operation is in
+ * progress and not suspended, reads then go through MemoryRead. */
+static bool lDRV_SST26_XipEnter( void )
+{
+    if (dObj->isXipActive == true)
+    {
+        return true;
+    }
+
+    if ((dObj->xipSize == 0U) || (dObj->sst26Plib->MemoryMapEnter == NULL))
+    {
+        return false;
+    }
+
+    /* A busy flash would answer the continuous read with garbage */
+    if ((dObj->isXipOpPending == true) && (dObj->isSuspended == false))
+    {
+        return false;
+    }
+
+    lDRV_SST26_XipTransferSetup((uint8_t)DRV_SST26_XIP_MODE_CONTINUOUS);
+
+    if (dObj->sst26Plib->MemoryMapEnter(&qspi_memory_xfer) == false)
+    {
+        return false;
+    }
+
+    lDRV_SST26_XipRegionSet(true);
+
+    dObj->isXipActive = true;
+
+    return true;
+}
+
+/* Unmaps the flash before any other command is sent to it. Fails while a
+ * consumer holds the window with DRV_SST26_XipLock. */
+static bool lDRV_SST26_XipExit( void )
+{
+    if (dObj->isXipActive == false)
+    {
+        return true;
+    }
+
+    if (dObj->xipLockCount > 0U)
+    {
+        return false;
+    }
+
+    /* Back to the strongly ordered attributes of the window, no access is
+     * served from the cache while the flash is not mapped */
+    lDRV_SST26_XipRegionSet(false);
+
+    dObj->isXipActive = false;
+
+    lDRV_SST26_XipTransferSetup((uint8_t)DRV_SST26_XIP_MODE_EXIT);
+
+    return dObj->sst26Plib->MemoryMapExit(&qspi_memory_xfer);
+}
+#endif
+
 static bool DRV_SST26_WriteEnable(void)
 {
     bool status = false;
 
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (lDRV_SST26_XipExit() == false)
+    {
+        return status;
+    }
+#endif
+
     (void) memset((void *)&qspi_command_xfer, 0, sizeof(qspi_command_xfer_t));
 
     qspi_command_xfer.instruction = (uint8_t)SST26_CMD_WRITE_ENABLE;
@@ -220,6 +402,13 @@ bool DRV_SST26_ReadJedecId( const DRV_HANDLE handle, void *jedec_id)
         return status;
     }
 
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (lDRV_SST26_XipExit() == false)
+    {
+        return status;
+    }
+#endif
+
     (void) memset((void *)&qspi_register_xfer, 0, sizeof(qspi_register_xfer_t));
 
     qspi_register_xfer.instruction = (uint8_t)SST26_CMD_QUAD_JEDEC_ID_READ;
@@ -240,6 +429,13 @@ bool DRV_SST26_ReadStatus( const DRV_HANDLE handle, void *rx_data, uint32_t rx_d
         return status;
     }
 
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (lDRV_SST26_XipExit() == false)
+    {
+        return status;
+    }
+#endif
+
     (void) memset((void *)&qspi_register_xfer, 0, sizeof(qspi_register_xfer_t));
 
     qspi_register_xfer.instruction = (uint8_t)SST26_CMD_READ_STATUS_REG;
@@ -262,23 +458,49 @@ DRV_SST26_TRANSFER_STATUS DRV_SST26_TransferStatusGet( const DRV_HANDLE handle )
         return status;
     }
 
-    if (gDrvSST26Obj.curOpType == DRV_SST26_OPERATION_TYPE_READ )
+#if (DRV_SST26_XIP_ENABLE == true)
+    /* Nothing is programmed or erased while the window is locked */
+    if (dObj->xipLockCount > 0U)
     {
         return DRV_SST26_TRANSFER_COMPLETED;
     }
+#endif
+
+    if (gDrvSST26Obj.curOpType == DRV_SST26_OPERATION_TYPE_READ )
+    {
+#if (DRV_SST26_XIP_ENABLE == true)
+        /* A read issued before the completion of a program or erase was
+         * seen leaves it to be checked below */
+        if (dObj->isXipOpPending == false)
+#endif
+        {
+            return DRV_SST26_TRANSFER_COMPLETED;
+        }
+    }
 
     if (DRV_SST26_ReadStatus(handle, (void *)&reg_status, 1) == false)
     {
         return status;
     }
 
-    if((reg_status & (1UL<<0)) != 0U)
+    if((reg_status & DRV_SST26_STATUS_BUSY) != 0U)
     {
         status = DRV_SST26_TRANSFER_BUSY;
     }
     else
     {
         status = DRV_SST26_TRANSFER_COMPLETED;
+
+#if (DRV_SST26_XIP_ENABLE == true)
+        /* The flash also reports idle while an operation is suspended */
+        if ((dObj->isXipOpPending == true) && (dObj->isSuspended == false))
+        {
+            lDRV_SST26_XipOperationComplete();
+        }
+
+        /* Map the flash again as soon as it is idle */
+        (void) lDRV_SST26_XipEnter();
+#endif
     }
 
     return status;
@@ -293,6 +515,18 @@ bool DRV_SST26_Read( const DRV_HANDLE handle, void *rx_data, uint32_t rx_data_le
         return status;
     }
 
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (lDRV_SST26_XipEnter() == true)
+    {
+        /* Plain memory read through the data cache */
+        (void) memcpy(rx_data, (const void *)(QSPIMEM_ADDR + address), rx_data_length);
+
+        gDrvSST26Obj.curOpType = DRV_SST26_OPERATION_TYPE_READ;
+
+        return true;
+    }
+#endif
+
     (void) memset((void *)&qspi_memory_xfer, 0, sizeof(qspi_memory_xfer_t));
 
     qspi_memory_xfer.instruction = (uint8_t)SST26_CMD_HIGH_SPEED_READ;
@@ -329,6 +563,10 @@ bool DRV_SST26_PageWrite( const DRV_HANDLE handle, void *tx_data, uint32_t addre
 
     status = dObj->sst26Plib->MemoryWrite(&qspi_memory_xfer, (uint32_t *)tx_data, DRV_SST26_PAGE_SIZE, address);
 
+#if (DRV_SST26_XIP_ENABLE == true)
+    lDRV_SST26_XipDirty(address, DRV_SST26_PAGE_SIZE);
+#endif
+
     gDrvSST26Obj.curOpType = DRV_SST26_OPERATION_TYPE_WRITE;
 
     return status;
@@ -357,32 +595,146 @@ static bool DRV_SST26_Erase( uint8_t instruction, uint32_t address )
 
 bool DRV_SST26_SectorErase( const DRV_HANDLE handle, uint32_t address )
 {
+    bool status = false;
+
     if(handle == DRV_HANDLE_INVALID)
     {
-        return false;
+        return status;
+    }
+
+    status = DRV_SST26_Erase((uint8_t)SST26_CMD_SECTOR_ERASE, address);
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (status == true)
+    {
+        lDRV_SST26_XipDirty((address & ~(DRV_SST26_ERASE_BUFFER_SIZE - 1U)), DRV_SST26_ERASE_BUFFER_SIZE);
     }
+#endif
 
-    return (DRV_SST26_Erase((uint8_t)SST26_CMD_SECTOR_ERASE, address));
+    return status;
 }
 
 bool DRV_SST26_BulkErase( const DRV_HANDLE handle, uint32_t address )
 {
+    bool status = false;
+
     if(handle == DRV_HANDLE_INVALID)
     {
-        return false;
+        return status;
+    }
+
+    status = DRV_SST26_Erase((uint8_t)SST26_CMD_BULK_ERASE_64K, address);
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (status == true)
+    {
+        /* The smaller blocks at both ends of the array lie within 64 KB */
+        lDRV_SST26_XipDirty((address & ~(DRV_SST26_BULK_ERASE_SIZE - 1U)), DRV_SST26_BULK_ERASE_SIZE);
     }
+#endif
 
-    return (DRV_SST26_Erase((uint8_t)SST26_CMD_BULK_ERASE_64K, address));
+    return status;
 }
 
 bool DRV_SST26_ChipErase( const DRV_HANDLE handle )
 {
+    bool status = false;
+
     if(handle == DRV_HANDLE_INVALID)
+    {
+        return status;
+    }
+
+    status = DRV_SST26_Erase((uint8_t)SST26_CMD_CHIP_ERASE, 0);
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (status == true)
+    {
+        lDRV_SST26_XipDirty(0, dObj->xipSize);
+    }
+#endif
+
+    return status;
+}
+
+bool DRV_SST26_Suspend( const DRV_HANDLE handle )
+{
+    uint8_t reg_status = 0;
+
+    if ((handle == DRV_HANDLE_INVALID) || (dObj->isSuspended == true))
+    {
+        return false;
+    }
+
+    if ((gDrvSST26Obj.curOpType != DRV_SST26_OPERATION_TYPE_WRITE) &&
+        (gDrvSST26Obj.curOpType != DRV_SST26_OPERATION_TYPE_ERASE))
     {
         return false;
     }
 
-    return (DRV_SST26_Erase((uint8_t)SST26_CMD_CHIP_ERASE, 0));
+    (void) memset((void *)&qspi_command_xfer, 0, sizeof(qspi_command_xfer_t));
+
+    qspi_command_xfer.instruction = (uint8_t)SST26_CMD_WRITE_SUSPEND;
+    qspi_command_xfer.width = QUAD_CMD;
+
+    if (dObj->sst26Plib->CommandWrite(&qspi_command_xfer, 0) == false)
+    {
+        return false;
+    }
+
+    /* The flash enters the suspended state within 10 us */
+    do
+    {
+        if (DRV_SST26_ReadStatus(handle, (void *)&reg_status, 1) == false)
+        {
+            return false;
+        }
+    } while ((reg_status & DRV_SST26_STATUS_BUSY) != 0U);
+
+    if ((reg_status & (DRV_SST26_STATUS_WSE | DRV_SST26_STATUS_WSP)) == 0U)
+    {
+        /* The operation completed before the suspend command was received */
+        return false;
+    }
+
+    dObj->suspendedOpType = gDrvSST26Obj.curOpType;
+    dObj->isSuspended     = true;
+
+    gDrvSST26Obj.curOpType = DRV_SST26_OPERATION_TYPE_CMD;
+
+    return true;
+}
+
+bool DRV_SST26_Resume( const DRV_HANDLE handle )
+{
+    bool status = false;
+
+    if ((handle == DRV_HANDLE_INVALID) || (dObj->isSuspended == false))
+    {
+        return status;
+    }
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (lDRV_SST26_XipExit() == false)
+    {
+        return status;
+    }
+#endif
+
+    (void) memset((void *)&qspi_command_xfer, 0, sizeof(qspi_command_xfer_t));
+
+    qspi_command_xfer.instruction = (uint8_t)SST26_CMD_WRITE_RESUME;
+    qspi_command_xfer.width = QUAD_CMD;
+
+    status = dObj->sst26Plib->CommandWrite(&qspi_command_xfer, 0);
+
+    if (status == true)
+    {
+        gDrvSST26Obj.curOpType = dObj->suspendedOpType;
+        dObj->isSuspended      = false;
+    }
+
+    return status;
 }
 
 bool DRV_SST26_GeometryGet( const DRV_HANDLE handle, DRV_SST26_GEOMETRY *geometry )
@@ -454,6 +806,13 @@ DRV_HANDLE DRV_SST26_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT
         return DRV_HANDLE_INVALID;
     }
 
+#if (DRV_SST26_XIP_ENABLE == true)
+    if (lDRV_SST26_XipExit() == false)
+    {
+        return DRV_HANDLE_INVALID;
+    }
+#endif
+
     /* Reset SST26 Flash device */
     if (DRV_SST26_ResetFlash() == false)
     {
@@ -475,6 +834,22 @@ DRV_HANDLE DRV_SST26_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT
         }
     }
 
+#if (DRV_SST26_XIP_ENABLE == true)
+    {
+        uint8_t jedecID[3] = { 0 };
+
+        if (DRV_SST26_ReadJedecId((DRV_HANDLE)drvIndex, (void *)&jedecID) == false)
+        {
+            return DRV_HANDLE_INVALID;
+        }
+
+        /* An unknown device is accessed through MemoryRead only */
+        dObj->xipSize = DRV_SST26_GetFlashSize(jedecID[2]);
+
+        (void) lDRV_SST26_XipEnter();
+    }
+#endif
+
     dObj->nClients++;
 
     dObj->ioIntent = ioIntent;
@@ -488,6 +863,13 @@ void DRV_SST26_Close( const DRV_HANDLE handle )
          (dObj->nClients > 0U))
     {
         dObj->nClients--;
+
+#if (DRV_SST26_XIP_ENABLE == true)
+        if (dObj->nClients == 0U)
+        {
+            (void) lDRV_SST26_XipExit();
+        }
+#endif
     }
 }
 /* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -
@@ -518,6 +900,18 @@ SYS_MODULE_OBJ DRV_SST26_Initialize
     /* Initialize the attached memory device functions */
     dObj->sst26Plib = sst26Init->sst26Plib;
 
+    dObj->isSuspended     = false;
+    dObj->suspendedOpType = DRV_SST26_OPERATION_TYPE_CMD;
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    dObj->isXipActive   = false;
+    dObj->isXipOpPending = false;
+    dObj->xipLockCount  = 0;
+    dObj->xipSize       = 0;
+    dObj->xipDirtyStart = 0;
+    dObj->xipDirtyEnd   = 0;
+#endif
+
     dObj->status    = SYS_STATUS_READY;
 
     /* Return the driver index */
@@ -525,6 +919,52 @@ SYS_MODULE_OBJ DRV_SST26_Initialize
 }
 /* MISRAC 2012 deviation block end */
 
+void *DRV_SST26_XipAddressGet( const DRV_HANDLE handle, uint32_t address )
+{
+    void *xipAddress = NULL;
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    if ((handle != DRV_HANDLE_INVALID) && (address < dObj->xipSize) && (lDRV_SST26_XipEnter() == true))
+    {
+        xipAddress = (void *)(QSPIMEM_ADDR + address);
+    }
+#else
+    (void)handle;
+    (void)address;
+#endif
+
+    return xipAddress;
+}
+
+bool DRV_SST26_XipLock( const DRV_HANDLE handle )
+{
+    bool status = false;
+
+#if (DRV_SST26_XIP_ENABLE == true)
+    if ((handle != DRV_HANDLE_INVALID) && (dObj->isXipOpPending == false) && (lDRV_SST26_XipEnter() == true))
+    {
+        dObj->xipLockCount++;
+        status = true;
+    }
+#else
+    (void)handle;
+#endif
+
+    return status;
+}
+
+void DRV_SST26_XipUnlock( const DRV_HANDLE handle )
+{
+#if (DRV_SST26_XIP_ENABLE == true)
+    if ((handle != DRV_HANDLE_INVALID) && (dObj->xipLockCount > 0U))
+    {
+        dObj->xipLockCount--;
+    }
+#else
+    (void)handle;
+#endif
+}
+
 SYS_STATUS DRV_SST26_Status( const SYS_MODULE_INDEX drvIndex )
 {
     /* Return the driver status */
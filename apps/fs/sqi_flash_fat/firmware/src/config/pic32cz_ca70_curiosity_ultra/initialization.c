@@ -87,7 +87,9 @@ static const DRV_MEMORY_DEVICE_INTERFACE drvMemory0DeviceAPI = {
     .PageWrite          = DRV_SST26_PageWrite,
     .EventHandlerSet    = NULL,
     .GeometryGet        = (DRV_MEMORY_DEVICE_GEOMETRY_GET)DRV_SST26_GeometryGet,
-    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_SST26_TransferStatusGet
+    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_SST26_TransferStatusGet,
+    .Suspend            = DRV_SST26_Suspend,
+    .Resume             = DRV_SST26_Resume
 };
 static const DRV_MEMORY_INIT drvMemory0InitData =
 {
@@ -234,6 +236,9 @@ void SYS_Initialize ( void* data )
     CLOCK_Initialize();
 	PIO_Initialize();
 
+    /* Skip cache maintenance for the non-cacheable MPU regions */
+    SYS_CACHE_NonCacheableRegionsLoad();
+
 
 
     QSPI_Initialize();
@@ -255,7 +255,7 @@
  * memory in the build.  Set to 0 to exclude the ability to create statically
  * allocated objects from the build.  Defaults to 0 if left undefined.  See
  * https://www.freertos.org/Static_Vs_Dynamic_Memory_Allocation.html. */
-#define configSUPPORT_STATIC_ALLOCATION         0
+#define configSUPPORT_STATIC_ALLOCATION         1
 
 /* Set configSUPPORT_DYNAMIC_ALLOCATION to 1 to include FreeRTOS API functions
  * that create FreeRTOS objects (tasks, queues, etc.) using dynamically allocated
@@ -264,8 +264,15 @@
  * https://www.freertos.org/Static_Vs_Dynamic_Memory_Allocation.html. */
 #define configSUPPORT_DYNAMIC_ALLOCATION        1
 
-/* Sets the total size of the FreeRTOS heap, in bytes, when heap_1.c, heap_2.c
- * or heap_4.c are included in the build.  This value is defaulted to 4096 bytes but
+/* Set configKERNEL_PROVIDED_STATIC_MEMORY to 1 to have the kernel provide the
+ * memory of the idle task and of the timer service task when
+ * configSUPPORT_STATIC_ALLOCATION is 1.  Set to 0 to have the application
+ * provide vApplicationGetIdleTaskMemory() and
+ * vApplicationGetTimerTaskMemory().  Defaults to 0 if left undefined. */
+#define configKERNEL_PROVIDED_STATIC_MEMORY     1
+
+/* Sets the total size of the FreeRTOS heap, in bytes, when heap_1.c, heap_2.c,
+ * heap_4.c or heap_tlsf.c are included in the build.  This value is defaulted to 4096 bytes but
  * it must be tailored to each application.  Note the heap will appear in the .bss
  * section.  See https://www.freertos.org/a00111.html. */
 #define configTOTAL_HEAP_SIZE                   ( ( size_t ) 40960 )
@@ -288,6 +295,12 @@
  * corruptions. Defaults to 0 if left undefined. */
 #define configENABLE_HEAP_PROTECTOR                  0
 
+/* heap_tlsf.c hands out blocks of up to ( 1 << configTLSF_FL_INDEX_MAX ) - 1
+ * bytes, headers included, and must be larger than configTOTAL_HEAP_SIZE.
+ * Each increment adds one size class, 84 bytes of free list heads and
+ * counters. */
+#define configTLSF_FL_INDEX_MAX                      16
+
 /******************************************************************************/
 /* Interrupt nesting behaviour configuration. *********************************/
 /******************************************************************************/
@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the TASK1_Tasks. */
 TaskHandle_t xTASK1_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the TASK1_Tasks task. */
+static StackType_t lTASK1_TasksStack[1024];
+static StaticTask_t lTASK1_TasksTCB;
+#endif
+
 static void lTASK1_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -79,6 +89,12 @@ TaskHandle_t xTASK2_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the TASK2_Tasks task. */
+static StackType_t lTASK2_TasksStack[1024];
+static StaticTask_t lTASK2_TasksTCB;
+#endif
+
 static void lTASK2_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -92,6 +108,12 @@ TaskHandle_t xTASK3_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the TASK3_Tasks task. */
+static StackType_t lTASK3_TasksStack[1024];
+static StaticTask_t lTASK3_TasksTCB;
+#endif
+
 static void lTASK3_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -105,6 +127,12 @@ TaskHandle_t xTASK4_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the TASK4_Tasks task. */
+static StackType_t lTASK4_TasksStack[1024];
+static StaticTask_t lTASK4_TasksTCB;
+#endif
+
 static void lTASK4_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -143,6 +171,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for TASK1_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xTASK1_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lTASK1_Tasks,
+           "TASK1_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lTASK1_TasksStack,
+           &lTASK1_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lTASK1_Tasks,
            "TASK1_Tasks",
@@ -150,8 +188,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xTASK1_Tasks);
+#endif
 
     /* Create OS Thread for TASK2_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xTASK2_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lTASK2_Tasks,
+           "TASK2_Tasks",
+           1024,
+           NULL,
+           2U ,
+           lTASK2_TasksStack,
+           &lTASK2_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lTASK2_Tasks,
            "TASK2_Tasks",
@@ -159,8 +208,19 @@ void SYS_Tasks ( void )
            NULL,
            2U ,
            &xTASK2_Tasks);
+#endif
 
     /* Create OS Thread for TASK3_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xTASK3_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lTASK3_Tasks,
+           "TASK3_Tasks",
+           1024,
+           NULL,
+           3U ,
+           lTASK3_TasksStack,
+           &lTASK3_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lTASK3_Tasks,
            "TASK3_Tasks",
@@ -168,8 +228,19 @@ void SYS_Tasks ( void )
            NULL,
            3U ,
            &xTASK3_Tasks);
+#endif
 
     /* Create OS Thread for TASK4_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xTASK4_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lTASK4_Tasks,
+           "TASK4_Tasks",
+           1024,
+           NULL,
+           4U ,
+           lTASK4_TasksStack,
+           &lTASK4_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lTASK4_Tasks,
            "TASK4_Tasks",
@@ -177,8 +248,13 @@ void SYS_Tasks ( void )
            NULL,
            4U ,
            &xTASK4_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
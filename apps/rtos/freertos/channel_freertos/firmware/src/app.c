@@ -0,0 +1,298 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MPLAB Harmony application.  It
+    implements the logic of the application's state machine and it may call
+    API routines of other MPLAB Harmony modules in the system, such as drivers,
+    system services, and middleware.  However, it does not call any of the
+    system interfaces (such as the "Initialize" and "Tasks" functions) of any of
+    the modules in the system or make any assumptions about when those functions
+    are called.  That is the responsibility of the configuration-specific system
+    files.
+ *******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "app.h"
+#include "app1.h"
+#include "definitions.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Application Data
+
+  Summary:
+    Holds application data
+
+  Description:
+    This structure holds the application's data.
+
+  Remarks:
+    This structure should be initialized by the APP_Initialize function.
+
+    Application strings and buffers are be defined outside this structure.
+*/
+
+APP_DATA appData;
+
+/* Storage of the channel */
+static uint8_t appChannelPool[APP_BENCH_BUFFER_COUNT * APP_BENCH_MESSAGE_SIZE] __ALIGNED(4);
+static OSAL_CHANNEL_MESSAGE appChannelMessages[APP_BENCH_BUFFER_COUNT];
+static uint32_t appChannelFree[APP_BENCH_BUFFER_COUNT];
+
+/* Message built by the producer before xQueueSend() copies it into the
+ * queue. */
+static APP_BENCH_MESSAGE appQueueMessage;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Callback Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* TODO:  Add any necessary callback functions.
+*/
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void APP_CycleCounterEnable(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t APP_CyclesToNs(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000U) / APP_BENCH_CYCLES_PER_US);
+}
+
+/* Hands one message over to the consumer, or the end of the test when
+ * sequence is APP_BENCH_SEQUENCE_END. The channel passes the buffer the
+ * header is written to, the queue copies the whole message in and out. */
+static void APP_MessageSend(bool isChannel, uint32_t sequence)
+{
+    APP_BENCH_MESSAGE* message;
+
+    if (isChannel == true)
+    {
+        message = (APP_BENCH_MESSAGE*)OSAL_CHANNEL_BufferGet(&appData.channel, OSAL_WAIT_FOREVER);
+
+        message->sequence = sequence;
+        message->timestamp = DWT->CYCCNT;
+
+        (void)OSAL_CHANNEL_Send(&appData.channel, message,
+            (sequence == APP_BENCH_SEQUENCE_END) ? 0U : APP_BENCH_MESSAGE_SIZE);
+    }
+    else
+    {
+        appQueueMessage.sequence = sequence;
+        appQueueMessage.timestamp = DWT->CYCCNT;
+
+        (void)xQueueSend(appData.queue, &appQueueMessage, portMAX_DELAY);
+    }
+}
+
+static void APP_TestRun(APP_BENCH_TEST test)
+{
+    APP_BENCH_RESULT* result = &appData.result[test];
+    bool isChannel = ((test == APP_BENCH_TEST_CHANNEL_THROUGHPUT) || (test == APP_BENCH_TEST_CHANNEL_LATENCY));
+    bool isLatency = ((test == APP_BENCH_TEST_CHANNEL_LATENCY) || (test == APP_BENCH_TEST_QUEUE_LATENCY));
+    uint32_t count = (isLatency == true) ? APP_BENCH_LATENCY_MESSAGES : APP_BENCH_THROUGHPUT_MESSAGES;
+    uint32_t sequence;
+    uint32_t start;
+
+    (void)memset(result, 0, sizeof(APP_BENCH_RESULT));
+    result->latencyMinCycles = UINT32_MAX;
+
+    /* Let the consumer select the transport of the test */
+    appData.test = test;
+    (void)xTaskNotifyGive(xAPP1_Tasks);
+
+    start = DWT->CYCCNT;
+
+    for (sequence = 0U; sequence < count; sequence++)
+    {
+        if (isLatency == true)
+        {
+            /* Give the consumer the time to block again */
+            vTaskDelay(1U);
+        }
+
+        APP_MessageSend(isChannel, sequence);
+    }
+
+    /* Wait for the consumer to drain the messages of the test */
+    APP_MessageSend(isChannel, APP_BENCH_SEQUENCE_END);
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    result->elapsedCycles = DWT->CYCCNT - start;
+
+    if (isLatency == false)
+    {
+        result->messagesPerSecond = (uint32_t)(((uint64_t)count * configCPU_CLOCK_HZ) / result->elapsedCycles);
+    }
+
+    if (result->latencyCount != 0U)
+    {
+        result->latencyMinNs = APP_CyclesToNs(result->latencyMinCycles);
+        result->latencyAvgNs = APP_CyclesToNs((uint32_t)(result->latencySumCycles / result->latencyCount));
+        result->latencyMaxNs = APP_CyclesToNs(result->latencyMaxCycles);
+    }
+}
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Initialization and State Machine Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP_Initialize ( void )
+
+  Remarks:
+    See prototype in app.h.
+ */
+
+void APP_Initialize ( void )
+{
+    /* Place the App state machine in its initial state. */
+    appData.state = APP_STATE_INIT;
+
+    appData.test = APP_BENCH_TEST_CHANNEL_THROUGHPUT;
+
+    appData.round = 0U;
+
+    xAPP_Tasks = NULL;
+}
+
+
+/******************************************************************************
+  Function:
+    void APP_Tasks ( void )
+
+  Remarks:
+    See prototype in app.h.
+ */
+
+void APP_Tasks ( void )
+{
+    /* Check the application's current state. */
+    switch ( appData.state )
+    {
+        /* Application's initial state. */
+        case APP_STATE_INIT:
+        {
+            APP_CycleCounterEnable();
+
+            appData.queue = xQueueCreate(APP_BENCH_BUFFER_COUNT, sizeof(APP_BENCH_MESSAGE));
+
+            if ((appData.queue != NULL) &&
+                (OSAL_CHANNEL_Create(&appData.channel, appChannelPool, APP_BENCH_MESSAGE_SIZE,
+                    APP_BENCH_BUFFER_COUNT, appChannelMessages, appChannelFree) == OSAL_RESULT_SUCCESS))
+            {
+                appData.test = APP_BENCH_TEST_CHANNEL_THROUGHPUT;
+                appData.state = APP_STATE_TEST_RUN;
+            }
+            else
+            {
+                /* Nothing to benchmark, park the task */
+                vTaskSuspend(NULL);
+            }
+            break;
+        }
+
+        case APP_STATE_TEST_RUN:
+        {
+            APP_TestRun(appData.test);
+
+            if (appData.test == APP_BENCH_TEST_QUEUE_LATENCY)
+            {
+                appData.state = APP_STATE_ROUND_DONE;
+            }
+            else
+            {
+                appData.test = (APP_BENCH_TEST)((uint32_t)appData.test + 1U);
+            }
+            break;
+        }
+
+        case APP_STATE_ROUND_DONE:
+        {
+            appData.round++;
+
+            LED_TOGGLE();
+
+            vTaskDelay(APP_TASK_DELAY_MS);
+
+            appData.test = APP_BENCH_TEST_CHANNEL_THROUGHPUT;
+            appData.state = APP_STATE_TEST_RUN;
+            break;
+        }
+
+        /* The default state should never be executed. */
+        default:
+        {
+            /* TODO: Handle error in application's state machine. */
+            break;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ End of File
+ */
@@ -0,0 +1,333 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app.h
+
+  Summary:
+    This header file provides prototypes and definitions for the application.
+
+  Description:
+    This header file provides function prototypes and data type definitions for
+    the application.  Some of these are required by the system (such as the
+    "APP_Initialize" and "APP_Tasks" prototypes) and some of them are only used
+    internally by the application (such as the "APP_STATES" definition).  Both
+    are defined here for convenience.
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef _APP_H
+#define _APP_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "configuration.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "osal/osal.h"
+#include "osal/osal_channel.h"
+
+/* Delay between two benchmark rounds. i.e. 1000ms value is converted to ticks
+ * using the portTICK_RATE_MS constant.
+ */
+#define  APP_TASK_DELAY_MS         ( 1000 / portTICK_PERIOD_MS )
+
+/* Size of a benchmark message, number of buffers of the channel pool and
+ * number of entries of the queue. */
+#define APP_BENCH_MESSAGE_SIZE              (256U)
+#define APP_BENCH_BUFFER_COUNT              (8U)
+
+/* Number of messages sent by each throughput test and each latency test */
+#define APP_BENCH_THROUGHPUT_MESSAGES       (20000U)
+#define APP_BENCH_LATENCY_MESSAGES          (500U)
+
+/* Sequence number of the message that ends a test on the queue. On the
+ * channel a test ends with a message of zero length. */
+#define APP_BENCH_SEQUENCE_END              (0xFFFFFFFFU)
+
+#define APP_BENCH_CYCLES_PER_US             (configCPU_CLOCK_HZ / 1000000UL)
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Application States
+
+  Summary:
+    Application states enumeration
+
+  Description:
+    This enumeration defines the valid application states.  These states
+    determine the behavior of the application at various times.
+*/
+
+typedef enum
+{
+    /* Application's state machine's initial state. */
+    APP_STATE_INIT = 0,
+
+    /* Run one test, the test is selected by appData.test */
+    APP_STATE_TEST_RUN,
+
+    /* All the tests are done, wait and start the next round */
+    APP_STATE_ROUND_DONE,
+
+} APP_STATES;
+
+// *****************************************************************************
+/* Benchmark Tests
+
+  Summary:
+    Tests run in each round, in this order.
+
+  Description:
+    The throughput tests send messages back to back. The latency tests let
+    the consumer block before each message, so each message measures the time
+    from the producer handing it over to the consumer running with it.
+*/
+
+typedef enum
+{
+    APP_BENCH_TEST_CHANNEL_THROUGHPUT = 0,
+
+    APP_BENCH_TEST_QUEUE_THROUGHPUT,
+
+    APP_BENCH_TEST_CHANNEL_LATENCY,
+
+    APP_BENCH_TEST_QUEUE_LATENCY,
+
+    APP_BENCH_TEST_MAX
+
+} APP_BENCH_TEST;
+
+// *****************************************************************************
+/* Benchmark Message
+
+  Summary:
+    Layout of the payload exchanged by the producer and the consumer.
+*/
+
+typedef struct
+{
+    uint32_t sequence;
+
+    /* DWT cycle counter when the producer handed the message over */
+    uint32_t timestamp;
+
+    uint8_t  data[APP_BENCH_MESSAGE_SIZE - (2U * sizeof(uint32_t))];
+
+} APP_BENCH_MESSAGE;
+
+// *****************************************************************************
+/* Benchmark Result
+
+  Summary:
+    Result of one test of the last round.
+
+  Remarks:
+    The latency is measured by the consumer, the rest by the producer.
+*/
+
+typedef struct
+{
+    uint32_t messagesPerSecond;
+
+    uint32_t elapsedCycles;
+
+    uint32_t latencyCount;
+
+    uint32_t latencyMinCycles;
+
+    uint32_t latencyMaxCycles;
+
+    uint64_t latencySumCycles;
+
+    uint32_t latencyMinNs;
+
+    uint32_t latencyAvgNs;
+
+    uint32_t latencyMaxNs;
+
+} APP_BENCH_RESULT;
+
+
+// *****************************************************************************
+/* Application Data
+
+  Summary:
+    Holds application data
+
+  Description:
+    This structure holds the application's data.
+
+  Remarks:
+    Application strings and buffers are be defined outside this structure.
+ */
+
+typedef struct
+{
+    /* The application's current state */
+    APP_STATES state;
+
+    /* Test in progress */
+    APP_BENCH_TEST test;
+
+    /* Number of completed rounds */
+    uint32_t round;
+
+    /* Results of the last round, indexed by APP_BENCH_TEST */
+    APP_BENCH_RESULT result[APP_BENCH_TEST_MAX];
+
+    /* Zero-copy channel from APP_Tasks to APP1_Tasks */
+    OSAL_CHANNEL channel;
+
+    /* Queue from APP_Tasks to APP1_Tasks, copies each message in and out */
+    QueueHandle_t queue;
+} APP_DATA;
+
+extern APP_DATA appData;
+
+/* Handle for the APP_Tasks. */
+extern TaskHandle_t xAPP_Tasks;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Callback Routines
+// *****************************************************************************
+// *****************************************************************************
+/* These routines are called by drivers when certain events occur.
+*/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Initialization and State Machine Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP_Initialize ( void )
+
+  Summary:
+     MPLAB Harmony application initialization routine.
+
+  Description:
+    This function initializes the Harmony application.  It places the
+    application in its initial state and prepares it to run so that its
+    APP_Tasks function can be called.
+
+  Precondition:
+    All other system initialization routines should be called before calling
+    this routine (in "SYS_Initialize").
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    APP_Initialize();
+    </code>
+
+  Remarks:
+    This routine must be called from the SYS_Initialize function.
+*/
+
+void APP_Initialize ( void );
+
+
+/*******************************************************************************
+  Function:
+    void APP_Tasks ( void )
+
+  Summary:
+    MPLAB Harmony Demo application tasks function
+
+  Description:
+    This routine is the Harmony Demo application's tasks function.  It
+    defines the application's state machine and core logic.
+
+  Precondition:
+    The system and application initialization ("SYS_Initialize") should be
+    called before calling this.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    APP_Tasks();
+    </code>
+
+  Remarks:
+    This routine must be called from SYS_Tasks() routine.
+ */
+
+void APP_Tasks( void );
+
+
+
+#endif /* _APP_H */
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+/*******************************************************************************
+ End of File
+ */
+
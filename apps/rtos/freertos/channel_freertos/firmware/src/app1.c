@@ -0,0 +1,261 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app1.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MPLAB Harmony application.  It
+    implements the logic of the application's state machine and it may call
+    API routines of other MPLAB Harmony modules in the system, such as drivers,
+    system services, and middleware.  However, it does not call any of the
+    system interfaces (such as the "Initialize" and "Tasks" functions) of any of
+    the modules in the system or make any assumptions about when those functions
+    are called.  That is the responsibility of the configuration-specific system
+    files.
+ *******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "app.h"
+#include "app1.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Application Data
+
+  Summary:
+    Holds application data
+
+  Description:
+    This structure holds the application's data.
+
+  Remarks:
+    This structure should be initialized by the APP1_Initialize function.
+
+    Application strings and buffers are be defined outside this structure.
+*/
+
+APP1_DATA app1Data;
+
+/* Message xQueueReceive() copies out of the queue */
+static APP_BENCH_MESSAGE app1QueueMessage;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Callback Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* TODO:  Add any necessary callback functions.
+*/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+
+/* Takes the next message in place for the channel, or copied out of the
+ * queue. Returns false at the end of the test. */
+static bool APP1_MessageReceive(APP_BENCH_MESSAGE** message)
+{
+    void* buffer;
+    size_t length;
+    bool isMessage;
+
+    if (app1Data.isChannel == true)
+    {
+        (void)OSAL_CHANNEL_Receive(&appData.channel, &buffer, &length, OSAL_WAIT_FOREVER);
+
+        *message = (APP_BENCH_MESSAGE*)buffer;
+        isMessage = (length != 0U);
+    }
+    else
+    {
+        (void)xQueueReceive(appData.queue, &app1QueueMessage, portMAX_DELAY);
+
+        *message = &app1QueueMessage;
+        isMessage = (app1QueueMessage.sequence != APP_BENCH_SEQUENCE_END);
+    }
+
+    return isMessage;
+}
+
+static void APP1_LatencyAdd(uint32_t cycles)
+{
+    APP_BENCH_RESULT* result = &appData.result[appData.test];
+
+    if (cycles < result->latencyMinCycles)
+    {
+        result->latencyMinCycles = cycles;
+    }
+
+    if (cycles > result->latencyMaxCycles)
+    {
+        result->latencyMaxCycles = cycles;
+    }
+
+    result->latencySumCycles += cycles;
+    result->latencyCount++;
+}
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Initialization and State Machine Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP1_Initialize ( void )
+
+  Remarks:
+    See prototype in app1.h.
+ */
+
+void APP1_Initialize ( void )
+{
+    /* Place the App1 state machine in its initial state. */
+    app1Data.state = APP1_STATE_INIT;
+
+    
+    xAPP1_Tasks = NULL;
+
+    /* TODO: Initialize your application's state machine and other
+     * parameters.
+     */
+}
+
+
+/******************************************************************************
+  Function:
+    void APP1_Tasks ( void )
+
+  Remarks:
+    See prototype in app1.h.
+ */
+
+void APP1_Tasks ( void )
+{
+    APP_BENCH_MESSAGE* message;
+    bool isMessage;
+    uint32_t now;
+
+    /* Check the application's current state. */
+    switch ( app1Data.state )
+    {
+        /* Application's initial state. */
+        case APP1_STATE_INIT:
+        {
+            app1Data.state = APP1_STATE_TEST_WAIT;
+            break;
+        }
+
+        case APP1_STATE_TEST_WAIT:
+        {
+            /* Block to wait for APP_Tasks() to start a test. */
+            (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+            app1Data.isChannel = ((appData.test == APP_BENCH_TEST_CHANNEL_THROUGHPUT) ||
+                                  (appData.test == APP_BENCH_TEST_CHANNEL_LATENCY));
+            app1Data.isLatency = ((appData.test == APP_BENCH_TEST_CHANNEL_LATENCY) ||
+                                  (appData.test == APP_BENCH_TEST_QUEUE_LATENCY));
+            app1Data.sequence = 0U;
+
+            app1Data.state = APP1_STATE_TEST_RECEIVE;
+            break;
+        }
+
+        case APP1_STATE_TEST_RECEIVE:
+        {
+            isMessage = APP1_MessageReceive(&message);
+
+            if (isMessage == true)
+            {
+                now = DWT->CYCCNT;
+
+                if (app1Data.isLatency == true)
+                {
+                    APP1_LatencyAdd(now - message->timestamp);
+                }
+
+                if (message->sequence != app1Data.sequence)
+                {
+                    app1Data.sequenceErrors++;
+                }
+
+                app1Data.sequence = message->sequence + 1U;
+            }
+
+            if (app1Data.isChannel == true)
+            {
+                /* The payload was used in place, hand the buffer back. */
+                (void)OSAL_CHANNEL_BufferRelease(&appData.channel, message);
+            }
+
+            if (isMessage == false)
+            {
+                /* Tell APP_Tasks() the test is over. */
+                (void)xTaskNotifyGive( xAPP_Tasks );
+
+                app1Data.state = APP1_STATE_TEST_WAIT;
+            }
+            break;
+        }
+
+        /* The default state should never be executed. */
+        default:
+        {
+            /* TODO: Handle error in application's state machine. */
+            break;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ End of File
+ */
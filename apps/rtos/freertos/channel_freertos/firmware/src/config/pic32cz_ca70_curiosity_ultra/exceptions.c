@@ -0,0 +1,129 @@
+/*******************************************************************************
+  System Exceptions File
+
+  File Name:
+    exceptions.c
+
+  Summary:
+    This file contains a function which overrides the default _weak_ exception
+    handlers provided by the interrupt.c file.
+
+  Description:
+    This file redefines the default _weak_  exception handler with a more debug
+    friendly one. If an unexpected exception occurs the code will stop in a
+    while(1) loop.
+ *******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+    #include "configuration.h"
+#include "interrupts.h"
+#include "definitions.h"
+
+ 
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Exception Handling Routine
+// *****************************************************************************
+// *****************************************************************************
+/* MISRAC 2012 deviation block start */
+/* MISRA C-2012 Rule 8.6 might be violated here if the users provide a strong
+   implementations to these weak handler functions. Deviation record ID -  H3_MISRAC_2012_R_8_6_DR_1
+*/
+
+
+/* Brief default interrupt handlers for core IRQs.*/
+void __attribute__((noreturn, weak)) NonMaskableInt_Handler(void)
+{
+#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+    __builtin_software_breakpoint();
+#endif
+    while (true)
+    {
+    }
+}
+ 
+void __attribute__((noreturn, weak)) HardFault_Handler(void)
+{
+#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+   __builtin_software_breakpoint();
+#endif
+   while (true)
+   {
+   }
+}
+
+void __attribute__((noreturn, weak)) DebugMonitor_Handler(void)
+{
+#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+   __builtin_software_breakpoint();
+#endif
+   while (true)
+   {
+   }
+}
+
+void __attribute__((noreturn, weak)) MemoryManagement_Handler(void)
+{
+#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+   __builtin_software_breakpoint();
+#endif
+   while (true)
+   {
+   }
+}
+
+void __attribute__((noreturn, weak)) BusFault_Handler(void)
+{
+#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+   __builtin_software_breakpoint();
+#endif
+   while (true)
+   {
+   }
+}
+
+void __attribute__((noreturn, weak)) UsageFault_Handler(void)
+{
+#if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+   __builtin_software_breakpoint();
+#endif
+   while (true)
+   {
+   }
+}
+ 
+/* MISRAC 2012 deviation block end for rule 8.6 */
+
+/*******************************************************************************
+ End of File
+ */
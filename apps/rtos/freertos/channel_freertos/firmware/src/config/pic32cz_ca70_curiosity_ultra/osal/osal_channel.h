@@ -0,0 +1,340 @@
+/*******************************************************************************
+  Operating System Abstraction Layer Zero-Copy Channel
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    osal_channel.h
+
+  Summary:
+    OSAL single producer, single consumer zero-copy channel interface file
+
+  Description:
+    A channel hands buffers of a fixed pool from one producer to one consumer
+    by pointer and length. The payload is never copied: the producer takes a
+    free buffer from the pool, fills it and sends it, the consumer receives
+    it, uses it in place and releases it back to the pool.
+
+    Messages and free buffers travel through two lock-free rings, each one
+    written by one side only. The blocked side is woken with a task
+    notification on index OSAL_CHANNEL_NOTIFY_INDEX, only when the ring it
+    waits on goes from empty to not empty.
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef OSAL_CHANNEL_H
+#define OSAL_CHANNEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "osal/osal.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+/* Task notification index used to wake the producer and the consumer. The
+ * application must not use this index on the tasks attached to a channel. */
+#ifndef OSAL_CHANNEL_NOTIFY_INDEX
+#define OSAL_CHANNEL_NOTIFY_INDEX       ((UBaseType_t)configTASK_NOTIFICATION_ARRAY_ENTRIES - 1U)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* OSAL Channel Message
+
+  Summary:
+    One message in flight: a pool buffer and the number of valid bytes in it.
+*/
+
+typedef struct
+{
+    void*                   buffer;
+
+    size_t                  length;
+
+} OSAL_CHANNEL_MESSAGE;
+
+// *****************************************************************************
+/* OSAL Channel
+
+  Summary:
+    Holds the state of a channel.
+
+  Remarks:
+    The members are private to osal_channel_freertos.c. The head and tail
+    indexes run freely and are masked with (bufferCount - 1U) on access.
+*/
+
+typedef struct
+{
+    /* Buffer pool, bufferCount buffers of bufferSize bytes */
+    uint8_t*                pool;
+
+    size_t                  bufferSize;
+
+    uint32_t                bufferCount;
+
+    /* Producer to consumer ring of messages */
+    OSAL_CHANNEL_MESSAGE*   messageRing;
+
+    /* Consumer to producer ring of free buffer indexes */
+    uint32_t*               freeRing;
+
+    /* Written by the producer only */
+    volatile uint32_t       messageHead;
+
+    volatile uint32_t       freeTail;
+
+    /* Written by the consumer only */
+    volatile uint32_t       messageTail;
+
+    volatile uint32_t       freeHead;
+
+    /* Tasks that wait on the channel, NULL until they first block on it */
+    TaskHandle_t volatile   producer;
+
+    TaskHandle_t volatile   consumer;
+
+} OSAL_CHANNEL;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    OSAL_RESULT OSAL_CHANNEL_Create(OSAL_CHANNEL* channel, void* pool,
+        size_t bufferSize, uint32_t bufferCount,
+        OSAL_CHANNEL_MESSAGE* messageRing, uint32_t* freeRing)
+
+  Summary:
+    Creates a channel on caller provided storage.
+
+  Description:
+    Initializes the channel with all the pool buffers free and no message in
+    flight.
+
+  Precondition:
+    None.
+
+  Parameters:
+    channel     - Channel to initialize
+    pool        - Storage of bufferCount * bufferSize bytes
+    bufferSize  - Size of one buffer. Keep it a multiple of the alignment the
+                  payload needs.
+    bufferCount - Number of buffers, a power of two
+    messageRing - Storage of bufferCount messages
+    freeRing    - Storage of bufferCount buffer indexes
+
+  Returns:
+    OSAL_RESULT_SUCCESS - Channel created
+    OSAL_RESULT_FAIL    - Invalid parameter
+
+  Example:
+    <code>
+    static uint8_t pool[8U * 256U] __ALIGNED(4);
+    static OSAL_CHANNEL_MESSAGE messageRing[8U];
+    static uint32_t freeRing[8U];
+    static OSAL_CHANNEL channel;
+
+    OSAL_CHANNEL_Create(&channel, pool, 256U, 8U, messageRing, freeRing);
+    </code>
+
+  Remarks:
+    A channel has exactly one producer and one consumer, each of them a task
+    or an interrupt. Calls from the same side must not run concurrently.
+*/
+
+OSAL_RESULT OSAL_CHANNEL_Create(OSAL_CHANNEL* channel, void* pool, size_t bufferSize,
+    uint32_t bufferCount, OSAL_CHANNEL_MESSAGE* messageRing, uint32_t* freeRing);
+
+// *****************************************************************************
+/* Function:
+    void* OSAL_CHANNEL_BufferGet(OSAL_CHANNEL* channel, OSAL_TICK_TYPE waitMS)
+
+  Summary:
+    Takes a free buffer of the pool, on the producer side.
+
+  Description:
+    Returns a free buffer, blocking up to waitMS while all the buffers are in
+    flight or held by the consumer. The producer owns the buffer until it
+    sends it.
+
+  Parameters:
+    channel     - Channel
+    waitMS      - Time to wait in milliseconds, OSAL_NO_WAIT or
+                  OSAL_WAIT_FOREVER
+
+  Returns:
+    Pointer to a buffer of bufferSize bytes, NULL on timeout.
+*/
+
+void* OSAL_CHANNEL_BufferGet(OSAL_CHANNEL* channel, OSAL_TICK_TYPE waitMS);
+
+// *****************************************************************************
+/* Function:
+    void* OSAL_CHANNEL_BufferGetISR(OSAL_CHANNEL* channel)
+
+  Summary:
+    Takes a free buffer of the pool from an interrupt, without waiting.
+
+  Returns:
+    Pointer to a buffer of bufferSize bytes, NULL when no buffer is free.
+*/
+
+void* OSAL_CHANNEL_BufferGetISR(OSAL_CHANNEL* channel);
+
+// *****************************************************************************
+/* Function:
+    OSAL_RESULT OSAL_CHANNEL_Send(OSAL_CHANNEL* channel, void* buffer,
+        size_t length)
+
+  Summary:
+    Hands a buffer over to the consumer.
+
+  Description:
+    Queues the buffer and the number of valid bytes in it, and wakes the
+    consumer if it may be waiting. The producer must not touch the buffer
+    afterwards.
+
+  Parameters:
+    channel     - Channel
+    buffer      - Buffer returned by OSAL_CHANNEL_BufferGet
+    length      - Number of valid bytes, up to bufferSize
+
+  Returns:
+    OSAL_RESULT_SUCCESS - Message sent
+    OSAL_RESULT_FAIL    - buffer is not a buffer of the pool, or length is
+                          larger than the buffer size
+*/
+
+OSAL_RESULT OSAL_CHANNEL_Send(OSAL_CHANNEL* channel, void* buffer, size_t length);
+
+// *****************************************************************************
+/* Function:
+    OSAL_RESULT OSAL_CHANNEL_SendISR(OSAL_CHANNEL* channel, void* buffer,
+        size_t length)
+
+  Summary:
+    Hands a buffer over to the consumer from an interrupt.
+
+  Remarks:
+    Same as OSAL_CHANNEL_Send. Requests a context switch on exit of the
+    interrupt when the consumer was woken and has a higher priority than the
+    interrupted task.
+*/
+
+OSAL_RESULT OSAL_CHANNEL_SendISR(OSAL_CHANNEL* channel, void* buffer, size_t length);
+
+// *****************************************************************************
+/* Function:
+    OSAL_RESULT OSAL_CHANNEL_Receive(OSAL_CHANNEL* channel, void** buffer,
+        size_t* length, OSAL_TICK_TYPE waitMS)
+
+  Summary:
+    Takes the oldest message, on the consumer side.
+
+  Description:
+    Returns the oldest buffer sent and its length, blocking up to waitMS
+    while no message is in flight. The consumer owns the buffer until it
+    releases it.
+
+  Parameters:
+    channel     - Channel
+    buffer      - Returns the buffer
+    length      - Returns the number of valid bytes in the buffer
+    waitMS      - Time to wait in milliseconds, OSAL_NO_WAIT or
+                  OSAL_WAIT_FOREVER
+
+  Returns:
+    OSAL_RESULT_SUCCESS - Message received
+    OSAL_RESULT_FAIL    - Timeout
+*/
+
+OSAL_RESULT OSAL_CHANNEL_Receive(OSAL_CHANNEL* channel, void** buffer, size_t* length,
+    OSAL_TICK_TYPE waitMS);
+
+// *****************************************************************************
+/* Function:
+    OSAL_RESULT OSAL_CHANNEL_BufferRelease(OSAL_CHANNEL* channel,
+        void* buffer)
+
+  Summary:
+    Returns a received buffer to the pool, on the consumer side.
+
+  Description:
+    Wakes the producer if it may be waiting for a free buffer.
+
+  Returns:
+    OSAL_RESULT_SUCCESS - Buffer released
+    OSAL_RESULT_FAIL    - buffer is not a buffer of the pool
+*/
+
+OSAL_RESULT OSAL_CHANNEL_BufferRelease(OSAL_CHANNEL* channel, void* buffer);
+
+// *****************************************************************************
+/* Function:
+    OSAL_RESULT OSAL_CHANNEL_BufferReleaseISR(OSAL_CHANNEL* channel,
+        void* buffer)
+
+  Summary:
+    Returns a received buffer to the pool from an interrupt.
+
+  Remarks:
+    Same as OSAL_CHANNEL_BufferRelease, for a consumer that completes the
+    processing of a buffer in an interrupt, for example at the end of a DMA
+    transfer.
+*/
+
+OSAL_RESULT OSAL_CHANNEL_BufferReleaseISR(OSAL_CHANNEL* channel, void* buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OSAL_CHANNEL_H
@@ -0,0 +1,367 @@
+/*******************************************************************************
+  Operating System Abstraction Layer Zero-Copy Channel for FreeRTOS
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    osal_channel_freertos.c
+
+  Summary:
+    OSAL single producer, single consumer zero-copy channel for FreeRTOS
+
+  Description:
+    Implements osal_channel.h with two lock-free rings and FreeRTOS task
+    notifications.
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "FreeRTOS.h"
+#include "task.h"
+#include "configuration.h"
+#include "osal/osal_channel.h"
+
+#if (configTASK_NOTIFICATION_ARRAY_ENTRIES < 2)
+#error "OSAL_CHANNEL needs configTASK_NOTIFICATION_ARRAY_ENTRIES of 2 or more"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Each ring is written by one side and read by the other. A side stores its
+ * index and then loads the index of the other side to decide whether to wake
+ * it. The barrier between the store and the load guarantees that either the
+ * waker sees the ring was empty, or the waiter sees the new entry before it
+ * blocks, so no wake-up is lost while most sends skip the notification. */
+
+static TickType_t lOSAL_CHANNEL_TicksGet(OSAL_TICK_TYPE waitMS)
+{
+    TickType_t ticks;
+
+    if (waitMS == OSAL_WAIT_FOREVER)
+    {
+        ticks = portMAX_DELAY;
+    }
+    else
+    {
+        ticks = ((TickType_t)waitMS / portTICK_PERIOD_MS);
+    }
+
+    return ticks;
+}
+
+static bool lOSAL_CHANNEL_IndexGet(const OSAL_CHANNEL* channel, const void* buffer, uint32_t* index)
+{
+    uintptr_t offset;
+    bool isValid = false;
+
+    if ((uintptr_t)buffer >= (uintptr_t)channel->pool)
+    {
+        offset = (uintptr_t)buffer - (uintptr_t)channel->pool;
+
+        if (((offset % channel->bufferSize) == 0U) && ((offset / channel->bufferSize) < channel->bufferCount))
+        {
+            *index = (uint32_t)(offset / channel->bufferSize);
+            isValid = true;
+        }
+    }
+
+    return isValid;
+}
+
+/* Producer side. Returns the buffer at the tail of the free ring, or NULL. */
+static void* lOSAL_CHANNEL_FreePop(OSAL_CHANNEL* channel)
+{
+    uint32_t tail = channel->freeTail;
+    void* buffer = NULL;
+
+    if (channel->freeHead != tail)
+    {
+        __DMB();
+
+        buffer = &channel->pool[channel->freeRing[tail & (channel->bufferCount - 1U)] * channel->bufferSize];
+
+        __DMB();
+
+        channel->freeTail = tail + 1U;
+    }
+
+    return buffer;
+}
+
+/* Producer side. Returns true when the consumer may be waiting for it. */
+static bool lOSAL_CHANNEL_MessagePush(OSAL_CHANNEL* channel, void* buffer, size_t length)
+{
+    uint32_t head = channel->messageHead;
+    OSAL_CHANNEL_MESSAGE* message = &channel->messageRing[head & (channel->bufferCount - 1U)];
+
+    message->buffer = buffer;
+    message->length = length;
+
+    __DMB();
+
+    channel->messageHead = head + 1U;
+
+    __DMB();
+
+    return ((channel->messageTail == head) && (channel->consumer != NULL));
+}
+
+/* Consumer side. Returns false when the message ring is empty. */
+static bool lOSAL_CHANNEL_MessagePop(OSAL_CHANNEL* channel, void** buffer, size_t* length)
+{
+    uint32_t tail = channel->messageTail;
+    const OSAL_CHANNEL_MESSAGE* message;
+    bool isPopped = false;
+
+    if (channel->messageHead != tail)
+    {
+        __DMB();
+
+        message = &channel->messageRing[tail & (channel->bufferCount - 1U)];
+        *buffer = message->buffer;
+        *length = message->length;
+
+        __DMB();
+
+        channel->messageTail = tail + 1U;
+
+        isPopped = true;
+    }
+
+    return isPopped;
+}
+
+/* Consumer side. Returns true when the producer may be waiting for it. */
+static bool lOSAL_CHANNEL_FreePush(OSAL_CHANNEL* channel, uint32_t index)
+{
+    uint32_t head = channel->freeHead;
+
+    channel->freeRing[head & (channel->bufferCount - 1U)] = index;
+
+    __DMB();
+
+    channel->freeHead = head + 1U;
+
+    __DMB();
+
+    return ((channel->freeTail == head) && (channel->producer != NULL));
+}
+
+/* Blocks the calling task until it is notified or the timeout expires.
+ * Returns false once the timeout has expired. */
+static bool lOSAL_CHANNEL_Wait(TimeOut_t* timeOut, TickType_t* ticksToWait)
+{
+    bool isWaiting = false;
+
+    if ((*ticksToWait != 0U) && (xTaskCheckForTimeOut(timeOut, ticksToWait) == pdFALSE))
+    {
+        (void)ulTaskNotifyTakeIndexed(OSAL_CHANNEL_NOTIFY_INDEX, pdTRUE, *ticksToWait);
+
+        isWaiting = true;
+    }
+
+    return isWaiting;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+OSAL_RESULT OSAL_CHANNEL_Create(OSAL_CHANNEL* channel, void* pool, size_t bufferSize,
+    uint32_t bufferCount, OSAL_CHANNEL_MESSAGE* messageRing, uint32_t* freeRing)
+{
+    uint32_t index;
+
+    if ((channel == NULL) || (pool == NULL) || (messageRing == NULL) || (freeRing == NULL) ||
+        (bufferSize == 0U) || (bufferCount == 0U) || ((bufferCount & (bufferCount - 1U)) != 0U))
+    {
+        return OSAL_RESULT_FAIL;
+    }
+
+    channel->pool        = (uint8_t*)pool;
+    channel->bufferSize  = bufferSize;
+    channel->bufferCount = bufferCount;
+    channel->messageRing = messageRing;
+    channel->freeRing    = freeRing;
+
+    for (index = 0U; index < bufferCount; index++)
+    {
+        freeRing[index] = index;
+    }
+
+    channel->messageHead = 0U;
+    channel->messageTail = 0U;
+    channel->freeHead    = bufferCount;
+    channel->freeTail    = 0U;
+    channel->producer    = NULL;
+    channel->consumer    = NULL;
+
+    return OSAL_RESULT_SUCCESS;
+}
+
+void* OSAL_CHANNEL_BufferGet(OSAL_CHANNEL* channel, OSAL_TICK_TYPE waitMS)
+{
+    TickType_t ticksToWait = lOSAL_CHANNEL_TicksGet(waitMS);
+    TimeOut_t timeOut;
+    void* buffer;
+
+    buffer = lOSAL_CHANNEL_FreePop(channel);
+
+    if ((buffer == NULL) && (ticksToWait != 0U))
+    {
+        channel->producer = xTaskGetCurrentTaskHandle();
+
+        __DMB();
+
+        vTaskSetTimeOutState(&timeOut);
+
+        do
+        {
+            buffer = lOSAL_CHANNEL_FreePop(channel);
+
+        } while ((buffer == NULL) && (lOSAL_CHANNEL_Wait(&timeOut, &ticksToWait) == true));
+    }
+
+    return buffer;
+}
+
+void* OSAL_CHANNEL_BufferGetISR(OSAL_CHANNEL* channel)
+{
+    return lOSAL_CHANNEL_FreePop(channel);
+}
+
+OSAL_RESULT OSAL_CHANNEL_Send(OSAL_CHANNEL* channel, void* buffer, size_t length)
+{
+    uint32_t index;
+
+    if ((lOSAL_CHANNEL_IndexGet(channel, buffer, &index) == false) || (length > channel->bufferSize))
+    {
+        return OSAL_RESULT_FAIL;
+    }
+
+    if (lOSAL_CHANNEL_MessagePush(channel, buffer, length) == true)
+    {
+        (void)xTaskNotifyGiveIndexed(channel->consumer, OSAL_CHANNEL_NOTIFY_INDEX);
+    }
+
+    return OSAL_RESULT_SUCCESS;
+}
+
+OSAL_RESULT OSAL_CHANNEL_SendISR(OSAL_CHANNEL* channel, void* buffer, size_t length)
+{
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    uint32_t index;
+
+    if ((lOSAL_CHANNEL_IndexGet(channel, buffer, &index) == false) || (length > channel->bufferSize))
+    {
+        return OSAL_RESULT_FAIL;
+    }
+
+    if (lOSAL_CHANNEL_MessagePush(channel, buffer, length) == true)
+    {
+        vTaskNotifyGiveIndexedFromISR(channel->consumer, OSAL_CHANNEL_NOTIFY_INDEX, &higherPriorityTaskWoken);
+    }
+
+    portEND_SWITCHING_ISR(higherPriorityTaskWoken);
+
+    return OSAL_RESULT_SUCCESS;
+}
+
+OSAL_RESULT OSAL_CHANNEL_Receive(OSAL_CHANNEL* channel, void** buffer, size_t* length,
+    OSAL_TICK_TYPE waitMS)
+{
+    TickType_t ticksToWait = lOSAL_CHANNEL_TicksGet(waitMS);
+    TimeOut_t timeOut;
+    bool isReceived;
+
+    isReceived = lOSAL_CHANNEL_MessagePop(channel, buffer, length);
+
+    if ((isReceived == false) && (ticksToWait != 0U))
+    {
+        channel->consumer = xTaskGetCurrentTaskHandle();
+
+        __DMB();
+
+        vTaskSetTimeOutState(&timeOut);
+
+        do
+        {
+            isReceived = lOSAL_CHANNEL_MessagePop(channel, buffer, length);
+
+        } while ((isReceived == false) && (lOSAL_CHANNEL_Wait(&timeOut, &ticksToWait) == true));
+    }
+
+    return (isReceived == true) ? OSAL_RESULT_SUCCESS : OSAL_RESULT_FAIL;
+}
+
+OSAL_RESULT OSAL_CHANNEL_BufferRelease(OSAL_CHANNEL* channel, void* buffer)
+{
+    uint32_t index;
+
+    if (lOSAL_CHANNEL_IndexGet(channel, buffer, &index) == false)
+    {
+        return OSAL_RESULT_FAIL;
+    }
+
+    if (lOSAL_CHANNEL_FreePush(channel, index) == true)
+    {
+        (void)xTaskNotifyGiveIndexed(channel->producer, OSAL_CHANNEL_NOTIFY_INDEX);
+    }
+
+    return OSAL_RESULT_SUCCESS;
+}
+
+OSAL_RESULT OSAL_CHANNEL_BufferReleaseISR(OSAL_CHANNEL* channel, void* buffer)
+{
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    uint32_t index;
+
+    if (lOSAL_CHANNEL_IndexGet(channel, buffer, &index) == false)
+    {
+        return OSAL_RESULT_FAIL;
+    }
+
+    if (lOSAL_CHANNEL_FreePush(channel, index) == true)
+    {
+        vTaskNotifyGiveIndexedFromISR(channel->producer, OSAL_CHANNEL_NOTIFY_INDEX, &higherPriorityTaskWoken);
+    }
+
+    portEND_SWITCHING_ISR(higherPriorityTaskWoken);
+
+    return OSAL_RESULT_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/*
+ * Instance header file for PIC32CZ2051CA70144
+ *
+ * Copyright (c) 2025 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* file generated from device description file (ATDF) version 2025-04-15T17:35:01Z */
+#ifndef _PIC32CZCA70_I2SC0_INSTANCE_
+#define _PIC32CZCA70_I2SC0_INSTANCE_
+
+
+/* ========== Instance Parameter definitions for I2SC0 peripheral ========== */
+#define I2SC0_CLOCK_ID                           (69)       
+#define I2SC0_DMAC_ID_RX_LEFT                    (45)       
+#define I2SC0_DMAC_ID_RX_RIGHT                   (49)       
+#define I2SC0_DMAC_ID_TX_LEFT                    (44)       
+#define I2SC0_DMAC_ID_TX_RIGHT                   (48)       
+#define I2SC0_INSTANCE_ID                        (69)       
+
+#endif /* _PIC32CZCA70_I2SC0_INSTANCE_ */
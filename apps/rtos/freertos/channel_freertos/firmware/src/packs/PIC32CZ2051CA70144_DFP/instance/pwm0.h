@@ -0,0 +1,40 @@
+/*
+ * Instance header file for PIC32CZ2051CA70144
+ *
+ * Copyright (c) 2025 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* file generated from device description file (ATDF) version 2025-04-15T17:35:01Z */
+#ifndef _PIC32CZCA70_PWM0_INSTANCE_
+#define _PIC32CZCA70_PWM0_INSTANCE_
+
+
+/* ========== Instance Parameter definitions for PWM0 peripheral ========== */
+#define PWM0_CLOCK_ID                            (31)       
+#define PWM0_DMAC_ID_TX                          (13)       
+#define PWM0_FAULT_PWM_ID0                       (0x0)      /* Fault 0 - PWM0_PWMFI0 Input pin */
+#define PWM0_FAULT_PWM_ID1                       (0x1)      /* Fault 1 - PWM0_PWMFI1 Input pin */
+#define PWM0_FAULT_PWM_ID2                       (0x2)      /* Fault 2 - PWM0_PWMFI2 Input pin */
+#define PWM0_FAULT_PWM_ID3                       (0x3)      /* Fault 3 - MAIN_OSC_PMC */
+#define PWM0_FAULT_PWM_ID4                       (0x4)      /* Fault 4 - AFEC0 */
+#define PWM0_FAULT_PWM_ID5                       (0x5)      /* Fault 5 - AFEC1 */
+#define PWM0_FAULT_PWM_ID6                       (0x6)      /* Fault 6 - ACC */
+#define PWM0_FAULT_PWM_ID7                       (0x7)      /* Fault 7 - TC0 */
+#define PWM0_INSTANCE_ID                         (31)       
+
+#endif /* _PIC32CZCA70_PWM0_INSTANCE_ */
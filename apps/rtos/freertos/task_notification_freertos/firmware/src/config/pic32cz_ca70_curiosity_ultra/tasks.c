@@ -61,11 +61,21 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+uint32_t SYS_BootCycles;
+#endif
+
 /* Handle for the APP_Tasks. */
 TaskHandle_t xAPP_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP_Tasks task. */
+static StackType_t lAPP_TasksStack[1024];
+static StaticTask_t lAPP_TasksTCB;
+#endif
+
 static void lAPP_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -79,6 +89,12 @@ TaskHandle_t xAPP1_Tasks;
 
 
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and control block of the APP1_Tasks task. */
+static StackType_t lAPP1_TasksStack[1024];
+static StaticTask_t lAPP1_TasksTCB;
+#endif
+
 static void lAPP1_Tasks(  void *pvParameters  )
 {   
     while(true)
@@ -117,6 +133,16 @@ void SYS_Tasks ( void )
     /* Maintain the application's state machine. */
     
     /* Create OS Thread for APP_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP_Tasks,
+           "APP_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP_TasksStack,
+           &lAPP_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP_Tasks,
            "APP_Tasks",
@@ -124,8 +150,19 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP_Tasks);
+#endif
 
     /* Create OS Thread for APP1_Tasks. */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xAPP1_Tasks = xTaskCreateStatic(
+           (TaskFunction_t) lAPP1_Tasks,
+           "APP1_Tasks",
+           1024,
+           NULL,
+           1U ,
+           lAPP1_TasksStack,
+           &lAPP1_TasksTCB);
+#else
     (void) xTaskCreate(
            (TaskFunction_t) lAPP1_Tasks,
            "APP1_Tasks",
@@ -133,8 +170,13 @@ void SYS_Tasks ( void )
            NULL,
            1U ,
            &xAPP1_Tasks);
+#endif
+
 
 
+#if (SYS_BOOT_TIME_ENABLE == true)
+    SYS_BootCycles = DWT->CYCCNT;
+#endif
 
     /* Start RTOS Scheduler. */
     
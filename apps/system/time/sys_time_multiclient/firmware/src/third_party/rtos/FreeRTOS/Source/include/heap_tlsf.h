@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*
+ * Telemetry of the TLSF heap implemented by heap_tlsf.c, in addition to the
+ * standard vPortGetHeapStats() and xPortGetMinimumEverFreeHeapSize().
+ */
+
+#ifndef HEAP_TLSF_H
+#define HEAP_TLSF_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include heap_tlsf.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Blocks up to ( 1 << configTLSF_FL_INDEX_MAX ) - 1 bytes, headers included,
+ * can be handed out. configTOTAL_HEAP_SIZE must be below that limit. */
+#ifndef configTLSF_FL_INDEX_MAX
+    #define configTLSF_FL_INDEX_MAX    16
+#endif
+
+/* Blocks below ( 1 << heapTLSF_FL_INDEX_SHIFT ) bytes share the first size
+ * class. Every following class covers a power of two. */
+#define heapTLSF_FL_INDEX_SHIFT        7
+
+/* Number of first level size classes, and of entries returned by
+ * vPortGetHeapClassStats(). */
+#define heapTLSF_CLASS_COUNT           ( configTLSF_FL_INDEX_MAX - heapTLSF_FL_INDEX_SHIFT + 1 )
+
+/* Used to pass the counters of one size class out of vPortGetHeapClassStats().
+ * Block sizes include the block header. */
+typedef struct xHeapClassStats
+{
+    size_t xMaximumBlockSizeInBytes;       /* The largest block size that falls into this class. */
+    size_t xNumberOfSuccessfulAllocations; /* The number of calls to pvPortMalloc() that returned a block of this class. */
+    size_t xNumberOfSuccessfulFrees;       /* The number of calls to vPortFree() that released a block of this class. */
+    size_t xNumberOfFailedAllocations;     /* The number of calls to pvPortMalloc() for a block of this class that returned NULL. */
+} HeapClassStats_t;
+
+/*
+ * Returns the largest number of bytes that have been allocated at the same
+ * time since the heap was initialised, block headers included.
+ */
+size_t xPortGetHeapHighWaterMark( void );
+
+/*
+ * Returns the external fragmentation of the free space in percent: 0 when all
+ * the free space is one block, close to 100 when it is scattered over many
+ * small blocks.
+ */
+UBaseType_t uxPortGetHeapFragmentation( void );
+
+/*
+ * Fills pxClassStats[ 0 .. heapTLSF_CLASS_COUNT - 1 ] with the counters of
+ * each size class, smallest class first.
+ */
+void vPortGetHeapClassStats( HeapClassStats_t * pxClassStats );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* HEAP_TLSF_H */